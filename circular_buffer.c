@@ -49,6 +49,33 @@
  * 4. Atomic operations for thread-safety
  *    원자적 연산을 통한 Thread-safety 보장
  * 
+ * Lock-free SPSC Mode / 락-프리 SPSC 모드 (-DCB_LOCKFREE_SPSC):
+ * - writeIndex/readIndex become C11 atomics with acquire/release ordering
+ *   writeIndex/readIndex를 C11 atomic(acquire/release)으로 변경
+ * - Shared count is removed; count is derived from the two indices
+ *   공유 count 제거, 두 인덱스의 차이로 개수 계산
+ * - One producer (ISR/thread) + one consumer need no critical section
+ *   생산자 1 + 소비자 1 구성에서 인터럽트 비활성화 불필요
+ * - Build / 빌드: gcc -std=c11 -DCB_LOCKFREE_SPSC -pthread circular_buffer.c -lm
+ * 
+ * Windowed Statistics / 윈도우 통계:
+ * - cb_windowStats(): min/max/mean/RMS over the most recent N samples (no pop)
+ *   cb_windowStats(): 최근 N개 샘플의 min/max/mean/RMS (데이터 소비 없음)
+ * - SIMD kernels selected at compile time (AVX2 / SSE4.1 / NEON / scalar)
+ *   컴파일 타임에 SIMD 커널 선택 (AVX2 / SSE4.1 / NEON / 스칼라)
+ * - -DCB_RUNNING_STATS: running sums updated on push/pop → O(1) cb_runningMean()
+ *   -DCB_RUNNING_STATS: push/pop 시 누적 합 갱신 → O(1) cb_runningMean()
+ * 
+ * Compressed Ring Mode / 압축 링 모드 (cbz_*):
+ * - Samples are stored as blocks of CB_BLOCK_SAMPLES: raw base + bit-packed zigzag deltas
+ *   CB_BLOCK_SAMPLES개 단위 블록으로 저장: 원본 base + 비트 패킹된 zigzag 델타
+ * - Slowly changing sensor data needs only a few bits per sample → several times more history
+ *   천천히 변하는 센서 데이터는 샘플당 몇 비트면 충분 → 같은 메모리에 몇 배의 이력
+ * - Push appends to the open (raw) block; pop and window queries decode whole blocks
+ *   push는 열린(원본) 블록에 추가, pop과 윈도우 통계는 블록 단위로 디코딩
+ * - Full: oldest whole blocks are evicted (CBZ_FULL_POLICY, default OVERWRITE_OLDEST)
+ *   가득 차면 가장 오래된 블록을 통째로 버림 (CBZ_FULL_POLICY, 기본값 OVERWRITE_OLDEST)
+ * 
  * Buffer Full Policy / 버퍼 가득 참 정책:
  * - OVERWRITE_OLDEST: Overwrites oldest data (default, prioritizes latest sensor data)
  *   가장 오래된 데이터를 덮어씀 (기본값, 센서 데이터 특성상 최신 데이터 우선)
@@ -65,6 +92,21 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <math.h>       /* sqrt() for RMS / RMS 계산용 */
+#include <time.h>       /* clock() for decode benchmark / 디코딩 벤치마크용 */
+
+/* SIMD intrinsics for windowed statistics / 윈도우 통계용 SIMD 인트린식 */
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    #include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+
+#ifdef CB_LOCKFREE_SPSC
+    #include <stdatomic.h>
+    #include <pthread.h>    /* Stress test threads / 스트레스 테스트용 스레드 */
+    #include <sched.h>      /* sched_yield() */
+#endif
 
 /* ============================================================================
  * Windows UTF-8 Console Output Support / 윈도우 UTF-8 콘솔 출력 지원
@@ -97,7 +139,27 @@
 #define POLICY_REJECT_NEW           1       /* Reject new data / 새 데이터 거부 */
 
 /* Currently applied policy / 현재 적용할 정책 선택 */
+/* Lock-free mode: the producer must never move readIndex, so only REJECT_NEW is safe */
+/* 락-프리 모드: 생산자가 readIndex를 건드리면 안 되므로 REJECT_NEW만 안전함 */
+#ifdef CB_LOCKFREE_SPSC
+#define BUFFER_FULL_POLICY          POLICY_REJECT_NEW
+#else
 #define BUFFER_FULL_POLICY          POLICY_OVERWRITE_OLDEST
+#endif
+
+/* Cache line size for index separation / 인덱스 분리용 캐시 라인 크기 */
+#define CB_CACHE_LINE_SIZE          64
+
+/* Compressed ring mode / 압축 링 모드 */
+#define CB_BLOCK_SAMPLES            64      /* Samples per block (base + 63 deltas) / 블록당 샘플 수 */
+#define CB_BLOCK_MAX_BYTES          (((CB_BLOCK_SAMPLES - 1) * 32 + 7) / 8)  /* 32-bit deltas / 최악의 경우 */
+#define CB_ARENA_SLACK              8       /* Decoder reads 8 bytes at a time / 디코더가 8바이트씩 읽음 */
+
+/* Compressed ring full policy (independent of BUFFER_FULL_POLICY) */
+/* 압축 링 가득 참 정책 (BUFFER_FULL_POLICY와 별개) */
+#ifndef CBZ_FULL_POLICY
+#define CBZ_FULL_POLICY             POLICY_OVERWRITE_OLDEST
+#endif
 
 /* Error codes / 에러 코드 정의 */
 #define CB_SUCCESS                  0       /* Success / 성공 */
@@ -114,6 +176,44 @@
 /* 센서 데이터 타입 (필요에 따라 수정 가능) */
 typedef int32_t SensorData_t;
 
+/**
+ * Index type / 인덱스 타입
+ * - Default: volatile (single core ISR-main loop, used with critical section)
+ *   기본: volatile (단일 코어 ISR-메인 루프, 임계 영역과 함께 사용)
+ * - CB_LOCKFREE_SPSC: _Atomic, free-running counters (wrapped only on access)
+ *   CB_LOCKFREE_SPSC: _Atomic, 계속 증가하는 카운터 (접근 시에만 래핑)
+ *   uint32_t overflow is harmless because capacity is 2^n
+ *   capacity가 2^n이므로 uint32_t 오버플로우가 발생해도 차이 계산은 정확함
+ */
+#ifdef CB_LOCKFREE_SPSC
+typedef _Atomic uint32_t CbIndex_t;
+#define CB_LOAD(var, order)         atomic_load_explicit(&(var), order)
+#define CB_STORE(var, val, order)   atomic_store_explicit(&(var), (val), order)
+#define CB_ALIGN_CACHE_LINE         _Alignas(CB_CACHE_LINE_SIZE)
+#else
+typedef volatile uint32_t CbIndex_t;
+#define CB_ALIGN_CACHE_LINE
+#endif
+
+/**
+ * Running sum type (CB_RUNNING_STATS) / 누적 합 타입 (CB_RUNNING_STATS)
+ * - sumPushed is written by producer only, sumPopped by consumer only
+ *   sumPushed는 생산자만, sumPopped는 소비자만 갱신 → 공유 쓰기 없음
+ */
+#ifdef CB_RUNNING_STATS
+#ifdef CB_LOCKFREE_SPSC
+typedef _Atomic int64_t CbSum_t;
+#define CB_SUM_ADD(var, val)        atomic_fetch_add_explicit(&(var), (val), memory_order_relaxed)
+#define CB_SUM_READ(var)            atomic_load_explicit(&(var), memory_order_relaxed)
+#define CB_SUM_SET(var, val)        atomic_store_explicit(&(var), (val), memory_order_relaxed)
+#else
+typedef int64_t CbSum_t;
+#define CB_SUM_ADD(var, val)        ((var) += (val))
+#define CB_SUM_READ(var)            (var)
+#define CB_SUM_SET(var, val)        ((var) = (val))
+#endif
+#endif
+
 /**
  * Circular Buffer Structure / Circular Buffer 구조체
  * 
@@ -131,20 +231,96 @@ typedef int32_t SensorData_t;
  *               다음에 데이터를 읽을 위치
  * - count: Current number of stored data items
  *          현재 저장된 데이터 개수
+ *          (not present in CB_LOCKFREE_SPSC mode / CB_LOCKFREE_SPSC 모드에서는 없음)
  */
 typedef struct {
     SensorData_t*   pBuffer;            /* Data storage buffer pointer / 데이터 저장 버퍼 포인터 */
-    volatile uint32_t writeIndex;       /* Write index (head) - volatile to prevent optimization */
-                                        /* 쓰기 인덱스 (head) - volatile로 최적화 방지 */
-    volatile uint32_t readIndex;        /* Read index (tail) - volatile to prevent optimization */
-                                        /* 읽기 인덱스 (tail) - volatile로 최적화 방지 */
+    CB_ALIGN_CACHE_LINE
+    CbIndex_t       writeIndex;         /* Write index (head) - written by producer only */
+                                        /* 쓰기 인덱스 (head) - 생산자만 쓰기 */
+#ifdef CB_RUNNING_STATS
+    CbSum_t         sumPushed;          /* Sum of all pushed samples / push된 샘플 누적 합 */
+#endif
+    CB_ALIGN_CACHE_LINE
+    CbIndex_t       readIndex;          /* Read index (tail) - written by consumer only */
+                                        /* 읽기 인덱스 (tail) - 소비자만 쓰기 */
+#ifdef CB_RUNNING_STATS
+    CbSum_t         sumPopped;          /* Sum of all removed samples / 제거된 샘플 누적 합 */
+#endif
+#ifndef CB_LOCKFREE_SPSC
     volatile uint32_t count;            /* Current stored data count / 현재 저장된 데이터 개수 */
+#endif
+    CB_ALIGN_CACHE_LINE
     uint32_t        capacity;           /* Maximum buffer capacity / 버퍼 최대 용량 */
     uint32_t        indexMask;          /* Bit mask for index wrapping (capacity - 1) */
                                         /* 비트 마스킹용 마스크 (capacity - 1) */
     bool            isInitialized;      /* Initialization flag / 초기화 완료 여부 */
 } CircularBuffer_t;
 
+/**
+ * Windowed statistics result / 윈도우 통계 결과
+ */
+typedef struct {
+    uint32_t        count;              /* Samples in window / 윈도우 내 샘플 수 */
+    SensorData_t    min;                /* Minimum / 최솟값 */
+    SensorData_t    max;                /* Maximum / 최댓값 */
+    double          mean;               /* Mean / 평균 */
+    double          rms;                /* Root mean square / 제곱평균제곱근 */
+} CbWindowStats_t;
+
+/**
+ * Compressed block descriptor / 압축 블록 디스크립터
+ * 
+ * Block layout / 블록 구성:
+ *   sample[0]     = base (raw / 원본)
+ *   sample[i > 0] = sample[i-1] + unzigzag(delta[i-1])
+ *   delta[]       = (count - 1) values of 'width' bits, packed LSB-first at arena[offset]
+ *                   width 비트씩 (count - 1)개, arena[offset]부터 LSB 우선으로 연속 저장
+ * 
+ * - width = bits of the largest zigzag delta in the block (0 for a constant block)
+ *   width = 블록 내 가장 큰 zigzag 델타의 비트 수 (값이 일정하면 0)
+ * - span includes bytes skipped at the arena end so the block stays contiguous
+ *   span은 블록을 연속으로 두기 위해 아레나 끝에서 건너뛴 바이트를 포함
+ */
+typedef struct {
+    SensorData_t    base;               /* First sample / 첫 샘플 */
+    uint32_t        offset;             /* Packed deltas start in arena / 아레나 내 델타 시작 위치 */
+    uint16_t        span;               /* Arena bytes consumed (skip + packed) / 사용한 아레나 바이트 */
+    uint8_t         count;              /* Samples in block (1..CB_BLOCK_SAMPLES) / 블록 샘플 수 */
+    uint8_t         width;              /* Bits per delta (0..32) / 델타당 비트 수 */
+} CbBlockInfo_t;
+
+/**
+ * Compressed ring structure / 압축 링 구조체
+ * 
+ * Sample order (oldest → newest) / 샘플 순서 (오래된 것 → 최신):
+ *   frontBlock[frontRead..frontCount)   decoded remainder of a popped block / pop 중인 블록의 디코딩 결과
+ *   pBlocks[blockTail..blockHead)       sealed compressed blocks / 봉인된 압축 블록
+ *   openBlock[openRead..openCount)      raw samples not yet sealed / 아직 봉인 안 된 원본 샘플
+ * 
+ * Not lock-free: share between ISR and main loop with ENTER_CRITICAL()/EXIT_CRITICAL()
+ * 락-프리 아님: ISR-메인 루프 공유 시 ENTER_CRITICAL()/EXIT_CRITICAL()로 보호
+ */
+typedef struct {
+    uint8_t*        pArena;             /* Packed delta storage (+CB_ARENA_SLACK) / 델타 저장 영역 */
+    uint32_t        arenaBytes;         /* Arena capacity / 아레나 용량 */
+    uint32_t        arenaHead;          /* Next write offset / 다음 쓰기 위치 */
+    uint32_t        arenaUsed;          /* Bytes held by sealed blocks / 봉인된 블록이 쓰는 바이트 */
+    CbBlockInfo_t*  pBlocks;            /* Descriptor ring / 디스크립터 링 */
+    uint32_t        blockMask;          /* Descriptor count - 1 (2^n) / 디스크립터 수 - 1 */
+    uint32_t        blockHead;          /* Next descriptor (free-running) / 다음 디스크립터 (계속 증가) */
+    uint32_t        blockTail;          /* Oldest descriptor (free-running) / 가장 오래된 디스크립터 */
+    SensorData_t    openBlock[CB_BLOCK_SAMPLES];    /* Block being filled / 채우는 중인 블록 */
+    uint32_t        openCount;
+    uint32_t        openRead;           /* Popped before sealing / 봉인 전에 pop된 개수 */
+    SensorData_t    frontBlock[CB_BLOCK_SAMPLES];   /* Decoded oldest block / 디코딩된 가장 오래된 블록 */
+    uint32_t        frontCount;
+    uint32_t        frontRead;
+    uint32_t        count;              /* Stored samples / 저장된 샘플 수 */
+    uint32_t        evicted;            /* Samples dropped by overwrite / 덮어쓰기로 버려진 샘플 수 */
+    bool            isInitialized;      /* Initialization flag / 초기화 완료 여부 */
+} CbCompressedRing_t;
+
 /* ============================================================================
  * Static Memory Allocation (for embedded environments)
  * 정적 메모리 할당 (임베디드 환경용)
@@ -195,6 +371,179 @@ static inline uint32_t wrapIndex(CircularBuffer_t* cb, uint32_t index) {
     return index & cb->indexMask;
 }
 
+/**
+ * Partial aggregate over one or more segments / 구간 부분 집계값
+ */
+typedef struct {
+    SensorData_t    min;
+    SensorData_t    max;
+    int64_t         sum;
+    double          sumSquares;         /* double: int32^2 sums overflow int64 quickly */
+                                        /* double 사용: int32 제곱의 합은 int64를 쉽게 넘음 */
+} CbAccumulator_t;
+
+/**
+ * @brief Accumulate one contiguous segment (SIMD with scalar tail)
+ *        연속 구간 하나를 집계 (SIMD + 스칼라 나머지 처리)
+ * @param pData Segment start / 구간 시작 주소
+ * @param length Segment length / 구간 길이
+ * @param pAcc Accumulator to update / 갱신할 집계값
+ * 
+ * Kernel selection (compile time) / 커널 선택 (컴파일 타임):
+ * - __AVX2__        : 8 samples per iteration / 반복당 8개
+ * - __SSE4_1__      : 4 samples per iteration / 반복당 4개
+ * - NEON (AArch64)  : 4 samples per iteration / 반복당 4개
+ * - otherwise       : scalar only / 스칼라만
+ */
+static void accumulateSegment(const SensorData_t* pData, uint32_t length, CbAccumulator_t* pAcc) {
+    uint32_t i = 0;
+    
+#if defined(__AVX2__)
+    if (length >= 8) {
+        __m256i vMin = _mm256_set1_epi32(pAcc->min);
+        __m256i vMax = _mm256_set1_epi32(pAcc->max);
+        __m256i vSum = _mm256_setzero_si256();              /* 4 x int64 */
+        __m256d vSq = _mm256_setzero_pd();                  /* 4 x double */
+        int32_t lanes32[8];
+        int64_t lanes64[4];
+        double lanesF[4];
+        
+        for (; i + 8 <= length; i += 8) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(pData + i));
+            __m128i lo = _mm256_castsi256_si128(v);
+            __m128i hi = _mm256_extracti128_si256(v, 1);
+            __m256d dLo = _mm256_cvtepi32_pd(lo);
+            __m256d dHi = _mm256_cvtepi32_pd(hi);
+            
+            vMin = _mm256_min_epi32(vMin, v);
+            vMax = _mm256_max_epi32(vMax, v);
+            vSum = _mm256_add_epi64(vSum, _mm256_cvtepi32_epi64(lo));
+            vSum = _mm256_add_epi64(vSum, _mm256_cvtepi32_epi64(hi));
+            vSq = _mm256_add_pd(vSq, _mm256_mul_pd(dLo, dLo));
+            vSq = _mm256_add_pd(vSq, _mm256_mul_pd(dHi, dHi));
+        }
+        
+        /* Horizontal reduction / 수평 리덕션 */
+        _mm256_storeu_si256((__m256i*)lanes32, vMin);
+        for (int k = 0; k < 8; k++) if (lanes32[k] < pAcc->min) pAcc->min = lanes32[k];
+        _mm256_storeu_si256((__m256i*)lanes32, vMax);
+        for (int k = 0; k < 8; k++) if (lanes32[k] > pAcc->max) pAcc->max = lanes32[k];
+        _mm256_storeu_si256((__m256i*)lanes64, vSum);
+        _mm256_storeu_pd(lanesF, vSq);
+        for (int k = 0; k < 4; k++) {
+            pAcc->sum += lanes64[k];
+            pAcc->sumSquares += lanesF[k];
+        }
+    }
+#elif defined(__SSE4_1__)
+    if (length >= 4) {
+        __m128i vMin = _mm_set1_epi32(pAcc->min);
+        __m128i vMax = _mm_set1_epi32(pAcc->max);
+        __m128i vSum = _mm_setzero_si128();                 /* 2 x int64 */
+        __m128d vSq = _mm_setzero_pd();                     /* 2 x double */
+        int32_t lanes32[4];
+        int64_t lanes64[2];
+        double lanesF[2];
+        
+        for (; i + 4 <= length; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(pData + i));
+            __m128i hi = _mm_srli_si128(v, 8);
+            __m128d dLo = _mm_cvtepi32_pd(v);
+            __m128d dHi = _mm_cvtepi32_pd(hi);
+            
+            vMin = _mm_min_epi32(vMin, v);
+            vMax = _mm_max_epi32(vMax, v);
+            vSum = _mm_add_epi64(vSum, _mm_cvtepi32_epi64(v));
+            vSum = _mm_add_epi64(vSum, _mm_cvtepi32_epi64(hi));
+            vSq = _mm_add_pd(vSq, _mm_mul_pd(dLo, dLo));
+            vSq = _mm_add_pd(vSq, _mm_mul_pd(dHi, dHi));
+        }
+        
+        _mm_storeu_si128((__m128i*)lanes32, vMin);
+        for (int k = 0; k < 4; k++) if (lanes32[k] < pAcc->min) pAcc->min = lanes32[k];
+        _mm_storeu_si128((__m128i*)lanes32, vMax);
+        for (int k = 0; k < 4; k++) if (lanes32[k] > pAcc->max) pAcc->max = lanes32[k];
+        _mm_storeu_si128((__m128i*)lanes64, vSum);
+        _mm_storeu_pd(lanesF, vSq);
+        for (int k = 0; k < 2; k++) {
+            pAcc->sum += lanes64[k];
+            pAcc->sumSquares += lanesF[k];
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    if (length >= 4) {
+        int32x4_t vMin = vdupq_n_s32(pAcc->min);
+        int32x4_t vMax = vdupq_n_s32(pAcc->max);
+        int64x2_t vSum = vdupq_n_s64(0);
+        float64x2_t vSq = vdupq_n_f64(0.0);
+        
+        for (; i + 4 <= length; i += 4) {
+            int32x4_t v = vld1q_s32(pData + i);
+            float64x2_t dLo = vcvtq_f64_s64(vmovl_s32(vget_low_s32(v)));
+            float64x2_t dHi = vcvtq_f64_s64(vmovl_high_s32(v));
+            
+            vMin = vminq_s32(vMin, v);
+            vMax = vmaxq_s32(vMax, v);
+            vSum = vpadalq_s32(vSum, v);
+            vSq = vfmaq_f64(vSq, dLo, dLo);
+            vSq = vfmaq_f64(vSq, dHi, dHi);
+        }
+        
+        pAcc->min = vminvq_s32(vMin);
+        pAcc->max = vmaxvq_s32(vMax);
+        pAcc->sum += vaddvq_s64(vSum);
+        pAcc->sumSquares += vaddvq_f64(vSq);
+    }
+#endif
+    
+    /* Scalar fallback / remaining samples / 스칼라 처리 (나머지 샘플) */
+    for (; i < length; i++) {
+        SensorData_t v = pData[i];
+        if (v < pAcc->min) pAcc->min = v;
+        if (v > pAcc->max) pAcc->max = v;
+        pAcc->sum += v;
+        pAcc->sumSquares += (double)v * (double)v;
+    }
+}
+
+/**
+ * @brief Accumulate n samples starting at physical position (handles wrap split)
+ *        물리 위치부터 n개 집계 (래핑 분할 처리)
+ * 
+ * The live region is at most two contiguous segments:
+ * 유효 영역은 최대 두 개의 연속 구간:
+ *   [position, capacity) + [0, rest)
+ */
+static void accumulateRange(CircularBuffer_t* cb, uint32_t position, uint32_t n, CbAccumulator_t* pAcc) {
+    uint32_t first = cb->capacity - position;
+    if (first > n) {
+        first = n;
+    }
+    accumulateSegment(&cb->pBuffer[position], first, pAcc);
+    accumulateSegment(cb->pBuffer, n - first, pAcc);
+}
+
+/* Running sum hooks (no-op unless CB_RUNNING_STATS) / 누적 합 훅 (CB_RUNNING_STATS 아니면 무동작) */
+#ifdef CB_RUNNING_STATS
+static int64_t rangeSum(CircularBuffer_t* cb, uint32_t position, uint32_t n) {
+    CbAccumulator_t acc = { INT32_MAX, INT32_MIN, 0, 0.0 };
+    accumulateRange(cb, position, n, &acc);
+    return acc.sum;
+}
+#define CB_STATS_IN(cb, val)            CB_SUM_ADD((cb)->sumPushed, (val))
+#define CB_STATS_OUT(cb, val)           CB_SUM_ADD((cb)->sumPopped, (val))
+#define CB_STATS_IN_RANGE(cb, pos, n)   CB_SUM_ADD((cb)->sumPushed, rangeSum((cb), (pos), (n)))
+#define CB_STATS_OUT_RANGE(cb, pos, n)  CB_SUM_ADD((cb)->sumPopped, rangeSum((cb), (pos), (n)))
+#define CB_STATS_RESET(cb)              do { CB_SUM_SET((cb)->sumPushed, 0); \
+                                             CB_SUM_SET((cb)->sumPopped, 0); } while(0)
+#else
+#define CB_STATS_IN(cb, val)            ((void)0)
+#define CB_STATS_OUT(cb, val)           ((void)0)
+#define CB_STATS_IN_RANGE(cb, pos, n)   ((void)0)
+#define CB_STATS_OUT_RANGE(cb, pos, n)  ((void)0)
+#define CB_STATS_RESET(cb)              ((void)0)
+#endif
+
 /* ============================================================================
  * Public API Functions / 공개 API 함수
  * ============================================================================ */
@@ -230,9 +579,15 @@ int cb_init(CircularBuffer_t* cb, uint32_t size) {
     /* Initialize structure members / 구조체 멤버 초기화 */
     cb->capacity = size;
     cb->indexMask = size - 1;           /* Generate bit mask / 비트 마스킹용 마스크 생성 */
+#ifdef CB_LOCKFREE_SPSC
+    CB_STORE(cb->writeIndex, 0, memory_order_relaxed);
+    CB_STORE(cb->readIndex, 0, memory_order_relaxed);
+#else
     cb->writeIndex = 0;
     cb->readIndex = 0;
     cb->count = 0;
+#endif
+    CB_STATS_RESET(cb);
     
 #ifdef USE_STATIC_ALLOCATION
     /* Use static allocation / 정적 할당 사용 */
@@ -278,9 +633,15 @@ int cb_deinit(CircularBuffer_t* cb) {
     
     cb->isInitialized = false;
     cb->capacity = 0;
+#ifdef CB_LOCKFREE_SPSC
+    CB_STORE(cb->writeIndex, 0, memory_order_relaxed);
+    CB_STORE(cb->readIndex, 0, memory_order_relaxed);
+#else
     cb->writeIndex = 0;
     cb->readIndex = 0;
     cb->count = 0;
+#endif
+    CB_STATS_RESET(cb);
     
     return CB_SUCCESS;
 }
@@ -297,7 +658,12 @@ bool cb_isEmpty(CircularBuffer_t* cb) {
     if (cb == NULL || !cb->isInitialized) {
         return true;
     }
+#ifdef CB_LOCKFREE_SPSC
+    return (CB_LOAD(cb->writeIndex, memory_order_acquire) ==
+            CB_LOAD(cb->readIndex, memory_order_acquire));
+#else
     return (cb->count == 0);
+#endif
 }
 
 /**
@@ -312,7 +678,12 @@ bool cb_isFull(CircularBuffer_t* cb) {
     if (cb == NULL || !cb->isInitialized) {
         return false;
     }
+#ifdef CB_LOCKFREE_SPSC
+    return ((CB_LOAD(cb->writeIndex, memory_order_acquire) -
+             CB_LOAD(cb->readIndex, memory_order_acquire)) == cb->capacity);
+#else
     return (cb->count == cb->capacity);
+#endif
 }
 
 /**
@@ -338,6 +709,8 @@ bool cb_isFull(CircularBuffer_t* cb) {
  * Time complexity / 시간 복잡도: O(1)
  * Thread-safety: Basic safety ensured through volatile variables
  *                volatile 변수 사용으로 기본적인 안전성 확보
+ *                CB_LOCKFREE_SPSC: safe for one producer without critical section
+ *                CB_LOCKFREE_SPSC: 생산자 1개라면 임계 영역 없이 안전
  */
 int cb_push(CircularBuffer_t* cb, SensorData_t data) {
     /* Validation / 유효성 검증 */
@@ -345,6 +718,26 @@ int cb_push(CircularBuffer_t* cb, SensorData_t data) {
         return CB_ERROR_NULL_POINTER;
     }
     
+#ifdef CB_LOCKFREE_SPSC
+    {
+        /* Own index: relaxed, peer index: acquire (slot must be freed before reuse) */
+        /* 자기 인덱스는 relaxed, 상대 인덱스는 acquire (슬롯이 비워진 뒤에 재사용) */
+        uint32_t write = CB_LOAD(cb->writeIndex, memory_order_relaxed);
+        uint32_t read = CB_LOAD(cb->readIndex, memory_order_acquire);
+        
+        if ((write - read) == cb->capacity) {
+            return CB_ERROR_FULL;
+        }
+        
+        cb->pBuffer[wrapIndex(cb, write)] = data;
+        CB_STATS_IN(cb, data);
+        
+        /* Release: data write becomes visible before the new index */
+        /* Release: 데이터 기록이 새 인덱스보다 먼저 보이도록 보장 */
+        CB_STORE(cb->writeIndex, write + 1, memory_order_release);
+        return CB_SUCCESS;
+    }
+#else
     /* Handle buffer full condition / 버퍼 가득 참 처리 */
     if (cb_isFull(cb)) {
 #if (BUFFER_FULL_POLICY == POLICY_OVERWRITE_OLDEST)
@@ -361,6 +754,7 @@ int cb_push(CircularBuffer_t* cb, SensorData_t data) {
          * 주의: 이 정책은 데이터 유실을 허용합니다.
          *       중요 데이터의 경우 POLICY_REJECT_NEW 사용을 권장합니다.
          */
+        CB_STATS_OUT(cb, cb->pBuffer[cb->readIndex]);
         cb->readIndex = wrapIndex(cb, cb->readIndex + 1);
         /* count not changed - already equals capacity */
         /* count는 변경하지 않음 - 이미 capacity와 같음 */
@@ -383,12 +777,14 @@ int cb_push(CircularBuffer_t* cb, SensorData_t data) {
     
     /* Insert data / 데이터 삽입 */
     cb->pBuffer[cb->writeIndex] = data;
+    CB_STATS_IN(cb, data);
     
     /* Increment write index (wrap using bit masking) */
     /* 쓰기 인덱스 증가 (비트 마스킹으로 래핑) */
     cb->writeIndex = wrapIndex(cb, cb->writeIndex + 1);
     
     return CB_SUCCESS;
+#endif
 }
 
 /**
@@ -416,6 +812,24 @@ int cb_pop(CircularBuffer_t* cb, SensorData_t* pData) {
         return CB_ERROR_NULL_POINTER;
     }
     
+#ifdef CB_LOCKFREE_SPSC
+    {
+        uint32_t read = CB_LOAD(cb->readIndex, memory_order_relaxed);
+        uint32_t write = CB_LOAD(cb->writeIndex, memory_order_acquire);
+        
+        if (read == write) {
+            return CB_ERROR_EMPTY;
+        }
+        
+        *pData = cb->pBuffer[wrapIndex(cb, read)];
+        CB_STATS_OUT(cb, *pData);
+        
+        /* Release: slot is handed back to producer only after data is read */
+        /* Release: 데이터를 읽은 뒤에만 슬롯을 생산자에게 반환 */
+        CB_STORE(cb->readIndex, read + 1, memory_order_release);
+        return CB_SUCCESS;
+    }
+#else
     /* Check if buffer is empty - Edge Case handling */
     /* 버퍼 비어있음 검사 - Edge Case 처리 */
     if (cb_isEmpty(cb)) {
@@ -432,6 +846,7 @@ int cb_pop(CircularBuffer_t* cb, SensorData_t* pData) {
     
     /* Extract data / 데이터 추출 */
     *pData = cb->pBuffer[cb->readIndex];
+    CB_STATS_OUT(cb, *pData);
     
     /* Increment read index (wrap using bit masking) */
     /* 읽기 인덱스 증가 (비트 마스킹으로 래핑) */
@@ -441,6 +856,7 @@ int cb_pop(CircularBuffer_t* cb, SensorData_t* pData) {
     cb->count--;
     
     return CB_SUCCESS;
+#endif
 }
 
 /**
@@ -452,7 +868,13 @@ uint32_t cb_getCount(CircularBuffer_t* cb) {
     if (cb == NULL || !cb->isInitialized) {
         return 0;
     }
+#ifdef CB_LOCKFREE_SPSC
+    /* Derived from indices (snapshot) / 인덱스 차이로 계산 (시점 스냅샷) */
+    return CB_LOAD(cb->writeIndex, memory_order_acquire) -
+           CB_LOAD(cb->readIndex, memory_order_acquire);
+#else
     return cb->count;
+#endif
 }
 
 /**
@@ -464,22 +886,31 @@ uint32_t cb_getFreeSpace(CircularBuffer_t* cb) {
     if (cb == NULL || !cb->isInitialized) {
         return 0;
     }
-    return cb->capacity - cb->count;
+    return cb->capacity - cb_getCount(cb);
 }
 
 /**
  * @brief Clear buffer contents (size maintained) / 버퍼 내용 초기화 (크기는 유지)
  * @param cb Circular Buffer structure pointer / Circular Buffer 구조체 포인터
  * @return CB_SUCCESS: success / 성공
+ * 
+ * CB_LOCKFREE_SPSC: call only while producer and consumer are stopped
+ *                   생산자/소비자가 모두 멈춘 상태에서만 호출
  */
 int cb_clear(CircularBuffer_t* cb) {
     if (cb == NULL || !cb->isInitialized) {
         return CB_ERROR_NULL_POINTER;
     }
     
+#ifdef CB_LOCKFREE_SPSC
+    CB_STORE(cb->writeIndex, 0, memory_order_relaxed);
+    CB_STORE(cb->readIndex, 0, memory_order_relaxed);
+#else
     cb->writeIndex = 0;
     cb->readIndex = 0;
     cb->count = 0;
+#endif
+    CB_STATS_RESET(cb);
     
     return CB_SUCCESS;
 }
@@ -501,9 +932,794 @@ int cb_peek(CircularBuffer_t* cb, SensorData_t* pData) {
         return CB_ERROR_EMPTY;
     }
     
+#ifdef CB_LOCKFREE_SPSC
+    *pData = cb->pBuffer[wrapIndex(cb, CB_LOAD(cb->readIndex, memory_order_relaxed))];
+#else
     *pData = cb->pBuffer[cb->readIndex];
+#endif
+    return CB_SUCCESS;
+}
+
+/* ============================================================================
+ * Zero-Copy Region API (DMA-friendly) / 제로-카피 영역 API (DMA 친화적)
+ * 
+ * Exposes contiguous regions of pBuffer directly instead of copying by value.
+ * 값 복사 대신 pBuffer의 연속 영역을 직접 노출합니다.
+ * 
+ * Producer / 생산자:  cb_reserve() → write (DMA/memcpy) → cb_commit()
+ * Consumer / 소비자:  cb_peekRegion() → process in place → cb_consume()
+ * 
+ * - A region never crosses the wrap point, so at most two rounds are needed
+ *   영역은 래핑 지점을 넘지 않으므로 최대 두 번이면 전체 처리 가능
+ * - cb_reserve() only hands out free slots (never overwrites, regardless of policy)
+ *   cb_reserve()는 빈 슬롯만 제공 (정책과 무관하게 덮어쓰지 않음)
+ * ============================================================================ */
+
+/**
+ * @brief Reserve contiguous writable region / 쓰기 가능한 연속 영역 예약
+ * @param cb Circular Buffer structure pointer / Circular Buffer 구조체 포인터
+ * @param n Requested element count / 요청 원소 개수
+ * @param ppRegion Output: start of writable region / 출력: 쓰기 영역 시작 주소
+ * @param pLength Output: usable length (<= n) / 출력: 사용 가능한 길이 (<= n)
+ * @return CB_SUCCESS: success / 성공
+ *         CB_ERROR_FULL: no free space / 여유 공간 없음
+ */
+int cb_reserve(CircularBuffer_t* cb, uint32_t n, SensorData_t** ppRegion, uint32_t* pLength) {
+    uint32_t writePos;
+    uint32_t freeSpace;
+    
+    if (cb == NULL || !cb->isInitialized || ppRegion == NULL || pLength == NULL) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+#ifdef CB_LOCKFREE_SPSC
+    {
+        uint32_t write = CB_LOAD(cb->writeIndex, memory_order_relaxed);
+        freeSpace = cb->capacity - (write - CB_LOAD(cb->readIndex, memory_order_acquire));
+        writePos = wrapIndex(cb, write);
+    }
+#else
+    freeSpace = cb->capacity - cb->count;
+    writePos = cb->writeIndex;
+#endif
+    
+    if (freeSpace == 0) {
+        *pLength = 0;
+        return CB_ERROR_FULL;
+    }
+    
+    /* Clip at wrap point / 래핑 지점에서 자름 */
+    if (freeSpace > cb->capacity - writePos) {
+        freeSpace = cb->capacity - writePos;
+    }
+    
+    *ppRegion = &cb->pBuffer[writePos];
+    *pLength = (n < freeSpace) ? n : freeSpace;
+    return CB_SUCCESS;
+}
+
+/**
+ * @brief Publish n elements written into reserved region / 예약 영역에 쓴 n개 공개
+ * @param cb Circular Buffer structure pointer / Circular Buffer 구조체 포인터
+ * @param n Element count actually written / 실제로 쓴 원소 개수
+ * @return CB_SUCCESS: success / 성공
+ *         CB_ERROR_FULL: n exceeds free space / n이 여유 공간 초과
+ */
+int cb_commit(CircularBuffer_t* cb, uint32_t n) {
+    if (cb == NULL || !cb->isInitialized) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+#ifdef CB_LOCKFREE_SPSC
+    {
+        uint32_t write = CB_LOAD(cb->writeIndex, memory_order_relaxed);
+        if (n > cb->capacity - (write - CB_LOAD(cb->readIndex, memory_order_acquire))) {
+            return CB_ERROR_FULL;
+        }
+        CB_STATS_IN_RANGE(cb, wrapIndex(cb, write), n);
+        /* Release: DMA/memcpy writes become visible before the new index */
+        /* Release: DMA/memcpy 기록이 새 인덱스보다 먼저 보이도록 보장 */
+        CB_STORE(cb->writeIndex, write + n, memory_order_release);
+    }
+#else
+    if (n > cb->capacity - cb->count) {
+        return CB_ERROR_FULL;
+    }
+    CB_STATS_IN_RANGE(cb, cb->writeIndex, n);
+    cb->writeIndex = wrapIndex(cb, cb->writeIndex + n);
+    cb->count += n;
+#endif
+    
+    return CB_SUCCESS;
+}
+
+/**
+ * @brief Get contiguous readable region without copying
+ *        복사 없이 읽기 가능한 연속 영역 확인
+ * @param cb Circular Buffer structure pointer / Circular Buffer 구조체 포인터
+ * @param ppRegion Output: start of readable region / 출력: 읽기 영역 시작 주소
+ * @param pLength Output: readable length / 출력: 읽기 가능한 길이
+ * @return CB_SUCCESS: success / 성공
+ *         CB_ERROR_EMPTY: buffer empty / 버퍼 비어있음
+ */
+int cb_peekRegion(CircularBuffer_t* cb, const SensorData_t** ppRegion, uint32_t* pLength) {
+    uint32_t readPos;
+    uint32_t available;
+    
+    if (cb == NULL || !cb->isInitialized || ppRegion == NULL || pLength == NULL) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+#ifdef CB_LOCKFREE_SPSC
+    {
+        uint32_t read = CB_LOAD(cb->readIndex, memory_order_relaxed);
+        available = CB_LOAD(cb->writeIndex, memory_order_acquire) - read;
+        readPos = wrapIndex(cb, read);
+    }
+#else
+    available = cb->count;
+    readPos = cb->readIndex;
+#endif
+    
+    if (available == 0) {
+        *pLength = 0;
+        return CB_ERROR_EMPTY;
+    }
+    
+    /* Clip at wrap point / 래핑 지점에서 자름 */
+    if (available > cb->capacity - readPos) {
+        available = cb->capacity - readPos;
+    }
+    
+    *ppRegion = &cb->pBuffer[readPos];
+    *pLength = available;
+    return CB_SUCCESS;
+}
+
+/**
+ * @brief Release n elements processed in place / 제자리 처리한 n개 반환
+ * @param cb Circular Buffer structure pointer / Circular Buffer 구조체 포인터
+ * @param n Element count to release / 반환할 원소 개수
+ * @return CB_SUCCESS: success / 성공
+ *         CB_ERROR_EMPTY: n exceeds stored count / n이 저장된 개수 초과
+ */
+int cb_consume(CircularBuffer_t* cb, uint32_t n) {
+    if (cb == NULL || !cb->isInitialized) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+#ifdef CB_LOCKFREE_SPSC
+    {
+        uint32_t read = CB_LOAD(cb->readIndex, memory_order_relaxed);
+        if (n > CB_LOAD(cb->writeIndex, memory_order_acquire) - read) {
+            return CB_ERROR_EMPTY;
+        }
+        CB_STATS_OUT_RANGE(cb, wrapIndex(cb, read), n);
+        /* Release: slots are reused only after processing finished */
+        /* Release: 처리가 끝난 뒤에만 슬롯 재사용 */
+        CB_STORE(cb->readIndex, read + n, memory_order_release);
+    }
+#else
+    if (n > cb->count) {
+        return CB_ERROR_EMPTY;
+    }
+    CB_STATS_OUT_RANGE(cb, cb->readIndex, n);
+    cb->readIndex = wrapIndex(cb, cb->readIndex + n);
+    cb->count -= n;
+#endif
+    
+    return CB_SUCCESS;
+}
+
+/* ============================================================================
+ * Windowed Statistics / 윈도우 통계
+ * 
+ * Aggregates over the live contents without consuming them.
+ * 데이터를 소비하지 않고 현재 저장된 내용에 대해 집계합니다.
+ * 
+ * CB_LOCKFREE_SPSC: call from the consumer side only (producer may keep pushing)
+ *                   소비자 측에서만 호출 (생산자는 계속 push 가능)
+ * ============================================================================ */
+
+/**
+ * @brief Compute min/max/mean/RMS over the most recent N samples
+ *        최근 N개 샘플의 min/max/mean/RMS 계산
+ * @param cb Circular Buffer structure pointer / Circular Buffer 구조체 포인터
+ * @param window Number of most recent samples (clipped to count)
+ *               최근 샘플 개수 (저장 개수로 제한)
+ * @param pStats Output statistics / 출력 통계
+ * @return CB_SUCCESS: success / 성공
+ *         CB_ERROR_EMPTY: no samples / 샘플 없음
+ * 
+ * Time complexity / 시간 복잡도: O(N / SIMD width)
+ */
+int cb_windowStats(CircularBuffer_t* cb, uint32_t window, CbWindowStats_t* pStats) {
+    CbAccumulator_t acc = { INT32_MAX, INT32_MIN, 0, 0.0 };
+    uint32_t write;
+    uint32_t count;
+    
+    if (cb == NULL || !cb->isInitialized || pStats == NULL) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+#ifdef CB_LOCKFREE_SPSC
+    write = CB_LOAD(cb->writeIndex, memory_order_acquire);
+    count = write - CB_LOAD(cb->readIndex, memory_order_relaxed);
+#else
+    write = cb->writeIndex;
+    count = cb->count;
+#endif
+    
+    if (window > count) {
+        window = count;
+    }
+    if (window == 0) {
+        return CB_ERROR_EMPTY;
+    }
+    
+    /* Window starts N samples behind write position / 윈도우는 쓰기 위치에서 N개 앞부터 */
+    accumulateRange(cb, wrapIndex(cb, write - window), window, &acc);
+    
+    pStats->count = window;
+    pStats->min = acc.min;
+    pStats->max = acc.max;
+    pStats->mean = (double)acc.sum / window;
+    pStats->rms = sqrt(acc.sumSquares / window);
+    return CB_SUCCESS;
+}
+
+#ifdef CB_RUNNING_STATS
+/**
+ * @brief O(1) mean over all stored samples (running sums)
+ *        저장된 전체 샘플의 O(1) 평균 (누적 합 사용)
+ * @param cb Circular Buffer structure pointer / Circular Buffer 구조체 포인터
+ * @param pMean Output mean / 출력 평균
+ * @return CB_SUCCESS: success / 성공
+ *         CB_ERROR_EMPTY: no samples / 샘플 없음
+ * 
+ * CB_LOCKFREE_SPSC: snapshot may include a sample pushed during the call
+ *                   호출 중에 push된 샘플이 일시적으로 포함될 수 있음 (근사값)
+ */
+int cb_runningMean(CircularBuffer_t* cb, double* pMean) {
+    uint32_t count;
+    
+    if (cb == NULL || !cb->isInitialized || pMean == NULL) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+    count = cb_getCount(cb);
+    if (count == 0) {
+        return CB_ERROR_EMPTY;
+    }
+    
+    *pMean = (double)(CB_SUM_READ(cb->sumPushed) - CB_SUM_READ(cb->sumPopped)) / count;
     return CB_SUCCESS;
 }
+#endif
+
+/* ============================================================================
+ * Compressed Ring Mode / 압축 링 모드
+ * 
+ * Delta + zigzag + fixed-width bit packing per block (no per-sample branches):
+ * 블록마다 델타 + zigzag + 고정 폭 비트 패킹 (샘플별 분기 없음):
+ *   encode / 인코딩: d = x[i] - x[i-1] → zigzag (small |d| → small code) → width bits
+ *   decode / 디코딩: 8-byte load + shift + mask per delta, then SIMD prefix sum
+ *                    델타마다 8바이트 로드 + 시프트 + 마스크, 이후 SIMD 누적 합
+ * 
+ * Packed bytes are read as little-endian 64-bit words (x86 / ARM little-endian)
+ * 패킹된 바이트는 리틀 엔디언 64비트 워드로 읽음 (x86 / ARM 리틀 엔디언)
+ * ============================================================================ */
+
+/* Zigzag mapping: 0, -1, 1, -2, 2 ... → 0, 1, 2, 3, 4 ... / zigzag 매핑 */
+static inline uint32_t zigzagEncode(uint32_t delta) {
+    return (delta << 1) ^ (0u - (delta >> 31));
+}
+
+static inline uint32_t zigzagDecode(uint32_t code) {
+    return (code >> 1) ^ (0u - (code & 1u));
+}
+
+/* Bits needed to hold value (0 for 0) / 값을 담는 데 필요한 비트 수 (0이면 0) */
+static inline uint32_t bitWidth(uint32_t value) {
+#if defined(__GNUC__)
+    return (value == 0) ? 0 : 32u - (uint32_t)__builtin_clz(value);
+#else
+    uint32_t width = 0;
+    while (value != 0) {
+        width++;
+        value >>= 1;
+    }
+    return width;
+#endif
+}
+
+/**
+ * @brief In-place inclusive prefix sum (wrapping int32 arithmetic)
+ *        제자리 누적 합 (int32 래핑 연산)
+ * 
+ * Kernel selection (compile time) / 커널 선택 (컴파일 타임):
+ * - __AVX2__        : 8 samples per iteration (in-lane shifts + cross-lane carry)
+ *                     반복당 8개 (레인 내 시프트 + 레인 간 carry)
+ * - __SSE4_1__      : 4 samples per iteration / 반복당 4개
+ * - NEON (AArch64)  : 4 samples per iteration / 반복당 4개
+ * - otherwise       : scalar only / 스칼라만
+ */
+static void prefixSum(SensorData_t* pData, uint32_t length) {
+    uint32_t i = 0;
+    
+#if defined(__AVX2__)
+    __m256i carry = _mm256_setzero_si256();
+    for (; i + 8 <= length; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(pData + i));
+        v = _mm256_add_epi32(v, _mm256_slli_si256(v, 4));
+        v = _mm256_add_epi32(v, _mm256_slli_si256(v, 8));
+        /* Low 128-bit lane total → every element of the high lane / 하위 레인 합을 상위 레인에 더함 */
+        v = _mm256_add_epi32(v, _mm256_shuffle_epi32(_mm256_permute2x128_si256(v, v, 0x08), 0xFF));
+        v = _mm256_add_epi32(v, carry);
+        _mm256_storeu_si256((__m256i*)(pData + i), v);
+        carry = _mm256_permutevar8x32_epi32(v, _mm256_set1_epi32(7));
+    }
+#elif defined(__SSE4_1__)
+    __m128i carry = _mm_setzero_si128();
+    for (; i + 4 <= length; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(pData + i));
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+        v = _mm_add_epi32(v, carry);
+        _mm_storeu_si128((__m128i*)(pData + i), v);
+        carry = _mm_shuffle_epi32(v, 0xFF);
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    int32x4_t zero = vdupq_n_s32(0);
+    int32x4_t carry = zero;
+    for (; i + 4 <= length; i += 4) {
+        int32x4_t v = vld1q_s32(pData + i);
+        v = vaddq_s32(v, vextq_s32(zero, v, 3));
+        v = vaddq_s32(v, vextq_s32(zero, v, 2));
+        v = vaddq_s32(v, carry);
+        vst1q_s32(pData + i, v);
+        carry = vdupq_laneq_s32(v, 3);
+    }
+#endif
+    
+    /* Scalar fallback / remaining samples / 스칼라 처리 (나머지 샘플) */
+    if (i == 0) {
+        i = 1;
+    }
+    for (; i < length; i++) {
+        pData[i] = (SensorData_t)((uint32_t)pData[i - 1] + (uint32_t)pData[i]);
+    }
+}
+
+/**
+ * @brief Decode one block into pOut[0..count) / 블록 하나를 pOut[0..count)에 디코딩
+ */
+static void decodeBlock(const CbCompressedRing_t* ring, const CbBlockInfo_t* pBlock, SensorData_t* pOut) {
+    const uint8_t* pBits = ring->pArena + pBlock->offset;
+    const uint32_t width = pBlock->width;
+    const uint64_t mask = (width == 0) ? 0 : (~(uint64_t)0 >> (64 - width));
+    uint32_t bitPos = 0;
+    
+    pOut[0] = pBlock->base;
+    for (uint32_t i = 1; i < pBlock->count; i++, bitPos += width) {
+        uint64_t word;
+        memcpy(&word, pBits + (bitPos >> 3), sizeof(word));    /* Never past CB_ARENA_SLACK / 여유 바이트 안 */
+        pOut[i] = (SensorData_t)zigzagDecode((uint32_t)((word >> (bitPos & 7)) & mask));
+    }
+    prefixSum(pOut, pBlock->count);
+}
+
+/* Oldest / newest sealed descriptor / 가장 오래된 봉인 블록 디스크립터 */
+static inline CbBlockInfo_t* oldestBlock(CbCompressedRing_t* ring) {
+    return &ring->pBlocks[ring->blockTail & ring->blockMask];
+}
+
+static inline uint32_t sealedBlocks(const CbCompressedRing_t* ring) {
+    return ring->blockHead - ring->blockTail;
+}
+
+/* Free the oldest sealed block's arena bytes / 가장 오래된 봉인 블록의 아레나 반환 */
+static void releaseOldestBlock(CbCompressedRing_t* ring) {
+    ring->arenaUsed -= oldestBlock(ring)->span;
+    ring->blockTail++;
+    if (ring->blockHead == ring->blockTail) {
+        ring->arenaHead = 0;            /* Empty arena: restart at offset 0 / 비면 0부터 다시 */
+        ring->arenaUsed = 0;
+    }
+}
+
+#if (CBZ_FULL_POLICY == POLICY_OVERWRITE_OLDEST)
+/**
+ * @brief Drop the oldest whole block (overwrite policy)
+ *        가장 오래된 블록을 통째로 버림 (덮어쓰기 정책)
+ * 
+ * The decoded front remainder is older than every sealed block, so it goes first.
+ * 디코딩된 front 나머지가 모든 봉인 블록보다 오래되었으므로 먼저 버림.
+ */
+static void evictOldestBlock(CbCompressedRing_t* ring) {
+    uint32_t dropped = (ring->frontCount - ring->frontRead) + oldestBlock(ring)->count;
+    
+    ring->frontRead = ring->frontCount = 0;
+    ring->count -= dropped;
+    ring->evicted += dropped;
+    releaseOldestBlock(ring);
+}
+#endif
+
+/* Contiguous space for 'bytes' at arenaHead, or at 0 after skipping the arena end */
+/* arenaHead에 연속 'bytes' 공간 확인, 끝에 안 들어가면 남은 끝을 건너뛰고 0부터 */
+static bool arenaFits(const CbCompressedRing_t* ring, uint32_t bytes, uint32_t* pOffset, uint32_t* pSpan) {
+    bool wraps = (ring->arenaHead + bytes > ring->arenaBytes);
+    
+    *pOffset = wraps ? 0 : ring->arenaHead;
+    *pSpan = wraps ? (ring->arenaBytes - ring->arenaHead) + bytes : bytes;
+    return ring->arenaUsed + *pSpan <= ring->arenaBytes;
+}
+
+/**
+ * @brief Compress the open block into the arena / 열린 블록을 압축해서 아레나에 저장
+ * @return CB_SUCCESS: sealed / 봉인 완료
+ *         CB_ERROR_FULL: no room (POLICY_REJECT_NEW) / 공간 없음
+ */
+static int sealOpenBlock(CbCompressedRing_t* ring) {
+    const SensorData_t* pSamples = &ring->openBlock[ring->openRead];
+    const uint32_t n = ring->openCount - ring->openRead;
+    uint32_t codes[CB_BLOCK_SAMPLES];
+    uint32_t all = 0;
+    uint32_t offset;
+    uint32_t span;
+    
+    if (n == 0) {
+        ring->openRead = ring->openCount = 0;
+        return CB_SUCCESS;
+    }
+    
+    /* Width = widest code in the block / 폭 = 블록 내 가장 넓은 코드 */
+    for (uint32_t i = 1; i < n; i++) {
+        codes[i - 1] = zigzagEncode((uint32_t)pSamples[i] - (uint32_t)pSamples[i - 1]);
+        all |= codes[i - 1];
+    }
+    const uint32_t width = bitWidth(all);
+    const uint32_t bytes = ((n - 1) * width + 7) / 8;
+    
+    /* Make room: descriptor slot + contiguous arena bytes / 디스크립터 + 연속 아레나 공간 확보 */
+    while (sealedBlocks(ring) > ring->blockMask || !arenaFits(ring, bytes, &offset, &span)) {
+#if (CBZ_FULL_POLICY == POLICY_REJECT_NEW)
+        return CB_ERROR_FULL;
+#else
+        evictOldestBlock(ring);         /* Empty ring always fits (bytes <= CB_BLOCK_MAX_BYTES) */
+#endif
+    }
+    
+    CbBlockInfo_t* pBlock = &ring->pBlocks[ring->blockHead & ring->blockMask];
+    pBlock->base = pSamples[0];
+    pBlock->offset = offset;
+    pBlock->span = (uint16_t)span;
+    pBlock->count = (uint8_t)n;
+    pBlock->width = (uint8_t)width;
+    
+    /* Bit packing through a 64-bit accumulator / 64비트 누산기로 비트 패킹 */
+    {
+        uint8_t* pOut = ring->pArena + pBlock->offset;
+        uint64_t acc = 0;
+        uint32_t bits = 0;
+        for (uint32_t i = 0; i + 1 < n; i++) {
+            acc |= (uint64_t)codes[i] << bits;
+            bits += width;
+            while (bits >= 8) {
+                *pOut++ = (uint8_t)acc;
+                acc >>= 8;
+                bits -= 8;
+            }
+        }
+        if (bits != 0) {
+            *pOut = (uint8_t)acc;
+        }
+    }
+    
+    ring->arenaHead = pBlock->offset + bytes;
+    ring->arenaUsed += pBlock->span;
+    ring->blockHead++;
+    ring->openRead = ring->openCount = 0;
+    return CB_SUCCESS;
+}
+
+/* Decode the oldest sealed block into frontBlock / 가장 오래된 봉인 블록을 frontBlock으로 */
+static bool loadFrontBlock(CbCompressedRing_t* ring) {
+    if (sealedBlocks(ring) == 0) {
+        return false;
+    }
+    decodeBlock(ring, oldestBlock(ring), ring->frontBlock);
+    ring->frontCount = oldestBlock(ring)->count;
+    ring->frontRead = 0;
+    releaseOldestBlock(ring);
+    return true;
+}
+
+/**
+ * @brief Initialize compressed ring / 압축 링 초기화
+ * @param ring Compressed ring pointer / 압축 링 포인터
+ * @param arenaBytes Packed delta storage (>= CB_BLOCK_MAX_BYTES) / 델타 저장 바이트 수
+ * @param maxBlocks Descriptor count (power of two) / 디스크립터 수 (2의 거듭제곱)
+ * @return CB_SUCCESS: success / 성공
+ *         CB_ERROR_*: failure / 실패
+ * 
+ * Sizing / 크기 정하기:
+ * - A block of w-bit deltas needs ceil(63 * w / 8) arena bytes + one descriptor
+ *   w비트 델타 블록 하나 = 아레나 ceil(63 * w / 8) 바이트 + 디스크립터 1개
+ * - Balanced: maxBlocks ≈ arenaBytes / expected block bytes
+ *   균형: maxBlocks ≈ arenaBytes / 예상 블록 바이트
+ * - Dynamic memory allocation is only performed in this function
+ *   동적 메모리 할당은 이 함수에서만 수행됨
+ */
+int cbz_init(CbCompressedRing_t* ring, uint32_t arenaBytes, uint32_t maxBlocks) {
+    if (ring == NULL) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+    if (arenaBytes < CB_BLOCK_MAX_BYTES || arenaBytes > UINT32_MAX - CB_ARENA_SLACK ||
+        !isPowerOfTwo(maxBlocks)) {
+        printf("[ERROR] Arena must hold one raw block (%u bytes), maxBlocks must be power of two\n",
+               (unsigned)CB_BLOCK_MAX_BYTES);
+        printf("[ERROR] 아레나는 블록 하나(%u 바이트) 이상, maxBlocks는 2의 거듭제곱이어야 합니다.\n",
+               (unsigned)CB_BLOCK_MAX_BYTES);
+        return CB_ERROR_INVALID_SIZE;
+    }
+    
+    memset(ring, 0, sizeof(*ring));
+    ring->pArena = (uint8_t*)calloc((size_t)arenaBytes + CB_ARENA_SLACK, 1);
+    ring->pBlocks = (CbBlockInfo_t*)malloc(sizeof(CbBlockInfo_t) * maxBlocks);
+    if (ring->pArena == NULL || ring->pBlocks == NULL) {
+        free(ring->pArena);
+        free(ring->pBlocks);
+        printf("[ERROR] Memory allocation failed\n");
+        printf("[ERROR] 메모리 할당 실패\n");
+        return CB_ERROR_NULL_POINTER;
+    }
+    ring->arenaBytes = arenaBytes;
+    ring->blockMask = maxBlocks - 1;
+    ring->isInitialized = true;
+    
+    printf("[INFO] Compressed ring initialized (arena: %u bytes, blocks: %u)\n", arenaBytes, maxBlocks);
+    printf("[INFO] 압축 링 초기화 완료 (아레나: %u 바이트, 블록: %u)\n", arenaBytes, maxBlocks);
+    return CB_SUCCESS;
+}
+
+/**
+ * @brief Deinitialize compressed ring / 압축 링 해제
+ */
+int cbz_deinit(CbCompressedRing_t* ring) {
+    if (ring == NULL) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    free(ring->pArena);
+    free(ring->pBlocks);
+    ring->pArena = NULL;
+    ring->pBlocks = NULL;
+    ring->isInitialized = false;
+    return CB_SUCCESS;
+}
+
+/**
+ * @brief Clear contents (memory kept) / 내용 초기화 (메모리는 유지)
+ */
+int cbz_clear(CbCompressedRing_t* ring) {
+    if (ring == NULL || !ring->isInitialized) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    ring->arenaHead = ring->arenaUsed = 0;
+    ring->blockHead = ring->blockTail = 0;
+    ring->openCount = ring->openRead = 0;
+    ring->frontCount = ring->frontRead = 0;
+    ring->count = 0;
+    ring->evicted = 0;
+    return CB_SUCCESS;
+}
+
+/**
+ * @brief Append one sample / 샘플 하나 추가
+ * @return CB_SUCCESS: success / 성공
+ *         CB_ERROR_FULL: no room (CBZ_FULL_POLICY == POLICY_REJECT_NEW) / 공간 없음
+ * 
+ * Time complexity / 시간 복잡도: O(1) (sealing costs O(CB_BLOCK_SAMPLES) once per block)
+ *                                     (봉인은 블록당 한 번 O(CB_BLOCK_SAMPLES))
+ * The open block is sealed lazily when the next sample arrives, so the newest
+ * CB_BLOCK_SAMPLES samples always stay raw.
+ * 열린 블록은 다음 샘플이 올 때 봉인 → 최신 CB_BLOCK_SAMPLES개는 항상 원본 상태.
+ */
+int cbz_push(CbCompressedRing_t* ring, SensorData_t data) {
+    if (ring == NULL || !ring->isInitialized) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+    if (ring->openCount == CB_BLOCK_SAMPLES) {
+        int result = sealOpenBlock(ring);
+        if (result != CB_SUCCESS) {
+            return result;
+        }
+    }
+    
+    ring->openBlock[ring->openCount++] = data;
+    ring->count++;
+    return CB_SUCCESS;
+}
+
+/**
+ * @brief Remove the oldest sample / 가장 오래된 샘플 추출
+ * @return CB_SUCCESS: success / 성공
+ *         CB_ERROR_EMPTY: ring empty / 비어있음
+ * 
+ * Time complexity / 시간 복잡도: O(1) amortized (one block decode per CB_BLOCK_SAMPLES pops)
+ *                                     (pop CB_BLOCK_SAMPLES번마다 블록 디코딩 1번)
+ */
+int cbz_pop(CbCompressedRing_t* ring, SensorData_t* pData) {
+    if (ring == NULL || !ring->isInitialized || pData == NULL) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+    if (ring->count == 0) {
+        return CB_ERROR_EMPTY;
+    }
+    
+    if (ring->frontRead == ring->frontCount && !loadFrontBlock(ring)) {
+        /* Nothing sealed: read the open block directly / 봉인된 블록 없음: 열린 블록에서 바로 */
+        *pData = ring->openBlock[ring->openRead++];
+        if (ring->openRead == ring->openCount) {
+            ring->openRead = ring->openCount = 0;
+        }
+    } else {
+        *pData = ring->frontBlock[ring->frontRead++];
+    }
+    ring->count--;
+    return CB_SUCCESS;
+}
+
+/**
+ * @brief Remove up to maxCount oldest samples / 오래된 샘플을 최대 maxCount개 추출
+ * @param pOut Output array / 출력 배열
+ * @param maxCount Output capacity / 출력 배열 크기
+ * @param pPopped Samples written / 기록된 샘플 수
+ * @return CB_SUCCESS: at least one sample / 하나 이상 추출
+ *         CB_ERROR_EMPTY: ring empty / 비어있음
+ * 
+ * Whole blocks that fit are decoded straight into pOut (no front copy).
+ * 들어가는 블록은 pOut에 바로 디코딩 (front 복사 없음).
+ */
+int cbz_popBulk(CbCompressedRing_t* ring, SensorData_t* pOut, uint32_t maxCount, uint32_t* pPopped) {
+    uint32_t n = 0;
+    
+    if (ring == NULL || !ring->isInitialized || pOut == NULL || pPopped == NULL) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+    while (n < maxCount && ring->count > 0) {
+        uint32_t take;
+        
+        if (ring->frontRead < ring->frontCount) {
+            take = ring->frontCount - ring->frontRead;
+            take = (take < maxCount - n) ? take : maxCount - n;
+            memcpy(&pOut[n], &ring->frontBlock[ring->frontRead], take * sizeof(SensorData_t));
+            ring->frontRead += take;
+        } else if (sealedBlocks(ring) != 0) {
+            take = oldestBlock(ring)->count;
+            if (take > maxCount - n) {
+                loadFrontBlock(ring);   /* Partial block: go through front / 일부만: front 경유 */
+                continue;
+            }
+            decodeBlock(ring, oldestBlock(ring), &pOut[n]);
+            releaseOldestBlock(ring);
+        } else {
+            take = ring->openCount - ring->openRead;
+            take = (take < maxCount - n) ? take : maxCount - n;
+            memcpy(&pOut[n], &ring->openBlock[ring->openRead], take * sizeof(SensorData_t));
+            ring->openRead += take;
+            if (ring->openRead == ring->openCount) {
+                ring->openRead = ring->openCount = 0;
+            }
+        }
+        ring->count -= take;
+        n += take;
+    }
+    
+    *pPopped = n;
+    return (n == 0) ? CB_ERROR_EMPTY : CB_SUCCESS;
+}
+
+/**
+ * @brief Get stored sample count / 저장된 샘플 수 반환
+ */
+uint32_t cbz_getCount(CbCompressedRing_t* ring) {
+    if (ring == NULL || !ring->isInitialized) {
+        return 0;
+    }
+    return ring->count;
+}
+
+/**
+ * @brief Total memory footprint (struct + arena + descriptors) / 전체 메모리 사용량
+ */
+size_t cbz_memoryBytes(CbCompressedRing_t* ring) {
+    if (ring == NULL || !ring->isInitialized) {
+        return 0;
+    }
+    return sizeof(*ring) + ring->arenaBytes + CB_ARENA_SLACK +
+           sizeof(CbBlockInfo_t) * ((size_t)ring->blockMask + 1);
+}
+
+/**
+ * @brief Compute min/max/mean/RMS over the most recent N samples
+ *        최근 N개 샘플의 min/max/mean/RMS 계산
+ * @return CB_SUCCESS: success / 성공
+ *         CB_ERROR_EMPTY: no samples / 샘플 없음
+ * 
+ * Walks newest → oldest: open block (raw), then sealed blocks decoded whole,
+ * then the decoded front remainder. Each piece reuses accumulateSegment().
+ * 최신 → 과거 순: 열린 블록(원본) → 봉인 블록(통째로 디코딩) → front 나머지.
+ * 각 구간은 accumulateSegment()로 집계.
+ * 
+ * Time complexity / 시간 복잡도: O(N) decode + O(N / SIMD width) aggregate
+ */
+int cbz_windowStats(CbCompressedRing_t* ring, uint32_t window, CbWindowStats_t* pStats) {
+    CbAccumulator_t acc = { INT32_MAX, INT32_MIN, 0, 0.0 };
+    SensorData_t decoded[CB_BLOCK_SAMPLES];
+    uint32_t remaining;
+    uint32_t take;
+    
+    if (ring == NULL || !ring->isInitialized || pStats == NULL) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+    if (window > ring->count) {
+        window = ring->count;
+    }
+    if (window == 0) {
+        return CB_ERROR_EMPTY;
+    }
+    
+    remaining = window;
+    take = ring->openCount - ring->openRead;
+    take = (take < remaining) ? take : remaining;
+    accumulateSegment(&ring->openBlock[ring->openCount - take], take, &acc);
+    remaining -= take;
+    
+    for (uint32_t block = ring->blockHead; remaining > 0 && block != ring->blockTail; ) {
+        const CbBlockInfo_t* pBlock = &ring->pBlocks[--block & ring->blockMask];
+        decodeBlock(ring, pBlock, decoded);
+        take = (pBlock->count < remaining) ? pBlock->count : remaining;
+        accumulateSegment(&decoded[pBlock->count - take], take, &acc);
+        remaining -= take;
+    }
+    
+    if (remaining > 0) {
+        accumulateSegment(&ring->frontBlock[ring->frontCount - remaining], remaining, &acc);
+    }
+    
+    pStats->count = window;
+    pStats->min = acc.min;
+    pStats->max = acc.max;
+    pStats->mean = (double)acc.sum / window;
+    pStats->rms = sqrt(acc.sumSquares / window);
+    return CB_SUCCESS;
+}
+
+/**
+ * @brief Print compressed ring status (for debugging) / 압축 링 상태 출력 (디버깅용)
+ */
+void cbz_printStatus(CbCompressedRing_t* ring) {
+    if (ring == NULL || !ring->isInitialized) {
+        printf("[DEBUG] Buffer not initialized. / 버퍼가 초기화되지 않았습니다.\n");
+        return;
+    }
+    
+    const size_t memory = cbz_memoryBytes(ring);
+    printf("============ Compressed Ring Status / 압축 링 상태 ============\n");
+    printf("Samples / 샘플 수: %u (evicted / 버려짐: %u)\n", ring->count, ring->evicted);
+    printf("Sealed Blocks / 봉인 블록: %u / %u\n", sealedBlocks(ring), ring->blockMask + 1);
+    printf("Arena / 아레나: %u / %u bytes\n", ring->arenaUsed, ring->arenaBytes);
+    printf("Memory / 메모리: %zu bytes (%.2f bits/sample, raw: 32)\n", memory,
+           ring->count ? (double)memory * 8.0 / ring->count : 0.0);
+    printf("===============================================================\n");
+}
 
 /* ============================================================================
  * Thread-Safe Version (for interrupt environments)
@@ -523,7 +1739,11 @@ int cb_peek(CircularBuffer_t* cb, SensorData_t* pData) {
 
 /* Critical section entry/exit macros (modify per platform) */
 /* 임계 영역 진입/퇴장 매크로 (플랫폼에 따라 수정 필요) */
-#ifdef __ARM_ARCH
+#if defined(CB_LOCKFREE_SPSC)
+    /* Lock-free SPSC: no critical section required / 락-프리 SPSC: 임계 영역 불필요 */
+    #define ENTER_CRITICAL()    do {} while(0)
+    #define EXIT_CRITICAL()     do {} while(0)
+#elif defined(__ARM_ARCH)
     /* For ARM Cortex-M series / ARM Cortex-M 시리즈용 */
     #define ENTER_CRITICAL()    __disable_irq()
     #define EXIT_CRITICAL()     __enable_irq()
@@ -588,10 +1808,15 @@ void cb_printStatus(CircularBuffer_t* cb) {
     
     printf("============ Circular Buffer Status / 상태 ============\n");
     printf("Capacity / 용량: %u\n", cb->capacity);
-    printf("Current Count / 현재 개수: %u\n", cb->count);
+    printf("Current Count / 현재 개수: %u\n", cb_getCount(cb));
     printf("Free Space / 여유 공간: %u\n", cb_getFreeSpace(cb));
+#ifdef CB_LOCKFREE_SPSC
+    printf("Write Index (Head) / 쓰기 인덱스: %u\n", wrapIndex(cb, CB_LOAD(cb->writeIndex, memory_order_relaxed)));
+    printf("Read Index (Tail) / 읽기 인덱스: %u\n", wrapIndex(cb, CB_LOAD(cb->readIndex, memory_order_relaxed)));
+#else
     printf("Write Index (Head) / 쓰기 인덱스: %u\n", cb->writeIndex);
     printf("Read Index (Tail) / 읽기 인덱스: %u\n", cb->readIndex);
+#endif
     printf("Is Empty / 비어있음: %s\n", cb_isEmpty(cb) ? "Yes" : "No");
     printf("Is Full / 가득 참: %s\n", cb_isFull(cb) ? "Yes" : "No");
     printf("=======================================================\n");
@@ -613,14 +1838,101 @@ void cb_printContents(CircularBuffer_t* cb) {
         return;
     }
     
+#ifdef CB_LOCKFREE_SPSC
+    uint32_t idx = wrapIndex(cb, CB_LOAD(cb->readIndex, memory_order_relaxed));
+#else
     uint32_t idx = cb->readIndex;
-    for (uint32_t i = 0; i < cb->count; i++) {
+#endif
+    uint32_t count = cb_getCount(cb);
+    for (uint32_t i = 0; i < count; i++) {
         printf("%d ", cb->pBuffer[idx]);
         idx = wrapIndex(cb, idx + 1);
     }
     printf("\n");
 }
 
+#ifdef CB_LOCKFREE_SPSC
+/* ============================================================================
+ * Lock-free SPSC Stress Test / 락-프리 SPSC 스트레스 테스트
+ * - Producer thread streams sequential SensorData_t values
+ *   생산자 스레드가 연속된 SensorData_t 값을 스트리밍
+ * - Consumer (main thread) verifies order and completeness
+ *   소비자(메인 스레드)가 순서와 누락 여부를 검증
+ * ============================================================================ */
+#define STRESS_TEST_SAMPLES         5000000u
+#define STRESS_TEST_BUFFER_SIZE     1024u
+
+static void* stressProducer(void* arg) {
+    CircularBuffer_t* cb = (CircularBuffer_t*)arg;
+    
+    for (uint32_t i = 0; i < STRESS_TEST_SAMPLES; i++) {
+        /* Spin while full (REJECT_NEW policy) / 가득 차면 재시도 (REJECT_NEW 정책) */
+        while (cb_push(cb, (SensorData_t)i) == CB_ERROR_FULL) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static int cb_stressTest(void) {
+    CircularBuffer_t cb;
+    pthread_t producer;
+    struct timespec start, end;
+    SensorData_t data;
+    uint32_t expected = 0;
+    uint32_t errors = 0;
+    
+    if (cb_init(&cb, STRESS_TEST_BUFFER_SIZE) != CB_SUCCESS) {
+        return -1;
+    }
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pthread_create(&producer, NULL, stressProducer, &cb);
+    
+    while (expected < STRESS_TEST_SAMPLES) {
+        if (cb_pop(&cb, &data) == CB_SUCCESS) {
+            if ((uint32_t)data != expected) {
+                errors++;
+            }
+            expected++;
+        } else {
+            sched_yield();  /* Empty: let producer run / 비어있음: 생산자에게 양보 */
+        }
+    }
+    
+    pthread_join(producer, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    
+    double elapsed = (double)(end.tv_sec - start.tv_sec) +
+                     (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+    printf("Samples / 샘플 수: %u, Errors / 오류: %u\n", STRESS_TEST_SAMPLES, errors);
+    printf("Throughput / 처리량: %.1f M samples/sec\n", STRESS_TEST_SAMPLES / elapsed / 1e6);
+    
+    cb_deinit(&cb);
+    return (errors == 0) ? CB_SUCCESS : -1;
+}
+#endif
+
+/* ============================================================================
+ * Compressed Ring Test Helpers / 압축 링 테스트 헬퍼
+ * ============================================================================ */
+#define CBZ_TEST_ARENA_BYTES        16384u
+#define CBZ_TEST_MAX_BLOCKS         512u
+#define CBZ_TEST_SAMPLES            100000u
+#define CBZ_BENCH_ROUNDS            200u
+
+/* Slow sine (±2000 counts) + small noise (-4..3), regenerable from index */
+/* 느린 사인파 (±2000) + 작은 잡음 (-4..3), 인덱스로 다시 생성 가능 */
+static SensorData_t sensorSample(uint32_t i) {
+    double phase = 6.283185307179586 * (double)(i % 4096u) / 4096.0;
+    int32_t noise = (int32_t)((i * 2654435761u) >> 29) - 4;
+    return (SensorData_t)lround(2000.0 * sin(phase)) + noise;
+}
+
+static double secondsSince(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
 /* ============================================================================
  * Main Function (Test) / 메인 함수 (테스트)
  * ============================================================================ */
@@ -699,11 +2011,203 @@ int main(void) {
     printf("Buffer count / 버퍼 개수: %u (should be same after peek / Peek 후에도 동일해야 함)\n", 
            cb_getCount(&circularBuffer));
     
-    /* 7. Memory deallocation / 메모리 해제 */
-    printf("\n[Test 7] Buffer Memory Deallocation / 버퍼 메모리 해제\n");
+    /* 7. Zero-copy region test (DMA simulation) / 제로-카피 영역 테스트 (DMA 시뮬레이션) */
+    printf("\n[Test 7] Zero-Copy Reserve/Commit, Peek/Consume (DMA simulation)\n");
+    printf("         제로-카피 Reserve/Commit, Peek/Consume (DMA 시뮬레이션)\n");
+    {
+        /* ADC burst captured by DMA / DMA가 수집한 ADC 버스트 */
+        static const SensorData_t adcBurst[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        SensorData_t* pWrite;
+        const SensorData_t* pRead;
+        uint32_t written = 0;
+        uint32_t length;
+        int64_t sum = 0;
+        
+        cb_clear(&circularBuffer);
+        cb_push(&circularBuffer, 0);    /* Offset indices to force a wrap / 래핑 유도용 오프셋 */
+        cb_push(&circularBuffer, 0);
+        cb_pop(&circularBuffer, &data);
+        cb_pop(&circularBuffer, &data);
+        
+        /* Producer: DMA writes straight into the ring / 생산자: DMA가 링에 직접 기록 */
+        while (written < 8 &&
+               cb_reserve(&circularBuffer, 8 - written, &pWrite, &length) == CB_SUCCESS) {
+            memcpy(pWrite, &adcBurst[written], length * sizeof(SensorData_t));
+            cb_commit(&circularBuffer, length);
+            printf("Reserve/Commit: %u samples\n", length);
+            written += length;
+        }
+        
+        /* Consumer: process in place / 소비자: 제자리에서 처리 */
+        while (cb_peekRegion(&circularBuffer, &pRead, &length) == CB_SUCCESS) {
+            for (uint32_t i = 0; i < length; i++) {
+                sum += pRead[i];
+            }
+            cb_consume(&circularBuffer, length);
+            printf("Peek/Consume: %u samples\n", length);
+        }
+        printf("Sum / 합계: %lld (expected / 예상: 36)\n", (long long)sum);
+    }
+    
+    /* 8. Windowed statistics test / 윈도우 통계 테스트 */
+    printf("\n[Test 8] Windowed Statistics (most recent N) / 윈도우 통계 (최근 N개)\n");
+    {
+        CbWindowStats_t stats;
+        
+        cb_clear(&circularBuffer);
+        for (int i = 1; i <= 12; i++) {
+            cb_push(&circularBuffer, i * 10);     /* Wraps around capacity 8 / 용량 8에서 래핑 */
+        }
+        cb_printContents(&circularBuffer);
+        
+        if (cb_windowStats(&circularBuffer, 4, &stats) == CB_SUCCESS) {
+            printf("Last %u: min=%d max=%d mean=%.2f rms=%.2f\n",
+                   stats.count, stats.min, stats.max, stats.mean, stats.rms);
+        }
+        if (cb_windowStats(&circularBuffer, 100, &stats) == CB_SUCCESS) {
+            printf("All %u:  min=%d max=%d mean=%.2f rms=%.2f\n",
+                   stats.count, stats.min, stats.max, stats.mean, stats.rms);
+        }
+#ifdef CB_RUNNING_STATS
+        {
+            double mean;
+            if (cb_runningMean(&circularBuffer, &mean) == CB_SUCCESS) {
+                printf("Running mean (O(1)) / 누적 평균: %.2f\n", mean);
+            }
+        }
+#endif
+        cb_clear(&circularBuffer);
+    }
+    
+    /* 9. Memory deallocation / 메모리 해제 */
+    printf("\n[Test 9] Buffer Memory Deallocation / 버퍼 메모리 해제\n");
     cb_deinit(&circularBuffer);
     printf("Memory deallocated / 메모리 해제 완료\n");
     
+    /* 10. Compressed ring: history per byte + exact round trip / 압축 링: 바이트당 이력 + 무손실 확인 */
+    printf("\n[Test 10] Compressed Ring (delta + zigzag + bit packing)\n");
+    printf("         압축 링 (델타 + zigzag + 비트 패킹)\n");
+    {
+        CbCompressedRing_t ring;
+        CbWindowStats_t stats;
+        CbAccumulator_t expected = { INT32_MAX, INT32_MIN, 0, 0.0 };
+        SensorData_t reference[1000];
+        uint32_t first;
+        uint32_t held;
+        uint32_t mismatches = 0;
+        
+        if (cbz_init(&ring, CBZ_TEST_ARENA_BYTES, CBZ_TEST_MAX_BLOCKS) != CB_SUCCESS) {
+            return -1;
+        }
+        for (uint32_t i = 0; i < CBZ_TEST_SAMPLES; i++) {
+            cbz_push(&ring, sensorSample(i));
+        }
+        cbz_printStatus(&ring);
+        printf("History / 이력: %u samples vs raw ring in same memory / 같은 메모리의 원본 링: %zu samples\n",
+               cbz_getCount(&ring), cbz_memoryBytes(&ring) / sizeof(SensorData_t));
+        
+        /* Window over the newest 1000 survivors vs regenerated signal / 남은 샘플 중 최신 1000개를 원 신호와 비교 */
+        first = ring.evicted;
+        held = cbz_getCount(&ring);
+        for (uint32_t i = 0; i < 1000; i++) {
+            reference[i] = sensorSample(first + held - 1000 + i);
+        }
+        accumulateSegment(reference, 1000, &expected);
+        if (cbz_windowStats(&ring, 1000, &stats) == CB_SUCCESS) {
+            printf("Last %u: min=%d max=%d mean=%.2f (expected / 예상: min=%d max=%d mean=%.2f)\n",
+                   stats.count, stats.min, stats.max, stats.mean,
+                   expected.min, expected.max, (double)expected.sum / 1000);
+        }
+        
+        /* Survivors are exactly the newest samples, in order / 남은 샘플은 정확히 최신 샘플 (순서 유지) */
+        for (uint32_t i = first; cbz_pop(&ring, &data) == CB_SUCCESS; i++) {
+            mismatches += (data != sensorSample(i));
+        }
+        printf("Popped samples %u..%u, mismatches / 불일치: %u\n", first, first + held - 1, mismatches);
+        cbz_deinit(&ring);
+    }
+    
+    /* 11. Decode throughput benchmark / 디코딩 처리량 벤치마크 */
+    printf("\n[Test 11] Compressed Ring Decode Throughput / 압축 링 디코딩 처리량\n");
+    {
+        CbCompressedRing_t ring;
+        CbWindowStats_t stats;
+        SensorData_t* pRaw;
+        SensorData_t* pOut;
+        uint32_t held;
+        uint32_t popped;
+        clock_t start;
+        double rawSeconds;
+        double windowSeconds;
+        double popSeconds = 0;
+        
+        if (cbz_init(&ring, CBZ_TEST_ARENA_BYTES, CBZ_TEST_MAX_BLOCKS) != CB_SUCCESS) {
+            return -1;
+        }
+        for (uint32_t i = 0; i < CBZ_TEST_SAMPLES; i++) {
+            cbz_push(&ring, sensorSample(i));
+        }
+        held = cbz_getCount(&ring);
+        pRaw = (SensorData_t*)malloc(sizeof(SensorData_t) * held);
+        pOut = (SensorData_t*)malloc(sizeof(SensorData_t) * held);
+        if (pRaw == NULL || pOut == NULL) {
+            free(pRaw);
+            free(pOut);
+            cbz_deinit(&ring);
+            return -1;
+        }
+        for (uint32_t i = 0; i < held; i++) {
+            pRaw[i] = sensorSample(ring.evicted + i);
+        }
+        
+        /* Baseline: same statistics over raw int32 samples / 기준: 원본 int32 샘플에서 같은 통계 */
+        start = clock();
+        for (uint32_t r = 0; r < CBZ_BENCH_ROUNDS; r++) {
+            CbAccumulator_t acc = { INT32_MAX, INT32_MIN, 0, 0.0 };
+            accumulateSegment(pRaw, held, &acc);
+            stats.mean = (double)acc.sum / held;
+        }
+        rawSeconds = secondsSince(start);
+        
+        start = clock();
+        for (uint32_t r = 0; r < CBZ_BENCH_ROUNDS; r++) {
+            cbz_windowStats(&ring, held, &stats);
+        }
+        windowSeconds = secondsSince(start);
+        
+        /* Drain with popBulk, refill untimed / popBulk로 비우기 (다시 채우는 시간은 제외) */
+        for (uint32_t r = 0; r < CBZ_BENCH_ROUNDS / 10; r++) {
+            start = clock();
+            cbz_popBulk(&ring, pOut, held, &popped);
+            popSeconds += secondsSince(start);
+            for (uint32_t i = 0; i < held; i++) {
+                cbz_push(&ring, pOut[i]);
+            }
+        }
+        
+        printf("Samples per pass / 회당 샘플: %u (mean=%.2f)\n", held, stats.mean);
+        printf("Raw window stats     / 원본 윈도우 통계: %8.1f M samples/sec\n",
+               (double)held * CBZ_BENCH_ROUNDS / rawSeconds / 1e6);
+        printf("Compressed window    / 압축 윈도우 통계: %8.1f M samples/sec\n",
+               (double)held * CBZ_BENCH_ROUNDS / windowSeconds / 1e6);
+        printf("Compressed popBulk   / 압축 popBulk:    %8.1f M samples/sec\n",
+               (double)held * (CBZ_BENCH_ROUNDS / 10) / popSeconds / 1e6);
+        
+        free(pRaw);
+        free(pOut);
+        cbz_deinit(&ring);
+    }
+    
+#ifdef CB_LOCKFREE_SPSC
+    /* 12. Two-thread stress test / 2-스레드 스트레스 테스트 */
+    printf("\n[Test 12] Lock-free SPSC Stress Test (2 threads)\n");
+    printf("         락-프리 SPSC 스트레스 테스트 (2 스레드)\n");
+    if (cb_stressTest() != CB_SUCCESS) {
+        printf("Stress test failed! / 스트레스 테스트 실패!\n");
+        return -1;
+    }
+#endif
+    
     printf("\n========================================\n");
     printf("  All Tests Completed\n");
     printf("  모든 테스트 완료\n");
@@ -25,10 +25,18 @@
  * ============================================================================
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <stdatomic.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+#endif
 
 #define MAX_EVENTS 20
 
@@ -38,7 +46,8 @@ typedef enum {
     EVENT_BUTTON_RELEASED,
     EVENT_TIMER_EXPIRED,
     EVENT_DATA_RECEIVED,
-    EVENT_ERROR
+    EVENT_ERROR,
+    EVENT_TYPE_COUNT
 } EventType;
 
 /* 이벤트 구조체 */
@@ -93,27 +102,258 @@ int EventQueue_Pop(EventQueue* queue, Event* event) {
     return 0;
 }
 
-/* 이벤트 처리 핸들러 */
+/* 이벤트 처리 핸들러 - 타입별 함수 테이블 (switch 대신 인덱스 한 번) */
+typedef void (*EventHandlerFn)(const Event* event);
+
+static void Handle_ButtonPressed(const Event* event) {
+    printf("  → [Handler] 버튼 눌림 처리 (데이터: %d)\n", event->data);
+}
+
+static void Handle_ButtonReleased(const Event* event) {
+    (void)event;
+    printf("  → [Handler] 버튼 릴리즈 처리\n");
+}
+
+static void Handle_TimerExpired(const Event* event) {
+    (void)event;
+    printf("  → [Handler] 타이머 만료 처리\n");
+}
+
+static void Handle_DataReceived(const Event* event) {
+    printf("  → [Handler] 데이터 수신: %s\n", event->message);
+}
+
+static void Handle_Error(const Event* event) {
+    printf("  → [Handler] 오류 처리: %s\n", event->message);
+}
+
+static const EventHandlerFn event_handlers[EVENT_TYPE_COUNT] = {
+    [EVENT_BUTTON_PRESSED]  = Handle_ButtonPressed,
+    [EVENT_BUTTON_RELEASED] = Handle_ButtonReleased,
+    [EVENT_TIMER_EXPIRED]   = Handle_TimerExpired,
+    [EVENT_DATA_RECEIVED]   = Handle_DataReceived,
+    [EVENT_ERROR]           = Handle_Error,
+};
+
 void EventHandler_Process(const Event* event) {
-    switch (event->type) {
-        case EVENT_BUTTON_PRESSED:
-            printf("  → [Handler] 버튼 눌림 처리 (데이터: %d)\n", event->data);
-            break;
-        case EVENT_BUTTON_RELEASED:
-            printf("  → [Handler] 버튼 릴리즈 처리\n");
-            break;
-        case EVENT_TIMER_EXPIRED:
-            printf("  → [Handler] 타이머 만료 처리\n");
-            break;
-        case EVENT_DATA_RECEIVED:
-            printf("  → [Handler] 데이터 수신: %s\n", event->message);
-            break;
-        case EVENT_ERROR:
-            printf("  → [Handler] 오류 처리: %s\n", event->message);
-            break;
+    if ((unsigned)event->type < EVENT_TYPE_COUNT && event_handlers[event->type]) {
+        event_handlers[event->type](event);
+    }
+}
+
+/* ============================================================================
+ * Lock-free Event Queue - ISR에서 인터럽트 금지 없이 Push
+ * ============================================================================
+ *
+ * 위 EventQueue는 head/tail/count를 ISR과 메인 루프가 동기화 없이 공유하므로
+ * ISR Push 앞뒤로 인터럽트를 막아야 함. LfEventQueue는 C11 atomic만 사용:
+ *
+ * - LF_SPSC: 생산자 1 (ISR 하나) / 소비자 1 (메인 루프)
+ *     tail은 생산자만, head는 소비자만 씀 → CAS 없이 load/store 두 번
+ * - LF_MPSC: 생산자 여럿 (우선순위가 다른 ISR, 메인 루프) / 소비자 1
+ *     슬롯마다 sequence 번호 (Vyukov bounded queue), tail만 CAS로 예약
+ *     → 선점된 생산자가 있어도 다른 생산자는 막히지 않음 (wait-free 아님, lock-free)
+ * - count 필드 없음: 크기는 tail - head (부호 없는 wrap-around)
+ * - 용량은 2의 거듭제곱 → % 대신 & mask
+ */
+
+#define LF_QUEUE_SIZE 32
+#define LF_QUEUE_MASK (LF_QUEUE_SIZE - 1)
+
+_Static_assert((LF_QUEUE_SIZE & LF_QUEUE_MASK) == 0, "LF_QUEUE_SIZE must be a power of two");
+_Static_assert(ATOMIC_INT_LOCK_FREE == 2, "ISR에서 쓰려면 atomic_uint가 lock-free여야 함");
+
+typedef enum {
+    LF_SPSC,
+    LF_MPSC
+} LfQueueMode;
+
+typedef struct {
+    atomic_uint sequence;   // MPSC: pos → 비어 있음, pos + 1 → 데이터 준비됨
+    Event event;
+} LfCell;
+
+typedef struct {
+    LfQueueMode mode;
+    atomic_uint head;       // 소비자만 씀
+    atomic_uint tail;       // SPSC: 생산자만 씀, MPSC: CAS로 예약
+    atomic_uint dropped;    // 가득 차서 버린 이벤트 수
+    LfCell cells[LF_QUEUE_SIZE];
+} LfEventQueue;
+
+void LfEventQueue_Init(LfEventQueue* queue, LfQueueMode mode) {
+    queue->mode = mode;
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->dropped, 0);
+    for (unsigned i = 0; i < LF_QUEUE_SIZE; i++) {
+        atomic_init(&queue->cells[i].sequence, i);
+    }
+}
+
+/* ISR에서 호출 가능: 블로킹/printf 없음 */
+int LfEventQueue_Push(LfEventQueue* queue, const Event* event) {
+    if (queue->mode == LF_SPSC) {
+        unsigned tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        unsigned head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        if (tail - head >= LF_QUEUE_SIZE) {
+            atomic_fetch_add_explicit(&queue->dropped, 1, memory_order_relaxed);
+            return -1;
+        }
+        queue->cells[tail & LF_QUEUE_MASK].event = *event;
+        atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+        return 0;
+    }
+    
+    unsigned pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    LfCell* cell;
+    for (;;) {
+        cell = &queue->cells[pos & LF_QUEUE_MASK];
+        unsigned seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        int diff = (int)(seq - pos);
+        if (diff == 0) {
+            // 실패하면 pos가 현재 tail로 갱신됨
+            if (atomic_compare_exchange_weak_explicit(&queue->tail, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            atomic_fetch_add_explicit(&queue->dropped, 1, memory_order_relaxed);
+            return -1;      // 한 바퀴 전 데이터가 아직 소비되지 않음 → 가득 참
+        } else {
+            pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        }
+    }
+    cell->event = *event;
+    atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+    return 0;
+}
+
+/* 최대 max개를 한 번에 꺼냄 (메인 루프 전용), 꺼낸 개수 반환 */
+int LfEventQueue_PopMany(LfEventQueue* queue, Event* out, int max) {
+    unsigned head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    int n = 0;
+    
+    if (max <= 0) {
+        return 0;           // SPSC 경로에서 음수 n으로 head가 뒤로 가지 않도록
+    }
+    
+    if (queue->mode == LF_SPSC) {
+        // tail을 한 번만 읽고 head도 한 번만 씀 → 이벤트 수와 무관하게 atomic 2회
+        unsigned tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        unsigned available = tail - head;
+        n = (int)available < max ? (int)available : max;
+        for (int i = 0; i < n; i++) {
+            out[i] = queue->cells[(head + (unsigned)i) & LF_QUEUE_MASK].event;
+        }
+        atomic_store_explicit(&queue->head, head + (unsigned)n, memory_order_release);
+        return n;
+    }
+    
+    while (n < max) {
+        LfCell* cell = &queue->cells[head & LF_QUEUE_MASK];
+        unsigned seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        if (seq != head + 1) {
+            break;          // 비었거나 예약만 되고 아직 기록 중
+        }
+        out[n++] = cell->event;
+        atomic_store_explicit(&cell->sequence, head + LF_QUEUE_SIZE, memory_order_release);
+        head++;
+    }
+    atomic_store_explicit(&queue->head, head, memory_order_relaxed);
+    return n;
+}
+
+int LfEventQueue_Pop(LfEventQueue* queue, Event* event) {
+    return LfEventQueue_PopMany(queue, event, 1) == 1 ? 0 : -1;
+}
+
+/* ============================================================================
+ * 인터럽트 컨텍스트 Push 지연 측정
+ * ============================================================================
+ *
+ * - 호스트에서는 주기 타이머 시그널(SIGALRM)을 인터럽트로 사용
+ *   시그널 핸들러는 메인 루프를 임의 지점에서 선점 → ISR과 같은 조건
+ * - 핸들러 안에서는 printf 금지 (async-signal-safe 아님) → 통계만 기록
+ * - MPSC 모드에서는 메인 루프도 생산자로 Push → 선점된 Push와 경합
+ */
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#define ISR_SAMPLES 2000
+
+static LfEventQueue* isr_queue;
+static volatile sig_atomic_t isr_count;
+static uint64_t isr_worst_ns;
+static uint64_t isr_total_ns;
+
+static uint64_t Now_Ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void Timer_Isr(int signo) {
+    (void)signo;
+    Event event = { EVENT_TIMER_EXPIRED, isr_count, "" };
+    uint64_t start = Now_Ns();
+    LfEventQueue_Push(isr_queue, &event);
+    uint64_t elapsed = Now_Ns() - start;
+    if (elapsed > isr_worst_ns) {
+        isr_worst_ns = elapsed;
+    }
+    isr_total_ns += elapsed;
+    isr_count++;
+}
+
+void Measure_IsrPushLatency(LfQueueMode mode) {
+    static LfEventQueue queue;
+    LfEventQueue_Init(&queue, mode);
+    isr_queue = &queue;
+    isr_count = 0;
+    isr_worst_ns = 0;
+    isr_total_ns = 0;
+    
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = Timer_Isr;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGALRM, &action, NULL);
+    
+    struct itimerval timer = { { 0, 100 }, { 0, 100 } };   // 100us 주기
+    setitimer(ITIMER_REAL, &timer, NULL);
+    
+    Event batch[8];
+    long received = 0;
+    int main_pushes = 0;
+    while (isr_count < ISR_SAMPLES) {
+        if (mode == LF_MPSC) {
+            Event own = { EVENT_DATA_RECEIVED, main_pushes, "main" };
+            if (LfEventQueue_Push(&queue, &own) == 0) {
+                main_pushes++;
+            }
+        }
+        received += LfEventQueue_PopMany(&queue, batch, 8);
     }
+    
+    struct itimerval stop = { { 0, 0 }, { 0, 0 } };
+    setitimer(ITIMER_REAL, &stop, NULL);
+    signal(SIGALRM, SIG_DFL);
+    
+    Event rest;
+    while (LfEventQueue_Pop(&queue, &rest) == 0) {
+        received++;
+    }
+    
+    printf("[%s] ISR Push %d회: 평균 %llu ns, 최악 %llu ns (수신 %ld, 메인 Push %d, 드롭 %u)\n",
+           mode == LF_SPSC ? "SPSC" : "MPSC", ISR_SAMPLES,
+           (unsigned long long)(isr_total_ns / ISR_SAMPLES),
+           (unsigned long long)isr_worst_ns, received, main_pushes,
+           atomic_load(&queue.dropped));
 }
 
+#endif
+
 /* ============================================================================
  * 메인 함수
  * ============================================================================ */
@@ -151,6 +391,27 @@ int main(void) {
     
     printf("\n모든 이벤트 처리 완료\n");
     
+    // Lock-free 큐 + 일괄 처리
+    printf("\n=== Lock-free 큐 (PopMany) ===\n");
+    static LfEventQueue lf_queue;
+    LfEventQueue_Init(&lf_queue, LF_MPSC);
+    LfEventQueue_Push(&lf_queue, &e1);
+    LfEventQueue_Push(&lf_queue, &e3);
+    LfEventQueue_Push(&lf_queue, &e4);
+    
+    Event batch[8];
+    int n = LfEventQueue_PopMany(&lf_queue, batch, 8);
+    printf("[LfEventQueue] %d개를 한 번에 꺼냄\n", n);
+    for (int i = 0; i < n; i++) {
+        EventHandler_Process(&batch[i]);
+    }
+    
+#if defined(__unix__) || defined(__APPLE__)
+    printf("\n=== 인터럽트 컨텍스트 Push 지연 ===\n");
+    Measure_IsrPushLatency(LF_SPSC);
+    Measure_IsrPushLatency(LF_MPSC);
+#endif
+    
     printf("\n========================================\n");
     printf("Event Queue 패턴 예제 종료\n");
     printf("========================================\n");
@@ -44,6 +44,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdint.h>
 
@@ -123,6 +124,199 @@ void MemPool_PrintStatus(MemoryPool* pool) {
            pool->total_blocks - pool->allocated_count);
 }
 
+/* ============================================================================
+ * Bitmap Pool - 블록 헤더 없이 비트맵으로 free 블록 추적
+ * ============================================================================
+ *
+ * - 블록마다 1비트 (1 = free), 별도 헤더 없음 → 블록당 오버헤드 1비트
+ * - 2단계 비트맵: summary의 비트 w = bitmap[w]에 free 블록이 있음
+ *   → 할당은 count-trailing-zeros 2번으로 O(1) (블록 수와 무관)
+ * - 해제 검증: 풀 범위 밖 / 블록 경계가 아님 / 이미 free (이중 해제)를 에러 코드로 반환
+ * - 최대 32 * 32 = 1024 블록 (MCU에서도 32비트 연산만 사용)
+ */
+
+#define BITMAP_POOL_MAX_BLOCKS 1024
+#define BITMAP_WORDS(count) (((count) + 31u) / 32u)
+
+typedef enum {
+    POOL_OK = 0,
+    POOL_ERR_NULL,          // NULL 포인터
+    POOL_ERR_FOREIGN,       // 이 풀의 메모리가 아님
+    POOL_ERR_MISALIGNED,    // 블록 시작 주소가 아님
+    POOL_ERR_DOUBLE_FREE    // 이미 해제된 블록
+} PoolResult;
+
+static const char* PoolResult_Name(PoolResult r) {
+    static const char* names[] = {"OK", "NULL", "FOREIGN", "MISALIGNED", "DOUBLE_FREE"};
+    return names[r];
+}
+
+/* count trailing zeros (x != 0), GCC/Clang는 내장 명령, 그 외는 de Bruijn 곱셈 */
+static inline uint32_t Pool_Ctz32(uint32_t x) {
+#if defined(__GNUC__)
+    return (uint32_t)__builtin_ctz(x);
+#else
+    static const uint8_t table[32] = {
+        0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+        31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+    };
+    return table[((x & (0u - x)) * 0x077CB531u) >> 27];
+#endif
+}
+
+typedef struct {
+    uint8_t* base;          // 사용자 제공 저장 공간
+    uint32_t block_size;
+    uint32_t block_count;
+    uint32_t free_count;
+    uint32_t summary;       // 비트 w = bitmap[w] != 0
+    uint32_t* bitmap;       // BITMAP_WORDS(block_count)개, 비트 = 1이면 free
+} BitmapPool;
+
+/* 저장 공간과 비트맵은 호출자가 제공 (정적 배열 → 힙 사용 없음) */
+int BitmapPool_Init(BitmapPool* pool, void* storage, uint32_t block_size,
+                    uint32_t block_count, uint32_t* bitmap) {
+    if (!pool || !storage || !bitmap || block_size == 0 ||
+        block_count == 0 || block_count > BITMAP_POOL_MAX_BLOCKS) {
+        return -1;
+    }
+    pool->base = (uint8_t*)storage;
+    pool->block_size = block_size;
+    pool->block_count = block_count;
+    pool->free_count = block_count;
+    pool->bitmap = bitmap;
+    pool->summary = 0;
+    
+    uint32_t words = BITMAP_WORDS(block_count);
+    for (uint32_t w = 0; w < words; w++) {
+        uint32_t bits = (w + 1 < words || block_count % 32 == 0)
+                        ? 0xFFFFFFFFu : ((1u << (block_count % 32)) - 1);
+        bitmap[w] = bits;
+        pool->summary |= 1u << w;
+    }
+    return 0;
+}
+
+/* O(1): summary에서 word, word에서 비트 */
+void* BitmapPool_Alloc(BitmapPool* pool) {
+    if (pool->summary == 0) {
+        return NULL;
+    }
+    uint32_t w = Pool_Ctz32(pool->summary);
+    uint32_t b = Pool_Ctz32(pool->bitmap[w]);
+    pool->bitmap[w] &= pool->bitmap[w] - 1;     // 가장 낮은 1비트 지움
+    if (pool->bitmap[w] == 0) {
+        pool->summary &= ~(1u << w);
+    }
+    pool->free_count--;
+    return pool->base + (size_t)(w * 32 + b) * pool->block_size;
+}
+
+int BitmapPool_Owns(const BitmapPool* pool, const void* ptr) {
+    const uint8_t* p = (const uint8_t*)ptr;
+    return p >= pool->base &&
+           p < pool->base + (size_t)pool->block_count * pool->block_size;
+}
+
+/* O(1): 범위 / 경계 / 이중 해제 검사 후 비트 설정 */
+PoolResult BitmapPool_Free(BitmapPool* pool, void* ptr) {
+    if (ptr == NULL) {
+        return POOL_ERR_NULL;
+    }
+    if (!BitmapPool_Owns(pool, ptr)) {
+        return POOL_ERR_FOREIGN;
+    }
+    size_t offset = (size_t)((uint8_t*)ptr - pool->base);
+    if (offset % pool->block_size != 0) {
+        return POOL_ERR_MISALIGNED;
+    }
+    uint32_t index = (uint32_t)(offset / pool->block_size);
+    uint32_t w = index / 32, bit = 1u << (index % 32);
+    if (pool->bitmap[w] & bit) {
+        return POOL_ERR_DOUBLE_FREE;
+    }
+    pool->bitmap[w] |= bit;
+    pool->summary |= 1u << w;
+    pool->free_count++;
+    return POOL_OK;
+}
+
+/* ============================================================================
+ * MemPoolMulti - 여러 크기 클래스를 하나의 할당 창구로
+ * ============================================================================
+ *
+ * - 클래스는 block_size 오름차순으로 유지
+ * - Alloc(size): size 이상인 가장 작은 클래스부터, 비어 있으면 더 큰 클래스로
+ * - Free(ptr): 주소 범위로 클래스를 찾아 검증 후 반환
+ * - 클래스 수가 상수(MEMPOOL_MAX_CLASSES)이므로 최악 시간도 상수
+ */
+
+#define MEMPOOL_MAX_CLASSES 8
+
+typedef struct {
+    BitmapPool classes[MEMPOOL_MAX_CLASSES];
+    int class_count;
+    uint32_t failed_allocs;
+} MemPoolMulti;
+
+void MemPoolMulti_Init(MemPoolMulti* mp) {
+    memset(mp, 0, sizeof(*mp));
+}
+
+int MemPoolMulti_AddClass(MemPoolMulti* mp, void* storage, uint32_t block_size,
+                          uint32_t block_count, uint32_t* bitmap) {
+    if (mp->class_count >= MEMPOOL_MAX_CLASSES) {
+        return -1;
+    }
+    int pos = mp->class_count;
+    while (pos > 0 && mp->classes[pos - 1].block_size > block_size) {
+        mp->classes[pos] = mp->classes[pos - 1];     // 오름차순 삽입
+        pos--;
+    }
+    if (BitmapPool_Init(&mp->classes[pos], storage, block_size, block_count, bitmap) != 0) {
+        for (int i = pos; i < mp->class_count; i++) {
+            mp->classes[i] = mp->classes[i + 1];
+        }
+        return -1;
+    }
+    mp->class_count++;
+    return 0;
+}
+
+void* MemPoolMulti_Alloc(MemPoolMulti* mp, size_t size) {
+    for (int i = 0; i < mp->class_count; i++) {
+        if (mp->classes[i].block_size >= size) {
+            void* p = BitmapPool_Alloc(&mp->classes[i]);
+            if (p) {
+                return p;
+            }
+        }
+    }
+    mp->failed_allocs++;
+    return NULL;
+}
+
+PoolResult MemPoolMulti_Free(MemPoolMulti* mp, void* ptr) {
+    if (ptr == NULL) {
+        return POOL_ERR_NULL;
+    }
+    for (int i = 0; i < mp->class_count; i++) {
+        if (BitmapPool_Owns(&mp->classes[i], ptr)) {
+            return BitmapPool_Free(&mp->classes[i], ptr);
+        }
+    }
+    return POOL_ERR_FOREIGN;
+}
+
+void MemPoolMulti_PrintStatus(const MemPoolMulti* mp) {
+    for (int i = 0; i < mp->class_count; i++) {
+        const BitmapPool* c = &mp->classes[i];
+        printf("[MemPoolMulti] %4u bytes: 사용 중 %u / %u\n",
+               c->block_size, c->block_count - c->free_count, c->block_count);
+    }
+    printf("[MemPoolMulti] 할당 실패: %u\n", mp->failed_allocs);
+}
+
 /* ============================================================================
  * 메인 함수
  * ============================================================================ */
@@ -169,6 +363,48 @@ int main(void) {
     printf("재할당된 메모리: %p\n", buf);
     MemPool_Free(&pool, buf);
     
+    // 비트맵 풀 + 다중 크기 클래스
+    printf("\n=== 다중 크기 비트맵 풀 ===\n");
+    static uint8_t small_storage[64][16];
+    static uint8_t medium_storage[32][64];
+    static uint8_t large_storage[8][256];
+    static uint32_t small_bitmap[BITMAP_WORDS(64)];
+    static uint32_t medium_bitmap[BITMAP_WORDS(32)];
+    static uint32_t large_bitmap[BITMAP_WORDS(8)];
+    
+    MemPoolMulti multi;
+    MemPoolMulti_Init(&multi);
+    MemPoolMulti_AddClass(&multi, large_storage, 256, 8, large_bitmap);
+    MemPoolMulti_AddClass(&multi, small_storage, 16, 64, small_bitmap);
+    MemPoolMulti_AddClass(&multi, medium_storage, 64, 32, medium_bitmap);
+    
+    void* msg = MemPoolMulti_Alloc(&multi, 12);     // → 16 bytes 클래스
+    void* packet = MemPoolMulti_Alloc(&multi, 48);  // → 64 bytes 클래스
+    void* frame = MemPoolMulti_Alloc(&multi, 200);  // → 256 bytes 클래스
+    MemPoolMulti_PrintStatus(&multi);
+    
+    printf("\n=== 해제 검증 ===\n");
+    int on_stack = 0;
+    printf("정상 해제:     %s\n", PoolResult_Name(MemPoolMulti_Free(&multi, packet)));
+    printf("이중 해제:     %s\n", PoolResult_Name(MemPoolMulti_Free(&multi, packet)));
+    printf("다른 메모리:   %s\n", PoolResult_Name(MemPoolMulti_Free(&multi, &on_stack)));
+    printf("블록 중간:     %s\n", PoolResult_Name(MemPoolMulti_Free(&multi, (uint8_t*)frame + 8)));
+    MemPoolMulti_Free(&multi, msg);
+    MemPoolMulti_Free(&multi, frame);
+    
+    printf("\n=== 작은 클래스 소진 → 큰 클래스로 ===\n");
+    void* held[65];
+    for (int i = 0; i < 65; i++) {
+        held[i] = MemPoolMulti_Alloc(&multi, 16);
+    }
+    MemPoolMulti_PrintStatus(&multi);
+    for (int i = 0; i < 65; i++) {
+        MemPoolMulti_Free(&multi, held[i]);
+    }
+    
+    printf("\n블록당 관리 오버헤드: 기존 MemBlock 헤더 %u bytes, 비트맵 1 bit\n",
+           (unsigned)offsetof(MemBlock, data));
+    
     printf("\n========================================\n");
     printf("Memory Pool 패턴 예제 종료\n");
     printf("========================================\n");
@@ -29,7 +29,7 @@ g++ -std=c++17 00_function_pointer_basics.cpp -o 00_function_pointer.exe
  * 5단계: 클래스 기반 Callback
  * 6단계: 템플릿 콜백
  * 7단계: 실무 예제 (Observer, Command, Strategy)
- * 8단계: C vs C++ 비교
+ * 8단계: C vs C++ 비교 + 호출 방식별 벤치마크
  * 
  * ============================================================================
  */
@@ -41,9 +41,32 @@ g++ -std=c++17 00_function_pointer_basics.cpp -o 00_function_pointer.exe
 #include <map>
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#if defined(__linux__) && defined(__ELF__)
+#include <elf.h>
+#include <fstream>
+#include <iterator>
+#define HAVE_ELF_SYMTAB 1
+#endif
 
 using namespace std;
 
+// 할당 횟수 측정용 전역 operator new 교체 (8단계 벤치마크)
+static size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+    ++allocationCount;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
 namespace patterns {
 
 /* ============================================================================
@@ -199,10 +222,13 @@ public:
 
 class Counter {
     int count = 0;
+    bool verbose;
 public:
+    Counter(bool verbose = true) : verbose(verbose) {}
+    
     void operator()() {
         count++;
-        cout << "  Count: " << count << endl;
+        if (verbose) cout << "  Count: " << count << endl;
     }
     
     int getCount() const { return count; }
@@ -294,11 +320,13 @@ void Step4_Bind() {
  * ============================================================================
  */
 
+// 콜백 저장 타입은 템플릿 인자 (04_callback_pattern.cpp의 InplaceFunction / function_ref도 가능)
+template<typename Callback = function<void()>>
 class Button {
-    function<void()> onClick;
+    Callback onClick;
 public:
-    void setOnClick(function<void()> callback) {
-        onClick = callback;
+    void setOnClick(Callback callback) {
+        onClick = std::move(callback);
     }
     
     void click() {
@@ -364,12 +392,12 @@ void Step5_ClassCallback() {
  * ============================================================================
  */
 
-template<typename T>
+template<typename T, typename Observer = function<void(const T&)>>
 class Observable {
-    vector<function<void(const T&)>> observers;
+    vector<Observer> observers;
 public:
-    void attach(function<void(const T&)> observer) {
-        observers.push_back(observer);
+    void attach(Observer observer) {
+        observers.push_back(std::move(observer));
     }
     
     void notify(const T& data) {
@@ -480,6 +508,35 @@ public:
     }
 };
 
+// 내장 전략: 08_strategy_pattern.cpp의 radixSort / adaptiveSort와 같은 구조 (단일 스레드 축약본)
+class RadixSortStrategy : public SortStrategy {
+public:
+    // 11비트 digit LSD, 부호 비트를 뒤집어 unsigned 순서로
+    void sort(vector<int>& data) override {
+        const size_t BUCKETS = 2048;
+        vector<int> scratch(data.size());
+        vector<int>* from = &data;
+        vector<int>* to = &scratch;
+        for (int shift = 0; shift < 32; shift += 11) {
+            vector<size_t> count(BUCKETS + 1, 0);
+            for (int v : *from) ++count[((static_cast<uint32_t>(v) ^ 0x80000000u) >> shift & (BUCKETS - 1)) + 1];
+            for (size_t b = 0; b < BUCKETS; ++b) count[b + 1] += count[b];
+            for (int v : *from) (*to)[count[(static_cast<uint32_t>(v) ^ 0x80000000u) >> shift & (BUCKETS - 1)]++] = v;
+            swap(from, to);
+        }
+        if (from != &data) data.swap(scratch);
+    }
+};
+
+class AdaptiveSortStrategy : public SortStrategy {
+    RadixSortStrategy radix;
+public:
+    void sort(vector<int>& data) override {
+        if (data.size() >= 4096) radix.sort(data);      // 큰 정수 배열은 radix
+        else std::sort(data.begin(), data.end());
+    }
+};
+
 // 하지만 C++에서는 람다가 더 간단!
 class SimpleSorter {
     function<void(vector<int>&)> strategy;
@@ -553,6 +610,15 @@ void Step7_RealWorld() {
     for (int n : numbers) cout << n << " ";
     cout << endl;
     
+    // 내장 전략 (가상 함수 버전)
+    Sorter builtIn;
+    builtIn.setStrategy(make_unique<AdaptiveSortStrategy>());
+    vector<int> many(10000);
+    for (size_t i = 0; i < many.size(); ++i) many[i] = static_cast<int>((i * 2654435761u) % 20001) - 10000;
+    builtIn.sort(many);
+    cout << "AdaptiveSortStrategy (n=" << many.size() << "): " << many.front() << " .. " << many.back()
+         << (is_sorted(many.begin(), many.end()) ? " (정렬됨)" : " (정렬 안 됨)") << endl;
+    
     cout << "\n💡 C++의 람다는 디자인 패턴을 매우 간결하게 만듭니다!" << endl;
 }
 
@@ -561,6 +627,154 @@ void Step7_RealWorld() {
  * ============================================================================
  */
 
+/*
+ * function_ref - 비소유 콜백 참조 (04_callback_pattern.cpp와 같은 구조, C++17용 enable_if 버전)
+ */
+template<typename Signature>
+class function_ref;
+
+template<typename R, typename... Args>
+class function_ref<R(Args...)> {
+    void* object = nullptr;
+    R (*thunk)(void*, Args&&...) = nullptr;
+public:
+    template<typename F, typename = enable_if_t<!is_same_v<decay_t<F>, function_ref> && is_invocable_r_v<R, F&, Args...>>>
+    function_ref(F&& f) noexcept
+        : object(const_cast<void*>(static_cast<const void*>(addressof(f)))),
+          thunk([](void* o, Args&&... args) -> R {
+              return invoke(*static_cast<remove_reference_t<F>*>(o), forward<Args>(args)...);
+          }) {}
+    R operator()(Args... args) const { return thunk(object, forward<Args>(args)...); }
+};
+
+/*
+ * 호출 방식별 벤치마크
+ *  - inline site : callable을 호출 지점에서 만들어 바로 호출 (컴파일러가 대상 타입/값을 앎)
+ *  - opaque site : callable 주소를 매 반복 asm barrier로 숨김 → 상수 전파/devirtualize 불가
+ *  - 측정: ns/call, 생성~호출 동안 할당 횟수, site 함수의 기계어 크기(ELF 심볼 크기)
+ *  - 결과는 한 줄에 JSON 하나 (JSON Lines)
+ */
+template<typename T>
+static inline void hideFromOptimizer(T*& p) {
+#if defined(__GNUC__)
+    asm volatile("" : "+r"(p));
+#else
+    p = *static_cast<T* volatile*>(&p);
+#endif
+}
+
+class IncrementCommand : public Command {
+    int total = 0;
+public:
+    void execute() override { ++total; }
+    void undo() override { --total; }
+};
+
+int addSeven(int x) { return x + 7; }
+
+template<typename F>
+static int callOnce(F& f, int i) {
+    if constexpr (is_base_of_v<Command, F>) {
+        Command& command = f;
+        command.execute();
+        return 1;
+    } else if constexpr (is_invocable_r_v<int, F&, int>) {
+        return f(i);
+    } else {
+        f();
+        return 1;
+    }
+}
+
+template<typename Make>
+[[gnu::noinline]] long long inlineSite(Make make, int calls) {
+    auto f = make();
+    long long sum = 0;
+    for (int i = 0; i < calls; ++i) sum += callOnce(f, i);
+    return sum;
+}
+
+template<typename Make>
+[[gnu::noinline]] long long opaqueSite(Make make, int calls) {
+    auto f = make();
+    auto* p = &f;
+    long long sum = 0;
+    for (int i = 0; i < calls; ++i) {
+        hideFromOptimizer(p);
+        sum += callOnce(*p, i);
+    }
+    return sum;
+}
+
+#ifdef HAVE_ELF_SYMTAB
+extern "C" char __executable_start;
+
+// /proc/self/exe의 .symtab에서 fn 주소에 해당하는 함수 심볼 크기 (strip된 바이너리면 0)
+static size_t functionCodeBytes(const void* fn) {
+    static const vector<char> image = []() {
+        ifstream in("/proc/self/exe", ios::binary);
+        return vector<char>(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    }();
+    if (image.size() < sizeof(Elf64_Ehdr)) return 0;
+    const auto* header = reinterpret_cast<const Elf64_Ehdr*>(image.data());
+    if (memcmp(header->e_ident, ELFMAG, SELFMAG) != 0 || header->e_ident[EI_CLASS] != ELFCLASS64) return 0;
+    // PIE 로드 오프셋 = 실제 이미지 시작 - 첫 PT_LOAD의 vaddr
+    const auto* segments = reinterpret_cast<const Elf64_Phdr*>(image.data() + header->e_phoff);
+    uintptr_t firstLoad = UINTPTR_MAX;
+    for (int i = 0; i < header->e_phnum; ++i)
+        if (segments[i].p_type == PT_LOAD) firstLoad = min<uintptr_t>(firstLoad, segments[i].p_vaddr);
+    uintptr_t target = reinterpret_cast<uintptr_t>(fn) - (reinterpret_cast<uintptr_t>(&__executable_start) - firstLoad);
+    const auto* sections = reinterpret_cast<const Elf64_Shdr*>(image.data() + header->e_shoff);
+    for (int i = 0; i < header->e_shnum; ++i) {
+        if (sections[i].sh_type != SHT_SYMTAB) continue;
+        const auto* symbols = reinterpret_cast<const Elf64_Sym*>(image.data() + sections[i].sh_offset);
+        for (size_t s = 0; s < sections[i].sh_size / sizeof(Elf64_Sym); ++s)
+            if (ELF64_ST_TYPE(symbols[s].st_info) == STT_FUNC && symbols[s].st_value == target) return symbols[s].st_size;
+    }
+    return 0;
+}
+#else
+static size_t functionCodeBytes(const void*) { return 0; }
+#endif
+
+template<typename Make>
+static void benchmarkCallable(const char* name, Make make) {
+    constexpr int CALLS = 1000000;
+    size_t stateBytes = sizeof(decltype(make()));
+    auto measure = [&](const char* site, long long (*run)(Make, int)) {
+        run(make, 1000);        // warm-up
+        size_t before = allocationCount;
+        auto start = chrono::steady_clock::now();
+        long long sum = run(make, CALLS);
+        double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / CALLS;
+        size_t allocations = allocationCount - before;
+        cout << "{\"callable\":\"" << name << "\",\"site\":\"" << site << "\",\"ns_per_call\":" << ns
+             << ",\"allocations\":" << allocations << ",\"code_bytes\":"
+             << functionCodeBytes(reinterpret_cast<const void*>(run)) << ",\"state_bytes\":" << stateBytes
+             << ",\"checksum\":" << sum << "}" << endl;
+    };
+    measure("inline", &inlineSite<Make>);
+    measure("opaque", &opaqueSite<Make>);
+}
+
+void Step8_Benchmark() {
+    cout << "\n[Benchmark: 호출 방식별 비용 (JSON Lines)]" << endl;
+    int offset = 7;
+    int a = 1, b = 2, c = 3, d = 4, e = 5;
+    auto lambda = [offset](int x) { return x + offset; };
+    auto largeLambda = [=](int x) { return x + a + b + c + d + e + offset; };   // 24바이트 → std::function SBO 초과
+    
+    benchmarkCallable("function_pointer", []() { return &addSeven; });
+    benchmarkCallable("lambda_template", [&]() { return lambda; });
+    benchmarkCallable("functor_adder", [&]() { return Adder(offset); });
+    benchmarkCallable("functor_counter", []() { return Counter(false); });
+    benchmarkCallable("std_bind", [&]() { return bind(plus<int>(), placeholders::_1, offset); });
+    benchmarkCallable("std_function_small", [&]() { return function<int(int)>(lambda); });
+    benchmarkCallable("std_function_large", [&]() { return function<int(int)>(largeLambda); });
+    benchmarkCallable("virtual_command", []() { return IncrementCommand(); });
+    benchmarkCallable("function_ref", [&]() { return function_ref<int(int)>(lambda); });
+}
+
 void Step8_Comparison() {
     cout << "\n";
     cout << "========================================" << endl;
@@ -589,7 +803,7 @@ void Step8_Comparison() {
     cout << "  ✓ 타입 안전" << endl;
     cout << "  ✓ 람다 캡처로 상태 보유" << endl;
     cout << "  ✓ 유연하고 표현력 높음" << endl;
-    cout << "  ✗ 오버헤드 존재 (가상 함수 호출)" << endl;
+    cout << "  ✗ 간접 호출 + 큰 캡처는 heap 할당 (아래 측정)" << endl;
     cout << "  ✗ 임베디드에는 과할 수 있음" << endl;
     
     cout << "\n언제 무엇을 사용할까?" << endl;
@@ -597,6 +811,8 @@ void Step8_Comparison() {
     cout << "  • 애플리케이션, 유연성 중요 → C++ std::function" << endl;
     cout << "  • 간단한 콜백 → 람다" << endl;
     cout << "  • 복잡한 상태 → 함수 객체" << endl;
+    
+    Step8_Benchmark();
 }
 
 } // namespace patterns
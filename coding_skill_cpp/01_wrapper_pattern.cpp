@@ -26,6 +26,28 @@
 #include <chrono>
 #include <vector>
 #include <functional>
+#include <mutex>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <cstdint>
+#include <iomanip>
+#include <thread>
+#include <type_traits>
+#include <charconv>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <string_view>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#define HAVE_POSIX_IO 1
+#endif
 
 using namespace std;
 using namespace chrono;
@@ -169,8 +191,10 @@ public:
     }
 };
 
+// 첫 호출이 여러 스레드에서 동시에 와도 리소스는 한 번만 생성 (call_once)
 class ResourceProxy {
     unique_ptr<ExpensiveResource> resource;
+    once_flag created;
     
 public:
     ResourceProxy() : resource(nullptr) {
@@ -178,10 +202,10 @@ public:
     }
     
     void doWork() {
-        if (!resource) {
+        call_once(created, [this]() {
             cout << "[Proxy] 첫 호출! 리소스 생성" << endl;
             resource = make_unique<ExpensiveResource>();
-        }
+        });
         resource->doWork();
     }
 };
@@ -238,6 +262,348 @@ public:
     }
 };
 
+/*
+ * 비동기 로거 백엔드
+ *  - 호출자: 포맷 문자열 포인터 + 인자 값만 per-thread SPSC 큐에 복사 (포맷/쓰기 없음)
+ *  - 백그라운드 스레드: 모든 큐를 비우면서 포맷, 포맷 문자열의 리터럴 조각은 복사 없이
+ *    iovec으로 가리키고 writev 한 번에 배치 전송
+ *  - 큐가 가득 차면 Backpressure 정책: Drop(버리고 카운트) 또는 Block(공간 날 때까지 대기)
+ *  - installCrashHandler: 치명적 시그널/terminate 시 남은 레코드를 호출 스레드에서 직접 flush
+ */
+enum class LogArgType : uint8_t { Int, UInt, Double, Text };
+
+struct LogRecord {
+    static constexpr size_t MAX_ARGS = 4;
+    static constexpr size_t TEXT_BYTES = 88;     // 문자열 인자 복사 공간 (넘치면 잘림)
+    const char* format;                         // 정적 문자열 = 포맷 ID
+    uint64_t timestampNs;
+    int64_t values[MAX_ARGS];                   // Text면 (offset << 8) | length
+    LogArgType types[MAX_ARGS];
+    uint8_t argCount;
+    uint8_t textUsed;
+    char text[TEXT_BYTES];
+
+    template<typename T>
+    void capture(const T& value) {
+        if (argCount == MAX_ARGS) return;
+        size_t i = argCount++;
+        if constexpr (is_integral_v<T> && is_signed_v<T>) {
+            types[i] = LogArgType::Int;
+            values[i] = value;
+        } else if constexpr (is_integral_v<T>) {
+            types[i] = LogArgType::UInt;
+            values[i] = static_cast<int64_t>(static_cast<uint64_t>(value));
+        } else if constexpr (is_floating_point_v<T>) {
+            types[i] = LogArgType::Double;
+            values[i] = bit_cast<int64_t>(static_cast<double>(value));
+        } else {
+            string_view sv(value);
+            size_t length = min(sv.size(), TEXT_BYTES - textUsed);
+            memcpy(text + textUsed, sv.data(), length);
+            types[i] = LogArgType::Text;
+            values[i] = static_cast<int64_t>(textUsed) << 8 | static_cast<int64_t>(length);
+            textUsed = static_cast<uint8_t>(textUsed + length);
+        }
+    }
+};
+
+class ThreadLogQueue {
+    static constexpr uint32_t CAPACITY = 1024;
+    array<LogRecord, CAPACITY> records;
+    alignas(64) atomic<uint32_t> head{0};       // 생산자
+    alignas(64) atomic<uint32_t> tail{0};       // 소비자
+public:
+    ThreadLogQueue* next = nullptr;             // AsyncLogger의 큐 목록 (등록 전에 정해지고 이후 불변)
+
+    LogRecord* reserve() {
+        uint32_t h = head.load(memory_order_relaxed);
+        return h - tail.load(memory_order_acquire) == CAPACITY ? nullptr : &records[h % CAPACITY];
+    }
+    void commit() { head.store(head.load(memory_order_relaxed) + 1, memory_order_release); }
+    bool almostFull() const {
+        return head.load(memory_order_relaxed) - tail.load(memory_order_relaxed) >= CAPACITY * 3 / 4;
+    }
+
+    // 소비자 전용: 레코드를 하나씩 넘기고, consume이 false면 거기서 멈춤 (남은 것은 다음 flush)
+    template<typename Consume>
+    void drain(Consume consume) {
+        uint32_t t = tail.load(memory_order_relaxed);
+        uint32_t h = head.load(memory_order_acquire);
+        while (t != h && consume(records[t % CAPACITY])) ++t;
+        tail.store(t, memory_order_release);
+    }
+};
+
+class AsyncLogger {
+public:
+    enum class Backpressure { Drop, Block };
+    struct Options {
+        int fd = 1;
+        Backpressure policy = Backpressure::Drop;
+        milliseconds flushInterval{5};
+    };
+
+    explicit AsyncLogger(Options options) : options(options), start(steady_clock::now()), writer([this]() { run(); }) {}
+
+    ~AsyncLogger() {
+        {
+            lock_guard<mutex> guard(wakeLock);
+            stopping = true;
+        }
+        wake.notify_one();
+        writer.join();
+        if (crashTarget == this) crashTarget = nullptr;
+        for (ThreadLogQueue* queue = queues.load(memory_order_acquire); queue;) {
+            ThreadLogQueue* next = queue->next;
+            delete queue;
+            queue = next;
+        }
+    }
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    // format은 정적 수명이어야 함 (문자열 리터럴), "{}" 자리에 인자가 들어감
+    template<size_t N, typename... Args>
+    void log(const char (&format)[N], const Args&... args) {
+        static_assert(sizeof...(Args) <= LogRecord::MAX_ARGS, "too many log arguments");
+        ThreadLogQueue& queue = threadQueue();
+        LogRecord* record = queue.reserve();
+        while (!record) {
+            if (options.policy == Backpressure::Drop) {
+                droppedCount.fetch_add(1, memory_order_relaxed);
+                return;
+            }
+            wake.notify_one();
+            this_thread::yield();
+            record = queue.reserve();
+        }
+        record->format = format;
+        record->timestampNs = static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+        record->argCount = 0;
+        record->textUsed = 0;
+        (record->capture(args), ...);
+        queue.commit();
+        if (queue.almostFull()) wake.notify_one();
+    }
+
+    // 지금까지 push된 레코드가 모두 써질 때까지 대기
+    void flush() {
+        unique_lock<mutex> guard(wakeLock);
+        uint64_t target = ++flushRequested;
+        wake.notify_one();
+        flushed.wait(guard, [&]() { return flushCompleted >= target; });
+    }
+
+    uint64_t dropped() const { return droppedCount.load(memory_order_relaxed); }
+    uint64_t writevCalls() const { return writes.load(memory_order_relaxed); }
+
+    static void installCrashHandler(AsyncLogger& logger) {
+        crashTarget = &logger;
+#ifdef HAVE_POSIX_IO
+        for (int sig : {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT}) signal(sig, onFatalSignal);
+#endif
+        set_terminate([]() {
+            if (AsyncLogger* target = crashTarget) target->emergencyFlush();
+            abort();
+        });
+    }
+
+    // 크래시 경로: 할당 없이 정적 버퍼로 포맷, writer 스레드가 버퍼를 잡고 있으면 잠깐 기다렸다 포기
+    void emergencyFlush() noexcept {
+        for (int spin = 0; consumerBusy.test_and_set(memory_order_acquire); ++spin) {
+            if (spin > 100000) return;
+        }
+        static char arena[ARENA_BYTES];
+        static iovec iov[MAX_IOV];
+        Batch batch{arena, iov};
+        drainAll(batch);
+        consumerBusy.clear(memory_order_release);
+    }
+
+private:
+    static constexpr size_t ARENA_BYTES = 64 * 1024;
+    static constexpr size_t MAX_IOV = 1024;
+
+#ifndef HAVE_POSIX_IO
+    struct iovec {
+        void* iov_base;
+        size_t iov_len;
+    };
+#endif
+
+    // 한 번의 writev로 나갈 조각들: 숫자/접두어는 arena에, 리터럴은 포맷 문자열을 직접 가리킴
+    struct Batch {
+        char* arena;
+        iovec* iov;
+        size_t used = 0;
+        size_t count = 0;
+    };
+
+    static constexpr size_t RECORD_WORST_IOV = 2 * LogRecord::MAX_ARGS + 3;
+    static constexpr size_t RECORD_WORST_BYTES = 32 + LogRecord::MAX_ARGS * 32 + LogRecord::TEXT_BYTES;
+
+    Options options;
+    steady_clock::time_point start;
+    atomic<ThreadLogQueue*> queues{nullptr};    // 앞에 끼워 넣기만 하는 lock-free 목록 (시그널 핸들러에서도 순회)
+    atomic_flag consumerBusy = ATOMIC_FLAG_INIT;
+    atomic<uint64_t> droppedCount{0};
+    atomic<uint64_t> writes{0};
+    uint64_t reportedDrops = 0;
+    const uint64_t id = nextId.fetch_add(1);
+
+    mutex wakeLock;
+    condition_variable wake;
+    condition_variable flushed;
+    bool stopping = false;
+    uint64_t flushRequested = 0;
+    uint64_t flushCompleted = 0;
+    thread writer;                              // 마지막 멤버: 나머지가 모두 생성된 뒤 시작
+
+    static inline atomic<uint64_t> nextId{1};
+    static inline AsyncLogger* crashTarget = nullptr;
+
+#ifdef HAVE_POSIX_IO
+    static void onFatalSignal(int sig) {
+        if (AsyncLogger* target = crashTarget) target->emergencyFlush();
+        signal(sig, SIG_DFL);
+        raise(sig);
+    }
+#endif
+
+    ThreadLogQueue& threadQueue() {
+        thread_local vector<pair<uint64_t, ThreadLogQueue*>> mine;     // (logger id, queue)
+        for (auto& [owner, queue] : mine)
+            if (owner == id) return *queue;
+        ThreadLogQueue* queue = new ThreadLogQueue;
+        queue->next = queues.load(memory_order_relaxed);
+        while (!queues.compare_exchange_weak(queue->next, queue, memory_order_release, memory_order_relaxed)) {}
+        mine.emplace_back(id, queue);
+        return *queue;
+    }
+
+    void pushPiece(Batch& batch, const char* data, size_t length) {
+        if (length == 0) return;
+        batch.iov[batch.count].iov_base = const_cast<char*>(data);
+        batch.iov[batch.count].iov_len = length;
+        ++batch.count;
+    }
+
+    void pushArena(Batch& batch, const char* data, size_t length) {
+        memcpy(batch.arena + batch.used, data, length);
+        pushPiece(batch, batch.arena + batch.used, length);
+        batch.used += length;
+    }
+
+    void appendArg(Batch& batch, const LogRecord& r, size_t i) {
+        char number[32];
+        char* end = number;
+        switch (r.types[i]) {
+        case LogArgType::Int: end = to_chars(number, number + sizeof number, r.values[i]).ptr; break;
+        case LogArgType::UInt: end = to_chars(number, number + sizeof number, static_cast<uint64_t>(r.values[i])).ptr; break;
+        case LogArgType::Double: end = to_chars(number, number + sizeof number, bit_cast<double>(r.values[i])).ptr; break;
+        case LogArgType::Text:
+            pushArena(batch, r.text + (r.values[i] >> 8), static_cast<size_t>(r.values[i] & 0xFF));
+            return;
+        }
+        pushArena(batch, number, static_cast<size_t>(end - number));
+    }
+
+    void appendRecord(Batch& batch, const LogRecord& r) {
+        char prefix[32];
+        int length = snprintf(prefix, sizeof prefix, "[%8.3f ms] ", r.timestampNs / 1e6);
+        pushArena(batch, prefix, static_cast<size_t>(max(length, 0)));
+        const char* literal = r.format;
+        size_t arg = 0;
+        for (const char* p = r.format; *p; ++p) {
+            if (p[0] == '{' && p[1] == '}' && arg < r.argCount) {
+                pushPiece(batch, literal, static_cast<size_t>(p - literal));
+                appendArg(batch, r, arg++);
+                literal = ++p + 1;
+            }
+        }
+        pushPiece(batch, literal, strlen(literal));
+        pushPiece(batch, "\n", 1);
+    }
+
+    void writeBatch(Batch& batch) {
+        if (batch.count == 0) return;
+#ifdef HAVE_POSIX_IO
+        size_t index = 0;
+        while (index < batch.count) {
+            ssize_t n = ::writev(options.fd, batch.iov + index, static_cast<int>(batch.count - index));
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                break;                          // 로그 쓰기 실패는 호출자에게 전파하지 않음
+            }
+            writes.fetch_add(1, memory_order_relaxed);
+            // 부분 쓰기: 다 나간 iovec은 건너뛰고 걸친 것은 앞부분을 잘라냄
+            size_t left = static_cast<size_t>(n);
+            for (; index < batch.count && left >= batch.iov[index].iov_len; ++index) left -= batch.iov[index].iov_len;
+            if (index < batch.count) {
+                batch.iov[index].iov_base = static_cast<char*>(batch.iov[index].iov_base) + left;
+                batch.iov[index].iov_len -= left;
+            }
+        }
+#else
+        for (size_t i = 0; i < batch.count; ++i) fwrite(batch.iov[i].iov_base, 1, batch.iov[i].iov_len, stdout);
+        writes.fetch_add(1, memory_order_relaxed);
+#endif
+        batch.used = 0;
+        batch.count = 0;
+    }
+
+    // 할당 / 잠금 없음: emergencyFlush가 시그널 핸들러에서도 부름
+    void drainAll(Batch& batch) {
+        for (ThreadLogQueue* queue = queues.load(memory_order_acquire); queue; queue = queue->next) {
+            queue->drain([&](const LogRecord& r) {
+                if (batch.count + RECORD_WORST_IOV > MAX_IOV || batch.used + RECORD_WORST_BYTES > ARENA_BYTES)
+                    writeBatch(batch);
+                appendRecord(batch, r);
+                return true;
+            });
+        }
+        uint64_t drops = droppedCount.load(memory_order_relaxed);
+        if (drops != reportedDrops) {
+            char note[64];
+            int length = snprintf(note, sizeof note, "[async-log] %llu records dropped\n",
+                                  static_cast<unsigned long long>(drops - reportedDrops));
+            if (batch.count + 1 > MAX_IOV || batch.used + sizeof note > ARENA_BYTES) writeBatch(batch);
+            pushArena(batch, note, static_cast<size_t>(max(length, 0)));
+            reportedDrops = drops;
+        }
+        writeBatch(batch);
+    }
+
+    void run() {
+        vector<char> arena(ARENA_BYTES);
+        vector<iovec> iov(MAX_IOV);
+        Batch batch{arena.data(), iov.data()};
+        unique_lock<mutex> guard(wakeLock);
+        for (;;) {
+            wake.wait_for(guard, options.flushInterval);
+            bool exiting = stopping;
+            uint64_t target = flushRequested;
+            guard.unlock();
+            while (consumerBusy.test_and_set(memory_order_acquire)) this_thread::yield();
+            drainAll(batch);
+            consumerBusy.clear(memory_order_release);
+            guard.lock();
+            flushCompleted = target;
+            flushed.notify_all();
+            if (exiting) return;
+        }
+    }
+};
+
+// ILogger 어댑터: 기존 log(const string&) 호출을 비동기 백엔드로 (메시지는 88바이트까지 복사)
+class AsyncLoggerAdapter : public ILogger {
+    AsyncLogger& backend;
+public:
+    explicit AsyncLoggerAdapter(AsyncLogger& backend) : backend(backend) {}
+    void log(const string& message) override { backend.log("[Async] {}", message); }
+};
+
 /* ============================================================================
  * 6. PIMPL (Pointer to Implementation) 패턴
  * ============================================================================
@@ -269,37 +635,352 @@ public:
     }
 };
 
+/*
+ * FastPimpl<T, Size, Align> - heap 없는 PIMPL
+ *  - 구현 객체를 래퍼 안의 정렬된 버퍼에 직접 생성 (할당/간접 참조 제거)
+ *  - 헤더에는 Size/Align 숫자만 노출 → T 정의는 여전히 .cpp에 숨김
+ *  - 생성자/소멸자가 인스턴스화되는 곳(.cpp, T가 완전한 타입)에서 static_assert로 크기/정렬 검사
+ *    → 구현이 커지면 컴파일 에러 메시지가 필요한 Size를 알려줌
+ */
+template<typename T, size_t Size, size_t Align = alignof(max_align_t)>
+class FastPimpl {
+    alignas(Align) unsigned char storage[Size];
+    
+    template<size_t ActualSize, size_t ActualAlign>
+    static constexpr void validate() {
+        static_assert(ActualSize <= Size, "FastPimpl: Size too small for T (see ActualSize)");
+        static_assert(Align % ActualAlign == 0, "FastPimpl: Align is not a multiple of alignof(T)");
+    }
+    
+    T* get() noexcept { return launder(reinterpret_cast<T*>(storage)); }
+    const T* get() const noexcept { return launder(reinterpret_cast<const T*>(storage)); }
+    
+public:
+    // 인자 하나가 FastPimpl 자신이면 제외 → non-const lvalue 복사가 이 생성자로 새지 않고 복사 생성자로
+    template<typename... Args>
+        requires(!(sizeof...(Args) == 1 && (is_same_v<remove_cvref_t<Args>, FastPimpl> && ...)))
+    explicit FastPimpl(Args&&... args) {
+        validate<sizeof(T), alignof(T)>();
+        ::new (static_cast<void*>(storage)) T(forward<Args>(args)...);
+    }
+    FastPimpl(const FastPimpl& other) { ::new (static_cast<void*>(storage)) T(*other); }
+    FastPimpl(FastPimpl&& other) noexcept { ::new (static_cast<void*>(storage)) T(std::move(*other)); }
+    FastPimpl& operator=(const FastPimpl& other) {
+        **this = *other;
+        return *this;
+    }
+    FastPimpl& operator=(FastPimpl&& other) noexcept {
+        **this = std::move(*other);
+        return *this;
+    }
+    ~FastPimpl() {
+        validate<sizeof(T), alignof(T)>();
+        get()->~T();
+    }
+    
+    T* operator->() noexcept { return get(); }
+    const T* operator->() const noexcept { return get(); }
+    T& operator*() noexcept { return *get(); }
+    const T& operator*() const noexcept { return *get(); }
+};
+
+// ---- 헤더에 노출되는 부분: 구현 타입은 선언만 ----
+class FastWidgetImpl;
+
+class FastWidget {
+    FastPimpl<FastWidgetImpl, 32, 8> impl;
+public:
+    explicit FastWidget(int id);
+    ~FastWidget();
+    FastWidget(FastWidget&&) noexcept;
+    FastWidget& operator=(FastWidget&&) noexcept;
+    void record(double sample);
+    double average() const;
+};
+
+// 비교용: 같은 인터페이스의 heap PIMPL
+class HeapWidgetImpl;
+
+class HeapWidget {
+    unique_ptr<HeapWidgetImpl> impl;
+public:
+    explicit HeapWidget(int id);
+    ~HeapWidget();
+    HeapWidget(HeapWidget&&) noexcept;
+    HeapWidget& operator=(HeapWidget&&) noexcept;
+    void record(double sample);
+    double average() const;
+};
+
+// ---- .cpp에 숨겨지는 부분 ----
+struct WidgetStats {
+    int id;
+    uint32_t samples = 0;
+    double sum = 0;
+    double last = 0;
+    
+    explicit WidgetStats(int id) : id(id) {}
+    void record(double sample) {
+        ++samples;
+        sum += sample;
+        last = sample;
+    }
+    double average() const { return samples ? sum / samples : 0; }
+};
+
+class FastWidgetImpl : public WidgetStats {
+    using WidgetStats::WidgetStats;
+};
+class HeapWidgetImpl : public WidgetStats {
+    using WidgetStats::WidgetStats;
+};
+
+FastWidget::FastWidget(int id) : impl(id) {}
+FastWidget::~FastWidget() = default;
+FastWidget::FastWidget(FastWidget&&) noexcept = default;
+FastWidget& FastWidget::operator=(FastWidget&&) noexcept = default;
+void FastWidget::record(double sample) { impl->record(sample); }
+double FastWidget::average() const { return impl->average(); }
+
+HeapWidget::HeapWidget(int id) : impl(make_unique<HeapWidgetImpl>(id)) {}
+HeapWidget::~HeapWidget() = default;
+HeapWidget::HeapWidget(HeapWidget&&) noexcept = default;
+HeapWidget& HeapWidget::operator=(HeapWidget&&) noexcept = default;
+void HeapWidget::record(double sample) { impl->record(sample); }
+double HeapWidget::average() const { return impl->average(); }
+
+// N개 생성 → 접근 (stride로 흩어 읽기) → 소멸
+template<typename W>
+static void benchmarkPimpl(const char* name, size_t count) {
+    auto t0 = steady_clock::now();
+    {
+        vector<W> widgets;
+        widgets.reserve(count);
+        for (size_t i = 0; i < count; ++i) widgets.emplace_back(static_cast<int>(i));
+        auto t1 = steady_clock::now();
+        for (int round = 0; round < 4; ++round)
+            for (size_t i = 0; i < count; ++i) widgets[(i * 7919) % count].record(static_cast<double>(i & 1023));
+        double total = 0;
+        for (const auto& w : widgets) total += w.average();
+        auto t2 = steady_clock::now();
+        cout << "  " << name << ": construct " << duration<double, milli>(t1 - t0).count() << " ms, access "
+             << duration<double, milli>(t2 - t1).count() << " ms, sizeof " << sizeof(W) << " (checksum " << total
+             << ")" << endl;
+    }
+    cout << "    total incl. destroy " << duration<double, milli>(steady_clock::now() - t0).count() << " ms" << endl;
+}
+
 /* ============================================================================
  * 7. 함수 래퍼 - 성능 측정
  * ============================================================================
  */
 
-template<typename Func>
+/*
+ * LatencyHistogram - HDR 방식 log-linear 히스토그램 (ns 단위)
+ *  - 2의 거듭제곱 구간마다 16개 sub-bucket → 상대 오차 1/16 이내, 0..31ns는 정확
+ *  - 976개 고정 bucket, 할당 없음
+ *  - 주인 스레드만 기록 (relaxed load+store, RMW 없음), 다른 스레드는 relaxed load로 읽기만
+ */
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BITS = 4;
+    static constexpr size_t SUB_COUNT = size_t{1} << SUB_BITS;
+    static constexpr size_t BUCKETS = (64 - SUB_BITS - 1) * SUB_COUNT + 2 * SUB_COUNT;  // = 976
+
+    static constexpr size_t indexOf(uint64_t ns) {
+        unsigned width = static_cast<unsigned>(bit_width(ns));
+        unsigned shift = width > SUB_BITS + 1 ? width - (SUB_BITS + 1) : 0;
+        return shift * SUB_COUNT + static_cast<size_t>(ns >> shift);
+    }
+
+    // bucket에 들어가는 가장 큰 값 (HDR의 highest equivalent value)
+    static constexpr uint64_t highestValueOf(size_t index) {
+        unsigned shift = index < 2 * SUB_COUNT ? 0 : static_cast<unsigned>(index / SUB_COUNT - 1);
+        uint64_t mantissa = index - shift * SUB_COUNT;
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+    void record(uint64_t ns) {
+        bump(counts[indexOf(ns)], 1);
+        bump(total, 1);
+        if (ns > maxNs.load(memory_order_relaxed)) maxNs.store(ns, memory_order_relaxed);
+    }
+
+    // 다른 히스토그램(다른 스레드 것 포함) 값을 더함
+    void addTo(array<uint64_t, BUCKETS>& merged, uint64_t& count, uint64_t& max) const {
+        for (size_t i = 0; i < BUCKETS; ++i) merged[i] += counts[i].load(memory_order_relaxed);
+        count += total.load(memory_order_relaxed);
+        max = std::max(max, maxNs.load(memory_order_relaxed));
+    }
+
+private:
+    static void bump(atomic<uint64_t>& counter, uint64_t delta) {
+        counter.store(counter.load(memory_order_relaxed) + delta, memory_order_relaxed);
+    }
+    array<atomic<uint64_t>, BUCKETS> counts{};
+    atomic<uint64_t> total{0};
+    atomic<uint64_t> maxNs{0};
+};
+static_assert(LatencyHistogram::indexOf(UINT64_MAX) == LatencyHistogram::BUCKETS - 1);
+
+struct LatencySnapshot {
+    string name;
+    uint64_t count = 0;
+    uint64_t p50 = 0, p99 = 0, p999 = 0, max = 0;
+};
+
+/*
+ * TimingRegistry - 이름별 시계열 ID + 스레드별 히스토그램 목록
+ *  - 이름 → ID는 래퍼 생성 시 한 번 (mutex)
+ *  - 각 스레드는 thread_local 배열에서 ID로 자기 히스토그램을 찾음, 처음 한 번만 등록(lock)
+ *  - snapshot은 같은 이름의 모든 스레드 히스토그램을 합산
+ */
+class TimingRegistry {
+    mutex lock;
+    vector<string> names;
+    vector<vector<unique_ptr<LatencyHistogram>>> perThread;    // [id][thread]
+
+    LatencyHistogram& registerThread(size_t id) {
+        lock_guard<mutex> guard(lock);
+        perThread[id].push_back(make_unique<LatencyHistogram>());
+        return *perThread[id].back();
+    }
+
+    LatencySnapshot summarize(size_t id) {
+        array<uint64_t, LatencyHistogram::BUCKETS> merged{};
+        LatencySnapshot snap;
+        snap.name = names[id];
+        for (auto& histogram : perThread[id]) histogram->addTo(merged, snap.count, snap.max);
+        auto percentile = [&](double p) -> uint64_t {
+            if (snap.count == 0) return 0;
+            uint64_t rank = static_cast<uint64_t>(p / 100.0 * (snap.count - 1)) + 1, seen = 0;
+            for (size_t i = 0; i < merged.size(); ++i)
+                if ((seen += merged[i]) >= rank) return std::min(LatencyHistogram::highestValueOf(i), snap.max);
+            return snap.max;
+        };
+        snap.p50 = percentile(50);
+        snap.p99 = percentile(99);
+        snap.p999 = percentile(99.9);
+        return snap;
+    }
+
+public:
+    static TimingRegistry& instance() {
+        static TimingRegistry registry;
+        return registry;
+    }
+
+    size_t idFor(const string& name) {
+        lock_guard<mutex> guard(lock);
+        for (size_t i = 0; i < names.size(); ++i)
+            if (names[i] == name) return i;
+        names.push_back(name);
+        perThread.emplace_back();
+        return names.size() - 1;
+    }
+
+    LatencyHistogram& threadHistogram(size_t id) {
+        thread_local vector<LatencyHistogram*> mine;
+        if (id >= mine.size()) mine.resize(id + 1, nullptr);
+        if (!mine[id]) mine[id] = &registerThread(id);
+        return *mine[id];
+    }
+
+    LatencySnapshot snapshot(const string& name) {
+        size_t id = idFor(name);
+        lock_guard<mutex> guard(lock);
+        return summarize(id);
+    }
+
+    vector<LatencySnapshot> snapshotAll() {
+        lock_guard<mutex> guard(lock);
+        vector<LatencySnapshot> all;
+        for (size_t id = 0; id < names.size(); ++id) all.push_back(summarize(id));
+        return all;
+    }
+};
+
+inline void printLatency(const LatencySnapshot& s) {
+    cout << "[Timing] " << left << setw(16) << s.name << right << " n=" << s.count << " p50=" << s.p50
+         << "ns p99=" << s.p99 << "ns p999=" << s.p999 << "ns max=" << s.max << "ns" << endl;
+}
+
+/*
+ * TimingDumper - period마다 모든 시계열 snapshot을 sink로 넘김 (기본: printLatency)
+ *  - 누적값 기준, 소멸 시 스레드 정지
+ */
+class TimingDumper {
+    mutex lock;
+    condition_variable stopRequested;
+    bool stopping = false;
+    thread worker;
+public:
+    explicit TimingDumper(milliseconds period, function<void(const LatencySnapshot&)> sink = printLatency)
+        : worker([this, period, sink]() {
+              unique_lock<mutex> guard(lock);
+              while (!stopRequested.wait_for(guard, period, [this]() { return stopping; })) {
+                  guard.unlock();
+                  for (const auto& s : TimingRegistry::instance().snapshotAll()) sink(s);
+                  guard.lock();
+              }
+          }) {}
+    ~TimingDumper() {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+        }
+        stopRequested.notify_one();
+        worker.join();
+    }
+};
+
+// Print: 호출마다 cout (데모용), Histogram: thread-local 히스토그램에 ns 기록 (상시 계측용)
+enum class TimingMode { Print, Histogram };
+
+// Clock: now()가 있는 chrono 호환 시계 (hot path면 coarse/TSC 시계로 교체, 23_watchdog_pattern.cpp 참고)
+template<typename Func, typename Clock = high_resolution_clock, TimingMode Mode = TimingMode::Print>
 class TimingWrapper {
     Func func;
     string name;
+    size_t seriesId = 0;
+    
+    // 소멸자에서 측정 → void 반환/예외도 같은 경로로 처리
+    struct Stopwatch {
+        const TimingWrapper& owner;
+        typename Clock::time_point start = Clock::now();
+        ~Stopwatch() {
+            auto elapsed = Clock::now() - start;
+            if constexpr (Mode == TimingMode::Histogram) {
+                auto ns = duration_cast<nanoseconds>(elapsed).count();
+                TimingRegistry::instance().threadHistogram(owner.seriesId).record(ns > 0 ? static_cast<uint64_t>(ns) : 0);
+            } else {
+                cout << "[Timing] " << owner.name << " took "
+                     << duration_cast<microseconds>(elapsed).count() << " μs" << endl;
+            }
+        }
+    };
     
 public:
     TimingWrapper(Func f, const string& name)
-        : func(f), name(name) {}
+        : func(f), name(name) {
+        if constexpr (Mode == TimingMode::Histogram) seriesId = TimingRegistry::instance().idFor(name);
+    }
     
     template<typename... Args>
-    auto operator()(Args&&... args) {
-        auto start = high_resolution_clock::now();
-        auto result = func(forward<Args>(args)...);
-        auto end = high_resolution_clock::now();
-        
-        auto duration = duration_cast<microseconds>(end - start);
-        cout << "[Timing] " << name << " took " 
-             << duration.count() << " μs" << endl;
-        
-        return result;
+    decltype(auto) operator()(Args&&... args) {
+        Stopwatch stopwatch{*this};
+        return func(forward<Args>(args)...);
     }
 };
 
-template<typename Func>
+template<typename Clock = high_resolution_clock, typename Func>
 auto makeTimingWrapper(Func func, const string& name) {
-    return TimingWrapper<Func>(func, name);
+    return TimingWrapper<Func, Clock>(func, name);
+}
+
+template<typename Clock = steady_clock, typename Func>
+auto makeHistogramTimer(Func func, const string& name) {
+    return TimingWrapper<Func, Clock, TimingMode::Histogram>(func, name);
 }
 
 /* ============================================================================
@@ -363,6 +1044,47 @@ void demo_interface_wrapper() {
     
     wrapped->log("시스템 시작");
     wrapped->log("작업 완료");
+    
+    cout << "\n=== 비동기 로거 백엔드 ===" << endl;
+    cout.flush();       // 같은 fd(stdout)에 writev로 쓰므로 먼저 비움
+    {
+        AsyncLogger backend({});
+        AsyncLogger::installCrashHandler(backend);
+        AsyncLoggerAdapter asyncLogger(backend);
+        ILogger& logger = asyncLogger;
+        logger.log("시스템 시작");
+        backend.log("request {} took {} ms (status {})", 42, 3.25, "ok");
+        backend.flush();
+    }
+    
+#ifdef HAVE_POSIX_IO
+    cout << "\n[Benchmark: 호출자 측 비용, /dev/null 출력]" << endl;
+    constexpr int MESSAGES = 20000;
+    auto measure = [](const char* name, auto&& logOnce) {
+        double worst = 0;
+        auto begin = steady_clock::now();
+        for (int i = 0; i < MESSAGES; ++i) {
+            auto t0 = steady_clock::now();
+            logOnce(i);
+            worst = max(worst, duration<double, micro>(steady_clock::now() - t0).count());
+        }
+        double avg = duration<double, nano>(steady_clock::now() - begin).count() / MESSAGES;
+        cout << "  " << name << ": " << avg << " ns/call avg, worst " << worst << " us" << endl;
+    };
+    {
+        FileLogger file("/dev/null");
+        measure("FileLogger (sync)  ", [&](int i) { file.log("request " + to_string(i) + " done"); });
+    }
+    int devNull = ::open("/dev/null", O_WRONLY);
+    for (auto policy : {AsyncLogger::Backpressure::Drop, AsyncLogger::Backpressure::Block}) {
+        AsyncLogger backend({devNull, policy, milliseconds(1)});
+        measure(policy == AsyncLogger::Backpressure::Drop ? "AsyncLogger (drop) " : "AsyncLogger (block)",
+                [&](int i) { backend.log("request {} done", i); });
+        backend.flush();
+        cout << "    writev calls " << backend.writevCalls() << ", dropped " << backend.dropped() << endl;
+    }
+    ::close(devNull);
+#endif
 }
 
 void demo_pimpl() {
@@ -370,6 +1092,15 @@ void demo_pimpl() {
     
     Widget widget;
     widget.doSomething();
+    
+    using Label = FastPimpl<string, sizeof(string), alignof(string)>;
+    Label label("fast");
+    Label labelCopy(label);                 // non-const lvalue → 가변 생성자가 아닌 복사 생성자
+    cout << "FastPimpl copy: " << *labelCopy << endl;
+    
+    cout << "\n[Benchmark: heap PIMPL vs FastPimpl, 200k widgets]" << endl;
+    benchmarkPimpl<HeapWidget>("heap PIMPL", 200000);
+    benchmarkPimpl<FastWidget>("FastPimpl ", 200000);
 }
 
 void demo_timing_wrapper() {
@@ -386,6 +1117,35 @@ void demo_timing_wrapper() {
     auto timed = makeTimingWrapper(slow_function, "slow_function");
     int result = timed();
     cout << "Result: " << result << endl;
+    
+    auto timedVoid = makeTimingWrapper([&result]() { result /= 2; }, "void_function");
+    timedVoid();
+    
+    cout << "\n=== 히스토그램 타이밍 래퍼 (상시 계측) ===" << endl;
+    auto hash = [](uint64_t x) {
+        for (uint64_t i = 0, rounds = x & 63; i < rounds; ++i) x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        return x;
+    };
+    auto timedHash = makeHistogramTimer(hash, "hash");
+    uint64_t sink = 0;
+    atomic<uint64_t> checksum{0};
+    auto touch = makeHistogramTimer([&sink]() { ++sink; }, "touch");  // void 반환
+    {
+        TimingDumper dumper(milliseconds(20));
+        vector<thread> workers;
+        for (int t = 0; t < 2; ++t) {
+            workers.emplace_back([&timedHash, &checksum, t]() {
+                uint64_t local = 0;
+                for (int i = 0; i < 100000; ++i) local += timedHash(static_cast<uint64_t>(i * 2 + t));
+                checksum.fetch_add(local, memory_order_relaxed);
+            });
+        }
+        for (int i = 0; i < 100000; ++i) touch();
+        for (auto& w : workers) w.join();
+    }
+    cout << "최종 snapshot:" << endl;
+    printLatency(TimingRegistry::instance().snapshot("hash"));
+    printLatency(TimingRegistry::instance().snapshot("touch"));
 }
 
 } // namespace patterns
@@ -5,19 +5,116 @@
  */
 
 #include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 using namespace std;
 
+// 빌드 플래그: -DADAPTER_SIMD=0 이면 batch 변환도 scalar 루프만 사용
+#ifndef ADAPTER_SIMD
+#define ADAPTER_SIMD 1
+#endif
+
 namespace patterns {
 
+/*
+ * 단위 변환 kernel (in == out 허용, 제자리 변환)
+ *  - scalar 식과 같은 연산 순서 ((f - 32) * 5 / 9) → 결과가 bit 단위로 같음
+ *  - x86: AVX2를 target attribute로 컴파일하고 실행 시 CPU 지원 여부로 선택
+ *  - aarch64: NEON은 항상 있음
+ */
+void fahrenheitToCelsiusScalar(span<const float> in, span<float> out) {
+    for (size_t i = 0; i < in.size(); ++i) out[i] = (in[i] - 32.0f) * 5.0f / 9.0f;
+}
+
+void kelvinToCelsiusScalar(span<const float> in, span<float> out) {
+    for (size_t i = 0; i < in.size(); ++i) out[i] = in[i] - 273.15f;
+}
+
+#if ADAPTER_SIMD && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define HAVE_AVX2_KERNELS 1
+__attribute__((target("avx2"))) void fahrenheitToCelsiusAvx2(span<const float> in, span<float> out) {
+    const __m256 offset = _mm256_set1_ps(32.0f), five = _mm256_set1_ps(5.0f), nine = _mm256_set1_ps(9.0f);
+    size_t i = 0;
+    for (; i + 8 <= in.size(); i += 8) {
+        __m256 f = _mm256_loadu_ps(in.data() + i);
+        _mm256_storeu_ps(out.data() + i, _mm256_div_ps(_mm256_mul_ps(_mm256_sub_ps(f, offset), five), nine));
+    }
+    fahrenheitToCelsiusScalar(in.subspan(i), out.subspan(i));
+}
+
+__attribute__((target("avx2"))) void kelvinToCelsiusAvx2(span<const float> in, span<float> out) {
+    const __m256 offset = _mm256_set1_ps(273.15f);
+    size_t i = 0;
+    for (; i + 8 <= in.size(); i += 8)
+        _mm256_storeu_ps(out.data() + i, _mm256_sub_ps(_mm256_loadu_ps(in.data() + i), offset));
+    kelvinToCelsiusScalar(in.subspan(i), out.subspan(i));
+}
+#elif ADAPTER_SIMD && defined(__aarch64__)
+#define HAVE_NEON_KERNELS 1
+void fahrenheitToCelsiusNeon(span<const float> in, span<float> out) {
+    const float32x4_t offset = vdupq_n_f32(32.0f), five = vdupq_n_f32(5.0f), nine = vdupq_n_f32(9.0f);
+    size_t i = 0;
+    for (; i + 4 <= in.size(); i += 4) {
+        float32x4_t f = vld1q_f32(in.data() + i);
+        vst1q_f32(out.data() + i, vdivq_f32(vmulq_f32(vsubq_f32(f, offset), five), nine));
+    }
+    fahrenheitToCelsiusScalar(in.subspan(i), out.subspan(i));
+}
+
+void kelvinToCelsiusNeon(span<const float> in, span<float> out) {
+    const float32x4_t offset = vdupq_n_f32(273.15f);
+    size_t i = 0;
+    for (; i + 4 <= in.size(); i += 4) vst1q_f32(out.data() + i, vsubq_f32(vld1q_f32(in.data() + i), offset));
+    kelvinToCelsiusScalar(in.subspan(i), out.subspan(i));
+}
+#endif
+
+using ConvertKernel = void (*)(span<const float>, span<float>);
+
+struct ConversionKernels {
+    const char* isa = "scalar";
+    ConvertKernel fahrenheitToCelsius = fahrenheitToCelsiusScalar;
+    ConvertKernel kelvinToCelsius = kelvinToCelsiusScalar;
+};
+
+// 시작 시 한 번 선택
+const ConversionKernels& kernels() {
+    static const ConversionKernels selected = []() {
+        ConversionKernels k;
+#if defined(HAVE_AVX2_KERNELS)
+        if (__builtin_cpu_supports("avx2")) k = {"avx2", fahrenheitToCelsiusAvx2, kelvinToCelsiusAvx2};
+#elif defined(HAVE_NEON_KERNELS)
+        k = {"neon", fahrenheitToCelsiusNeon, kelvinToCelsiusNeon};
+#endif
+        return k;
+    }();
+    return selected;
+}
+
 // 타겟 인터페이스
 class ICelsiusSensor {
 public:
     virtual ~ICelsiusSensor() = default;
     virtual float readCelsius() = 0;
+    // batch read: 기본은 readCelsius() 반복, 어댑터가 벡터화된 경로로 override
+    virtual size_t readCelsius(span<float> out) {
+        for (float& v : out) v = readCelsius();
+        return out.size();
+    }
     virtual string getName() const = 0;
 };
 
@@ -25,6 +122,9 @@ public:
 class FahrenheitSensor {
 public:
     float readFahrenheit() { return 77.0f; }
+    void readFahrenheit(span<float> out) {
+        for (float& v : out) v = 77.0f;     // DMA로 채워지는 샘플 배열 흉내
+    }
     string getSensorName() { return "Fahrenheit Sensor"; }
 };
 
@@ -32,6 +132,9 @@ public:
 class KelvinSensor {
 public:
     float getKelvin() { return 300.0f; }
+    void getKelvin(span<float> out) {
+        for (float& v : out) v = 300.0f;
+    }
     string id() { return "Kelvin Sensor"; }
 };
 
@@ -46,6 +149,12 @@ public:
         return (f - 32.0f) * 5.0f / 9.0f;
     }
     
+    size_t readCelsius(span<float> out) override {
+        sensor->readFahrenheit(out);
+        kernels().fahrenheitToCelsius(out, out);
+        return out.size();
+    }
+    
     string getName() const override { return sensor->getSensorName(); }
 };
 
@@ -59,9 +168,19 @@ public:
         return sensor->getKelvin() - 273.15f;
     }
     
+    size_t readCelsius(span<float> out) override {
+        sensor->getKelvin(out);
+        kernels().kelvinToCelsius(out, out);
+        return out.size();
+    }
+    
     string getName() const override { return sensor->id(); }
 };
 
+// Converter가 (sensor, span<float>) 호출을 지원하면 batch 변환기로 사용
+template<typename Converter, typename T>
+concept BatchConverter = requires(Converter c, T& sensor, span<float> out) { c(sensor, out); };
+
 // 템플릿 Adapter
 template<typename T, typename Converter>
 class GenericAdapter : public ICelsiusSensor {
@@ -76,14 +195,174 @@ public:
         return converter(*sensor);
     }
     
+    size_t readCelsius(span<float> out) override {
+        if constexpr (BatchConverter<Converter, T>) {
+            converter(*sensor, out);
+            return out.size();
+        } else {
+            return ICelsiusSensor::readCelsius(out);
+        }
+    }
+    
+    string getName() const override { return name; }
+};
+
+// GenericAdapter용 변환기: scalar만 / scalar + batch
+struct KelvinScalarConverter {
+    float operator()(KelvinSensor& s) const { return s.getKelvin() - 273.15f; }
+};
+
+struct KelvinBatchConverter : KelvinScalarConverter {
+    using KelvinScalarConverter::operator();
+    void operator()(KelvinSensor& s, span<float> out) const {
+        s.getKelvin(out);
+        kernels().kelvinToCelsius(out, out);
+    }
+};
+
+/*
+ * 정적 어댑터 조합 (가상 호출/heap 없이 컴파일 타임에 체인 구성)
+ *  - SampleSource: read() 한 샘플 + read(span) 블록 (adaptee를 값으로 보관)
+ *  - SampleStage : 샘플 하나 변환 (x) + 블록 제자리 변환 (span)
+ *  - Pipeline<Source, Stages...>: 전부 값으로 보관 → read()가 통째로 inline
+ *  - 타입 소거는 경계에서만: ErasedSensor가 Pipeline을 ICelsiusSensor로 노출
+ */
+template<typename S>
+concept SampleSource = requires(S source, span<float> out) {
+    { source.read() } -> convertible_to<float>;
+    source.read(out);
+};
+
+template<typename S>
+concept SampleStage = requires(S stage, float x, span<float> block) {
+    { stage(x) } -> convertible_to<float>;
+    stage(block);
+};
+
+struct FahrenheitSource {
+    FahrenheitSensor sensor;
+    float read() { return sensor.readFahrenheit(); }
+    void read(span<float> out) { sensor.readFahrenheit(out); }
+};
+
+struct KelvinSource {
+    KelvinSensor sensor;
+    float read() { return sensor.getKelvin(); }
+    void read(span<float> out) { sensor.getKelvin(out); }
+};
+
+struct FahrenheitToCelsius {
+    float operator()(float f) const { return (f - 32.0f) * 5.0f / 9.0f; }
+    void operator()(span<float> block) const { kernels().fahrenheitToCelsius(block, block); }
+};
+
+struct KelvinToCelsius {
+    float operator()(float k) const { return k - 273.15f; }
+    void operator()(span<float> block) const { kernels().kelvinToCelsius(block, block); }
+};
+
+// 1차 IIR 저역 통과 (상태 있음 → 블록도 순차 처리)
+struct Smoothing {
+    float alpha;
+    float state = 0;
+    bool primed = false;
+    float operator()(float x) {
+        state = primed ? state + alpha * (x - state) : x;
+        primed = true;
+        return state;
+    }
+    void operator()(span<float> block) {
+        for (float& x : block) x = (*this)(x);
+    }
+};
+
+struct Clamp {
+    float low, high;
+    float operator()(float x) const { return clamp(x, low, high); }
+    void operator()(span<float> block) const {
+        for (float& x : block) x = clamp(x, low, high);
+    }
+};
+
+template<SampleSource Source, SampleStage... Stages>
+class Pipeline {
+    Source source;
+    tuple<Stages...> stages;
+public:
+    explicit Pipeline(Source source, Stages... stages) : source(std::move(source)), stages(std::move(stages)...) {}
+    
+    float read() {
+        float x = source.read();
+        apply([&x](auto&... stage) { ((x = stage(x)), ...); }, stages);
+        return x;
+    }
+    
+    void read(span<float> out) {
+        source.read(out);
+        apply([out](auto&... stage) { (stage(out), ...); }, stages);
+    }
+};
+
+template<SampleSource Source, SampleStage... Stages>
+auto makePipeline(Source source, Stages... stages) {
+    return Pipeline<Source, Stages...>(std::move(source), std::move(stages)...);
+}
+
+// 경계용 타입 소거: 블록 단위 호출이면 가상 호출 비용이 블록 전체에 분산됨
+template<SampleSource P>
+class ErasedSensor : public ICelsiusSensor {
+    P pipeline;
+    string name;
+public:
+    ErasedSensor(P pipeline, string name) : pipeline(std::move(pipeline)), name(std::move(name)) {}
+    float readCelsius() override { return pipeline.read(); }
+    size_t readCelsius(span<float> out) override {
+        pipeline.read(out);
+        return out.size();
+    }
     string getName() const override { return name; }
 };
 
+// 구체 타입을 아는 정적 경로: scalar read() / block read()
+template<SampleSource P>
+void benchmarkPipeline(const char* name, P& pipeline) {
+    constexpr size_t BLOCK = 4096;
+    constexpr int ROUNDS = 100;
+    vector<float> samples(BLOCK);
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; ++r)
+        for (size_t i = 0; i < BLOCK; ++i) samples[i] = pipeline.read();
+    double scalarSec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; ++r) pipeline.read(span<float>(samples));
+    double batchSec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << ": static scalar " << BLOCK * ROUNDS / scalarSec / 1e6 << " M samples/s, block "
+         << BLOCK * ROUNDS / batchSec / 1e6 << " M samples/s" << endl;
+}
+
 // 클라이언트 코드
 void processTemperature(ICelsiusSensor& sensor) {
     cout << sensor.getName() << ": " << sensor.readCelsius() << "°C" << endl;
 }
 
+// 같은 센서에서 scalar virtual 호출 vs batch 호출 처리량
+void benchmarkSensor(ICelsiusSensor& sensor) {
+    constexpr size_t BLOCK = 4096;
+    constexpr int ROUNDS = 100;
+    vector<float> samples(BLOCK);
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; ++r)
+        for (size_t i = 0; i < BLOCK; ++i) samples[i] = sensor.readCelsius();
+    double scalarSec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    float scalarLast = samples.back();
+    start = chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; ++r) sensor.readCelsius(span<float>(samples));
+    double batchSec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  " << sensor.getName() << ": scalar virtual " << BLOCK * ROUNDS / scalarSec / 1e6
+         << " M samples/s, batch " << BLOCK * ROUNDS / batchSec / 1e6 << " M samples/s"
+         << (samples.back() == scalarLast ? "" : " (MISMATCH)") << endl;
+}
+
 } // namespace patterns
 
 int main() {
@@ -99,5 +378,29 @@ int main() {
     
     cout << "\n다형성으로 통일된 인터페이스 사용!" << endl;
     
+    cout << "\n=== Batch 변환 (kernel: " << kernels().isa << ") ===" << endl;
+    GenericAdapter<KelvinSensor, KelvinScalarConverter> genericScalar("Generic Kelvin (scalar)");
+    GenericAdapter<KelvinSensor, KelvinBatchConverter> genericBatch("Generic Kelvin (batch)");
+    float block[10];
+    f_adapter.readCelsius(span<float>(block));
+    cout << "Fahrenheit batch[0..9]: " << block[0] << " ... " << block[9] << "°C" << endl;
+    
+    cout << "\n[Benchmark: scalar virtual vs batch]" << endl;
+    benchmarkSensor(f_adapter);
+    benchmarkSensor(k_adapter);
+    benchmarkSensor(genericScalar);
+    benchmarkSensor(genericBatch);
+    
+    cout << "\n=== 정적 Pipeline (Kelvin → Celsius → Smoothing → Clamp) ===" << endl;
+    auto kelvinChain = makePipeline(KelvinSource{}, KelvinToCelsius{}, Smoothing{0.25f}, Clamp{-40.0f, 125.0f});
+    auto fahrenheitChain = makePipeline(FahrenheitSource{}, FahrenheitToCelsius{});
+    cout << "sizeof(kelvinChain) = " << sizeof(kelvinChain) << " (센서/단계 값 보관, heap 없음)" << endl;
+    ErasedSensor edge(kelvinChain, "Kelvin pipeline (erased at edge)");
+    processTemperature(edge);
+    
+    benchmarkPipeline("Fahrenheit→C pipeline ", fahrenheitChain);
+    benchmarkPipeline("Kelvin chain pipeline ", kelvinChain);
+    benchmarkSensor(edge);
+    
     return 0;
 }
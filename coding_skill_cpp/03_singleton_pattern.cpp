@@ -5,17 +5,176 @@
  */
 
 #include <iostream>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#include <unistd.h>
+#define HAVE_POSIX_IO 1
+#endif
 
 using namespace std;
 
 namespace patterns {
 
+/*
+ * 비동기 Logger 백엔드 (01_wrapper_pattern.cpp의 AsyncLogger를 단순화한 구조)
+ *  - log()는 완성된 문자열을 스레드별 SPSC 큐 슬롯에 복사만 함 (122바이트까지, 넘치면 잘림)
+ *  - writer 스레드가 큐 슬롯을 그대로 iovec으로 묶어 writev 한 번 → 복사 없이 전송
+ *  - 큐가 차면 Drop(카운트) 또는 Block, 치명적 시그널/terminate 시 남은 로그를 직접 flush
+ *  - 문자열은 호출자가 이미 만들었으므로 lazy 포맷은 01의 AsyncLogger::log(format, args...) 참고
+ */
+class LogQueue {
+public:
+    struct Slot {
+        uint16_t length;
+        char text[126];
+    };
+    static constexpr uint32_t CAPACITY = 512;
+
+    Slot* reserve() {
+        uint32_t h = head.load(memory_order_relaxed);
+        return h - tail.load(memory_order_acquire) == CAPACITY ? nullptr : &slots[h % CAPACITY];
+    }
+    void commit() { head.store(head.load(memory_order_relaxed) + 1, memory_order_release); }
+
+    // 소비자 전용: [tail, head)를 차례로 visit → flush()가 돌아온 뒤에야 tail 이동
+    // (visit이 슬롯 포인터만 모아 두므로 그 포인터를 쓰는 write가 끝나기 전에 생산자가 슬롯을 재사용하면 안 됨)
+    template<typename Visit, typename Flush>
+    void drain(Visit visit, Flush flush) {
+        uint32_t t = tail.load(memory_order_relaxed);
+        uint32_t h = head.load(memory_order_acquire);
+        for (uint32_t i = t; i != h; ++i) visit(slots[i % CAPACITY]);
+        flush();
+        tail.store(h, memory_order_release);
+    }
+
+private:
+    array<Slot, CAPACITY> slots;
+    alignas(64) atomic<uint32_t> head{0};
+    alignas(64) atomic<uint32_t> tail{0};
+};
+
 // 1. Meyers Singleton (가장 권장)
 class Logger {
-    Logger() { cout << "[Logger] 생성" << endl; }
+public:
+    enum class Backpressure { Drop, Block };
+    
+private:
+    Logger() : writer([this]() { run(); }) { cout << "[Logger] 생성" << endl; }
+    
+    ~Logger() {
+        {
+            lock_guard<mutex> guard(wakeLock);
+            stopping = true;
+        }
+        wake.notify_one();
+        writer.join();
+    }
+    
+    static constexpr size_t MAX_IOV = 512;
+    static constexpr char PREFIX[] = "[LOG] ";
+    
+    mutex queuesLock;
+    vector<unique_ptr<LogQueue>> queues;
+    atomic<Backpressure> policy{Backpressure::Block};
+    atomic<uint64_t> droppedCount{0};
+    atomic_flag consumerBusy = ATOMIC_FLAG_INIT;
+    mutex wakeLock;
+    condition_variable wake, flushed;
+    bool stopping = false;
+    uint64_t flushRequested = 0, flushCompleted = 0;
+    thread writer;
+    
+    LogQueue& threadQueue() {
+        thread_local LogQueue* mine = nullptr;
+        if (!mine) {
+            lock_guard<mutex> guard(queuesLock);
+            queues.push_back(make_unique<LogQueue>());
+            mine = queues.back().get();
+        }
+        return *mine;
+    }
+    
+    // 큐마다 슬롯 포인터를 iovec에 모아 writev, writev가 끝난 뒤에야 슬롯 반환
+    void drainAll() {
+        vector<LogQueue*> snapshot;
+        {
+            lock_guard<mutex> guard(queuesLock);
+            for (auto& q : queues) snapshot.push_back(q.get());
+        }
+        for (LogQueue* queue : snapshot) {
+            iovec iov[MAX_IOV * 2];
+            size_t count = 0;
+            queue->drain([&](LogQueue::Slot& slot) {
+                if (count + 2 > MAX_IOV * 2) {
+                    writeFully(iov, count);
+                    count = 0;
+                }
+                iov[count++] = {const_cast<char*>(PREFIX), sizeof PREFIX - 1};
+                iov[count++] = {slot.text, slot.length};
+            }, [&]() { writeFully(iov, count); });
+        }
+    }
+    
+    static void writeFully(iovec* iov, size_t count) {
+#ifdef HAVE_POSIX_IO
+        while (count > 0) {
+            ssize_t n = ::writev(STDOUT_FILENO, iov, static_cast<int>(min<size_t>(count, IOV_MAX)));
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return;
+            }
+            size_t left = static_cast<size_t>(n);
+            for (; count > 0 && left >= iov->iov_len; ++iov, --count) left -= iov->iov_len;
+            if (count > 0) {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+                iov->iov_len -= left;
+            }
+        }
+#else
+        for (size_t i = 0; i < count; ++i) fwrite(iov[i].iov_base, 1, iov[i].iov_len, stdout);
+#endif
+    }
+    
+    void run() {
+        unique_lock<mutex> guard(wakeLock);
+        for (;;) {
+            wake.wait_for(guard, chrono::milliseconds(5));
+            bool exiting = stopping;
+            uint64_t target = flushRequested;
+            guard.unlock();
+            while (consumerBusy.test_and_set(memory_order_acquire)) this_thread::yield();
+            drainAll();
+            consumerBusy.clear(memory_order_release);
+            guard.lock();
+            flushCompleted = target;
+            flushed.notify_all();
+            if (exiting) return;
+        }
+    }
+    
+    static void onFatalSignal(int sig) {
+        getInstance().emergencyFlush();
+        signal(sig, SIG_DFL);
+        raise(sig);
+    }
     
 public:
     // 복사/이동 방지
@@ -28,12 +187,59 @@ public:
     }
     
     void log(const string& msg) {
-        cout << "[LOG] " << msg << endl;
+        LogQueue& queue = threadQueue();
+        LogQueue::Slot* slot = queue.reserve();
+        while (!slot) {
+            if (policy.load(memory_order_relaxed) == Backpressure::Drop) {
+                droppedCount.fetch_add(1, memory_order_relaxed);
+                return;
+            }
+            wake.notify_one();
+            this_thread::yield();
+            slot = queue.reserve();
+        }
+        size_t length = min(msg.size(), sizeof slot->text - 1);
+        memcpy(slot->text, msg.data(), length);
+        slot->text[length] = '\n';
+        slot->length = static_cast<uint16_t>(length + 1);
+        queue.commit();
+    }
+    
+    void setBackpressure(Backpressure p) { policy.store(p, memory_order_relaxed); }
+    uint64_t dropped() const { return droppedCount.load(memory_order_relaxed); }
+    
+    // 지금까지 log()된 내용이 stdout에 써질 때까지 대기
+    void flush() {
+        unique_lock<mutex> guard(wakeLock);
+        uint64_t target = ++flushRequested;
+        wake.notify_one();
+        flushed.wait(guard, [&]() { return flushCompleted >= target; });
+    }
+    
+    // 크래시 hook: writer가 소비 중이면 잠깐 기다렸다 포기 (교착 방지)
+    void emergencyFlush() noexcept {
+        for (int spin = 0; consumerBusy.test_and_set(memory_order_acquire); ++spin)
+            if (spin > 100000) return;
+        drainAll();
+        consumerBusy.clear(memory_order_release);
+    }
+    
+    static void installCrashHandler() {
+        for (int sig : {SIGSEGV, SIGFPE, SIGILL, SIGABRT}) signal(sig, onFatalSignal);
+        set_terminate([]() {
+            getInstance().emergencyFlush();
+            abort();
+        });
     }
 };
 
 // 2. CRTP를 이용한 Singleton Base
-template<typename T>
+//  - Policy: ProcessWide(기본, 인스턴스 하나) / PerThread(스레드마다) / ReadMostly(RCU식 교체)
+struct ProcessWide {};
+struct PerThread {};
+struct ReadMostly {};
+
+template<typename T, typename Policy = ProcessWide>
 class Singleton {
 protected:
     Singleton() = default;
@@ -48,6 +254,106 @@ public:
     }
 };
 
+/*
+ * PerThread: 스레드마다 자기 인스턴스 → 요청마다 쓰는 값이 코어 간에 오가지 않음
+ *  - 첫 접근 시 registry에 등록, 스레드 종료 시 해제
+ *  - forEachInstance로 살아 있는 인스턴스 순회/합산 (다른 스레드가 쓰는 필드는 atomic이어야 함)
+ */
+template<typename T>
+class Singleton<T, PerThread> {
+    struct Holder {
+        T instance;
+        Holder() {
+            lock_guard<mutex> guard(registryLock());
+            registry().push_back(&instance);
+        }
+        ~Holder() {
+            lock_guard<mutex> guard(registryLock());
+            auto& all = registry();
+            all.erase(find(all.begin(), all.end(), &instance));
+        }
+    };
+    friend T;
+    
+    static mutex& registryLock() {
+        static mutex lock;
+        return lock;
+    }
+    static vector<T*>& registry() {
+        static vector<T*> instances;
+        return instances;
+    }
+    
+protected:
+    Singleton() = default;
+    
+public:
+    Singleton(const Singleton&) = delete;
+    Singleton& operator=(const Singleton&) = delete;
+    
+    static T& getInstance() {
+        thread_local Holder holder;
+        return holder.instance;
+    }
+    
+    template<typename Visit>
+    static void forEachInstance(Visit visit) {
+        lock_guard<mutex> guard(registryLock());
+        for (T* instance : registry()) visit(static_cast<const T&>(*instance));
+    }
+};
+
+/*
+ * ReadMostly: 읽기는 경합 없이, 갱신은 복사 후 포인터 교체 (RCU 방식)
+ *  - 읽기: 전역 version 한 번 load (읽기 전용 cache line) → 바뀌지 않았으면 스레드 캐시의 포인터 사용
+ *    바뀌었으면 atomic<shared_ptr>에서 스냅샷을 다시 읽음, 그 사이 version이 또 바뀌면 재시도 (writer lock 없음)
+ *  - 갱신: 현재 값을 복사해 수정 → 새 shared_ptr 공개 + version 증가 (writer끼리만 mutex)
+ *  - 옛 버전은 모든 스레드가 새 버전을 읽어 간 뒤 마지막 참조와 함께 해제 (grace period)
+ *  - read()가 돌려준 참조는 같은 스레드의 다음 read() 전까지 유효
+ */
+template<typename T>
+class Singleton<T, ReadMostly> {
+    static mutex& writerLock() {
+        static mutex lock;
+        return lock;
+    }
+    static atomic<shared_ptr<const T>>& current() {
+        static atomic<shared_ptr<const T>> value(shared_ptr<const T>(new T()));
+        return value;
+    }
+    static inline atomic<uint64_t> version{1};
+    
+protected:
+    Singleton() = default;
+    Singleton(const Singleton&) = default;      // update()의 복사용
+    
+public:
+    Singleton& operator=(const Singleton&) = delete;
+    
+    static const T& read() {
+        thread_local shared_ptr<const T> cached;
+        thread_local uint64_t cachedVersion = 0;
+        uint64_t v = version.load(memory_order_acquire);
+        while (v != cachedVersion) [[unlikely]] {
+            cached = current().load(memory_order_acquire);
+            cachedVersion = v;
+            v = version.load(memory_order_acquire);     // 읽는 사이 갱신됐으면 새 스냅샷으로 다시
+        }
+        return *cached;
+    }
+    
+    static const T& getInstance() { return read(); }
+    
+    template<typename Mutate>
+    static void update(Mutate mutate) {
+        lock_guard<mutex> guard(writerLock());
+        shared_ptr<T> next(new T(*current().load(memory_order_relaxed)));
+        mutate(*next);
+        current().store(std::move(next), memory_order_release);
+        version.fetch_add(1, memory_order_release);
+    }
+};
+
 class Config : public Singleton<Config> {
     friend class Singleton<Config>;
     string version = "1.0.0";
@@ -59,32 +365,278 @@ public:
     void setVersion(const string& v) { version = v; }
 };
 
+// 요청마다 갱신되는 스레드별 통계 (합산은 registry로)
+class RequestScratch : public Singleton<RequestScratch, PerThread> {
+    friend class Singleton<RequestScratch, PerThread>;
+    RequestScratch() = default;
+    
+public:
+    atomic<uint64_t> requests{0};
+    atomic<uint64_t> bytes{0};
+    void record(uint64_t size) {
+        requests.store(requests.load(memory_order_relaxed) + 1, memory_order_relaxed);     // 주인 스레드만 씀
+        bytes.store(bytes.load(memory_order_relaxed) + size, memory_order_relaxed);
+    }
+    static uint64_t totalRequests() {
+        uint64_t total = 0;
+        forEachInstance([&total](const RequestScratch& s) { total += s.requests.load(memory_order_relaxed); });
+        return total;
+    }
+};
+
+// 매 요청 읽지만 거의 안 바뀌는 설정
+class FeatureFlags : public Singleton<FeatureFlags, ReadMostly> {
+    friend class Singleton<FeatureFlags, ReadMostly>;
+    FeatureFlags() = default;
+    
+public:
+    FeatureFlags(const FeatureFlags&) = default;
+    bool fastPath = false;
+    int maxBatch = 16;
+};
+
+// 비교용: 모든 스레드가 같은 atomic 카운터를 올림
+atomic<uint64_t> sharedRequestCounter{0};
+
+// 비교/풀 공용: 연결 하나 (query는 서버 왕복을 sleep으로 흉내)
+class Connection {
+    int connectionId;
+    uint64_t executed = 0;
+public:
+    explicit Connection(int id) : connectionId(id) {
+        this_thread::sleep_for(chrono::microseconds(200));    // 연결 수립 비용
+    }
+    void execute(const string& sql, chrono::microseconds roundTrip) {
+        (void)sql;
+        this_thread::sleep_for(roundTrip);
+        ++executed;
+    }
+    int id() const { return connectionId; }
+    uint64_t queries() const { return executed; }
+};
+
 // 3. Thread-safe Singleton (명시적 mutex)
+//  - double-checked locking은 포인터가 atomic일 때만 안전 (acquire/release로 생성 완료를 공개)
 class Database {
-    static unique_ptr<Database> instance;
+    static atomic<Database*> instance;
     static mutex mtx;
     
+    Connection connection{0};
+    mutex connectionLock;       // 연결 하나 → 모든 스레드의 query가 여기서 직렬화
+    
     Database() { cout << "[Database] 생성" << endl; }
     
 public:
     static Database& getInstance() {
-        if (!instance) {
+        Database* db = instance.load(memory_order_acquire);
+        if (!db) {
             lock_guard<mutex> lock(mtx);
-            if (!instance) {
-                instance = unique_ptr<Database>(new Database());
+            db = instance.load(memory_order_relaxed);
+            if (!db) {
+                db = new Database();        // 프로세스 수명 동안 유지 (종료 순서 문제 회피)
+                instance.store(db, memory_order_release);
             }
         }
-        return *instance;
+        return *db;
     }
     
     void query(const string& sql) {
         cout << "[DB] Query: " << sql << endl;
     }
+    
+    void execute(const string& sql, chrono::microseconds roundTrip) {
+        lock_guard<mutex> lock(connectionLock);
+        connection.execute(sql, roundTrip);
+    }
 };
 
-unique_ptr<Database> Database::instance = nullptr;
+atomic<Database*> Database::instance{nullptr};
 mutex Database::mtx;
 
+/*
+ * ConnectionPool - 싱글톤 하나에 몰리던 query를 여러 연결로 분산
+ *  - 슬롯 배열 크기는 maxSize로 고정, minSize개는 시작 시 미리 연결 (warm-up)
+ *  - checkout: 이 스레드가 마지막에 쓴 슬롯 → 나머지 슬롯 순으로 busy 플래그 CAS (lock-free)
+ *  - 모두 사용 중이면 maxSize까지 새 연결 생성 (elastic), 그래도 없으면 atomic::wait로 대기
+ *  - Lease(RAII)가 소멸하며 반환, 대기 시간/횟수/affinity 적중은 metrics()로 노출
+ *  - ConnectionPool::shared()로 싱글톤 서비스, 생성자로 직접 만들어 주입도 가능
+ */
+struct PoolOptions {
+    size_t minSize = 4;
+    size_t maxSize = 8;
+};
+
+class ConnectionPool {
+public:
+    using Options = PoolOptions;
+    
+    struct Metrics {
+        uint64_t checkouts = 0;
+        uint64_t affinityHits = 0;
+        uint64_t waits = 0;             // 빈 연결이 없어 잠든 checkout
+        double totalWaitMs = 0;
+        double maxWaitMs = 0;
+        size_t connections = 0;
+    };
+    
+    class Lease {
+        ConnectionPool* pool = nullptr;
+        size_t slot = 0;
+    public:
+        Lease(ConnectionPool* pool, size_t slot) : pool(pool), slot(slot) {}
+        Lease(Lease&& other) noexcept : pool(exchange(other.pool, nullptr)), slot(other.slot) {}
+        Lease& operator=(Lease&&) = delete;
+        ~Lease() {
+            if (pool) pool->release(slot);
+        }
+        Connection& operator*() const { return *pool->slots[slot].connection; }
+        Connection* operator->() const { return pool->slots[slot].connection.get(); }
+    };
+    
+    explicit ConnectionPool(Options options = {})
+        : options(options), slots(make_unique<Slot[]>(options.maxSize)), poolId(nextPoolId.fetch_add(1)) {
+        for (size_t i = 0; i < min(options.minSize, options.maxSize); ++i) {
+            slots[i].connection = make_unique<Connection>(static_cast<int>(i + 1));
+            slots[i].ready.store(true, memory_order_release);
+        }
+        created.store(min(options.minSize, options.maxSize), memory_order_release);
+    }
+    
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+    
+    static ConnectionPool& shared() {
+        static ConnectionPool pool;
+        return pool;
+    }
+    
+    Lease checkout() {
+        checkouts.fetch_add(1, memory_order_relaxed);
+        size_t& last = affinity();
+        if (last < options.maxSize && tryClaim(last)) {
+            affinityHits.fetch_add(1, memory_order_relaxed);
+            return Lease(this, last);
+        }
+        chrono::steady_clock::time_point waitStart{};
+        for (;;) {
+            uint32_t seen = releases.load(memory_order_acquire);
+            size_t count = created.load(memory_order_acquire);
+            for (size_t i = 0; i < count; ++i) {
+                size_t slot = (last + 1 + i) % count;
+                if (tryClaim(slot)) return finish(slot, waitStart);
+            }
+            if (auto grown = grow()) return finish(*grown, waitStart);
+            if (waitStart == chrono::steady_clock::time_point{}) waitStart = chrono::steady_clock::now();
+            waiters.fetch_add(1, memory_order_seq_cst);
+            releases.wait(seen, memory_order_acquire);      // release()가 카운터를 올리면 깨어남
+            waiters.fetch_sub(1, memory_order_relaxed);
+        }
+    }
+    
+    Metrics metrics() const {
+        Metrics m;
+        m.checkouts = checkouts.load(memory_order_relaxed);
+        m.affinityHits = affinityHits.load(memory_order_relaxed);
+        m.waits = waitCount.load(memory_order_relaxed);
+        m.totalWaitMs = waitNs.load(memory_order_relaxed) / 1e6;
+        m.maxWaitMs = maxWaitNs.load(memory_order_relaxed) / 1e6;
+        m.connections = created.load(memory_order_relaxed);
+        return m;
+    }
+    
+private:
+    struct Slot {
+        unique_ptr<Connection> connection;
+        atomic<bool> ready{false};      // connection 생성 완료 공개
+        atomic<bool> busy{false};
+    };
+    
+    Options options;
+    unique_ptr<Slot[]> slots;
+    atomic<size_t> created{0};          // 공개된(또는 생성 중인) 슬롯 수
+    atomic<uint32_t> releases{0};
+    atomic<uint32_t> waiters{0};
+    atomic<uint64_t> checkouts{0}, affinityHits{0}, waitCount{0}, waitNs{0}, maxWaitNs{0};
+    const uint64_t poolId;
+    static inline atomic<uint64_t> nextPoolId{1};
+    
+    // 스레드별 마지막 슬롯 (풀별로 구분)
+    size_t& affinity() {
+        thread_local vector<pair<uint64_t, size_t>> lastSlots;
+        for (auto& [id, slot] : lastSlots)
+            if (id == poolId) return slot;
+        lastSlots.emplace_back(poolId, SIZE_MAX);
+        return lastSlots.back().second;
+    }
+    
+    bool tryClaim(size_t slot) {
+        Slot& s = slots[slot];
+        if (!s.ready.load(memory_order_acquire) || s.busy.load(memory_order_relaxed)) return false;
+        bool expected = false;
+        return s.busy.compare_exchange_strong(expected, true, memory_order_acquire, memory_order_relaxed);
+    }
+    
+    // 빈 슬롯 번호를 CAS로 예약 → 그 슬롯에 연결 생성 (다른 스레드는 ready 전까지 건너뜀)
+    optional<size_t> grow() {
+        size_t count = created.load(memory_order_relaxed);
+        while (count < options.maxSize) {
+            if (created.compare_exchange_weak(count, count + 1, memory_order_acq_rel)) {
+                Slot& s = slots[count];
+                s.busy.store(true, memory_order_relaxed);
+                s.connection = make_unique<Connection>(static_cast<int>(count + 1));
+                s.ready.store(true, memory_order_release);
+                return count;
+            }
+        }
+        return nullopt;
+    }
+    
+    Lease finish(size_t slot, chrono::steady_clock::time_point waitStart) {
+        affinity() = slot;
+        if (waitStart != chrono::steady_clock::time_point{}) {
+            auto ns = static_cast<uint64_t>(
+                chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - waitStart).count());
+            waitCount.fetch_add(1, memory_order_relaxed);
+            waitNs.fetch_add(ns, memory_order_relaxed);
+            uint64_t seen = maxWaitNs.load(memory_order_relaxed);
+            while (ns > seen && !maxWaitNs.compare_exchange_weak(seen, ns, memory_order_relaxed)) {}
+        }
+        return Lease(this, slot);
+    }
+    
+    void release(size_t slot) {
+        slots[slot].busy.store(false, memory_order_release);
+        releases.fetch_add(1, memory_order_seq_cst);
+        if (waiters.load(memory_order_seq_cst) > 0) releases.notify_one();
+    }
+};
+
+// 주입 예: 저장소가 풀을 생성자로 받음 (테스트에서는 작은 풀을 넘김)
+class UserRepository {
+    ConnectionPool& pool;
+public:
+    explicit UserRepository(ConnectionPool& pool) : pool(pool) {}
+    int findUser(int userId) {
+        auto connection = pool.checkout();
+        connection->execute("SELECT * FROM users WHERE id = " + to_string(userId), chrono::microseconds(50));
+        return connection->id();
+    }
+};
+
+// THREADS개 스레드가 각각 QUERIES번 query (왕복 300us)
+template<typename Run>
+double runQueryLoad(Run run) {
+    constexpr int THREADS = 8, QUERIES = 20;
+    auto start = chrono::steady_clock::now();
+    vector<thread> clients;
+    for (int t = 0; t < THREADS; ++t)
+        clients.emplace_back([&run]() {
+            for (int q = 0; q < QUERIES; ++q) run("SELECT 1", chrono::microseconds(300));
+        });
+    for (auto& c : clients) c.join();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
 } // namespace patterns
 
 int main() {
@@ -94,18 +646,96 @@ int main() {
     
     // Meyers Singleton
     cout << "\n1. Meyers Singleton:" << endl;
+    Logger::installCrashHandler();
     Logger::getInstance().log("Message 1");
     Logger::getInstance().log("Message 2");
+    Logger::getInstance().flush();      // 비동기 출력이 아래 cout보다 먼저 나오도록
     
     // CRTP Singleton
     cout << "\n2. CRTP Singleton:" << endl;
     cout << "Version: " << Config::getInstance().getVersion() << endl;
     
+    cout << "\n2-1. PerThread / ReadMostly 정책:" << endl;
+    {
+        constexpr int THREADS = 4, REQUESTS = 200000;
+        auto runThreads = [](auto body) {
+            auto start = chrono::steady_clock::now();
+            vector<thread> threads;
+            for (int t = 0; t < THREADS; ++t) threads.emplace_back(body);
+            for (auto& th : threads) th.join();
+            return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        };
+        uint64_t liveTotal = 0;
+        double perThreadMs = runThreads([&liveTotal]() {
+            for (int i = 0; i < REQUESTS; ++i) RequestScratch::getInstance().record(64);
+            static mutex sumLock;
+            lock_guard<mutex> guard(sumLock);
+            liveTotal += RequestScratch::getInstance().requests.load();    // 스레드 종료 전 값
+        });
+        double sharedMs = runThreads([]() {
+            for (int i = 0; i < REQUESTS; ++i) sharedRequestCounter.fetch_add(1, memory_order_relaxed);
+        });
+        RequestScratch::getInstance().record(64);
+        cout << "PerThread counters : " << perThreadMs << " ms (threads' total " << liveTotal
+             << ", live main-thread sum " << RequestScratch::totalRequests() << ")" << endl;
+        cout << "shared atomic      : " << sharedMs << " ms" << endl;
+        
+        atomic<bool> stop{false};
+        atomic<uint64_t> fastReads{0};
+        thread updater([&stop]() {
+            for (int i = 0; !stop.load(); ++i) {
+                FeatureFlags::update([i](FeatureFlags& f) { f.fastPath = i % 2 == 0; f.maxBatch = 16 + i % 4; });
+                this_thread::sleep_for(chrono::milliseconds(1));
+            }
+        });
+        double readMs = runThreads([&fastReads]() {
+            uint64_t hits = 0;
+            for (int i = 0; i < REQUESTS; ++i) hits += FeatureFlags::read().fastPath;
+            fastReads.fetch_add(hits);
+        });
+        stop = true;
+        updater.join();
+        cout << "ReadMostly reads   : " << readMs << " ms for " << THREADS * REQUESTS << " reads with ~1 update/ms"
+             << " (fastPath seen " << fastReads.load() << " times, maxBatch now " << FeatureFlags::read().maxBatch << ")"
+             << endl;
+    }
+    
     // Thread-safe Singleton
     cout << "\n3. Thread-safe Singleton:" << endl;
     Database::getInstance().query("SELECT * FROM users");
     
     cout << "\n모두 동일한 인스턴스 사용!" << endl;
     
+    cout << "\n4. 여러 스레드에서 비동기 Logger:" << endl;
+    cout.flush();
+    vector<thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([t]() {
+            for (int step = 1; step <= 2; ++step)
+                Logger::getInstance().log("worker " + to_string(t) + " step " + to_string(step));
+        });
+    }
+    for (auto& w : workers) w.join();
+    Logger::getInstance().flush();
+    cout << "dropped: " << Logger::getInstance().dropped() << endl;
+    
+    cout << "\n5. ConnectionPool vs 단일 Database 연결 (8 threads x 20 queries, 300us 왕복):" << endl;
+    double singletonMs = runQueryLoad([](const string& sql, chrono::microseconds rt) {
+        Database::getInstance().execute(sql, rt);
+    });
+    ConnectionPool& pool = ConnectionPool::shared();        // 4개 warm-up, 최대 8개
+    double poolMs = runQueryLoad([&pool](const string& sql, chrono::microseconds rt) {
+        pool.checkout()->execute(sql, rt);
+    });
+    auto m = pool.metrics();
+    cout << "Database singleton: " << singletonMs << " ms" << endl;
+    cout << "ConnectionPool    : " << poolMs << " ms (connections " << m.connections << ", affinity hits "
+         << m.affinityHits << "/" << m.checkouts << ", waits " << m.waits << ", max wait " << m.maxWaitMs
+         << " ms)" << endl;
+    
+    ConnectionPool small({1, 2});          // 의존성 주입: 작은 전용 풀
+    UserRepository users(small);
+    cout << "UserRepository.findUser(7) → connection #" << users.findUser(7) << endl;
+    
     return 0;
 }
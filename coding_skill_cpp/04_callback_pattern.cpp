@@ -1,33 +1,393 @@
 /* C++ Callback - std::function과 람다 */
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 using namespace std;
 
+// 할당 횟수 측정용 전역 operator new 교체 (이 데모 실행 파일에만 적용)
+static size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+    ++allocationCount;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+/*
+ * function_ref - 빌려 쓰는 콜백용 비소유 참조 (포인터 두 개)
+ *  - 대상 객체 주소 + 호출 thunk만 저장, 할당/복사 없음
+ *  - 대상보다 오래 살면 안 됨: 임시 람다를 멤버로 저장하지 말 것 (인자로 넘길 때 적합)
+ */
+template<typename Signature>
+class function_ref;
+
+template<typename R, typename... Args>
+class function_ref<R(Args...)> {
+    union Target {
+        void* object;
+        void (*function)();
+    };
+    Target target{nullptr};
+    R (*thunk)(Target, Args&&...) = nullptr;
+public:
+    function_ref() = default;
+
+    template<typename F>
+        requires(!is_same_v<remove_cvref_t<F>, function_ref> && is_invocable_r_v<R, F&, Args...>)
+    function_ref(F&& f) noexcept {
+        using Fn = remove_reference_t<F>;
+        if constexpr (is_function_v<Fn> || is_pointer_v<Fn>) {
+            using Ptr = conditional_t<is_pointer_v<Fn>, Fn, Fn*>;
+            target.function = reinterpret_cast<void (*)()>(static_cast<Ptr>(f));
+            thunk = [](Target t, Args&&... args) -> R {
+                return invoke(reinterpret_cast<Ptr>(t.function), forward<Args>(args)...);
+            };
+        } else {
+            target.object = const_cast<void*>(static_cast<const void*>(addressof(f)));
+            thunk = [](Target t, Args&&... args) -> R {
+                return invoke(*static_cast<Fn*>(t.object), forward<Args>(args)...);
+            };
+        }
+    }
+
+    R operator()(Args... args) const { return thunk(target, forward<Args>(args)...); }
+    explicit operator bool() const { return thunk != nullptr; }
+};
+
+/*
+ * InplaceFunction - 내부 버퍼에만 저장하는 move-only 콜백
+ *  - Capacity 바이트 안에 callable을 직접 생성, heap fallback 없음
+ *  - 너무 크거나 정렬이 맞지 않으면 컴파일 에러 (static_assert)로 알려줌
+ *  - 연산 테이블(invoke/move/destroy)은 타입마다 constexpr 하나
+ */
+template<typename Signature, size_t Capacity = 32>
+class InplaceFunction;
+
+template<typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+    struct Ops {
+        R (*invoke)(void*, Args&&...);
+        void (*moveTo)(void* from, void* to) noexcept;
+        void (*destroy)(void*) noexcept;
+    };
+
+    template<typename Fn>
+    static constexpr Ops opsFor{
+        [](void* self, Args&&... args) -> R { return invoke(*static_cast<Fn*>(self), forward<Args>(args)...); },
+        [](void* from, void* to) noexcept { ::new (to) Fn(std::move(*static_cast<Fn*>(from))); },
+        [](void* self) noexcept { static_cast<Fn*>(self)->~Fn(); },
+    };
+
+    alignas(max_align_t) mutable unsigned char storage[Capacity];
+    const Ops* ops = nullptr;
+
+    void reset() noexcept {
+        if (ops) ops->destroy(storage);
+        ops = nullptr;
+    }
+
+public:
+    InplaceFunction() = default;
+    InplaceFunction(nullptr_t) noexcept {}
+
+    template<typename F>
+        requires(!is_same_v<remove_cvref_t<F>, InplaceFunction> && is_invocable_r_v<R, decay_t<F>&, Args...>)
+    InplaceFunction(F&& f) {
+        using Fn = decay_t<F>;
+        static_assert(sizeof(Fn) <= Capacity, "callable does not fit InplaceFunction: raise Capacity");
+        static_assert(alignof(Fn) <= alignof(max_align_t), "callable is over-aligned for InplaceFunction");
+        static_assert(is_nothrow_move_constructible_v<Fn>, "InplaceFunction needs a noexcept-movable callable");
+        ::new (storage) Fn(std::forward<F>(f));
+        ops = &opsFor<Fn>;
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept : ops(other.ops) {
+        if (ops) ops->moveTo(other.storage, storage);
+        other.reset();
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            if (other.ops) other.ops->moveTo(other.storage, storage);
+            ops = other.ops;
+            other.reset();
+        }
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+    ~InplaceFunction() { reset(); }
+
+    R operator()(Args... args) const { return ops->invoke(storage, forward<Args>(args)...); }
+    explicit operator bool() const { return ops != nullptr; }
+};
+
 // 콜백 타입 정의
 using Callback = function<void(int)>;
 using DataCallback = function<void(const string&)>;
+using CallbackRef = function_ref<void(int)>;
+using InplaceCallback = InplaceFunction<void(int), 32>;
 
+// 콜백 저장 타입을 고를 수 있음: std::function (기본) / InplaceCallback / CallbackRef
+template<typename Fn = Callback>
 class Button {
-    Callback onClick;
+    Fn onClick;
 public:
-    void setOnClick(Callback cb) { onClick = cb; }
+    void setOnClick(Fn cb) { onClick = std::move(cb); }
     void click() {
         cout << "[Button] 클릭!" << endl;
         if (onClick) onClick(1);
     }
 };
 
+template<typename Fn = Callback>
 class Observable {
-    vector<Callback> observers;
+    vector<Fn> observers;
 public:
-    void attach(Callback cb) { observers.push_back(cb); }
+    void reserve(size_t n) { observers.reserve(n); }
+    void attach(Fn cb) { observers.push_back(std::move(cb)); }
     void notify(int data) {
         cout << "[Observable] 통지: " << observers.size() << "명" << endl;
+        emit(data);
+    }
+    // 로그 없이 전달만 (hot path)
+    void emit(int data) {
         for (auto& obs : observers) obs(data);
     }
 };
 
+/*
+ * EpochDomain / CowObserverList - 07_observer_pattern.cpp와 같은 구조
+ *  - notify는 atomic 포인터로 잡은 스냅샷을 lock 없이 순회
+ *  - attach/detach는 배열을 복사해 교체, 옛 배열은 epoch 기반으로 회수
+ */
+class EpochDomain {
+public:
+    struct Reader {
+        atomic<uint64_t> epoch{0};      // 0 = 임계 구역 밖
+        atomic<bool> inUse{false};
+        int depth = 0;                  // 중첩 Guard (notify 안에서 notify)
+    };
+    
+    class Guard {
+        Reader& reader;
+    public:
+        explicit Guard(EpochDomain& domain) : reader(domain.threadReader()) {
+            if (reader.depth++ == 0) reader.epoch.store(domain.globalEpoch.load(memory_order_seq_cst), memory_order_seq_cst);
+        }
+        ~Guard() {
+            if (--reader.depth == 0) reader.epoch.store(0, memory_order_release);
+        }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+    
+    static EpochDomain& instance() {
+        static EpochDomain domain;
+        return domain;
+    }
+    
+    // 교체 직후 호출: 이 값보다 큰 epoch로 들어온 reader는 새 포인터만 봄
+    uint64_t retireEpoch() { return globalEpoch.fetch_add(1, memory_order_seq_cst); }
+    
+    uint64_t minActiveEpoch() {
+        lock_guard<mutex> guard(readersLock);
+        uint64_t lowest = UINT64_MAX;
+        for (auto& r : readers) {
+            uint64_t e = r.epoch.load(memory_order_seq_cst);
+            if (e != 0) lowest = min(lowest, e);
+        }
+        return lowest;
+    }
+    
+private:
+    atomic<uint64_t> globalEpoch{1};
+    mutex readersLock;
+    deque<Reader> readers;
+    
+    Reader& threadReader() {
+        struct Holder {
+            Reader* reader = nullptr;
+            ~Holder() {
+                if (reader) reader->inUse.store(false, memory_order_release);
+            }
+        };
+        thread_local Holder holder;
+        if (!holder.reader) [[unlikely]] {
+            lock_guard<mutex> guard(readersLock);
+            for (auto& r : readers) {
+                bool expected = false;
+                if (r.inUse.compare_exchange_strong(expected, true)) {
+                    holder.reader = &r;
+                    break;
+                }
+            }
+            if (!holder.reader) {
+                holder.reader = &readers.emplace_back();
+                holder.reader->inUse.store(true);
+            }
+        }
+        return *holder.reader;
+    }
+};
+
+template<typename Fn>
+class CowObserverList {
+    struct Entry {
+        uint64_t id;
+        shared_ptr<const Fn> callback;
+    };
+    struct Snapshot {
+        vector<Entry> entries;
+    };
+    
+    atomic<const Snapshot*> current{new Snapshot()};
+    mutex writerLock;
+    vector<pair<uint64_t, const Snapshot*>> retired;      // (retire epoch, 옛 배열)
+    uint64_t nextId = 1;
+    size_t reclaimedCount = 0;
+    
+    // writerLock 안에서 호출
+    void publish(const Snapshot* next) {
+        const Snapshot* old = current.exchange(next, memory_order_seq_cst);
+        retired.emplace_back(EpochDomain::instance().retireEpoch(), old);
+        uint64_t lowest = EpochDomain::instance().minActiveEpoch();
+        erase_if(retired, [&](const pair<uint64_t, const Snapshot*>& r) {
+            if (r.first >= lowest) return false;
+            delete r.second;
+            ++reclaimedCount;
+            return true;
+        });
+    }
+    
+public:
+    class Subscription {
+        CowObserverList* list = nullptr;
+        uint64_t id = 0;
+    public:
+        Subscription() = default;
+        Subscription(CowObserverList* list, uint64_t id) : list(list), id(id) {}
+        Subscription(Subscription&& other) noexcept : list(exchange(other.list, nullptr)), id(other.id) {}
+        Subscription& operator=(Subscription&& other) noexcept {
+            if (this != &other) {
+                reset();
+                list = exchange(other.list, nullptr);
+                id = other.id;
+            }
+            return *this;
+        }
+        ~Subscription() { reset(); }
+        void reset() {
+            if (list) exchange(list, nullptr)->detach(id);
+        }
+    };
+    
+    CowObserverList() = default;
+    CowObserverList(const CowObserverList&) = delete;
+    CowObserverList& operator=(const CowObserverList&) = delete;
+    
+    // 소멸 시점에는 notify 중인 스레드가 없어야 함
+    ~CowObserverList() {
+        delete current.load();
+        for (auto& r : retired) delete r.second;
+    }
+    
+    uint64_t attach(Fn callback) {
+        lock_guard<mutex> guard(writerLock);
+        auto* next = new Snapshot(*current.load(memory_order_relaxed));
+        uint64_t id = nextId++;
+        next->entries.push_back({id, make_shared<const Fn>(std::move(callback))});
+        publish(next);
+        return id;
+    }
+    
+    [[nodiscard]] Subscription subscribe(Fn callback) { return Subscription(this, attach(std::move(callback))); }
+    
+    bool detach(uint64_t id) {
+        lock_guard<mutex> guard(writerLock);
+        const Snapshot* now = current.load(memory_order_relaxed);
+        auto it = find_if(now->entries.begin(), now->entries.end(), [id](const Entry& e) { return e.id == id; });
+        if (it == now->entries.end()) return false;
+        auto* next = new Snapshot();
+        next->entries.reserve(now->entries.size() - 1);
+        for (const Entry& e : now->entries)
+            if (e.id != id) next->entries.push_back(e);
+        publish(next);
+        return true;
+    }
+    
+    template<typename... Args>
+    void notify(const Args&... args) {
+        EpochDomain::Guard guard(EpochDomain::instance());
+        const Snapshot* snapshot = current.load(memory_order_seq_cst);
+        for (const Entry& e : snapshot->entries) (*e.callback)(args...);
+    }
+    
+    size_t size() {
+        EpochDomain::Guard guard(EpochDomain::instance());
+        return current.load(memory_order_seq_cst)->entries.size();
+    }
+    
+    // 회수 대기 중 / 회수 완료된 옛 배열 수 (writer lock)
+    pair<size_t, size_t> reclamationStats() {
+        lock_guard<mutex> guard(writerLock);
+        return {retired.size(), reclaimedCount};
+    }
+};
+
+// 여러 스레드가 emit하는 중에도 subscribe/해지 가능한 Observable
+template<typename Fn = Callback>
+class ConcurrentObservable {
+    CowObserverList<Fn> observers;
+public:
+    using Subscription = typename CowObserverList<Fn>::Subscription;
+    [[nodiscard]] Subscription subscribe(Fn cb) { return observers.subscribe(std::move(cb)); }
+    void notify(int data) {
+        cout << "[ConcurrentObservable] 통지: " << observers.size() << "명" << endl;
+        emit(data);
+    }
+    void emit(int data) { observers.notify(data); }
+};
+
+// 관찰자 3개(각각 double 3개 캡처 = 24바이트) 등록 + 빈번한 emit
+template<typename Fn>
+static void benchmarkObservable(const char* name, double scale) {
+    constexpr int EVENTS = 1000000;
+    double sum = 0;
+    auto first = [&sum, scale, offset = 1.0, bias = 0.5](int x) { sum += x * scale + offset + bias; };
+    auto second = [&sum, scale, offset = 2.0, bias = 0.25](int x) { sum += x * scale - offset - bias; };
+    auto third = [&sum, scale, offset = 3.0, bias = 0.125](int x) { sum += x * offset * scale * bias; };
+    Observable<Fn> observable;
+    observable.reserve(3);      // vector 자체 할당은 제외하고 콜백 저장 비용만 셈
+    size_t before = allocationCount;
+    observable.attach(first);
+    observable.attach(second);
+    observable.attach(third);
+    size_t allocations = allocationCount - before;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < EVENTS; ++i) observable.emit(i);
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / (EVENTS * 3.0);
+    cout << "  " << name << ": " << allocations << " allocations to attach, " << ns << " ns/callback (sum " << sum
+         << ")" << endl;
+}
+
 int main() {
     cout << "\n=== C++ Callback Pattern ===" << endl;
     
@@ -42,5 +402,32 @@ int main() {
     obs.attach([](int x) { cout << "  → Observer 2: " << x * 2 << endl; });
     obs.notify(10);
     
+    cout << "\n=== InplaceFunction / function_ref ===" << endl;
+    int clicks = 0;
+    Button<InplaceCallback> inplaceBtn;
+    inplaceBtn.setOnClick([&clicks](int x) { clicks += x; cout << "  → inplace 콜백, 누적 " << clicks << endl; });
+    inplaceBtn.click();
+    inplaceBtn.click();
+    // InplaceCallback tooBig = [big = array<char, 64>{}](int) {};  // 컴파일 에러: raise Capacity
+    
+    auto logger = [](int x) { cout << "  → borrowed observer: " << x << endl; };   // Observable보다 오래 살아야 함
+    Observable<CallbackRef> borrowed;
+    borrowed.attach(logger);
+    borrowed.notify(7);
+    
+    cout << "\n=== ConcurrentObservable (copy-on-write) ===" << endl;
+    ConcurrentObservable<> bus;
+    {
+        auto sub = bus.subscribe([](int x) { cout << "  → scoped observer: " << x << endl; });
+        thread emitter([&bus]() { bus.notify(3); });
+        emitter.join();
+    }   // sub 소멸 → 자동 해지
+    bus.notify(4);
+    
+    cout << "\n=== Benchmark: attach allocations + dispatch ===" << endl;
+    benchmarkObservable<Callback>("std::function  ", 1.5);
+    benchmarkObservable<InplaceCallback>("InplaceFunction", 1.5);
+    benchmarkObservable<CallbackRef>("function_ref   ", 1.5);
+    
     return 0;
 }
@@ -1,22 +1,53 @@
 /* C++ State Machine - enum class + switch */
 #include <iostream>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <span>
 #include <string>
 #include <map>
 #include <functional>
+#include <utility>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 using namespace std;
 
+// 인스턴스당 메모리 측정용 전역 operator new 교체 (이 데모 실행 파일에만 적용)
+static size_t allocatedBytes = 0;
+
+void* operator new(size_t size) {
+    allocatedBytes += size;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
 enum class State { IDLE, RUNNING, STOPPED };
 
 class StateMachine {
     State current = State::IDLE;
     map<State, function<void()>> onEnter;
+    bool verbose;
     
 public:
+    explicit StateMachine(bool verbose = true) : verbose(verbose) {}
+    
     void setOnEnter(State s, function<void()> f) { onEnter[s] = f; }
     
     void transition(State next) {
-        cout << "[SM] " << static_cast<int>(current) 
-             << " → " << static_cast<int>(next) << endl;
+        if (verbose)
+            cout << "[SM] " << static_cast<int>(current) 
+                 << " → " << static_cast<int>(next) << endl;
         current = next;
         if (onEnter[current]) onEnter[current]();
     }
@@ -24,6 +55,425 @@ public:
     State getState() const { return current; }
 };
 
+/*
+ * TableStateMachine<Def> - constexpr 전이 표 기반 상태 기계
+ *  - Def::table: {from, event, to, guard, action} 행의 constexpr 배열
+ *  - (state, event) → 행 번호 평탄 배열을 컴파일 타임에 생성, 중복 행은 static_assert
+ *  - 전이 한 번 = 배열 조회 + 행 번호 switch(fold) → guard/action은 상수 함수 포인터라 인라인됨
+ *  - 표에 없는 전이나 guard 실패는 false 반환, 상태 불변 (할당 없음)
+ */
+template<typename S, typename E, typename Ctx>
+struct Transition {
+    S from;
+    E event;
+    S to;
+    bool (*guard)(const Ctx&) = nullptr;
+    void (*action)(Ctx&) = nullptr;
+};
+
+template<typename Def>
+class TableStateMachine {
+    using S = typename Def::StateType;
+    using E = typename Def::EventType;
+    using Ctx = typename Def::Context;
+    static constexpr size_t ROWS = Def::table.size();
+    static constexpr uint8_t NONE = 0xFF;
+    static_assert(ROWS < NONE, "transition table too large for uint8_t index");
+    
+    static constexpr size_t cell(S s, E e) {
+        return static_cast<size_t>(s) * Def::EVENTS + static_cast<size_t>(e);
+    }
+    
+    static constexpr bool tableIsValid() {
+        array<bool, Def::STATES * Def::EVENTS> seen{};
+        for (const auto& row : Def::table) {
+            if (static_cast<size_t>(row.from) >= Def::STATES || static_cast<size_t>(row.to) >= Def::STATES ||
+                static_cast<size_t>(row.event) >= Def::EVENTS)
+                return false;
+            if (seen[cell(row.from, row.event)]) return false;
+            seen[cell(row.from, row.event)] = true;
+        }
+        return true;
+    }
+    static_assert(tableIsValid(), "transition table has out-of-range or duplicate (state, event) rows");
+    
+    static constexpr array<uint8_t, Def::STATES * Def::EVENTS> LOOKUP = []() {
+        array<uint8_t, Def::STATES * Def::EVENTS> lookup{};
+        for (auto& slot : lookup) slot = NONE;
+        for (size_t i = 0; i < ROWS; ++i) lookup[cell(Def::table[i].from, Def::table[i].event)] = static_cast<uint8_t>(i);
+        return lookup;
+    }();
+    
+    S current;
+    Ctx ctx;
+    
+    template<size_t I>
+    bool fire() {
+        constexpr auto& row = Def::table[I];
+        if constexpr (row.guard != nullptr) {
+            if (!row.guard(ctx)) return false;
+        }
+        current = row.to;
+        if constexpr (row.action != nullptr) row.action(ctx);
+        return true;
+    }
+    
+    template<size_t... I>
+    bool fireRow(uint8_t row, index_sequence<I...>) {
+        bool fired = false;
+        (void)((row == I && (fired = fire<I>(), true)) || ...);
+        return fired;
+    }
+    
+public:
+    explicit TableStateMachine(S initial, Ctx context = {}) : current(initial), ctx(context) {}
+    
+    bool dispatch(E event) {
+        uint8_t row = LOOKUP[cell(current, event)];
+        if (row == NONE) return false;
+        return fireRow(row, make_index_sequence<ROWS>{});
+    }
+    
+    static constexpr bool canDispatch(S state, E event) { return LOOKUP[cell(state, event)] != NONE; }
+    
+    S getState() const { return current; }
+    const Ctx& context() const { return ctx; }
+};
+
+// 예제: 기존 State를 그대로 쓰는 모터 제어기
+enum class Event { START, STOP, RESET };
+
+struct MotorContext {
+    bool enabled = true;
+    int starts = 0;
+    int stops = 0;
+    bool verbose = false;
+};
+
+struct MotorMachine {
+    using StateType = State;
+    using EventType = Event;
+    using Context = MotorContext;
+    static constexpr size_t STATES = 3;
+    static constexpr size_t EVENTS = 3;
+    
+    static bool isEnabled(const MotorContext& c) { return c.enabled; }
+    static void onStart(MotorContext& c) {
+        ++c.starts;
+        if (c.verbose) cout << "  → 실행 시작!" << endl;
+    }
+    static void onStop(MotorContext& c) {
+        ++c.stops;
+        if (c.verbose) cout << "  → 정지됨" << endl;
+    }
+    
+    using Row = Transition<State, Event, MotorContext>;
+    static constexpr array table = {
+        Row{State::IDLE,    Event::START, State::RUNNING, isEnabled, onStart},
+        Row{State::RUNNING, Event::STOP,  State::STOPPED, nullptr,   onStop},
+        Row{State::STOPPED, Event::RESET, State::IDLE},
+        Row{State::STOPPED, Event::START, State::RUNNING, isEnabled, onStart},
+    };
+};
+
+using MotorStateMachine = TableStateMachine<MotorMachine>;
+static_assert(MotorStateMachine::canDispatch(State::IDLE, Event::START));
+static_assert(!MotorStateMachine::canDispatch(State::IDLE, Event::STOP));
+
+// IDLE → RUNNING → STOPPED → IDLE 순환을 반복
+static void benchmarkStateMachines() {
+    constexpr int CYCLES = 300000;
+    int enters = 0;
+    StateMachine mapped(false);
+    mapped.setOnEnter(State::RUNNING, [&enters]() { ++enters; });
+    mapped.setOnEnter(State::STOPPED, [&enters]() { ++enters; });
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < CYCLES; ++i) {
+        mapped.transition(State::RUNNING);
+        mapped.transition(State::STOPPED);
+        mapped.transition(State::IDLE);
+    }
+    double mapSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    
+    MotorStateMachine table(State::IDLE);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < CYCLES; ++i) {
+        table.dispatch(Event::START);
+        table.dispatch(Event::STOP);
+        table.dispatch(Event::RESET);
+    }
+    double tableSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    
+    constexpr double TRANSITIONS = CYCLES * 3.0;
+    cout << "  map<State, function> : " << static_cast<long long>(TRANSITIONS / mapSeconds / 1e3)
+         << "k transitions/sec (enters " << enters << ")" << endl;
+    cout << "  constexpr table      : " << static_cast<long long>(TRANSITIONS / tableSeconds / 1e3)
+         << "k transitions/sec (starts " << table.context().starts << ")" << endl;
+}
+
+/*
+ * FsmEngine<Def> - 인스턴스 수백만 개를 한 엔진이 관리하는 상태 기계
+ *  - 인스턴스 상태는 uint8_t 배열 하나 (SoA), 인스턴스별 데이터는 Def::Columns의 열 배열
+ *  - post(id, event)로 모은 뒤 flush(): (현재 상태, event) 칸별로 counting sort →
+ *    같은 행의 onBatch가 연속된 id 목록 전체에 한 번 실행
+ *  - broadcast(event): action 없는 event는 16칸 상태 LUT를 SIMD shuffle로 전체 배열에 적용
+ *  - 한 flush 안의 event는 모두 flush 시작 시점 상태 기준 (같은 id가 두 번 오면 마지막 행이 이김)
+ */
+template<typename S, typename E, typename Columns>
+struct BatchTransition {
+    S from;
+    E event;
+    S to;
+    void (*onBatch)(span<const uint32_t> ids, Columns&) = nullptr;
+};
+
+// 빌드 플래그: -DFSM_SIMD=0 이면 broadcast도 scalar 루프만 사용
+#ifndef FSM_SIMD
+#define FSM_SIMD 1
+#endif
+
+// states[i] = lut[states[i]], lut는 16칸 (상태 < 16)
+using RemapKernel = void (*)(uint8_t* states, size_t n, const uint8_t* lut);
+
+static void remapScalar(uint8_t* states, size_t n, const uint8_t* lut) {
+    for (size_t i = 0; i < n; ++i) states[i] = lut[states[i]];
+}
+
+#if FSM_SIMD && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define HAVE_SSSE3_REMAP 1
+__attribute__((target("ssse3"))) static void remapSsse3(uint8_t* states, size_t n, const uint8_t* lut) {
+    const __m128i table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut));
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(states + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(states + i), _mm_shuffle_epi8(table, s));
+    }
+    remapScalar(states + i, n - i, lut);
+}
+#elif FSM_SIMD && defined(__aarch64__)
+#define HAVE_NEON_REMAP 1
+static void remapNeon(uint8_t* states, size_t n, const uint8_t* lut) {
+    const uint8x16_t table = vld1q_u8(lut);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) vst1q_u8(states + i, vqtbl1q_u8(table, vld1q_u8(states + i)));
+    remapScalar(states + i, n - i, lut);
+}
+#endif
+
+static pair<const char*, RemapKernel> remapKernel() {
+    static const pair<const char*, RemapKernel> selected = []() -> pair<const char*, RemapKernel> {
+#if defined(HAVE_SSSE3_REMAP)
+        if (__builtin_cpu_supports("ssse3")) return {"ssse3", remapSsse3};
+#elif defined(HAVE_NEON_REMAP)
+        return {"neon", remapNeon};
+#endif
+        return {"scalar", remapScalar};
+    }();
+    return selected;
+}
+
+template<typename Def>
+class FsmEngine {
+    using S = typename Def::StateType;
+    using E = typename Def::EventType;
+    using Columns = typename Def::Columns;
+    static constexpr size_t CELLS = Def::STATES * Def::EVENTS;
+    static constexpr uint8_t NONE = 0xFF;
+    static_assert(Def::STATES <= 16, "state byte must index a 16-entry shuffle table");
+    static_assert(Def::table.size() < NONE);
+    
+    static constexpr size_t cell(size_t s, size_t e) { return s * Def::EVENTS + e; }
+    
+    static constexpr array<uint8_t, CELLS> ROW = []() {
+        array<uint8_t, CELLS> rows{};
+        for (auto& r : rows) r = NONE;
+        for (size_t i = 0; i < Def::table.size(); ++i) {
+            const auto& t = Def::table[i];
+            rows[cell(static_cast<size_t>(t.from), static_cast<size_t>(t.event))] = static_cast<uint8_t>(i);
+        }
+        return rows;
+    }();
+    
+    // event별 16칸 LUT: 표에 없는 전이는 제자리
+    static constexpr array<array<uint8_t, 16>, Def::EVENTS> NEXT = []() {
+        array<array<uint8_t, 16>, Def::EVENTS> next{};
+        for (size_t e = 0; e < Def::EVENTS; ++e) {
+            for (size_t s = 0; s < 16; ++s) next[e][s] = static_cast<uint8_t>(s);
+            for (const auto& t : Def::table)
+                if (static_cast<size_t>(t.event) == e) next[e][static_cast<size_t>(t.from)] = static_cast<uint8_t>(t.to);
+        }
+        return next;
+    }();
+    
+    static constexpr array<bool, Def::EVENTS> HAS_ACTION = []() {
+        array<bool, Def::EVENTS> has{};
+        for (const auto& t : Def::table)
+            if (t.onBatch) has[static_cast<size_t>(t.event)] = true;
+        return has;
+    }();
+    
+    vector<uint8_t> states;
+    Columns columns;
+    vector<uint32_t> pendingIds;
+    vector<uint8_t> pendingEvents;
+    vector<uint16_t> pendingCells;
+    vector<uint32_t> sorted;
+    array<uint32_t, CELLS + 1> offsets{};
+    size_t rejected = 0;
+    
+public:
+    FsmEngine(size_t count, S initial) : states(count, static_cast<uint8_t>(initial)) { columns.resize(count); }
+    
+    size_t size() const { return states.size(); }
+    S state(uint32_t id) const { return static_cast<S>(states[id]); }
+    Columns& data() { return columns; }
+    size_t rejectedEvents() const { return rejected; }
+    double bytesPerInstance() const { return static_cast<double>(states.size() + columns.bytes()) / states.size(); }
+    
+    void reserveBatch(size_t n) {
+        pendingIds.reserve(n);
+        pendingEvents.reserve(n);
+        pendingCells.reserve(n);
+        sorted.reserve(n);
+    }
+    
+    void post(uint32_t id, E event) {
+        pendingIds.push_back(id);
+        pendingEvents.push_back(static_cast<uint8_t>(event));
+    }
+    
+    // 쌓인 event를 (상태, event) 칸별로 묶어 실행, 적용된 전이 수 반환
+    size_t flush() {
+        size_t n = pendingIds.size();
+        offsets.fill(0);
+        pendingCells.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            uint16_t c = static_cast<uint16_t>(cell(states[pendingIds[i]], pendingEvents[i]));
+            pendingCells[i] = c;
+            ++offsets[c + 1];
+        }
+        for (size_t c = 0; c < CELLS; ++c) offsets[c + 1] += offsets[c];
+        array<uint32_t, CELLS> cursor;
+        copy_n(offsets.begin(), CELLS, cursor.begin());
+        sorted.resize(n);
+        for (size_t i = 0; i < n; ++i) sorted[cursor[pendingCells[i]]++] = pendingIds[i];
+        
+        size_t applied = 0;
+        for (size_t c = 0; c < CELLS; ++c) {
+            span<const uint32_t> ids(sorted.data() + offsets[c], offsets[c + 1] - offsets[c]);
+            if (ids.empty()) continue;
+            if (ROW[c] == NONE) {
+                rejected += ids.size();
+                continue;
+            }
+            const auto& t = Def::table[ROW[c]];
+            if (t.onBatch) t.onBatch(ids, columns);
+            const uint8_t to = static_cast<uint8_t>(t.to);
+            for (uint32_t id : ids) states[id] = to;
+            applied += ids.size();
+        }
+        pendingIds.clear();
+        pendingEvents.clear();
+        return applied;
+    }
+    
+    // 모든 인스턴스에 같은 event (표에 없는 상태는 그대로)
+    void broadcast(E event) {
+        size_t e = static_cast<size_t>(event);
+        if (HAS_ACTION[e]) {        // onBatch가 id 목록을 받아야 하므로 묶음 경로
+            for (uint32_t id = 0; id < states.size(); ++id) post(id, event);
+            flush();
+            return;
+        }
+        remapKernel().second(states.data(), states.size(), NEXT[e].data());
+    }
+    
+    size_t countIn(S s) const { return static_cast<size_t>(std::count(states.begin(), states.end(), static_cast<uint8_t>(s))); }
+};
+
+// 예제: 연결마다 하나씩 있는 상태 기계 (상태 1바이트 + 재시도 횟수 1바이트)
+enum class ConnState : uint8_t { CLOSED, CONNECTING, OPEN, BACKOFF };
+enum class ConnEvent : uint8_t { CONNECT, ESTABLISHED, FAIL, CLOSE, TICK };
+
+struct ConnectionColumns {
+    vector<uint8_t> retries;
+    void resize(size_t n) { retries.resize(n); }
+    size_t bytes() const { return retries.size(); }
+};
+
+struct ConnectionFsm {
+    using StateType = ConnState;
+    using EventType = ConnEvent;
+    using Columns = ConnectionColumns;
+    static constexpr size_t STATES = 4;
+    static constexpr size_t EVENTS = 5;
+    
+    static void countRetry(span<const uint32_t> ids, ConnectionColumns& c) {
+        for (uint32_t id : ids) c.retries[id] = static_cast<uint8_t>(c.retries[id] + (c.retries[id] < 255));
+    }
+    
+    using Row = BatchTransition<ConnState, ConnEvent, ConnectionColumns>;
+    static constexpr array table = {
+        Row{ConnState::CLOSED,     ConnEvent::CONNECT,     ConnState::CONNECTING},
+        Row{ConnState::CONNECTING, ConnEvent::ESTABLISHED, ConnState::OPEN},
+        Row{ConnState::CONNECTING, ConnEvent::FAIL,        ConnState::BACKOFF, countRetry},
+        Row{ConnState::OPEN,       ConnEvent::FAIL,        ConnState::BACKOFF, countRetry},
+        Row{ConnState::OPEN,       ConnEvent::CLOSE,       ConnState::CLOSED},
+        Row{ConnState::BACKOFF,    ConnEvent::TICK,        ConnState::CONNECTING},
+    };
+};
+
+static void benchmarkFsmEngine() {
+    constexpr size_t INSTANCES = 4'000'000;
+    
+    // map 버전: 인스턴스 하나 + onEnter 두 개의 메모리
+    size_t before = allocatedBytes;
+    {
+        vector<StateMachine> machines(1000, StateMachine(false));
+        for (auto& m : machines) {
+            m.setOnEnter(State::RUNNING, []() {});
+            m.setOnEnter(State::STOPPED, []() {});
+        }
+        cout << "  map StateMachine : " << (allocatedBytes - before) / 1000.0 << " bytes/instance" << endl;
+    }
+    
+    FsmEngine<ConnectionFsm> engine(INSTANCES, ConnState::CLOSED);
+    cout << "  FsmEngine        : " << engine.bytesPerInstance() << " bytes/instance, broadcast kernel "
+         << remapKernel().first << endl;
+    
+    constexpr int ROUNDS = 30;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; ++r) {
+        engine.broadcast(ConnEvent::CONNECT);
+        engine.broadcast(ConnEvent::ESTABLISHED);
+        engine.broadcast(ConnEvent::CLOSE);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  broadcast        : " << static_cast<long long>(ROUNDS * 3.0 * INSTANCES / seconds / 1e6)
+         << "M transitions/sec" << endl;
+    
+    // 임의의 인스턴스에 임의의 event → flush로 (상태, event)별 묶음 실행
+    constexpr size_t BATCH = 1'000'000;
+    mt19937 rng(7);
+    vector<pair<uint32_t, ConnEvent>> events(BATCH);
+    for (auto& [id, e] : events) {
+        id = static_cast<uint32_t>(rng() % INSTANCES);
+        e = static_cast<ConnEvent>(rng() % ConnectionFsm::EVENTS);
+    }
+    engine.broadcast(ConnEvent::CONNECT);
+    engine.reserveBatch(BATCH);
+    size_t applied = 0;
+    start = chrono::steady_clock::now();
+    for (int r = 0; r < 3; ++r) {
+        for (auto [id, e] : events) engine.post(id, e);
+        applied += engine.flush();
+    }
+    seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  post + flush     : " << static_cast<long long>(3.0 * BATCH / seconds / 1e6) << "M events/sec (applied "
+         << applied << ", rejected " << engine.rejectedEvents() << ", backoff " << engine.countIn(ConnState::BACKOFF)
+         << ")" << endl;
+}
+
 int main() {
     cout << "\n=== C++ State Machine ===" << endl;
     
@@ -35,5 +485,35 @@ int main() {
     sm.transition(State::STOPPED);
     sm.transition(State::IDLE);
     
+    cout << "\n=== Table-driven State Machine ===" << endl;
+    MotorStateMachine motor(State::IDLE, MotorContext{.enabled = true, .verbose = true});
+    cout << "STOP in IDLE accepted? " << boolalpha << motor.dispatch(Event::STOP) << endl;
+    for (Event e : {Event::START, Event::STOP, Event::RESET}) {
+        bool accepted = motor.dispatch(e);
+        cout << "event " << static_cast<int>(e) << " accepted=" << accepted << ", state=" << static_cast<int>(motor.getState())
+             << endl;
+    }
+    
+    MotorStateMachine disabled(State::IDLE, MotorContext{.enabled = false});
+    cout << "START while disabled (guard) accepted? " << disabled.dispatch(Event::START) << noboolalpha << endl;
+    
+    cout << "\n=== Benchmark: transitions/sec ===" << endl;
+    benchmarkStateMachines();
+    
+    cout << "\n=== FsmEngine: one state byte per instance ===" << endl;
+    {
+        FsmEngine<ConnectionFsm> small(8, ConnState::CLOSED);
+        small.broadcast(ConnEvent::CONNECT);
+        for (uint32_t id = 0; id < 8; ++id) small.post(id, id % 2 ? ConnEvent::FAIL : ConnEvent::ESTABLISHED);
+        small.post(0, ConnEvent::TICK);     // OPEN이 아닌 CONNECTING 기준으로 평가 → 표에 없음 → 거부
+        size_t applied = small.flush();
+        cout << "applied " << applied << ", rejected " << small.rejectedEvents() << ", open "
+             << small.countIn(ConnState::OPEN) << ", backoff " << small.countIn(ConnState::BACKOFF)
+             << ", retries[1]=" << static_cast<int>(small.data().retries[1]) << endl;
+    }
+    
+    cout << "\n=== Benchmark: FsmEngine (4M instances) ===" << endl;
+    benchmarkFsmEngine();
+    
     return 0;
 }
@@ -1,8 +1,20 @@
 /* C++ Factory - 템플릿과 unique_ptr */
 #include <iostream>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <map>
+#include <new>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 using namespace std;
 
 class Product {
@@ -39,6 +51,217 @@ public:
     }
 };
 
+/*
+ * ProductRegistry - 이름 → TypeId 등록표 (자기 등록)
+ *  - 각 제품이 정적 초기화 때 add<T>("이름")로 등록 → 번호(TypeId) 부여
+ *  - 설정 파일의 이름은 resolve()로 시작 시 한 번만 해시 조회, 이후 create(TypeId)는 배열 인덱스 (문자열 비교 없음)
+ *  - 생성 위치: heap / ProductPool(고정 블록) / ProductArena(bump), handle의 deleter가 출처를 기억
+ */
+using TypeId = uint32_t;
+constexpr TypeId INVALID_TYPE = UINT32_MAX;
+
+struct ProductDeleter {
+    void (*release)(void* source, Product* p) = nullptr;
+    void* source = nullptr;
+    void operator()(Product* p) const { release(source, p); }
+};
+
+using ProductHandle = unique_ptr<Product, ProductDeleter>;
+
+/*
+ * ProductPool - 11_memory_pool.cpp의 MemoryPool과 같은 free list 구조
+ *  - 블록 크기를 타입 대신 런타임 값으로 (등록된 제품 중 최대 크기)
+ */
+class ProductPool {
+    struct FreeBlock { FreeBlock* next; };
+    size_t blockSize;
+    vector<unique_ptr<byte[]>> chunks;
+    FreeBlock* freeList = nullptr;
+    size_t blocksPerChunk;
+    
+    void grow() {
+        chunks.emplace_back(new byte[blockSize * blocksPerChunk]);
+        byte* base = chunks.back().get();
+        for (size_t i = blocksPerChunk; i-- > 0;) freeList = ::new (base + i * blockSize) FreeBlock{freeList};
+    }
+public:
+    ProductPool(size_t blockSize, size_t blocksPerChunk = 1024)
+        : blockSize((max(blockSize, sizeof(FreeBlock)) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t)),
+          blocksPerChunk(blocksPerChunk) {}
+    ProductPool(const ProductPool&) = delete;
+    ProductPool& operator=(const ProductPool&) = delete;
+    
+    size_t capacity() const { return blockSize; }
+    void* allocate() {
+        if (!freeList) grow();
+        FreeBlock* block = freeList;
+        freeList = block->next;
+        return block;
+    }
+    void deallocate(void* p) { freeList = ::new (p) FreeBlock{freeList}; }
+};
+
+// ProductArena - 호출자가 준 버퍼에 bump 할당, reset()으로 한 번에 비움 (개별 해제는 소멸자만 호출)
+class ProductArena {
+    span<byte> buffer;
+    size_t used = 0;
+    size_t live = 0;
+public:
+    explicit ProductArena(span<byte> buffer) : buffer(buffer) {}
+    // 오프셋이 아니라 실제 주소를 정렬 (버퍼 시작이 max_align_t 정렬이 아닐 수 있음)
+    void* allocate(size_t size, size_t align) {
+        uintptr_t base = reinterpret_cast<uintptr_t>(buffer.data());
+        size_t offset = static_cast<size_t>(((base + used + align - 1) & ~(uintptr_t{align} - 1)) - base);
+        if (offset > buffer.size() || size > buffer.size() - offset) throw bad_alloc();
+        used = offset + size;
+        ++live;
+        return buffer.data() + offset;
+    }
+    void released() { --live; }
+    void reset() {
+        if (live != 0) throw logic_error("ProductArena::reset with live products");
+        used = 0;
+    }
+    size_t bytesUsed() const { return used; }
+};
+
+class ProductRegistry {
+    struct Entry {
+        string name;
+        size_t size;
+        size_t align;
+        Product* (*construct)(void* where);
+    };
+    vector<Entry> entries;
+    unordered_map<string, TypeId> byName;
+    size_t largest = 0;
+    
+    static void releaseHeap(void*, Product* p) {
+        p->~Product();
+        ::operator delete(static_cast<void*>(p));
+    }
+    static void releasePool(void* pool, Product* p) {
+        p->~Product();
+        static_cast<ProductPool*>(pool)->deallocate(p);
+    }
+    static void releaseArena(void* arena, Product* p) {
+        p->~Product();
+        static_cast<ProductArena*>(arena)->released();
+    }
+    
+public:
+    static ProductRegistry& instance() {
+        static ProductRegistry registry;
+        return registry;
+    }
+    
+    template<typename T>
+    TypeId add(string name) {
+        static_assert(is_base_of_v<Product, T> && alignof(T) <= alignof(max_align_t));
+        if (byName.count(name)) throw logic_error("product registered twice: " + name);
+        TypeId id = static_cast<TypeId>(entries.size());
+        entries.push_back({name, sizeof(T), alignof(T), [](void* where) -> Product* { return ::new (where) T(); }});
+        byName.emplace(std::move(name), id);
+        largest = max(largest, sizeof(T));
+        return id;
+    }
+    
+    // 설정 로드 시 한 번: 이름 → 번호 (없으면 INVALID_TYPE)
+    TypeId resolve(string_view name) const {
+        auto it = byName.find(string(name));
+        return it == byName.end() ? INVALID_TYPE : it->second;
+    }
+    
+    const string& nameOf(TypeId id) const { return entryOf(id).name; }
+    size_t largestProduct() const { return largest; }
+    
+    ProductHandle create(TypeId id) const {
+        const Entry& e = entryOf(id);
+        void* where = ::operator new(e.size);
+        return ProductHandle(construct(e, where, [&]() { ::operator delete(where); }), {releaseHeap, nullptr});
+    }
+    
+    ProductHandle create(TypeId id, ProductPool& pool) const {
+        const Entry& e = entryOf(id);
+        if (e.size > pool.capacity()) throw length_error("product larger than pool block: " + e.name);
+        void* where = pool.allocate();
+        return ProductHandle(construct(e, where, [&]() { pool.deallocate(where); }), {releasePool, &pool});
+    }
+    
+    ProductHandle create(TypeId id, ProductArena& arena) const {
+        const Entry& e = entryOf(id);
+        void* where = arena.allocate(e.size, e.align);
+        return ProductHandle(construct(e, where, [&]() { arena.released(); }), {releaseArena, &arena});
+    }
+    
+private:
+    // resolve() 실패(INVALID_TYPE)나 다른 레지스트리의 번호가 그대로 들어와도 배열 밖을 읽지 않음
+    const Entry& entryOf(TypeId id) const {
+        if (id >= entries.size()) throw out_of_range("unknown product type id " + to_string(id));
+        return entries[id];
+    }
+
+    // 생성자가 던지면 메모리를 출처에 돌려줌
+    template<typename Undo>
+    static Product* construct(const Entry& e, void* where, Undo undo) {
+        try {
+            return e.construct(where);
+        } catch (...) {
+            undo();
+            throw;
+        }
+    }
+};
+
+// 자기 등록: 제품 정의 옆에 한 줄
+template<typename T>
+struct RegisterProduct {
+    const TypeId id;
+    explicit RegisterProduct(string name) : id(ProductRegistry::instance().add<T>(std::move(name))) {}
+};
+
+class ProductC : public Product {
+    array<double, 8> calibration{};     // 크기가 다른 제품
+public:
+    void use() override { cout << "  → ProductC 사용 (" << sizeof(*this) << " bytes)" << endl; }
+};
+
+static const RegisterProduct<ProductA> registerA("A");
+static const RegisterProduct<ProductB> registerB("B");
+static const RegisterProduct<ProductC> registerC("C");
+
+// 설정에서 읽은 이름 배열로 생성/해제 반복
+static void benchmarkFactory() {
+    constexpr int ROUNDS = 200000;
+    const vector<string> config = {"A", "B", "C", "B"};
+    auto& registry = ProductRegistry::instance();
+    vector<TypeId> ids;
+    for (const auto& name : config) ids.push_back(registry.resolve(name));
+    size_t live = 0;
+    
+    auto noop = []() {};
+    auto run = [&](const char* label, auto&& createOne, auto&& endOfRound) {
+        auto start = chrono::steady_clock::now();
+        for (int r = 0; r < ROUNDS; ++r) {
+            for (size_t i = 0; i < ids.size(); ++i) live += createOne(i) != nullptr;
+            endOfRound();
+        }
+        double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / (ROUNDS * ids.size());
+        cout << "  " << label << ": " << ns << " ns/create+destroy" << endl;
+    };
+    
+    // 기존 Factory는 C를 모르므로 A로 대체
+    run("Factory::create(string) ", [&](size_t i) { return Factory::create(config[i] == "C" ? "A" : config[i]); }, noop);
+    run("registry heap           ", [&](size_t i) { return registry.create(ids[i]); }, noop);
+    ProductPool pool(registry.largestProduct());
+    run("registry ProductPool    ", [&](size_t i) { return registry.create(ids[i], pool); }, noop);
+    vector<byte> storage(4096);
+    ProductArena arena(storage);
+    run("registry ProductArena   ", [&](size_t i) { return registry.create(ids[i], arena); },
+        [&arena]() { arena.reset(); });    // 프레임 끝: 한 번에 비움
+    cout << "  (created " << live << ")" << endl;
+}
+
 int main() {
     cout << "\n=== C++ Factory Pattern ===" << endl;
     
@@ -52,5 +275,27 @@ int main() {
     auto product = GenericFactory<ProductA>::create();
     product->use();
     
+    cout << "\n=== Registry Factory (TypeId + placement) ===" << endl;
+    auto& registry = ProductRegistry::instance();
+    TypeId fromConfig = registry.resolve("C");      // 설정 로드 시 한 번
+    cout << "resolve(\"C\") = " << fromConfig << ", resolve(\"Z\") valid? " << boolalpha
+         << (registry.resolve("Z") != INVALID_TYPE) << noboolalpha << endl;
+    ProductPool pool(registry.largestProduct());
+    alignas(max_align_t) array<byte, 256> frame;
+    ProductArena arena(frame);
+    {
+        auto onHeap = registry.create(registerA.id);
+        auto inPool = registry.create(registerB.id, pool);
+        auto inArena = registry.create(fromConfig, arena);
+        onHeap->use();
+        inPool->use();
+        inArena->use();
+        cout << "arena used " << arena.bytesUsed() << " bytes" << endl;
+    }   // 각 handle이 자기 출처로 반환
+    arena.reset();
+    
+    cout << "\n=== Benchmark: create + destroy ===" << endl;
+    benchmarkFactory();
+    
     return 0;
 }
@@ -3,16 +3,92 @@
 #include <vector>
 #include <functional>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "reclaim/reclaim.h"
 using namespace std;
 
-template<typename T>
+// 04_callback_pattern.cpp의 function_ref / InplaceFunction과 같은 구조 (요약본)
+template<typename Signature>
+class function_ref;
+
+template<typename R, typename... Args>
+class function_ref<R(Args...)> {
+    void* object = nullptr;
+    R (*thunk)(void*, Args&&...) = nullptr;
+public:
+    template<typename F>
+        requires(!is_same_v<remove_cvref_t<F>, function_ref> && is_invocable_r_v<R, F&, Args...>)
+    function_ref(F&& f) noexcept
+        : object(const_cast<void*>(static_cast<const void*>(addressof(f)))),
+          thunk([](void* o, Args&&... args) -> R {
+              return invoke(*static_cast<remove_reference_t<F>*>(o), forward<Args>(args)...);
+          }) {}
+    R operator()(Args... args) const { return thunk(object, forward<Args>(args)...); }
+};
+
+template<typename Signature, size_t Capacity = 32>
+class InplaceFunction;
+
+template<typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+    struct Ops {
+        R (*invoke)(void*, Args&&...);
+        void (*moveTo)(void* from, void* to) noexcept;
+        void (*destroy)(void*) noexcept;
+    };
+    template<typename Fn>
+    static constexpr Ops opsFor{
+        [](void* self, Args&&... args) -> R { return invoke(*static_cast<Fn*>(self), forward<Args>(args)...); },
+        [](void* from, void* to) noexcept { ::new (to) Fn(std::move(*static_cast<Fn*>(from))); },
+        [](void* self) noexcept { static_cast<Fn*>(self)->~Fn(); },
+    };
+    alignas(max_align_t) mutable unsigned char storage[Capacity];
+    const Ops* ops = nullptr;
+public:
+    template<typename F>
+        requires(!is_same_v<remove_cvref_t<F>, InplaceFunction> && is_invocable_r_v<R, decay_t<F>&, Args...>)
+    InplaceFunction(F&& f) {
+        using Fn = decay_t<F>;
+        static_assert(sizeof(Fn) <= Capacity, "callable does not fit InplaceFunction: raise Capacity");
+        static_assert(alignof(Fn) <= alignof(max_align_t) && is_nothrow_move_constructible_v<Fn>);
+        ::new (storage) Fn(std::forward<F>(f));
+        ops = &opsFor<Fn>;
+    }
+    InplaceFunction(InplaceFunction&& other) noexcept : ops(other.ops) {
+        if (!ops) return;
+        ops->moveTo(other.storage, storage);
+        ops->destroy(other.storage);        // 원본은 빈 상태로 → 소유권이 한쪽에만
+        other.ops = nullptr;
+    }
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+    ~InplaceFunction() {
+        if (ops) ops->destroy(storage);
+    }
+    R operator()(Args... args) const { return ops->invoke(storage, forward<Args>(args)...); }
+};
+
+// Observer 저장 타입 선택: std::function (기본) / InplaceFunction (할당 없음) / function_ref (비소유)
+template<typename T, typename Observer = function<void(const T&)>>
 class Subject {
-    vector<function<void(const T&)>> observers;
+    vector<Observer> observers;
     T data;
     
 public:
-    void attach(function<void(const T&)> obs) {
-        observers.push_back(obs);
+    void attach(Observer obs) {
+        observers.push_back(std::move(obs));
     }
     
     void setData(const T& newData) {
@@ -28,6 +104,273 @@ public:
     }
 };
 
+/*
+ * EventQueue - 10_event_queue.cpp의 EventQueue와 같은 push/process 인터페이스 (축약본)
+ *  - 생산자 스레드에서 push할 수 있도록 mutex로 보호, process()는 소비 스레드에서
+ *  - process()는 큐를 통째로 swap해서 lock 밖에서 실행
+ */
+class EventQueue {
+    mutex lock;
+    vector<function<void()>> events;
+    vector<function<void()>> running;
+public:
+    void push(function<void()> event) {
+        lock_guard<mutex> guard(lock);
+        events.push_back(std::move(event));
+    }
+    size_t process() {
+        {
+            lock_guard<mutex> guard(lock);
+            swap(events, running);
+        }
+        size_t count = running.size();
+        for (auto& event : running) event();
+        running.clear();
+        return count;
+    }
+};
+
+/*
+ * DeliveringSubject<T> - 전달 방식을 고를 수 있는 Subject
+ *  - Immediate: setData마다 모든 observer 호출 (기존 Subject와 같음, 로그 없음)
+ *  - Coalesce : 최신 값만 보관, tick()마다 바뀐 경우에만 한 번 전달
+ *  - Batch    : tick() 사이의 모든 값을 모아 span으로 전달 (버퍼 두 개를 번갈아 써서 재할당 없음)
+ *  - Async    : 최신 값으로 합치고, 전달이 예약돼 있지 않을 때만 EventQueue에 하나 push
+ *               → 큐에는 Subject당 최대 한 건, setData는 다른 스레드에서 호출 가능
+ */
+enum class Delivery { Immediate, Coalesce, Batch, Async };
+
+template<typename T>
+class DeliveringSubject {
+    Delivery mode;
+    EventQueue* queue;
+    vector<function<void(const T&)>> observers;
+    vector<function<void(span<const T>)>> batchObservers;
+    T latest{};
+    bool dirty = false;
+    vector<T> pending, delivering;
+    mutex latestLock;                   // Async: setData(생산자) ↔ deliverLatest(큐 소비자)
+    atomic<bool> scheduled{false};
+    size_t deliveries = 0;
+    
+    void deliver(const T& value) {
+        ++deliveries;
+        for (auto& obs : observers) obs(value);
+    }
+    
+    void deliverLatest() {
+        scheduled.store(false, memory_order_release);     // 이후 setData는 새 전달을 예약
+        T value;
+        {
+            lock_guard<mutex> guard(latestLock);
+            value = latest;
+        }
+        deliver(value);
+    }
+    
+public:
+    explicit DeliveringSubject(Delivery mode, EventQueue* queue = nullptr) : mode(mode), queue(queue) {
+        if (mode == Delivery::Async && !queue) throw invalid_argument("Async delivery needs an EventQueue");
+    }
+    
+    void attach(function<void(const T&)> obs) { observers.push_back(std::move(obs)); }
+    // Batch 전용: 마지막 전달 이후의 모든 값 (span은 호출 동안만 유효)
+    void attachBatch(function<void(span<const T>)> obs) { batchObservers.push_back(std::move(obs)); }
+    
+    void setData(const T& value) {
+        switch (mode) {
+        case Delivery::Immediate:
+            deliver(value);
+            break;
+        case Delivery::Coalesce:
+            latest = value;
+            dirty = true;
+            break;
+        case Delivery::Batch:
+            pending.push_back(value);
+            break;
+        case Delivery::Async:
+            {
+                lock_guard<mutex> guard(latestLock);
+                latest = value;
+            }
+            if (!scheduled.exchange(true, memory_order_acq_rel)) queue->push([this]() { deliverLatest(); });
+            break;
+        }
+    }
+    
+    // 프레임/타이머 주기마다 호출 (Immediate, Async에서는 아무 일도 없음)
+    void tick() {
+        if (mode == Delivery::Coalesce && dirty) {
+            dirty = false;
+            deliver(latest);
+        } else if (mode == Delivery::Batch && !pending.empty()) {
+            swap(pending, delivering);
+            ++deliveries;
+            span<const T> values(delivering);
+            for (auto& obs : batchObservers) obs(values);
+            for (auto& obs : observers) obs(values.back());     // 단일 값 observer는 최신 값만
+            delivering.clear();                                 // capacity 유지
+        }
+    }
+    
+    size_t deliveryCount() const { return deliveries; }
+};
+
+// 10 kHz 센서를 흉내: tick 하나당 UPDATES_PER_TICK번 setData, observer 4개가 값마다 약간의 일을 함
+static void benchmarkDelivery(const char* name, Delivery mode) {
+    constexpr int TICKS = 2000;
+    constexpr int UPDATES_PER_TICK = 100;
+    EventQueue queue;
+    DeliveringSubject<double> subject(mode, &queue);
+    double acc = 0;
+    for (int i = 0; i < 4; ++i) {
+        if (mode == Delivery::Batch)
+            subject.attachBatch([&acc](span<const double> values) {
+                for (double v : values) acc += v * 0.5;
+            });
+        else
+            subject.attach([&acc](const double& v) { acc += v * 0.5; });
+    }
+    auto start = chrono::steady_clock::now();
+    for (int t = 0; t < TICKS; ++t) {
+        for (int u = 0; u < UPDATES_PER_TICK; ++u) subject.setData(t * UPDATES_PER_TICK + u);
+        subject.tick();
+        queue.process();
+    }
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / (TICKS * UPDATES_PER_TICK);
+    cout << "  " << name << ": " << ns << " ns/update, " << subject.deliveryCount() << " deliveries (acc " << acc << ")"
+         << endl;
+}
+
+/*
+ * CowObserverList<Fn, Domain> - copy-on-write 구독자 목록
+ *  - notify: Guard + protect 한 번으로 스냅샷 순회 (lock 없음, attach/detach와 동시 가능)
+ *  - attach/detach: writer mutex 안에서 배열 복사 → 포인터 교체 → 옛 배열 retire
+ *  - 회수 방식은 reclaim/reclaim.h의 도메인 (기본 EpochDomain, HazardDomain도 같은 API)
+ *  - 콜백 객체는 shared_ptr로 공유 → 배열 복사는 포인터 복사뿐
+ *  - subscribe()는 소멸 시 자동 해지되는 Subscription을 돌려줌 (목록보다 먼저 소멸해야 함)
+ */
+template<typename Fn, reclaim::ReclamationDomain Domain = reclaim::EpochDomain>
+class CowObserverList {
+    struct Entry {
+        uint64_t id;
+        shared_ptr<const Fn> callback;
+    };
+    struct Snapshot {
+        vector<Entry> entries;
+    };
+    
+    atomic<const Snapshot*> current{new Snapshot()};
+    mutex writerLock;
+    uint64_t nextId = 1;
+    
+    // writerLock 안에서 호출 (옛 배열은 도메인의 스레드별 retire 목록으로)
+    void publish(const Snapshot* next) {
+        Domain::global().retire(current.exchange(next, memory_order_seq_cst));
+    }
+    
+public:
+    class Subscription {
+        CowObserverList* list = nullptr;
+        uint64_t id = 0;
+    public:
+        Subscription() = default;
+        Subscription(CowObserverList* list, uint64_t id) : list(list), id(id) {}
+        Subscription(Subscription&& other) noexcept : list(exchange(other.list, nullptr)), id(other.id) {}
+        Subscription& operator=(Subscription&& other) noexcept {
+            if (this != &other) {
+                reset();
+                list = exchange(other.list, nullptr);
+                id = other.id;
+            }
+            return *this;
+        }
+        ~Subscription() { reset(); }
+        void reset() {
+            if (list) exchange(list, nullptr)->detach(id);
+        }
+    };
+    
+    CowObserverList() = default;
+    CowObserverList(const CowObserverList&) = delete;
+    CowObserverList& operator=(const CowObserverList&) = delete;
+    
+    // 소멸 시점에는 notify 중인 스레드가 없어야 함 (retire된 옛 배열은 도메인이 해제)
+    ~CowObserverList() { delete current.load(); }
+    
+    uint64_t attach(Fn callback) {
+        lock_guard<mutex> guard(writerLock);
+        auto* next = new Snapshot(*current.load(memory_order_relaxed));
+        uint64_t id = nextId++;
+        next->entries.push_back({id, make_shared<const Fn>(std::move(callback))});
+        publish(next);
+        return id;
+    }
+    
+    [[nodiscard]] Subscription subscribe(Fn callback) { return Subscription(this, attach(std::move(callback))); }
+    
+    bool detach(uint64_t id) {
+        lock_guard<mutex> guard(writerLock);
+        const Snapshot* now = current.load(memory_order_relaxed);
+        auto it = find_if(now->entries.begin(), now->entries.end(), [id](const Entry& e) { return e.id == id; });
+        if (it == now->entries.end()) return false;
+        auto* next = new Snapshot();
+        next->entries.reserve(now->entries.size() - 1);
+        for (const Entry& e : now->entries)
+            if (e.id != id) next->entries.push_back(e);
+        publish(next);
+        return true;
+    }
+    
+    template<typename... Args>
+    void notify(const Args&... args) {
+        typename Domain::Guard guard(Domain::global());
+        const Snapshot* snapshot = guard.protect(current);
+        for (const Entry& e : snapshot->entries) (*e.callback)(args...);
+    }
+    
+    size_t size() {
+        typename Domain::Guard guard(Domain::global());
+        return guard.protect(current)->entries.size();
+    }
+    
+    // 회수 대기 중 / 회수 완료된 노드 수 (도메인 전체, 끝난 스레드의 retire 목록까지 collect 후)
+    pair<size_t, size_t> reclamationStats() {
+        Domain::global().collect();
+        return {Domain::global().pending(), Domain::global().reclaimed()};
+    }
+};
+
+// 여러 스레드에서 publish/subscribe 가능한 Subject
+template<typename T>
+class ConcurrentSubject {
+    CowObserverList<function<void(const T&)>> observers;
+public:
+    using Subscription = typename CowObserverList<function<void(const T&)>>::Subscription;
+    
+    [[nodiscard]] Subscription subscribe(function<void(const T&)> obs) { return observers.subscribe(std::move(obs)); }
+    void publish(const T& value) { observers.notify(value); }
+    size_t subscribers() { return observers.size(); }
+    pair<size_t, size_t> reclamationStats() { return observers.reclamationStats(); }
+};
+
+// 비교용: notify 내내 mutex를 잡는 방식
+template<typename T>
+class LockedSubject {
+    mutex lock;
+    vector<function<void(const T&)>> observers;
+public:
+    void attach(function<void(const T&)> obs) {
+        lock_guard<mutex> guard(lock);
+        observers.push_back(std::move(obs));
+    }
+    void publish(const T& value) {
+        lock_guard<mutex> guard(lock);
+        for (auto& obs : observers) obs(value);
+    }
+};
+
 int main() {
     cout << "\n=== C++ Observer Pattern ===" << endl;
     
@@ -44,5 +387,109 @@ int main() {
     subject.setData(10);
     subject.setData(20);
     
+    cout << "\n=== Subject with InplaceFunction / function_ref ===" << endl;
+    int total = 0;
+    Subject<int, InplaceFunction<void(const int&)>> inplace;
+    inplace.attach([&total](const int& val) { total += val; cout << "  → inplace total: " << total << endl; });
+    inplace.setData(5);
+    inplace.setData(6);
+    
+    auto printer = [](const int& val) { cout << "  → borrowed: " << val << endl; };  // subject보다 오래 살아야 함
+    Subject<int, function_ref<void(const int&)>> borrowed;
+    borrowed.attach(printer);
+    borrowed.setData(42);
+    
+    cout << "\n=== Delivery modes ===" << endl;
+    {
+        EventQueue queue;
+        DeliveringSubject<int> coalesced(Delivery::Coalesce);
+        coalesced.attach([](const int& v) { cout << "  → coalesced: " << v << endl; });
+        DeliveringSubject<int> batched(Delivery::Batch);
+        batched.attachBatch([](span<const int> values) {
+            cout << "  → batch of " << values.size() << ":";
+            for (int v : values) cout << ' ' << v;
+            cout << endl;
+        });
+        DeliveringSubject<int> async(Delivery::Async, &queue);
+        async.attach([](const int& v) { cout << "  → async (event queue): " << v << endl; });
+        for (int v = 1; v <= 5; ++v) {
+            coalesced.setData(v);
+            batched.setData(v);
+        }
+        thread producer([&async]() {
+            for (int v = 1; v <= 5; ++v) async.setData(v * 10);
+        });
+        producer.join();
+        coalesced.tick();
+        coalesced.tick();       // 바뀐 값이 없으면 전달하지 않음
+        batched.tick();
+        size_t asyncEvents = queue.process();
+        cout << "  queued async deliveries: " << asyncEvents << endl;
+    }
+    
+    cout << "\n[Benchmark: 200k updates, 4 observers, tick every 100 updates]" << endl;
+    benchmarkDelivery("Immediate", Delivery::Immediate);
+    benchmarkDelivery("Coalesce ", Delivery::Coalesce);
+    benchmarkDelivery("Batch    ", Delivery::Batch);
+    benchmarkDelivery("Async    ", Delivery::Async);
+    
+    cout << "\n=== ConcurrentSubject (copy-on-write + epoch 회수) ===" << endl;
+    ConcurrentSubject<int> bus;
+    atomic<uint64_t> delivered{0};
+    {
+        auto first = bus.subscribe([](const int& v) { cout << "  → subscriber A: " << v << endl; });
+        {
+            auto second = bus.subscribe([](const int& v) { cout << "  → subscriber B: " << v << endl; });
+            bus.publish(1);
+        }   // second 해지
+        bus.publish(2);
+    }       // first 해지
+    cout << "subscribers after scope: " << bus.subscribers() << endl;
+    
+    // publisher 3개가 publish하는 동안 churn 스레드가 구독/해지를 반복
+    atomic<bool> running{true};
+    auto keep = bus.subscribe([&delivered](const int&) { delivered.fetch_add(1, memory_order_relaxed); });
+    thread churn([&]() {
+        for (int i = 0; running.load(); ++i) {
+            auto temporary = bus.subscribe([&delivered](const int&) { delivered.fetch_add(1, memory_order_relaxed); });
+            if (i % 8 == 0) this_thread::yield();
+        }
+    });
+    vector<thread> publishers;
+    for (int p = 0; p < 3; ++p)
+        publishers.emplace_back([&bus]() {
+            for (int i = 0; i < 20000; ++i) {
+                bus.publish(i);
+                if (i % 64 == 0) this_thread::yield();
+            }
+        });
+    for (auto& p : publishers) p.join();
+    running = false;
+    churn.join();
+    auto [pending, reclaimed] = bus.reclamationStats();
+    cout << "deliveries " << delivered.load() << " (>= 60000 from the permanent subscriber), old arrays reclaimed "
+         << reclaimed << ", pending " << pending << endl;
+    
+    cout << "\n[Benchmark: publish with 4 subscribers, 200k events]" << endl;
+    {
+        constexpr int EVENTS = 200000;
+        uint64_t sum = 0;
+        ConcurrentSubject<int> cow;
+        LockedSubject<int> locked;
+        vector<ConcurrentSubject<int>::Subscription> subs;
+        for (int i = 0; i < 4; ++i) {
+            subs.push_back(cow.subscribe([&sum](const int& v) { sum += v; }));
+            locked.attach([&sum](const int& v) { sum += v; });
+        }
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < EVENTS; ++i) cow.publish(i);
+        double cowMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < EVENTS; ++i) locked.publish(i);
+        double lockedMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        cout << "  CowObserverList : " << cowMs << " ms (no lock, attach/detach never blocks publish)" << endl;
+        cout << "  mutex + vector  : " << lockedMs << " ms (sum " << sum << ")" << endl;
+    }
+    
     return 0;
 }
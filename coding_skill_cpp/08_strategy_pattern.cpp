@@ -3,6 +3,24 @@
 #include <functional>
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 using namespace std;
 
 class Sorter {
@@ -12,6 +30,373 @@ public:
     void sort(vector<int>& data) { if (strategy) strategy(data); }
 };
 
+// 빌드 플래그: -DSORT_SIMD=0 이면 정렬 네트워크도 scalar만 사용
+#ifndef SORT_SIMD
+#define SORT_SIMD 1
+#endif
+
+namespace sorting {
+
+/*
+ * 정렬 네트워크 (원소 64개 이하)
+ *  - 8원소 최적 네트워크(비교기 19개)를 8개 열에 동시에 적용: AVX2 레지스터 8개 = 8x8 행렬
+ *    → 열마다 정렬됨 → 전치하면 길이 8의 정렬된 run 8개 → 병합 3단계
+ *  - 모자란 칸은 INT_MAX로 채움, AVX2가 없으면 같은 네트워크를 scalar min/max로
+ *  - 64개를 넘으면 length_error (더 큰 입력은 networkMergeSort가 64개 leaf로 잘라 씀)
+ */
+constexpr array<pair<uint8_t, uint8_t>, 19> NETWORK8 = {{
+    {0, 2}, {1, 3}, {4, 6}, {5, 7},
+    {0, 4}, {1, 5}, {2, 6}, {3, 7},
+    {0, 1}, {2, 3}, {4, 5}, {6, 7},
+    {2, 4}, {3, 5},
+    {1, 4}, {3, 6},
+    {1, 2}, {3, 4}, {5, 6},
+}};
+
+// 0-1 원리: 모든 0/1 입력 256개를 정렬하면 임의 입력도 정렬
+constexpr bool networkSortsAllBinaryInputs() {
+    for (unsigned bits = 0; bits < 256; ++bits) {
+        array<int, 8> v{};
+        for (int i = 0; i < 8; ++i) v[i] = (bits >> i) & 1;
+        for (auto [a, b] : NETWORK8)
+            if (v[a] > v[b]) swap(v[a], v[b]);
+        for (int i = 0; i + 1 < 8; ++i)
+            if (v[i] > v[i + 1]) return false;
+    }
+    return true;
+}
+static_assert(networkSortsAllBinaryInputs(), "NETWORK8 is not a sorting network");
+
+// block[8*row + col]: 열 col마다 정렬
+static void sortColumnsScalar(int* block) {
+    for (auto [a, b] : NETWORK8) {
+        for (int col = 0; col < 8; ++col) {
+            int& x = block[8 * a + col];
+            int& y = block[8 * b + col];
+            int lo = min(x, y), hi = max(x, y);
+            x = lo;
+            y = hi;
+        }
+    }
+    for (int i = 0; i < 8; ++i)
+        for (int j = i + 1; j < 8; ++j) swap(block[8 * i + j], block[8 * j + i]);     // 전치
+}
+
+#if SORT_SIMD && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define HAVE_AVX2_NETWORK 1
+__attribute__((target("avx2"))) static void sortColumnsAvx2(int* block) {
+    __m256i r[8];
+    for (int i = 0; i < 8; ++i) r[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 8 * i));
+    for (auto [a, b] : NETWORK8) {
+        __m256i lo = _mm256_min_epi32(r[a], r[b]);
+        r[b] = _mm256_max_epi32(r[a], r[b]);
+        r[a] = lo;
+    }
+    __m256i t[8], u[8];
+    for (int i = 0; i < 8; i += 2) {
+        t[i] = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+        t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+    }
+    for (int i = 0; i < 8; i += 4) {
+        u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+        u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+        u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+        u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+    for (int i = 0; i < 4; ++i) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(block + 8 * i), _mm256_permute2x128_si256(u[i], u[i + 4], 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(block + 8 * (i + 4)),
+                            _mm256_permute2x128_si256(u[i], u[i + 4], 0x31));
+    }
+}
+#endif
+
+using ColumnKernel = void (*)(int*);
+
+static pair<const char*, ColumnKernel> columnKernel() {
+    static const pair<const char*, ColumnKernel> selected = []() -> pair<const char*, ColumnKernel> {
+#if defined(HAVE_AVX2_NETWORK)
+        if (__builtin_cpu_supports("avx2")) return {"avx2", sortColumnsAvx2};
+#endif
+        return {"scalar", sortColumnsScalar};
+    }();
+    return selected;
+}
+
+constexpr size_t NETWORK_MAX = 64;
+
+void networkSort(span<int> data) {
+    if (data.size() > NETWORK_MAX) throw length_error("networkSort: more than 64 elements");
+    alignas(32) array<int, NETWORK_MAX> block, merged;
+    copy(data.begin(), data.end(), block.begin());
+    fill(block.begin() + data.size(), block.end(), INT_MAX);
+    columnKernel().second(block.data());
+    // 길이 8 run 8개 → 16 → 32 → 64
+    int* from = block.data();
+    int* to = merged.data();
+    for (size_t run = 8; run < NETWORK_MAX; run *= 2) {
+        for (size_t i = 0; i < NETWORK_MAX; i += 2 * run) merge(from + i, from + i + run, from + i + run, from + i + 2 * run, to + i);
+        swap(from, to);
+    }
+    copy_n(from, data.size(), data.begin());
+}
+
+// bottom-up merge sort: NETWORK_MAX개 leaf를 networkSort로 정렬 → data ↔ scratch 번갈아 병합
+void networkMergeSort(span<int> data, vector<int>& scratch) {
+    const size_t n = data.size();
+    for (size_t i = 0; i < n; i += NETWORK_MAX) networkSort(data.subspan(i, min(NETWORK_MAX, n - i)));
+    if (n <= NETWORK_MAX) return;
+    scratch.resize(n);
+    int* from = data.data();
+    int* to = scratch.data();
+    for (size_t run = NETWORK_MAX; run < n; run *= 2) {
+        for (size_t lo = 0; lo < n; lo += 2 * run) {
+            size_t mid = min(lo + run, n), hi = min(lo + 2 * run, n);
+            merge(from + lo, from + mid, from + mid, from + hi, to + lo);
+        }
+        swap(from, to);
+    }
+    if (from != data.data()) copy_n(from, n, data.data());
+}
+
+/*
+ * LSD radix sort - 32비트 정수 키, 11비트 digit → 3 pass
+ *  - 세 digit의 히스토그램을 한 번의 읽기로 계산
+ *  - 모든 키의 digit이 같으면 그 pass는 건너뜀 (작은 범위 키)
+ *  - 부호 있는 키는 부호 비트를 뒤집어 unsigned 순서로
+ */
+template<typename T>
+constexpr bool RADIX_KEY = is_integral_v<T> && sizeof(T) == 4;
+
+template<typename T>
+void radixSort(span<T> data, vector<T>& scratch) {
+    static_assert(RADIX_KEY<T>);
+    constexpr int BITS = 11;
+    constexpr size_t BUCKETS = size_t{1} << BITS;
+    constexpr uint32_t FLIP = is_signed_v<T> ? 0x80000000u : 0;
+    auto key = [](T v) { return static_cast<uint32_t>(v) ^ FLIP; };
+    
+    vector<array<size_t, BUCKETS>> counts(3);
+    for (auto& c : counts) c.fill(0);
+    for (T v : data) {
+        uint32_t k = key(v);
+        ++counts[0][k & (BUCKETS - 1)];
+        ++counts[1][(k >> BITS) & (BUCKETS - 1)];
+        ++counts[2][k >> (2 * BITS)];
+    }
+    scratch.resize(data.size());
+    span<T> from = data, to = scratch;
+    for (int pass = 0; pass < 3; ++pass) {
+        auto& c = counts[pass];
+        int shift = pass * BITS;
+        if (c[(key(data[0]) >> shift) & (BUCKETS - 1)] == data.size()) continue;     // digit이 모두 같음
+        size_t sum = 0;
+        for (auto& n : c) sum += exchange(n, sum);      // exclusive prefix sum
+        for (T v : from) to[c[(key(v) >> shift) & (BUCKETS - 1)]++] = v;
+        swap(from, to);
+    }
+    if (from.data() != data.data()) copy(from.begin(), from.end(), data.begin());
+}
+
+// 단일 스레드 선택: 크기와 키 타입 (병렬 병합의 chunk도 여기로 → 작은 int chunk는 네트워크 leaf 병합)
+template<typename T>
+void sequentialSort(span<T> data, vector<T>& scratch) {
+    if constexpr (is_same_v<T, int>) {
+        if (data.size() <= NETWORK_MAX) return networkSort(data);
+        if (data.size() < 4096) return networkMergeSort(data, scratch);
+    }
+    if constexpr (RADIX_KEY<T>) {
+        if (data.size() >= 4096) return radixSort(data, scratch);
+    }
+    std::sort(data.begin(), data.end());
+}
+
+/*
+ * SortThreadPool - fork-join용 고정 워커 풀
+ *  - runAll(jobs): 작업을 모두 넣고 호출 스레드도 같이 꺼내 실행 → 끝날 때까지 대기
+ *  - 호출 스레드가 돕기 때문에 워커 0개(코어 1개)여도 동작
+ */
+class SortThreadPool {
+    vector<thread> workers;
+    mutex lock;
+    condition_variable available, finished;
+    deque<function<void()>> tasks;
+    size_t unfinished = 0;
+    bool stopping = false;
+    
+    bool runOne(unique_lock<mutex>& guard) {
+        if (tasks.empty()) return false;
+        auto task = std::move(tasks.front());
+        tasks.pop_front();
+        guard.unlock();
+        task();
+        guard.lock();
+        if (--unfinished == 0) finished.notify_all();
+        return true;
+    }
+    
+public:
+    explicit SortThreadPool(size_t threads) {
+        for (size_t i = 1; i < threads; ++i) {      // 호출 스레드가 한 몫
+            workers.emplace_back([this]() {
+                unique_lock<mutex> guard(lock);
+                for (;;) {
+                    available.wait(guard, [this]() { return stopping || !tasks.empty(); });
+                    if (stopping) return;
+                    runOne(guard);
+                }
+            });
+        }
+    }
+    ~SortThreadPool() {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+        }
+        available.notify_all();
+        for (auto& w : workers) w.join();
+    }
+    SortThreadPool(const SortThreadPool&) = delete;
+    SortThreadPool& operator=(const SortThreadPool&) = delete;
+    
+    size_t threads() const { return workers.size() + 1; }
+    
+    void runAll(vector<function<void()>>& jobs) {
+        unique_lock<mutex> guard(lock);
+        for (auto& job : jobs) tasks.push_back(std::move(job));
+        unfinished += jobs.size();
+        available.notify_all();
+        while (runOne(guard)) {}
+        finished.wait(guard, [this]() { return unfinished == 0; });
+    }
+};
+
+/*
+ * parallelMergeSort - chunk를 풀에서 각각 정렬(sequentialSort) → 짝지어 병합을 log2(chunk) 단계
+ *  - 병합은 data ↔ buffer를 번갈아 사용, 같은 단계의 병합끼리는 병렬
+ */
+template<typename T>
+void parallelMergeSort(vector<T>& data, SortThreadPool& pool) {
+    size_t chunks = pool.threads();
+    if (chunks <= 1 || data.size() < 65536) {
+        vector<T> scratch;
+        return sequentialSort(span<T>(data), scratch);
+    }
+    vector<size_t> bounds(chunks + 1);
+    for (size_t i = 0; i <= chunks; ++i) bounds[i] = data.size() * i / chunks;
+    
+    vector<function<void()>> jobs;
+    for (size_t c = 0; c < chunks; ++c) {
+        jobs.push_back([&data, &bounds, c]() {
+            vector<T> scratch;
+            sequentialSort(span<T>(data.data() + bounds[c], bounds[c + 1] - bounds[c]), scratch);
+        });
+    }
+    pool.runAll(jobs);
+    
+    vector<T> buffer(data.size());
+    vector<T>* from = &data;
+    vector<T>* to = &buffer;
+    for (size_t width = 1; width < chunks; width *= 2) {
+        jobs.clear();
+        for (size_t c = 0; c < chunks; c += 2 * width) {
+            size_t lo = bounds[c], mid = bounds[min(c + width, chunks)], hi = bounds[min(c + 2 * width, chunks)];
+            jobs.push_back([from, to, lo, mid, hi]() {
+                merge(from->begin() + lo, from->begin() + mid, from->begin() + mid, from->begin() + hi, to->begin() + lo);
+            });
+        }
+        pool.runAll(jobs);
+        swap(from, to);
+    }
+    if (from != &data) data.swap(buffer);
+}
+
+// 크기/키 타입/코어 수로 선택
+template<typename T>
+void adaptiveSort(vector<T>& data, SortThreadPool& pool) {
+    if (pool.threads() > 1 && data.size() >= (size_t{1} << 20)) return parallelMergeSort(data, pool);
+    vector<T> scratch;
+    sequentialSort(span<T>(data), scratch);
+}
+
+template<typename T>
+const char* adaptiveChoice(size_t n, size_t threads) {
+    if (threads > 1 && n >= (size_t{1} << 20)) return "parallel merge";
+    if (is_same_v<T, int> && n <= NETWORK_MAX) return "network";
+    if (is_same_v<T, int> && n < 4096) return "network leaves + merge";
+    if (RADIX_KEY<T> && n >= 4096) return "radix";
+    return "std::sort";
+}
+
+}  // namespace sorting
+
+// Sorter에 꽂는 내장 전략
+namespace strategies {
+inline function<void(vector<int>&)> radix() {
+    return [](vector<int>& d) {
+        vector<int> scratch;
+        if (!d.empty()) sorting::radixSort(span<int>(d), scratch);
+    };
+}
+inline function<void(vector<int>&)> parallelMerge(sorting::SortThreadPool& pool) {
+    return [&pool](vector<int>& d) { sorting::parallelMergeSort(d, pool); };
+}
+inline function<void(vector<int>&)> adaptive(sorting::SortThreadPool& pool) {
+    return [&pool](vector<int>& d) { sorting::adaptiveSort(d, pool); };
+}
+}  // namespace strategies
+
+static void benchmarkSorts() {
+    mt19937 rng(42);
+    const size_t cores = max(1u, thread::hardware_concurrency());
+    sorting::SortThreadPool single(1), allCores(cores), four(4);
+    cout << "  (hardware threads: " << cores << ", network kernel: " << sorting::columnKernel().first << ")" << endl;
+    
+    for (size_t n : {size_t{48}, size_t{1000}, size_t{10000}, size_t{1} << 20}) {
+        vector<int> input(n);
+        for (int& v : input) v = static_cast<int>(rng());
+        int repeat = n < 1000 ? 20000 : n < 100000 ? 20 : 1;
+        
+        auto measure = [&](const char* name, const function<void(vector<int>&)>& strategy) {
+            Sorter sorter;
+            sorter.setStrategy(strategy);
+            vector<int> work;
+            double total = 0;
+            bool sorted = true;
+            for (int r = 0; r < repeat; ++r) {
+                work = input;
+                auto start = chrono::steady_clock::now();
+                sorter.sort(work);
+                total += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                sorted = sorted && is_sorted(work.begin(), work.end());
+            }
+            cout << "    " << name << ": " << total / repeat << " ms" << (sorted ? "" : "  (NOT SORTED)") << endl;
+        };
+        
+        cout << "  n=" << n << " (adaptive picks " << sorting::adaptiveChoice<int>(n, cores) << ")" << endl;
+        measure("std::sort          ", [](vector<int>& d) { sort(d.begin(), d.end()); });
+        if (n <= sorting::NETWORK_MAX)
+            measure("network            ", [](vector<int>& d) { sorting::networkSort(d); });
+        measure("network merge sort ", [](vector<int>& d) {
+            vector<int> scratch;
+            sorting::networkMergeSort(d, scratch);
+        });
+        measure("radix (11-bit)     ", strategies::radix());
+        if (n >= 65536) {
+            measure("merge x1 thread    ", strategies::parallelMerge(single));
+            measure("merge x4 threads   ", strategies::parallelMerge(four));
+        }
+        measure("adaptive           ", strategies::adaptive(allCores));
+    }
+    
+    // 키 타입에 따른 선택: double은 radix 대상이 아님
+    vector<double> reals(100000);
+    for (double& v : reals) v = static_cast<double>(rng()) / rng.max();
+    cout << "  double n=" << reals.size() << " → " << sorting::adaptiveChoice<double>(reals.size(), cores) << endl;
+    sorting::adaptiveSort(reals, allCores);
+    cout << "  sorted: " << boolalpha << is_sorted(reals.begin(), reals.end()) << noboolalpha << endl;
+}
+
 int main() {
     cout << "\n=== C++ Strategy ===" << endl;
     Sorter sorter;
@@ -25,5 +410,14 @@ int main() {
     sorter.sort(nums);
     cout << "내림차순: "; for (int n : nums) cout << n << " "; cout << endl;
     
+    cout << "\n=== Built-in strategies ===" << endl;
+    sorter.setStrategy(strategies::radix());
+    vector<int> mixed = {42, -7, 0, 1000000, -300, 5};
+    sorter.sort(mixed);
+    cout << "radix: "; for (int n : mixed) cout << n << " "; cout << endl;
+    
+    cout << "\n=== Benchmark: sizes x strategies ===" << endl;
+    benchmarkSorts();
+    
     return 0;
 }
@@ -3,6 +3,16 @@
 #include <functional>
 #include <vector>
 #include <memory>
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 using namespace std;
 
 struct Command {
@@ -26,6 +36,223 @@ public:
     }
 };
 
+/*
+ * BoundedHistory<Bytes, MaxEntries> - 고정 크기 ring arena에 명령을 인라인 저장하는 undo/redo 기록
+ *  - 명령 타입 C: apply()/revert() (+ 선택적으로 bool mergeWith(const C&))
+ *  - 명령 객체는 storage 바이트 배열에 직접 생성 (힙 할당 없음), 공간/개수가 모자라면 가장 오래된 기록부터 버림
+ *  - 병합: 직전 기록이 같은 타입이고 mergeWith가 true면 새 기록을 만들지 않음 (value += k 반복 → 한 칸)
+ *  - undo 후 새 명령을 실행하면 redo 구간은 버림
+ */
+template<typename C>
+concept HistoryCommand = requires(C c) {
+    c.apply();
+    c.revert();
+} && is_nothrow_move_constructible_v<C>;
+
+template<typename C>
+concept MergeableCommand = HistoryCommand<C> && requires(C c, const C& next) {
+    { c.mergeWith(next) } -> same_as<bool>;
+};
+
+// 기존 Command(함수 두 개)를 기록에 넣기 위한 래퍼
+struct FunctionCommand {
+    Command cmd;
+    void apply() { cmd.execute(); }
+    void revert() { cmd.undo(); }
+};
+
+// 여러 명령을 한 기록(트랜잭션)으로: 중간에 실패하면 이미 실행한 것을 역순으로 되돌리고 예외 전달
+struct CommandBatch {
+    vector<Command> commands;
+    void apply() {
+        size_t done = 0;
+        try {
+            for (; done < commands.size(); ++done) commands[done].execute();
+        } catch (...) {
+            while (done-- > 0) commands[done].undo();
+            throw;
+        }
+    }
+    void revert() {
+        for (size_t i = commands.size(); i-- > 0;) commands[i].undo();
+    }
+};
+
+template<size_t Bytes = 16 * 1024, size_t MaxEntries = 1024>
+class BoundedHistory {
+    static constexpr size_t ALIGN = alignof(max_align_t);
+    
+    struct Ops {
+        void (*apply)(void*);
+        void (*revert)(void*);
+        void (*destroy)(void*);
+    };
+    template<typename C>
+    static constexpr Ops opsFor = {
+        [](void* p) { static_cast<C*>(p)->apply(); },
+        [](void* p) { static_cast<C*>(p)->revert(); },
+        [](void* p) { static_cast<C*>(p)->~C(); },
+    };
+    
+    struct Entry {
+        const Ops* ops;
+        uint32_t offset;
+        uint32_t size;
+    };
+    
+    alignas(ALIGN) byte storage[Bytes];
+    array<Entry, MaxEntries> entries;
+    size_t head = 0;        // 가장 오래된 기록
+    size_t count = 0;       // 저장된 기록 (redo 포함)
+    size_t cursor = 0;      // 적용된 기록 수 (undo 가능)
+    size_t evicted = 0;
+    size_t merged = 0;
+    bool sealed = false;    // true면 다음 명령은 병합하지 않음
+    
+    Entry& at(size_t i) { return entries[(head + i) % MaxEntries]; }
+    void* payload(const Entry& e) { return storage + e.offset; }
+    
+    void dropNewest() {
+        Entry& e = at(count - 1);
+        e.ops->destroy(payload(e));
+        --count;
+    }
+    
+    void dropOldest() {
+        Entry& e = entries[head];
+        e.ops->destroy(payload(e));
+        head = (head + 1) % MaxEntries;
+        --count;
+        --cursor;
+        ++evicted;
+    }
+    
+    // 가장 새 기록 뒤에 size 바이트 자리를 만듦 (필요하면 오래된 기록을 버림)
+    uint32_t reserve(size_t size) {
+        if (count == MaxEntries) dropOldest();
+        for (;;) {
+            if (count == 0) return 0;
+            const Entry& oldest = entries[head];
+            const Entry& newest = at(count - 1);
+            size_t end = (newest.offset + newest.size + ALIGN - 1) / ALIGN * ALIGN;
+            if (oldest.offset >= end) {             // 빈 공간 = [end, oldest)
+                if (end + size <= oldest.offset) return static_cast<uint32_t>(end);
+            } else {                                // 빈 공간 = [end, Bytes) + [0, oldest)
+                if (end + size <= Bytes) return static_cast<uint32_t>(end);
+                if (size <= oldest.offset) return 0;
+            }
+            dropOldest();
+        }
+    }
+    
+public:
+    BoundedHistory() = default;
+    BoundedHistory(const BoundedHistory&) = delete;
+    BoundedHistory& operator=(const BoundedHistory&) = delete;
+    ~BoundedHistory() {
+        while (count > 0) dropNewest();
+    }
+    
+    template<HistoryCommand C>
+    void execute(C cmd) {
+        static_assert(sizeof(C) <= Bytes && alignof(C) <= ALIGN, "command does not fit the history arena");
+        cmd.apply();                                // 던지면 기록하지 않음
+        while (count > cursor) dropNewest();        // redo 구간 폐기
+        if constexpr (MergeableCommand<C>) {
+            if (!sealed && count > 0 && at(count - 1).ops == &opsFor<C> &&
+                static_cast<C*>(payload(at(count - 1)))->mergeWith(cmd)) {
+                ++merged;
+                return;
+            }
+        }
+        sealed = false;
+        uint32_t offset = reserve(sizeof(C));
+        ::new (storage + offset) C(std::move(cmd));
+        at(count) = {&opsFor<C>, offset, static_cast<uint32_t>(sizeof(C))};
+        ++count;
+        ++cursor;
+    }
+    
+    void execute(Command cmd) { execute(FunctionCommand{std::move(cmd)}); }
+    
+    // 한 트랜잭션: 모두 성공하면 기록 하나, 실패하면 전부 되돌리고 예외
+    void execute(span<const Command> batch) { execute(CommandBatch{vector<Command>(batch.begin(), batch.end())}); }
+    
+    bool undo() {
+        if (cursor == 0) return false;
+        Entry& e = at(--cursor);
+        e.ops->revert(payload(e));
+        sealed = true;          // undo 너머로 병합하지 않음
+        return true;
+    }
+    
+    bool redo() {
+        if (cursor == count) return false;
+        Entry& e = at(cursor++);
+        e.ops->apply(payload(e));
+        return true;
+    }
+    
+    // 입력이 끊긴 시점 등: 다음 명령을 새 기록으로 시작
+    void seal() { sealed = true; }
+    
+    size_t undoable() const { return cursor; }
+    size_t redoable() const { return count - cursor; }
+    size_t evictedCount() const { return evicted; }
+    size_t mergedCount() const { return merged; }
+    static constexpr size_t footprint() { return sizeof(BoundedHistory); }
+};
+
+// 병합 가능한 명령 예: *target += k
+struct AddCommand {
+    int* target;
+    int k;
+    void apply() { *target += k; }
+    void revert() { *target -= k; }
+    bool mergeWith(const AddCommand& next) {
+        if (next.target != target) return false;
+        k += next.k;
+        return true;
+    }
+};
+
+static_assert(MergeableCommand<AddCommand>);
+
+// 기존 Invoker(vector<Command>) vs BoundedHistory: 실행 후 전부 undo
+static void benchmarkHistory() {
+    constexpr int OPS = 200000;
+    int a = 0, b = 0;
+    
+    auto start = chrono::steady_clock::now();
+    {
+        Invoker invoker;
+        for (int i = 0; i < OPS; ++i) {
+            int* target = i % 2 ? &a : &b;
+            invoker.execute({[target]() { ++*target; }, [target]() { --*target; }});
+        }
+        for (int i = 0; i < OPS; ++i) invoker.undo();
+    }
+    double vectorMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    
+    auto history = make_unique<BoundedHistory<>>();
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < OPS; ++i) history->execute(AddCommand{i % 2 ? &a : &b, 1});    // 번갈아 → 병합 안 됨
+    int undone = 0;
+    while (history->undo()) ++undone;
+    while (history->redo()) {}
+    double boundedMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    
+    cout << "  vector<Command> Invoker : " << vectorMs << " ms, history grows to " << OPS << " entries (~"
+         << OPS * sizeof(Command) / 1024 << " KB + captures)" << endl;
+    cout << "  BoundedHistory          : " << boundedMs << " ms incl. redo, " << BoundedHistory<>::footprint() / 1024
+         << " KB fixed, kept " << undone << ", evicted " << history->evictedCount() << endl;
+    
+    auto coalescing = make_unique<BoundedHistory<>>();
+    for (int i = 0; i < OPS; ++i) coalescing->execute(AddCommand{&a, 1});
+    cout << "  repeated += on one value: " << coalescing->undoable() << " entry, " << coalescing->mergedCount()
+         << " merged (a=" << a << ", b=" << b << ")" << endl;
+}
+
 int main() {
     cout << "\n=== C++ Command ===" << endl;
     int value = 0;
@@ -44,5 +271,46 @@ int main() {
     invoker.undo();
     invoker.undo();
     
+    cout << "\n=== BoundedHistory (inline ring arena) ===" << endl;
+    {
+        BoundedHistory<1024, 8> history;      // 작게 잡아 오래된 기록이 밀려나는 것을 보여줌
+        int level = 0;
+        for (int i = 0; i < 5; ++i) history.execute(AddCommand{&level, 10});   // 한 기록으로 병합
+        history.seal();
+        history.execute(AddCommand{&level, 1});
+        cout << "level=" << level << ", undoable " << history.undoable() << " (merged " << history.mergedCount() << ")"
+             << endl;
+        history.undo();
+        history.undo();
+        cout << "after 2 undo: level=" << level << ", redoable " << history.redoable() << endl;
+        history.redo();
+        cout << "after redo: level=" << level << endl;
+        
+        const Command batch[] = {
+            {[&]() { level *= 2; }, [&]() { level /= 2; }},
+            {[&]() { level += 5; }, [&]() { level -= 5; }},
+        };
+        history.execute(span<const Command>(batch));
+        cout << "batch (x2, +5): level=" << level << endl;
+        history.undo();
+        cout << "undo batch as one: level=" << level << endl;
+        
+        const Command failing[] = {
+            {[&]() { level += 100; }, [&]() { level -= 100; }},
+            {[]() { throw runtime_error("device busy"); }, []() {}},
+        };
+        try {
+            history.execute(span<const Command>(failing));
+        } catch (const exception& e) {
+            cout << "batch failed (" << e.what() << "), rolled back: level=" << level << endl;
+        }
+        
+        for (int i = 0; i < 20; ++i) history.execute(AddCommand{i % 2 ? &level : &value, 1});
+        cout << "after 20 more: undoable " << history.undoable() << ", evicted " << history.evictedCount() << endl;
+    }
+    
+    cout << "\n=== Benchmark: 200k execute + undo ===" << endl;
+    benchmarkHistory();
+    
     return 0;
 }
@@ -2,29 +2,1163 @@
 #include <iostream>
 #include <queue>
 #include <functional>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "topology/topology.h"
 using namespace std;
 
-class EventQueue {
-    queue<function<void()>> events;
+// 힙 할당 횟수 측정용 (전역 operator new 교체)
+static atomic<size_t> g_allocationCount{0};
+
+void* operator new(size_t size) {
+    g_allocationCount.fetch_add(1, memory_order_relaxed);
+    if (void* p = malloc(size)) return p;
+    throw bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+/*
+ * Work-Stealing Executor
+ *  - 코어당 워커 1개, 워커마다 자기 deque 소유
+ *  - 워커는 자기 deque 뒤(LIFO, 캐시 지역성)에서 꺼내고
+ *    비면 다른 워커 deque 앞(FIFO)에서 훔쳐옴
+ *  - 워커 스레드 안에서 push하면 자기 deque로 → 캐시 지역성 유지
+ *  - process_until_idle(): 제출된 모든 작업(하위 작업 포함) 완료까지 대기
+ *  - 워커 i는 topology::compactOrder()의 i번째 CPU에 배정 (pinWorkers면 실제로 고정)
+ *    훔칠 때는 같은 NUMA node 워커를 먼저 → 작업이 만든 데이터가 다른 소켓으로 넘어가는 일을 줄임
+ */
+class WorkStealingExecutor {
+    struct alignas(64) Worker {
+        mutex mtx;
+        deque<function<void()>> tasks;
+        atomic<uint64_t> executed{0};
+        atomic<uint64_t> stolen{0};
+        atomic<uint64_t> stolenRemote{0};   // 다른 node 워커에게서 훔친 수
+        atomic<uint64_t> idleNs{0};
+        unsigned cpu = 0;
+        unsigned node = 0;
+        vector<size_t> victims;             // 훔칠 순서: 같은 node → 다른 node
+    };
+
+    vector<unique_ptr<Worker>> workers;
+    vector<thread> threads;
+    atomic<size_t> pending{0};      // 제출 후 아직 완료되지 않은 작업 수
+    atomic<size_t> queued{0};       // deque에 대기 중인 작업 수
+    atomic<size_t> sleepers{0};
+    atomic<size_t> nextWorker{0};
+    atomic<bool> stopping{false};
+    mutex sleepMtx;
+    condition_variable wakeCv, idleCv;
+
+    static inline thread_local WorkStealingExecutor* currentExecutor = nullptr;
+    static inline thread_local size_t currentIndex = 0;
+
+public:
+    struct WorkerStats {
+        uint64_t executed;
+        uint64_t stolen;
+        uint64_t stolenRemote;
+        double idleMs;
+        unsigned node;
+    };
+
+    explicit WorkStealingExecutor(size_t workerCount = max(1u, thread::hardware_concurrency()),
+                                  bool pinWorkers = false) {
+        const topology::Topology& topo = topology::system();
+        const vector<unsigned> order = topo.compactOrder();
+        for (size_t i = 0; i < workerCount; ++i) {
+            workers.push_back(make_unique<Worker>());
+            workers[i]->cpu = order[i % order.size()];
+            workers[i]->node = topo.nodeOf(workers[i]->cpu);
+        }
+        for (size_t i = 0; i < workerCount; ++i) {
+            for (int remote = 0; remote < 2; ++remote) {
+                for (size_t k = 1; k < workerCount; ++k) {
+                    size_t v = (i + k) % workerCount;
+                    if ((workers[v]->node != workers[i]->node) == (remote == 1)) workers[i]->victims.push_back(v);
+                }
+            }
+        }
+        for (size_t i = 0; i < workerCount; ++i) threads.emplace_back([this, i, pinWorkers]() {
+            if (pinWorkers) topology::pinCurrentThread(workers[i]->cpu);
+            workerLoop(i);
+        });
+    }
+
+    ~WorkStealingExecutor() {
+        stopping = true;
+        { lock_guard<mutex> lock(sleepMtx); }
+        wakeCv.notify_all();
+        for (auto& t : threads) t.join();
+    }
+
+    WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+    WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+    void push(function<void()> task) {
+        pending.fetch_add(1);
+        size_t index = (currentExecutor == this) ? currentIndex
+                                                 : nextWorker.fetch_add(1, memory_order_relaxed) % workers.size();
+        {
+            lock_guard<mutex> lock(workers[index]->mtx);
+            workers[index]->tasks.push_back(std::move(task));
+        }
+        queued.fetch_add(1);
+        // 잠든 워커가 있을 때만 깨움 (seq_cst로 sleepers와 queued 교차 확인)
+        if (sleepers.load() > 0) {
+            { lock_guard<mutex> lock(sleepMtx); }
+            wakeCv.notify_one();
+        }
+    }
+
+    // 외부 스레드 전용 (워커 안에서 호출하면 자기 자신을 기다리게 됨)
+    void process_until_idle() {
+        unique_lock<mutex> lock(sleepMtx);
+        idleCv.wait(lock, [this]() { return pending.load() == 0; });
+    }
+
+    vector<WorkerStats> stats() const {
+        vector<WorkerStats> result;
+        for (auto& w : workers) {
+            result.push_back({w->executed.load(memory_order_relaxed),
+                              w->stolen.load(memory_order_relaxed),
+                              w->stolenRemote.load(memory_order_relaxed),
+                              w->idleNs.load(memory_order_relaxed) / 1e6, w->node});
+        }
+        return result;
+    }
+
+    size_t workerCount() const { return workers.size(); }
+
+private:
+    bool popLocal(Worker& self, function<void()>& task) {
+        lock_guard<mutex> lock(self.mtx);
+        if (self.tasks.empty()) return false;
+        task = std::move(self.tasks.back());
+        self.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(size_t thief, function<void()>& task) {
+        Worker& self = *workers[thief];
+        for (size_t v : self.victims) {
+            Worker& victim = *workers[v];
+            lock_guard<mutex> lock(victim.mtx);
+            if (victim.tasks.empty()) continue;
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            self.stolen.fetch_add(1, memory_order_relaxed);
+            if (victim.node != self.node) self.stolenRemote.fetch_add(1, memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    void workerLoop(size_t index) {
+        currentExecutor = this;
+        currentIndex = index;
+        Worker& self = *workers[index];
+        function<void()> task;
+
+        for (;;) {
+            if (popLocal(self, task) || steal(index, task)) {
+                queued.fetch_sub(1);
+                task();
+                task = nullptr;
+                self.executed.fetch_add(1, memory_order_relaxed);
+                if (pending.fetch_sub(1) == 1) {
+                    { lock_guard<mutex> lock(sleepMtx); }
+                    idleCv.notify_all();
+                }
+                continue;
+            }
+
+            if (stopping.load() && queued.load() == 0) return;
+
+            auto idleStart = chrono::steady_clock::now();
+            {
+                unique_lock<mutex> lock(sleepMtx);
+                sleepers.fetch_add(1);
+                wakeCv.wait(lock, [this]() { return stopping.load() || queued.load() > 0; });
+                sleepers.fetch_sub(1);
+            }
+            self.idleNs.fetch_add(static_cast<uint64_t>(
+                chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - idleStart).count()),
+                memory_order_relaxed);
+        }
+    }
+};
+
+/*
+ * Trace 정책 - EventQueue의 이벤트별 로그 출력 방식 (컴파일 타임 선택)
+ *  - NullTrace   : 아무것도 안 함 (기본값, 인라인 후 완전히 제거됨)
+ *  - ConsoleTrace: 기존 동작 (cout + endl, 매 이벤트 동기 flush)
+ *  - BufferedTrace: 락-프리 메모리 버퍼에 기록, 백그라운드 스레드가 출력
+ */
+enum class TraceEvent : uint8_t { Push, Process, Dispatch };
+
+struct NullTrace {
+    void record(TraceEvent, size_t) {}
+};
+
+struct ConsoleTrace {
+    void record(TraceEvent type, size_t value) {
+        switch (type) {
+            case TraceEvent::Push:     cout << "[Queue] 이벤트 추가 (크기: " << value << ")" << endl; break;
+            case TraceEvent::Process:  cout << "[Queue] 이벤트 처리" << endl; break;
+            case TraceEvent::Dispatch: cout << "[Queue] 실행기로 이벤트 " << value << "개 전달" << endl; break;
+        }
+    }
+};
+
+/*
+ * TraceBuffer - SPSC 락-프리 trace ring + 백그라운드 drain 스레드
+ *  - 큐 스레드(생산자)는 고정 크기 레코드만 기록 → 포맷/출력 비용 없음
+ *  - 가득 차면 버리고 dropped 카운터 증가 (큐 처리량을 절대 막지 않음)
+ *  - drain 스레드가 모아서 한 번에 포맷·출력 (endl 대신 '\n', 마지막에만 flush)
+ */
+class TraceBuffer {
 public:
-    void push(function<void()> event) {
-        events.push(event);
-        cout << "[Queue] 이벤트 추가 (크기: " << events.size() << ")" << endl;
+    struct Record {
+        uint64_t timestampNs;
+        TraceEvent type;
+        uint32_t value;
+    };
+
+    explicit TraceBuffer(ostream& out = cout) : out(out), drainer([this]() { drainLoop(); }) {}
+
+    ~TraceBuffer() {
+        stopping = true;
+        drainer.join();
+        drain();
+        out.flush();
+    }
+
+    TraceBuffer(const TraceBuffer&) = delete;
+    TraceBuffer& operator=(const TraceBuffer&) = delete;
+
+    // 생산자 스레드 전용
+    void record(TraceEvent type, size_t value) {
+        const size_t t = tail.load(memory_order_relaxed);
+        if (t - head.load(memory_order_acquire) == CAPACITY) {
+            dropped.fetch_add(1, memory_order_relaxed);
+            return;
+        }
+        auto now = chrono::steady_clock::now().time_since_epoch();
+        records[t % CAPACITY] = {static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(now).count()),
+                                 type, static_cast<uint32_t>(value)};
+        tail.store(t + 1, memory_order_release);
+    }
+
+    size_t droppedCount() const { return dropped.load(memory_order_relaxed); }
+    size_t drainedCount() const { return drained.load(memory_order_relaxed); }
+
+private:
+    static constexpr size_t CAPACITY = 8192;
+    static constexpr const char* NAMES[] = {"push", "process", "dispatch"};
+
+    array<Record, CAPACITY> records;
+    alignas(64) atomic<size_t> head{0};
+    alignas(64) atomic<size_t> tail{0};
+    atomic<size_t> dropped{0};
+    atomic<size_t> drained{0};
+    atomic<bool> stopping{false};
+    ostream& out;
+    thread drainer;
+
+    void drain() {
+        size_t h = head.load(memory_order_relaxed);
+        const size_t t = tail.load(memory_order_acquire);
+        for (; h != t; ++h) {
+            const Record& r = records[h % CAPACITY];
+            out << "[Trace " << r.timestampNs << "] " << NAMES[static_cast<int>(r.type)]
+                << " " << r.value << '\n';
+        }
+        drained.fetch_add(t - head.load(memory_order_relaxed), memory_order_relaxed);
+        head.store(t, memory_order_release);
+    }
+
+    void drainLoop() {
+        while (!stopping.load()) {
+            drain();
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+    }
+};
+
+struct BufferedTrace {
+    TraceBuffer* buffer;
+    void record(TraceEvent type, size_t value) { buffer->record(type, value); }
+};
+
+// 우선순위 클래스 - 값이 작을수록 먼저 처리 (제어 루프 > 일반 > 텔레메트리)
+enum class Priority : uint8_t { High, Normal, Low };
+constexpr size_t PRIORITY_COUNT = 3;
+
+/*
+ * TimerWheel - 계층형 타이밍 휠 (4단계 × 64슬롯, 1틱 = 1ms → 약 4.6시간 범위)
+ *  - schedule / cancel: O(1) (슬롯 계산 + 이중 연결 리스트 삽입/삭제)
+ *  - advance: 틱마다 level 0 슬롯 하나만 만료, 상위 단계는 한 바퀴마다 아래로 cascade
+ *  - 노드는 풀(vector) + free list로 재사용, TimerId의 generation으로 만료된 ID 취소 방지
+ */
+struct TimerId {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+};
+
+class TimerWheel {
+public:
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOTS = size_t{1} << SLOT_BITS;
+    static constexpr size_t LEVELS = 4;
+    static constexpr uint64_t MAX_DELTA = (uint64_t{1} << (SLOT_BITS * LEVELS)) - 1;
+
+    // periodTicks == 0 이면 1회성 타이머
+    TimerId schedule(uint64_t expiryTick, uint64_t periodTicks, Priority priority, function<void()> fn) {
+        uint32_t index;
+        if (freeHead != NONE) {
+            index = freeHead;
+            freeHead = nodes[index].next;
+        } else {
+            index = static_cast<uint32_t>(nodes.size());
+            nodes.emplace_back();
+        }
+        Node& node = nodes[index];
+        node.fn = std::move(fn);
+        node.expiry = max(expiryTick, current + 1);
+        node.period = periodTicks;
+        node.priority = priority;
+        node.active = true;
+        link(index);
+        ++activeCount;
+        return {index, node.generation};
+    }
+
+    bool cancel(TimerId id) {
+        if (id.index >= nodes.size()) return false;
+        Node& node = nodes[id.index];
+        if (!node.active || node.generation != id.generation) return false;
+        unlink(id.index);
+        release(id.index);
+        return true;
+    }
+
+    // nowTick까지 진행하며 만료된 타이머를 expire(priority, function&&)로 전달
+    template<typename Expire>
+    void advance(uint64_t nowTick, Expire&& expire) {
+        if (activeCount == 0) {     // 빈 휠은 틱 단위로 돌 필요 없음
+            current = max(current, nowTick);
+            return;
+        }
+        while (current < nowTick) {
+            ++current;
+            // level 0 한 바퀴가 끝날 때마다 상위 단계 슬롯을 아래로 재배치
+            for (size_t level = 1; level < LEVELS && slotOf(current, level - 1) == 0; ++level) {
+                cascade(level, slotOf(current, level));
+            }
+            uint32_t index = heads[0][slotOf(current, 0)];
+            heads[0][slotOf(current, 0)] = NONE;
+            while (index != NONE) {
+                uint32_t next = nodes[index].next;
+                Node& node = nodes[index];
+                if (node.period != 0) {
+                    expire(node.priority, function<void()>(node.fn));  // 주기 타이머는 복사본 전달
+                    node.expiry += node.period;                         // 드리프트 없는 재예약
+                    if (node.expiry <= current) node.expiry = current + 1;
+                    link(index);
+                } else {
+                    function<void()> fn = std::move(node.fn);
+                    release(index);
+                    expire(node.priority, std::move(fn));
+                }
+                index = next;
+            }
+            if (activeCount == 0) {
+                current = nowTick;
+                return;
+            }
+        }
+    }
+
+    uint64_t currentTick() const { return current; }
+    size_t size() const { return activeCount; }
+
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    struct Node {
+        function<void()> fn;
+        uint64_t expiry = 0;
+        uint64_t period = 0;
+        uint32_t prev = NONE;
+        uint32_t next = NONE;
+        uint32_t generation = 0;
+        uint8_t level = 0;
+        uint8_t slot = 0;
+        Priority priority = Priority::Normal;
+        bool active = false;
+    };
+
+    vector<Node> nodes;
+    array<array<uint32_t, SLOTS>, LEVELS> heads = makeHeads();
+    uint32_t freeHead = NONE;
+    uint64_t current = 0;
+    size_t activeCount = 0;
+
+    static array<array<uint32_t, SLOTS>, LEVELS> makeHeads() {
+        array<array<uint32_t, SLOTS>, LEVELS> h;
+        for (auto& level : h) level.fill(NONE);
+        return h;
+    }
+
+    static size_t slotOf(uint64_t tick, size_t level) {
+        return (tick >> (SLOT_BITS * level)) & (SLOTS - 1);
+    }
+
+    // 남은 시간으로 단계 결정 → 해당 단계의 슬롯 리스트 앞에 삽입
+    void link(uint32_t index) {
+        Node& node = nodes[index];
+        uint64_t delta = node.expiry - current;
+        uint64_t placed = delta > MAX_DELTA ? current + MAX_DELTA : node.expiry;
+        size_t level = 0;
+        while (level + 1 < LEVELS && delta >= (uint64_t{1} << (SLOT_BITS * (level + 1)))) ++level;
+        size_t slot = slotOf(placed, level);
+        node.level = static_cast<uint8_t>(level);
+        node.slot = static_cast<uint8_t>(slot);
+        node.prev = NONE;
+        node.next = heads[level][slot];
+        if (node.next != NONE) nodes[node.next].prev = index;
+        heads[level][slot] = index;
+    }
+
+    void unlink(uint32_t index) {
+        Node& node = nodes[index];
+        if (node.prev != NONE) nodes[node.prev].next = node.next;
+        else heads[node.level][node.slot] = node.next;
+        if (node.next != NONE) nodes[node.next].prev = node.prev;
+    }
+
+    void release(uint32_t index) {
+        Node& node = nodes[index];
+        node.fn = nullptr;
+        node.active = false;
+        ++node.generation;
+        node.next = freeHead;
+        freeHead = index;
+        --activeCount;
+    }
+
+    void cascade(size_t level, size_t slot) {
+        uint32_t index = heads[level][slot];
+        heads[level][slot] = NONE;
+        while (index != NONE) {
+            uint32_t next = nodes[index].next;
+            link(index);
+            index = next;
+        }
+    }
+};
+
+template<typename Trace = NullTrace>
+class BasicEventQueue {
+    array<queue<function<void()>>, PRIORITY_COUNT> events;   // 우선순위별 FIFO
+    size_t pendingCount = 0;
+    TimerWheel timers;
+    chrono::steady_clock::time_point epoch = chrono::steady_clock::now();
+    WorkStealingExecutor* executor = nullptr;
+    [[no_unique_address]] Trace trace;
+
+    // 다른 스레드(드라이버 완료 문맥, 워커)에서 들어온 요청 - process()가 자기 스레드로 옮김
+    mutex inboxLock;
+    atomic<bool> inboxPending{false};
+    vector<function<void()>> inboxEvents;
+    vector<coroutine_handle<>> inboxResumes, readyResumes;     // 코루틴 재개는 function 없이 handle만
+    vector<pair<uint64_t, coroutine_handle<>>> inboxSleeps;    // (만료 tick, handle)
+
+    static constexpr chrono::milliseconds TICK{1};
+
+    // process()마다 시계를 한 번만 읽음 (타이머마다 chrono 조회하지 않음)
+    uint64_t nowTick() const {
+        return static_cast<uint64_t>((chrono::steady_clock::now() - epoch) / TICK);
+    }
+
+    static uint64_t toTicks(chrono::nanoseconds delay) {
+        auto ticks = (delay + TICK - chrono::nanoseconds(1)) / TICK;    // 올림
+        return static_cast<uint64_t>(max<int64_t>(ticks, 1));
+    }
+
+    void enqueue(Priority priority, function<void()>&& event) {
+        events[static_cast<size_t>(priority)].push(std::move(event));
+        ++pendingCount;
+    }
+
+    void drainInbox() {
+        if (!inboxPending.exchange(false, memory_order_acquire)) return;
+        {
+            lock_guard<mutex> guard(inboxLock);
+            for (auto& event : inboxEvents) enqueue(Priority::Normal, std::move(event));
+            inboxEvents.clear();
+            for (auto [expiry, handle] : inboxSleeps) {
+                timers.schedule(expiry, 0, Priority::Normal, [handle]() { handle.resume(); });
+            }
+            inboxSleeps.clear();
+            readyResumes.swap(inboxResumes);    // 두 벡터 용량 재사용 → 정상 상태 할당 0회
+        }
+        for (auto handle : readyResumes) {
+            if (executor) executor->push([handle]() { handle.resume(); });
+            else handle.resume();
+        }
+        readyResumes.clear();
+    }
+
+    template<typename Add>
+    void postToInbox(Add add) {
+        {
+            lock_guard<mutex> guard(inboxLock);
+            add();
+        }
+        inboxPending.store(true, memory_order_release);
+    }
+
+    void expireTimers() {
+        timers.advance(nowTick(), [this](Priority priority, function<void()>&& fn) {
+            enqueue(priority, std::move(fn));
+        });
+    }
+
+    // 가장 높은 우선순위의 비어있지 않은 큐
+    queue<function<void()>>* nextQueue() {
+        for (auto& q : events) {
+            if (!q.empty()) return &q;
+        }
+        return nullptr;
+    }
+public:
+    BasicEventQueue() = default;
+    explicit BasicEventQueue(Trace trace) : trace(trace) {}
+
+    // 실행기를 연결하면 process()가 이벤트를 워커들에게 분배
+    void setExecutor(WorkStealingExecutor* ex) { executor = ex; }
+    
+    void push(function<void()> event, Priority priority = Priority::Normal) {
+        enqueue(priority, std::move(event));
+        trace.record(TraceEvent::Push, pendingCount);
+    }
+
+    template<typename Rep, typename Period>
+    TimerId push_after(chrono::duration<Rep, Period> delay, function<void()> event,
+                       Priority priority = Priority::Normal) {
+        return timers.schedule(nowTick() + toTicks(delay), 0, priority, std::move(event));
+    }
+
+    template<typename Rep, typename Period>
+    TimerId push_every(chrono::duration<Rep, Period> period, function<void()> event,
+                       Priority priority = Priority::Normal) {
+        uint64_t ticks = toTicks(period);
+        return timers.schedule(nowTick() + ticks, ticks, priority, std::move(event));
+    }
+
+    bool cancel(TimerId id) { return timers.cancel(id); }
+    size_t pendingTimers() const { return timers.size(); }
+
+    // 아무 스레드에서나 호출 가능: 다음 process()에서 Normal 우선순위로 실행
+    void post(function<void()> event) {
+        postToInbox([&]() { inboxEvents.push_back(std::move(event)); });
+    }
+
+    // 아무 스레드에서나 호출 가능: 다음 process()에서 코루틴 재개
+    void resume_later(coroutine_handle<> handle) {
+        postToInbox([&]() { inboxResumes.push_back(handle); });
+    }
+
+    // co_await queue.schedule(): 현재 코루틴을 이 큐의 process() 스레드로 옮김
+    struct ScheduleAwaiter {
+        BasicEventQueue* queue;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(coroutine_handle<> handle) { queue->resume_later(handle); }
+        void await_resume() const noexcept {}
+    };
+    ScheduleAwaiter schedule() { return {this}; }
+
+    // co_await queue.sleep_for(d): 타이머 휠로 재개 (push_after와 같은 1ms 해상도)
+    struct SleepAwaiter {
+        BasicEventQueue* queue;
+        uint64_t expiry;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(coroutine_handle<> handle) {
+            queue->postToInbox([&]() { queue->inboxSleeps.emplace_back(expiry, handle); });
+        }
+        void await_resume() const noexcept {}
+    };
+    template<typename Rep, typename Period>
+    SleepAwaiter sleep_for(chrono::duration<Rep, Period> delay) {
+        return {this, nowTick() + toTicks(delay)};
     }
     
     void process() {
-        while (!events.empty()) {
-            cout << "[Queue] 이벤트 처리" << endl;
-            events.front()();
-            events.pop();
+        drainInbox();
+        expireTimers();
+        if (executor) {
+            trace.record(TraceEvent::Dispatch, pendingCount);
+            while (auto* q = nextQueue()) {     // 우선순위 순서로 전달
+                executor->push(std::move(q->front()));
+                q->pop();
+                --pendingCount;
+            }
+            executor->process_until_idle();
+            return;
+        }
+        // 이벤트 하나마다 최고 우선순위를 다시 선택 → 처리 중 들어온 High 이벤트가 앞지름
+        while (auto* q = nextQueue()) {
+            trace.record(TraceEvent::Process, pendingCount);
+            function<void()> event = std::move(q->front());
+            q->pop();
+            --pendingCount;
+            event();
         }
     }
 };
 
+using EventQueue = BasicEventQueue<>;
+
+/*
+ * CoroFramePool - 코루틴 프레임 전용 크기별 free list
+ *  - 프레임 크기를 64바이트 단위 클래스로 올림 (1KB 초과는 operator new)
+ *  - 빈 클래스는 블록 32개짜리 chunk를 한 번에 할당 → 정상 상태에서는 프레임마다 힙 할당 없음
+ *  - 프레임은 만든 스레드와 다른 스레드에서 끝날 수 있음 (드라이버 완료 문맥) → 클래스별 mutex
+ */
+class CoroFramePool {
+public:
+    static constexpr size_t GRANULE = 64;
+    static constexpr size_t CLASSES = 16;
+    static constexpr size_t BLOCKS_PER_CHUNK = 32;
+
+    static CoroFramePool& instance() {
+        static CoroFramePool pool;
+        return pool;
+    }
+
+    void* allocate(size_t size) {
+        size_t cls = classOf(size);
+        if (cls >= CLASSES) return ::operator new(size);
+        SizeClass& c = classes[cls];
+        lock_guard<mutex> guard(c.lock);
+        if (!c.free) refill(c, (cls + 1) * GRANULE);
+        FreeBlock* block = c.free;
+        c.free = block->next;
+        return block;
+    }
+
+    void deallocate(void* p, size_t size) noexcept {
+        size_t cls = classOf(size);
+        if (cls >= CLASSES) {
+            ::operator delete(p);
+            return;
+        }
+        SizeClass& c = classes[cls];
+        lock_guard<mutex> guard(c.lock);
+        c.free = new (p) FreeBlock{c.free};
+    }
+
+    size_t chunkCount() {
+        size_t total = 0;
+        for (auto& c : classes) {
+            lock_guard<mutex> guard(c.lock);
+            total += c.chunks.size();
+        }
+        return total;
+    }
+
+    ~CoroFramePool() {
+        for (auto& c : classes) {
+            for (void* chunk : c.chunks) ::operator delete(chunk);
+        }
+    }
+
+private:
+    struct FreeBlock { FreeBlock* next; };
+    struct SizeClass {
+        mutex lock;
+        FreeBlock* free = nullptr;
+        vector<void*> chunks;
+    };
+    array<SizeClass, CLASSES> classes;
+
+    static size_t classOf(size_t size) { return size == 0 ? 0 : (size - 1) / GRANULE; }
+
+    static void refill(SizeClass& c, size_t blockSize) {
+        char* chunk = static_cast<char*>(::operator new(blockSize * BLOCKS_PER_CHUNK));
+        c.chunks.push_back(chunk);
+        for (size_t i = BLOCKS_PER_CHUNK; i-- > 0;) {
+            c.free = new (chunk + i * blockSize) FreeBlock{c.free};
+        }
+    }
+};
+
+/*
+ * Task<T> - lazy 코루틴 작업
+ *  - 처음 co_await 될 때 시작, 끝나면 기다리던 코루틴으로 대칭 전송 (스택이 쌓이지 않음)
+ *  - 프레임은 promise의 operator new로 CoroFramePool에서 할당
+ *  - 예외는 co_await한 쪽에서 다시 던짐
+ *  - detach(): 최상위 작업 - 프레임이 스스로 소유권을 가지고 끝나면 해제
+ */
+template<typename T = void>
+class Task;
+
+namespace coro_detail {
+
+struct PromiseBase {
+    coroutine_handle<> continuation;
+    exception_ptr error;
+    bool detached = false;
+
+    static void* operator new(size_t size) { return CoroFramePool::instance().allocate(size); }
+    static void operator delete(void* p, size_t size) noexcept { CoroFramePool::instance().deallocate(p, size); }
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+        template<typename Promise>
+        coroutine_handle<> await_suspend(coroutine_handle<Promise> self) noexcept {
+            PromiseBase& promise = self.promise();
+            if (promise.continuation) return promise.continuation;
+            if (promise.detached) {
+                if (promise.error) terminate();     // detach된 작업의 예외는 받을 곳이 없음 (std::thread와 같음)
+                self.destroy();
+            }
+            return noop_coroutine();
+        }
+        void await_resume() const noexcept {}
+    };
+
+    suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() { error = current_exception(); }
+};
+
+template<typename T>
+struct Promise : PromiseBase {
+    optional<T> value;
+
+    Task<T> get_return_object();
+    template<typename U>
+    void return_value(U&& v) { value.emplace(std::forward<U>(v)); }
+    T result() {
+        if (error) rethrow_exception(error);
+        return std::move(*value);
+    }
+};
+
+template<>
+struct Promise<void> : PromiseBase {
+    Task<void> get_return_object();
+    void return_void() const noexcept {}
+    void result() const {
+        if (error) rethrow_exception(error);
+    }
+};
+
+}  // namespace coro_detail
+
+template<typename T>
+class [[nodiscard]] Task {
+public:
+    using promise_type = coro_detail::Promise<T>;
+
+    explicit Task(coroutine_handle<promise_type> h) : handle(h) {}
+    Task(Task&& other) noexcept : handle(exchange(other.handle, {})) {}
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&&) = delete;
+    ~Task() {
+        if (handle) handle.destroy();
+    }
+
+    bool await_ready() const noexcept { return false; }
+    coroutine_handle<> await_suspend(coroutine_handle<> awaiting) noexcept {
+        handle.promise().continuation = awaiting;
+        return handle;
+    }
+    T await_resume() { return handle.promise().result(); }
+
+    void detach() && {
+        auto h = exchange(handle, {});
+        h.promise().detached = true;
+        h.resume();
+    }
+
+private:
+    coroutine_handle<promise_type> handle;
+};
+
+namespace coro_detail {
+template<typename T>
+Task<T> Promise<T>::get_return_object() { return Task<T>(coroutine_handle<Promise>::from_promise(*this)); }
+inline Task<void> Promise<void>::get_return_object() { return Task<void>(coroutine_handle<Promise>::from_promise(*this)); }
+}  // namespace coro_detail
+
+/*
+ * 비동기 드라이버 (27_driver_interface.cpp의 IAsyncDriver와 같은 submit + 완료 콜백 인터페이스)
+ *  - SensorLinkDriver: 하드웨어 스레드가 요청을 FIFO로 완료 (요청 링은 고정 크기, 초과는 -EBUSY)
+ *  - 읽기는 센서 프레임 "S<id>=<value>;" 를 채움, 쓰기는 바이트 수만 세고 완료
+ */
+class IAsyncDriver {
+public:
+    using Completion = function<void(int result)>;     // result: 전송 바이트 수 또는 -errno
+    virtual ~IAsyncDriver() = default;
+    virtual int submit_read(uint8_t* buf, size_t len, Completion done) = 0;
+    virtual int submit_write(const uint8_t* buf, size_t len, Completion done) = 0;
+};
+
+class SensorLinkDriver : public IAsyncDriver {
+public:
+    static constexpr size_t QUEUE_DEPTH = 2048;
+
+    SensorLinkDriver() : hardware([this]() { hardwareLoop(); }) {}
+    ~SensorLinkDriver() {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+        }
+        work.notify_one();
+        hardware.join();
+    }
+
+    int submit_read(uint8_t* buf, size_t len, Completion done) override {
+        return enqueue(Request{buf, nullptr, len, std::move(done)});
+    }
+    int submit_write(const uint8_t* buf, size_t len, Completion done) override {
+        return enqueue(Request{nullptr, buf, len, std::move(done)});
+    }
+
+    uint64_t bytesWritten() const { return written.load(memory_order_relaxed); }
+
+private:
+    struct Request {
+        uint8_t* rxBuf = nullptr;
+        const uint8_t* txBuf = nullptr;
+        size_t len = 0;
+        Completion completion;
+    };
+
+    array<Request, QUEUE_DEPTH> ring;
+    size_t head = 0, count = 0;
+    mutex lock;
+    condition_variable work;
+    bool stopping = false;
+    uint32_t sample = 0;
+    atomic<uint64_t> written{0};
+    thread hardware;
+
+    int enqueue(Request request) {
+        {
+            lock_guard<mutex> guard(lock);
+            if (count == QUEUE_DEPTH) return -EBUSY;
+            ring[(head + count++) % QUEUE_DEPTH] = std::move(request);
+        }
+        work.notify_one();
+        return 0;
+    }
+
+    int complete(Request& r) {
+        if (r.txBuf) {
+            written.fetch_add(r.len, memory_order_relaxed);
+            return static_cast<int>(r.len);
+        }
+        ++sample;
+        int n = snprintf(reinterpret_cast<char*>(r.rxBuf), r.len, "S%u=%u;", sample % 16, sample % 1000);
+        return min(n, static_cast<int>(r.len) - 1);
+    }
+
+    // "DMA 완료 ISR": 쌓인 요청을 한꺼번에 꺼내 lock 밖에서 완료 콜백 호출
+    void hardwareLoop() {
+        array<Request, 64> batch;
+        unique_lock<mutex> guard(lock);
+        for (;;) {
+            work.wait(guard, [this]() { return stopping || count > 0; });
+            if (stopping && count == 0) return;
+            size_t n = min(count, batch.size());
+            for (size_t i = 0; i < n; ++i) {
+                batch[i] = std::move(ring[head]);
+                head = (head + 1) % QUEUE_DEPTH;
+            }
+            count -= n;
+            guard.unlock();
+            for (size_t i = 0; i < n; ++i) {
+                Completion done = std::move(batch[i].completion);
+                done(complete(batch[i]));
+            }
+            guard.lock();
+        }
+    }
+};
+
+/*
+ * 드라이버 awaitable - co_await asyncRead(driver, buf, len)
+ *  - 완료 콜백은 awaiter 포인터만 캡처 → std::function 내부 버퍼에 들어가 힙 할당 없음
+ *  - 재개는 완료 문맥(드라이버 스레드)에서 일어남 → 긴 작업 전에 co_await queue.schedule()로 복귀
+ *  - 접수 실패(-EBUSY 등)는 중단하지 않고 바로 오류 코드 반환
+ */
+struct DriverIoAwaiter {
+    IAsyncDriver& driver;
+    uint8_t* rxBuf;
+    const uint8_t* txBuf;
+    size_t len;
+    int result = 0;
+    coroutine_handle<> waiting;
+
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(coroutine_handle<> handle) {
+        waiting = handle;
+        auto done = [this](int r) {
+            result = r;
+            waiting.resume();
+        };
+        // 접수 뒤에는 이미 다른 스레드에서 재개됐을 수 있음 → 멤버를 다시 건드리지 않음
+        int rc = rxBuf ? driver.submit_read(rxBuf, len, done) : driver.submit_write(txBuf, len, done);
+        if (rc != 0) {
+            result = rc;
+            return false;
+        }
+        return true;
+    }
+    int await_resume() const noexcept { return result; }
+};
+
+inline DriverIoAwaiter asyncRead(IAsyncDriver& driver, uint8_t* buf, size_t len) {
+    return {driver, buf, nullptr, len, 0, {}};
+}
+inline DriverIoAwaiter asyncWrite(IAsyncDriver& driver, const uint8_t* buf, size_t len) {
+    return {driver, nullptr, buf, len, 0, {}};
+}
+
+// 파이프라인의 마지막 단계: 센서별 최신 값 (큐 스레드에서만 갱신)
+struct SensorCache {
+    array<int, 16> latest{};
+    uint64_t updates = 0;
+    void update(int sensor, int value) {
+        latest[static_cast<size_t>(sensor) % latest.size()] = value;
+        ++updates;
+    }
+};
+
+// "S<id>=<value>;" 파싱 (하위 Task로 분리해 Task<int> 연결을 보여줌)
+static Task<int> parseFrame(const uint8_t* raw, int len) {
+    int value = 0;
+    bool inValue = false;
+    for (int i = 0; i < len && raw[i] != ';'; ++i) {
+        if (raw[i] == '=') inValue = true;
+        else if (inValue) value = value * 10 + (raw[i] - '0');
+    }
+    co_return value;
+}
+
+// driver read → parse → cache update (+ 로그 write)를 순서대로 읽히는 코드로
+static Task<void> sensorPipeline(EventQueue& queue, IAsyncDriver& driver, SensorCache& cache,
+                                 int sensor, int rounds, atomic<int>& finished) {
+    array<uint8_t, 16> raw{};
+    for (int r = 0; r < rounds; ++r) {
+        int n = co_await asyncRead(driver, raw.data(), raw.size());
+        co_await queue.schedule();                  // 드라이버 스레드 → 큐 스레드
+        if (n < 0) continue;
+        int value = co_await parseFrame(raw.data(), n);
+        cache.update(sensor, value);
+    }
+    static constexpr uint8_t DONE[] = "done\n";
+    co_await asyncWrite(driver, DONE, sizeof(DONE) - 1);
+    finished.fetch_add(1, memory_order_release);
+}
+
+// 비교용: 지금 방식 - 단계마다 중첩 람다를 queue.post로 전달 (단계마다 std::function 할당)
+static void callbackPipeline(EventQueue& queue, IAsyncDriver& driver, SensorCache& cache, atomic<int>& finished,
+                             shared_ptr<array<uint8_t, 16>> raw, int sensor, int remaining) {
+    if (remaining == 0) {
+        static constexpr uint8_t DONE[] = "done\n";
+        driver.submit_write(DONE, sizeof(DONE) - 1, [&finished](int) { finished.fetch_add(1, memory_order_release); });
+        return;
+    }
+    uint8_t* buf = raw->data();
+    driver.submit_read(buf, raw->size(), [&queue, &driver, &cache, &finished, raw, sensor, remaining](int n) {
+        queue.post([&queue, &driver, &cache, &finished, raw, sensor, remaining, n]() {
+            if (n >= 0) {
+                int value = 0;
+                bool inValue = false;
+                for (int i = 0; i < n && (*raw)[i] != ';'; ++i) {
+                    if ((*raw)[i] == '=') inValue = true;
+                    else if (inValue) value = value * 10 + ((*raw)[i] - '0');
+                }
+                cache.update(sensor, value);
+            }
+            callbackPipeline(queue, driver, cache, finished, raw, sensor, remaining - 1);
+        });
+    });
+}
+
+// 작업 N개 동시 진행 → 모두 끝날 때까지 큐 스레드 하나가 process()
+template<typename Start>
+static void benchmarkPipeline(const char* name, int inFlight, int rounds, Start start) {
+    EventQueue queue;
+    SensorLinkDriver driver;
+    SensorCache cache;
+    atomic<int> finished{0};
+    size_t allocationsBefore = g_allocationCount;
+    auto t0 = chrono::steady_clock::now();
+    for (int s = 0; s < inFlight; ++s) start(queue, driver, cache, finished, s, rounds);
+    while (finished.load(memory_order_acquire) < inFlight) {
+        queue.process();
+        this_thread::yield();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+    size_t allocations = g_allocationCount - allocationsBefore;
+    double steps = static_cast<double>(inFlight) * rounds;
+    cout << "  " << name << ": " << static_cast<long long>(steps / seconds) << " steps/sec, "
+         << allocations / steps << " allocations/step (" << cache.updates << " cache updates)" << endl;
+}
+
+/*
+ * InplaceTask - 고정 크기 인라인 버퍼에 저장하는 move-only void() callable
+ *  - 캡처 크기/정렬은 컴파일 타임에 검사 (힙 fallback 없음)
+ *  - 복사 불가, 이동만 가능 → std::function처럼 복사 비용 없음
+ */
+template<size_t Capacity = 48>
+class InplaceTask {
+    struct Ops {
+        void (*invoke)(void*);
+        void (*moveTo)(void* dst, void* src) noexcept;
+        void (*destroy)(void*) noexcept;
+    };
+
+    template<typename F>
+    static constexpr Ops opsFor = {
+        [](void* p) { (*static_cast<F*>(p))(); },
+        [](void* dst, void* src) noexcept { new (dst) F(std::move(*static_cast<F*>(src))); static_cast<F*>(src)->~F(); },
+        [](void* p) noexcept { static_cast<F*>(p)->~F(); }
+    };
+
+    alignas(max_align_t) unsigned char storage[Capacity];
+    const Ops* ops = nullptr;
+
+public:
+    InplaceTask() = default;
+
+    template<typename F, typename Fn = decay_t<F>,
+             typename = enable_if_t<!is_same_v<Fn, InplaceTask>>>
+    InplaceTask(F&& f) {
+        static_assert(sizeof(Fn) <= Capacity, "Callable capture exceeds InplaceTask capacity");
+        static_assert(alignof(Fn) <= alignof(max_align_t), "Callable is over-aligned for InplaceTask");
+        static_assert(is_nothrow_move_constructible_v<Fn>, "Callable must be nothrow move constructible");
+        new (storage) Fn(std::forward<F>(f));
+        ops = &opsFor<Fn>;
+    }
+
+    InplaceTask(InplaceTask&& other) noexcept { moveFrom(other); }
+
+    InplaceTask& operator=(InplaceTask&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceTask(const InplaceTask&) = delete;
+    InplaceTask& operator=(const InplaceTask&) = delete;
+
+    ~InplaceTask() { reset(); }
+
+    void operator()() { ops->invoke(storage); }
+    explicit operator bool() const { return ops != nullptr; }
+
+    void reset() {
+        if (ops) {
+            ops->destroy(storage);
+            ops = nullptr;
+        }
+    }
+
+private:
+    void moveFrom(InplaceTask& other) noexcept {
+        if (other.ops) {
+            other.ops->moveTo(storage, other.storage);
+            ops = other.ops;
+            other.ops = nullptr;
+        }
+    }
+};
+
+/*
+ * 할당 없는 Event Queue
+ *  - 미리 할당된 고정 크기 ring에 InplaceTask를 직접 생성
+ *  - push/process 사이클에서 힙 할당 0회
+ */
+template<size_t QueueSize = 256, size_t TaskCapacity = 48>
+class InplaceEventQueue {
+    array<InplaceTask<TaskCapacity>, QueueSize> ring;
+    size_t head = 0, tail = 0, count = 0;
+
+public:
+    template<typename F>
+    bool push(F&& event) {
+        if (count >= QueueSize) return false;  // 가득 참
+        ring[tail] = InplaceTask<TaskCapacity>(std::forward<F>(event));
+        tail = (tail + 1) % QueueSize;
+        count++;
+        return true;
+    }
+
+    void process() {
+        while (count > 0) {
+            // 지역으로 옮긴 뒤 슬롯 반환: 이벤트 안에서 push해도 실행 중인 task를 덮어쓰지 않음
+            InplaceTask<TaskCapacity> task(std::move(ring[head]));
+            head = (head + 1) % QueueSize;
+            count--;
+            task();
+        }
+    }
+
+    size_t size() const { return count; }
+};
+
+// push/process 사이클 벤치마크 (콘솔 출력 없이 저장 방식만 비교)
+template<typename Push, typename Process>
+void benchmarkQueue(const char* name, size_t rounds, Push push, Process process) {
+    size_t allocationsBefore = g_allocationCount;
+    auto start = chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (int i = 0; i < 64; ++i) push(i);
+        process();
+    }
+    auto elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    size_t events = rounds * 64;
+    cout << "  " << name << ": " << static_cast<long long>(events / elapsed) << " events/sec, "
+         << (g_allocationCount - allocationsBefore) << " allocations" << endl;
+}
+
 int main() {
     cout << "\n=== C++ Event Queue ===" << endl;
     
-    EventQueue queue;
+    BasicEventQueue<ConsoleTrace> queue;  // 학습용: 이벤트마다 콘솔 로그
     
     queue.push([]() { cout << "  → Event 1" << endl; });
     queue.push([]() { cout << "  → Event 2" << endl; });
@@ -32,5 +1166,196 @@ int main() {
     
     queue.process();
     
+    cout << "\n=== Work-Stealing Executor ===" << endl;
+    {
+        WorkStealingExecutor executor(4);
+        BasicEventQueue<ConsoleTrace> parallelQueue;
+        parallelQueue.setExecutor(&executor);
+
+        atomic<long long> total{0};
+        for (int e = 0; e < 8; ++e) {
+            // 각 이벤트가 워커 안에서 하위 작업을 push → 자기 deque에 쌓이고 다른 워커가 훔쳐감
+            parallelQueue.push([&executor, &total, e]() {
+                for (int k = 0; k < 50; ++k) {
+                    executor.push([&total, e, k]() {
+                        long long x = 0;
+                        for (int i = 0; i < 2000; ++i) x += (e * k + i) % 7;
+                        total += x;
+                    });
+                }
+            });
+        }
+        parallelQueue.process();    // process_until_idle()로 모든 하위 작업 완료까지 대기
+        cout << "  total = " << total << endl;
+
+        auto stats = executor.stats();
+        for (size_t w = 0; w < stats.size(); ++w) {
+            cout << "  worker " << w << " (node " << stats[w].node << "): executed=" << stats[w].executed
+                 << " stolen=" << stats[w].stolen << " (remote " << stats[w].stolenRemote << ")"
+                 << " idle=" << stats[w].idleMs << "ms" << endl;
+        }
+    }
+
+    cout << "\n=== Allocation-free Event Queue ===" << endl;
+    InplaceEventQueue<> inplace;
+    inplace.push([]() { cout << "  → Inplace Event 1" << endl; });
+    inplace.push([]() { cout << "  → Inplace Event 2" << endl; });
+    inplace.process();
+
+    cout << "\n=== Benchmark (40-byte capture) ===" << endl;
+    constexpr size_t ROUNDS = 20000;
+    long long sink = 0;
+    long long a = 1, b = 2, c = 3;  // 캡처 40바이트 → std::function SBO(16바이트) 초과
+
+    std::queue<function<void()>> stdQueue;  // main의 지역 변수 queue와 구분
+    benchmarkQueue("std::function queue", ROUNDS,
+        [&](int i) { stdQueue.push([&sink, a, b, c, i]() { sink += a + b + c + i; }); },
+        [&]() { while (!stdQueue.empty()) { stdQueue.front()(); stdQueue.pop(); } });
+
+    InplaceEventQueue<64> inplaceQueue;
+    benchmarkQueue("InplaceEventQueue  ", ROUNDS,
+        [&](int i) { inplaceQueue.push([&sink, a, b, c, i]() { sink += a + b + c + i; }); },
+        [&]() { inplaceQueue.process(); });
+    cout << "  (checksum " << sink << ")" << endl;
+
+    cout << "\n=== Trace Policy Benchmark (events/sec) ===" << endl;
+    constexpr int TRACE_EVENTS = 200000;
+    auto runTraced = [](auto& q) {
+        long long counter = 0;
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < TRACE_EVENTS; ++i) {
+            q.push([&counter]() { counter++; });
+            if ((i & 63) == 63) q.process();
+        }
+        q.process();
+        return TRACE_EVENTS / chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    };
+
+    EventQueue quiet;   // NullTrace (기본값)
+    cout << "  NullTrace    : " << static_cast<long long>(runTraced(quiet)) << endl;
+
+    ostringstream traceLog;     // 백그라운드 스레드가 여기에 출력
+    {
+        TraceBuffer traceBuffer(traceLog);
+        BasicEventQueue<BufferedTrace> buffered(BufferedTrace{&traceBuffer});
+        cout << "  BufferedTrace: " << static_cast<long long>(runTraced(buffered)) << endl;
+        this_thread::sleep_for(chrono::milliseconds(5));
+        cout << "  (drained " << traceBuffer.drainedCount()
+             << ", dropped " << traceBuffer.droppedCount() << ")" << endl;
+    }
+
+    cout << "\n=== Delayed / Periodic Events ===" << endl;
+    {
+        EventQueue timed;
+        int ticks = 0;
+        bool cancelledFired = false;
+        timed.push_every(chrono::milliseconds(10), [&ticks]() { ticks++; }, Priority::High);
+        timed.push_after(chrono::milliseconds(25), []() { cout << "  → 25ms 지연 이벤트" << endl; });
+        TimerId cancelled = timed.push_after(chrono::milliseconds(30), [&cancelledFired]() { cancelledFired = true; });
+        timed.cancel(cancelled);
+        auto until = chrono::steady_clock::now() + chrono::milliseconds(55);
+        while (chrono::steady_clock::now() < until) {
+            timed.process();
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        cout << "  10ms 주기 이벤트 " << ticks << "회, 취소된 이벤트 실행: "
+             << (cancelledFired ? "예" : "아니오") << endl;
+    }
+
+    cout << "\n=== Timer Wheel: 50000 timers schedule/cancel ===" << endl;
+    {
+        constexpr int TIMERS = 50000;
+        EventQueue timed;
+        mt19937 rng(42);
+        uniform_int_distribution<int> delayMs(1, 600000);
+        vector<TimerId> ids;
+        ids.reserve(TIMERS);
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < TIMERS; ++i) {
+            ids.push_back(timed.push_after(chrono::milliseconds(delayMs(rng)), []() {}));
+        }
+        auto scheduled = chrono::steady_clock::now();
+        for (int i = 0; i < TIMERS; i += 2) timed.cancel(ids[i]);
+        auto cancelled = chrono::steady_clock::now();
+        auto perOp = [](auto begin, auto end, int n) {
+            return chrono::duration<double, nano>(end - begin).count() / n;
+        };
+        cout << "  schedule: " << static_cast<int>(perOp(start, scheduled, TIMERS)) << " ns/timer, cancel: "
+             << static_cast<int>(perOp(scheduled, cancelled, TIMERS / 2)) << " ns/timer, 남은 타이머 "
+             << timed.pendingTimers() << endl;
+    }
+
+    cout << "\n=== High-priority Latency under Low-priority Load ===" << endl;
+    {
+        // Low 이벤트 2000개 backlog 처리 중 50개마다 제어 이벤트 도착 → push부터 실행까지 지연 측정
+        auto measure = [](Priority controlPriority) {
+            EventQueue q;
+            vector<double> latencyUs;
+            volatile long long work = 0;
+            for (int round = 0; round < 10; ++round) {
+                for (int i = 0; i < 2000; ++i) {
+                    q.push([&q, &latencyUs, &work, i, controlPriority]() {
+                        for (int k = 0; k < 50; ++k) work = work + k;     // 텔레메트리 처리 흉내
+                        if (i % 50 == 0) {
+                            auto pushed = chrono::steady_clock::now();
+                            q.push([&latencyUs, pushed]() {
+                                latencyUs.push_back(chrono::duration<double, micro>(
+                                    chrono::steady_clock::now() - pushed).count());
+                            }, controlPriority);
+                        }
+                    }, Priority::Low);
+                }
+                q.process();
+            }
+            sort(latencyUs.begin(), latencyUs.end());
+            auto pct = [&](double p) { return latencyUs[static_cast<size_t>(p * (latencyUs.size() - 1))]; };
+            cout << "  p50=" << pct(0.50) << "us  p99=" << pct(0.99) << "us  max=" << latencyUs.back()
+                 << "us  (" << latencyUs.size() << " samples)" << endl;
+        };
+        cout << "  FIFO (Low)    : ";
+        measure(Priority::Low);
+        cout << "  Priority High : ";
+        measure(Priority::High);
+    }
+
+    cout << "\n=== Coroutines: driver read -> parse -> cache ===" << endl;
+    {
+        EventQueue queue;
+        SensorLinkDriver driver;
+        SensorCache cache;
+        atomic<int> finished{0};
+        sensorPipeline(queue, driver, cache, 3, 4, finished).detach();
+        [](EventQueue& q, SensorCache& c, atomic<int>& done) -> Task<void> {
+            for (int beat = 1; beat <= 3; ++beat) {
+                co_await q.sleep_for(chrono::milliseconds(10));
+                cout << "  → heartbeat " << beat << " (cache updates " << c.updates << ")" << endl;
+            }
+            done.fetch_add(1, memory_order_release);
+        }(queue, cache, finished).detach();
+        // 고정 시간 창이 아니라 두 작업이 끝날 때까지 돌림: 먼저 queue/driver를 파괴하면 detach된 프레임이 남음
+        auto start = chrono::steady_clock::now();
+        while (finished.load(memory_order_acquire) < 2) {
+            queue.process();
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        cout << "  pipeline + heartbeat finished in "
+             << chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() << " ms"
+             << ", sensor 3 latest = " << cache.latest[3] << ", bytes written = " << driver.bytesWritten() << endl;
+    }
+
+    cout << "\n=== Benchmark: 1000 in-flight pipelines x 20 steps ===" << endl;
+    {
+        constexpr int IN_FLIGHT = 1000, ROUNDS_PER = 20;
+        benchmarkPipeline("nested lambdas", IN_FLIGHT, ROUNDS_PER,
+            [](EventQueue& q, IAsyncDriver& d, SensorCache& c, atomic<int>& f, int s, int r) {
+                callbackPipeline(q, d, c, f, make_shared<array<uint8_t, 16>>(), s, r);
+            });
+        benchmarkPipeline("coroutines    ", IN_FLIGHT, ROUNDS_PER,
+            [](EventQueue& q, IAsyncDriver& d, SensorCache& c, atomic<int>& f, int s, int r) {
+                sensorPipeline(q, d, c, s, r, f).detach();
+            });
+        cout << "  frame pool chunks: " << CoroFramePool::instance().chunkCount() << endl;
+    }
+
     return 0;
 }
@@ -1,30 +1,155 @@
 /* C++ Memory Pool - custom allocator */
 #include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <thread>
 #include <vector>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+#include "mempool/concurrent_pool.h"
+#include "topology/topology.h"
 using namespace std;
 
+// 전역 할당기 사용 횟수 측정용 (전역 operator new 교체)
+static atomic<size_t> g_globalAllocations{0};
+
+void* operator new(size_t size) {
+    g_globalAllocations.fetch_add(1, memory_order_relaxed);
+    if (void* p = malloc(size)) return p;
+    throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+// 청크 메모리 공급 방식
+enum class ChunkBacking {
+    Heap,       // aligned operator new
+    HugePages,  // 2MB huge page mmap (실패 시 일반 mmap + THP 힌트, 비-Linux는 Heap)
+    NodeLocal   // 지정 NUMA node 페이지 (topology::NodeMemory: mbind → first-touch, 비-Linux는 Heap)
+};
+
+// 용량 계획용 카운터 (스크레이프 가능)
+struct PoolStats {
+    size_t liveBlocks;          // 현재 사용 중인 블록
+    size_t highWater;           // liveBlocks 최대값
+    size_t chunks;              // 현재 보유 청크
+    size_t chunkAllocations;    // 누적 청크 할당 (reset()해도 유지)
+    size_t hugePageChunks;      // MAP_HUGETLB로 받은 청크
+    size_t nodeLocalChunks;     // node에 배치된 청크 (node가 하나뿐이면 0)
+    size_t capacityBlocks;      // 보유 청크의 총 블록 수
+};
+
 template<typename T, size_t BlockSize = 4096>
 class MemoryPool {
-    struct Block { uint8_t data[sizeof(T)]; Block* next; };
+    // free 상태에서는 객체 저장 공간 자체를 next 링크로 재사용 → 블록 크기 = sizeof(T) (최소 포인터 크기)
+    union alignas(alignof(T) > alignof(void*) ? alignof(T) : alignof(void*)) Block {
+        uint8_t data[sizeof(T)];
+        Block* next;
+    };
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    // T가 BlockSize보다 커도 청크당 최소 1블록
+    static constexpr size_t BLOCKS_PER_CHUNK = BlockSize / sizeof(Block) ? BlockSize / sizeof(Block) : 1;
+
+    struct Chunk {
+        void* base;
+        size_t bytes;
+        bool mapped;
+    };
+
     Block* freeList = nullptr;
-    vector<unique_ptr<uint8_t[]>> chunks;
+    vector<Chunk> chunks;
+    ChunkBacking backing;
+    unsigned node;
+    PoolStats counters{};
     
-public:
-    T* allocate() {
-        if (!freeList) {
-            auto chunk = make_unique<uint8_t[]>(BlockSize);
-            Block* block = reinterpret_cast<Block*>(chunk.get());
-            for (size_t i = 0; i < BlockSize / sizeof(Block) - 1; ++i) {
-                block[i].next = &block[i + 1];
+    Chunk allocateChunk() {
+#ifdef __linux__
+        if (backing == ChunkBacking::HugePages) {
+            size_t bytes = (BLOCKS_PER_CHUNK * sizeof(Block) + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+            void* base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (base != MAP_FAILED) {
+                ++counters.hugePageChunks;
+                return {base, bytes, true};
+            }
+            // 예약된 huge page가 없으면 일반 매핑 + transparent huge page 힌트
+            base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (base != MAP_FAILED) {
+                madvise(base, bytes, MADV_HUGEPAGE);
+                return {base, bytes, true};
             }
-            block[BlockSize / sizeof(Block) - 1].next = nullptr;
-            freeList = block;
-            chunks.push_back(move(chunk));
         }
+        if (backing == ChunkBacking::NodeLocal) {
+            // 청크마다 mmap + mbind syscall → 청크를 크게(BlockSize) 잡을수록 비용이 분산됨
+            topology::NodeMapping mapping = topology::mapOnNode(BLOCKS_PER_CHUNK * sizeof(Block), node);
+            if (mapping.binding != topology::Binding::None) ++counters.nodeLocalChunks;
+            return {mapping.data, mapping.bytes, true};     // mapped → releaseChunk의 munmap
+        }
+#endif
+        size_t bytes = BLOCKS_PER_CHUNK * sizeof(Block);
+        return {::operator new(bytes, align_val_t{alignof(Block)}), bytes, false};
+    }
+
+    static void releaseChunk(const Chunk& chunk) {
+#ifdef __linux__
+        if (chunk.mapped) {
+            munmap(chunk.base, chunk.bytes);
+            return;
+        }
+#endif
+        ::operator delete(chunk.base, align_val_t{alignof(Block)});
+    }
+
+    // 청크 보충은 드문 경로 → 인라인하지 않아 allocate() 빠른 경로를 작게 유지
+#if defined(__GNUC__)
+    __attribute__((noinline))
+#endif
+    void refill() {
+        Chunk chunk = allocateChunk();
+        chunks.push_back(chunk);
+        Block* block = static_cast<Block*>(chunk.base);
+        size_t count = chunk.bytes / sizeof(Block);     // huge page 청크는 남는 공간까지 사용
+        for (size_t i = 0; i < count - 1; ++i) {
+            block[i].next = &block[i + 1];
+        }
+        block[count - 1].next = nullptr;
+        freeList = block;
+        ++counters.chunkAllocations;
+        counters.capacityBlocks += count;
+    }
+
+public:
+    static constexpr unsigned CURRENT_NODE = ~0u;
+
+    // node: NodeLocal 전용, 기본값은 풀을 만드는 스레드의 node
+    // (sysfs 탐색은 할당을 하므로 NodeLocal일 때만 그 자리에서 조회, Heap/HugePages는 topology를 건드리지 않음)
+    explicit MemoryPool(ChunkBacking backing = ChunkBacking::Heap, unsigned node = CURRENT_NODE)
+        : backing(backing),
+          node(backing == ChunkBacking::NodeLocal && node == CURRENT_NODE ? topology::currentNode() : node) {}
+    ~MemoryPool() {
+        for (const Chunk& chunk : chunks) releaseChunk(chunk);
+    }
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    T* allocate() {
+        if (!freeList) refill();
         
         Block* block = freeList;
         freeList = block->next;
+        counters.highWater = max(counters.highWater, ++counters.liveBlocks);
         return reinterpret_cast<T*>(block);
     }
     
@@ -32,9 +157,241 @@ public:
         Block* block = reinterpret_cast<Block*>(ptr);
         block->next = freeList;
         freeList = block;
+        --counters.liveBlocks;
+    }
+
+    // 사용 중인 블록이 없을 때만 청크를 모두 반환
+    bool reset() {
+        if (counters.liveBlocks) return false;
+        for (const Chunk& chunk : chunks) releaseChunk(chunk);
+        chunks.clear();
+        freeList = nullptr;
+        counters.capacityBlocks = 0;
+        counters.hugePageChunks = 0;
+        counters.nodeLocalChunks = 0;
+        return true;
     }
+
+    PoolStats stats() const {
+        PoolStats s = counters;
+        s.chunks = chunks.size();
+        return s;
+    }
+
+    static constexpr size_t blockSize() { return sizeof(Block); }
+};
+
+// 비교용: 기존 MemoryPool을 mutex로 감싼 버전 (모든 할당이 직렬화됨)
+template<typename T>
+class LockedMemoryPool {
+    MemoryPool<T> pool;
+    mutex lock;
+public:
+    T* allocate() { lock_guard<mutex> guard(lock); return pool.allocate(); }
+    void deallocate(T* ptr) { lock_guard<mutex> guard(lock); pool.deallocate(ptr); }
+};
+
+// ConcurrentMemoryPool: mempool/concurrent_pool.h (15_linked_list.cpp와 공용)
+using mempool::ConcurrentMemoryPool;
+
+/*
+ * PoolResource - pmr::memory_resource 어댑터
+ *  - 요청 크기(정렬 포함)에 맞는 가장 작은 크기 클래스의 MemoryPool로 라우팅
+ *  - 가장 큰 클래스보다 크거나 정렬이 16바이트를 넘으면 upstream으로
+ *  - pmr::vector / string / unordered_map 노드가 전역 할당기 대신 풀을 사용
+ */
+template<size_t N>
+struct alignas(N < alignof(max_align_t) ? N : alignof(max_align_t)) SizeClass {
+    uint8_t bytes[N];
 };
 
+template<size_t... Sizes>
+class PoolResource : public pmr::memory_resource {
+    tuple<MemoryPool<SizeClass<Sizes>>...> pools;
+    pmr::memory_resource* upstream;
+    size_t pooled = 0;
+    size_t forwarded = 0;
+
+    // 작은 클래스부터 순서대로 맞는 풀 탐색 (컴파일 타임 전개)
+    template<size_t I = 0>
+    void* allocateFromPool(size_t need) {
+        if constexpr (I == sizeof...(Sizes)) {
+            return nullptr;
+        } else {
+            using Class = tuple_element_t<I, tuple<SizeClass<Sizes>...>>;
+            if (need <= sizeof(Class)) return get<I>(pools).allocate();
+            return allocateFromPool<I + 1>(need);
+        }
+    }
+
+    template<size_t I = 0>
+    bool deallocateToPool(void* p, size_t need) {
+        if constexpr (I == sizeof...(Sizes)) {
+            return false;
+        } else {
+            using Class = tuple_element_t<I, tuple<SizeClass<Sizes>...>>;
+            if (need <= sizeof(Class)) {
+                get<I>(pools).deallocate(static_cast<Class*>(p));
+                return true;
+            }
+            return deallocateToPool<I + 1>(p, need);
+        }
+    }
+
+    static size_t classSize(size_t bytes, size_t alignment) {
+        return alignment > alignof(max_align_t) ? SIZE_MAX : max(bytes, alignment);
+    }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        if (void* p = allocateFromPool(classSize(bytes, alignment))) {
+            ++pooled;
+            return p;
+        }
+        ++forwarded;
+        return upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        if (!deallocateToPool(p, classSize(bytes, alignment))) {
+            upstream->deallocate(p, bytes, alignment);
+        }
+    }
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    explicit PoolResource(pmr::memory_resource* upstream = pmr::new_delete_resource())
+        : upstream(upstream) {}
+
+    size_t pooledCount() const { return pooled; }
+    size_t forwardedCount() const { return forwarded; }
+};
+
+using MessageResource = PoolResource<8, 16, 32, 64, 128, 256>;
+
+/*
+ * ScratchArena - 요청 단위 monotonic 아레나
+ *  - 내장 버퍼에서 bump 포인터로만 할당, deallocate는 아무것도 안 함
+ *  - 버퍼가 모자라면 upstream에서 블록을 받아 이어붙임 (2배씩 증가)
+ *  - release()로 요청 종료 시 한 번에 반환 → 내장 버퍼는 다음 요청에 재사용
+ */
+template<size_t InlineBytes = 8192>
+class ScratchArena : public pmr::memory_resource {
+    struct Overflow {
+        Overflow* next;
+        size_t size;
+    };
+
+    alignas(max_align_t) uint8_t inlineBuffer[InlineBytes];
+    uint8_t* cursor = inlineBuffer;
+    uint8_t* end = inlineBuffer + InlineBytes;
+    Overflow* overflow = nullptr;
+    size_t nextOverflowSize = InlineBytes;
+    pmr::memory_resource* upstream;
+
+    void grow(size_t bytes, size_t alignment) {
+        size_t size = max(nextOverflowSize, bytes + alignment + sizeof(Overflow));
+        auto* block = static_cast<Overflow*>(upstream->allocate(size, alignof(max_align_t)));
+        *block = {overflow, size};
+        overflow = block;
+        cursor = reinterpret_cast<uint8_t*>(block + 1);
+        end = reinterpret_cast<uint8_t*>(block) + size;
+        nextOverflowSize = size * 2;
+    }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        void* p = cursor;
+        size_t space = static_cast<size_t>(end - cursor);
+        if (!align(alignment, bytes, p, space)) {
+            grow(bytes, alignment);
+            p = cursor;
+            space = static_cast<size_t>(end - cursor);
+            align(alignment, bytes, p, space);
+        }
+        cursor = static_cast<uint8_t*>(p) + bytes;
+        return p;
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    explicit ScratchArena(pmr::memory_resource* upstream = pmr::new_delete_resource())
+        : upstream(upstream) {}
+    ~ScratchArena() { release(); }
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    void release() {
+        while (overflow) {
+            Overflow* next = overflow->next;
+            upstream->deallocate(overflow, overflow->size, alignof(max_align_t));
+            overflow = next;
+        }
+        cursor = inlineBuffer;
+        end = inlineBuffer + InlineBytes;
+        nextOverflowSize = InlineBytes;
+    }
+
+    size_t used() const { return overflow ? 0 : static_cast<size_t>(cursor - inlineBuffer); }
+};
+
+// 요청 하나 처리: 토큰 분리 + 단어 빈도 집계 (모든 컨테이너가 arena 사용)
+size_t handleRequest(const char* text, pmr::memory_resource* scratch) {
+    pmr::vector<pmr::string> tokens(scratch);
+    pmr::unordered_map<pmr::string, int> counts(scratch);
+    pmr::string current(scratch);
+    for (const char* c = text; ; ++c) {
+        if (*c == ' ' || *c == '\0') {
+            if (!current.empty()) tokens.push_back(current);
+            current.clear();
+            if (*c == '\0') break;
+        } else {
+            current += *c;
+        }
+    }
+    for (const auto& token : tokens) counts[token]++;
+    return counts.size();
+}
+
+struct Message {
+    uint64_t id;
+    double payload[3];
+};
+
+// 스레드마다 256개 할당 → 전부 해제를 반복, 전체 처리량(ops/sec) 측정
+template<typename MakeWorker>
+void benchmarkScaling(const char* name, MakeWorker makeWorker) {
+    constexpr int ROUNDS = 200;
+    constexpr int BATCH = 256;
+    cout << "  " << name << ":";
+    for (int threads : {1, 2, 4, 8}) {
+        auto start = chrono::steady_clock::now();
+        vector<thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&makeWorker]() {
+                auto [alloc, dealloc] = makeWorker();
+                Message* slots[BATCH];
+                for (int r = 0; r < ROUNDS; ++r) {
+                    for (int i = 0; i < BATCH; ++i) { slots[i] = alloc(); slots[i]->id = i; }
+                    for (int i = 0; i < BATCH; ++i) dealloc(slots[i]);
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "  " << threads << "T=" << static_cast<long long>(threads * ROUNDS * BATCH * 2 / seconds / 1e3) << "k";
+    }
+    cout << " ops/sec" << endl;
+}
+
 int main() {
     cout << "=== C++ Memory Pool ===" << endl;
     MemoryPool<int> pool;
@@ -46,5 +403,115 @@ int main() {
     pool.deallocate(p1);
     cout << "Deallocated" << endl;
     
+    cout << "\n=== Block Layout / Alignment ===" << endl;
+    struct alignas(64) CacheLinePacket { uint8_t bytes[40]; };
+    struct LargeFrame { uint8_t bytes[8192]; };     // BlockSize(4096)보다 큼
+    cout << "  MemoryPool<int> block: " << MemoryPool<int>::blockSize() << " bytes (link가 저장 공간 재사용)" << endl;
+    MemoryPool<CacheLinePacket> packets;
+    bool aligned = true;
+    vector<CacheLinePacket*> held;
+    for (int i = 0; i < 200; ++i) {
+        held.push_back(packets.allocate());
+        aligned = aligned && reinterpret_cast<uintptr_t>(held.back()) % 64 == 0;
+    }
+    cout << "  alignas(64) packets 64-byte aligned: " << (aligned ? "yes" : "NO") << endl;
+    for (int i = 0; i < 150; ++i) { packets.deallocate(held.back()); held.pop_back(); }
+    auto printStats = [](const char* name, const PoolStats& st) {
+        cout << "  " << name << ": live=" << st.liveBlocks << " highWater=" << st.highWater
+             << " chunks=" << st.chunks << " chunkAllocs=" << st.chunkAllocations
+             << " hugeChunks=" << st.hugePageChunks << " nodeChunks=" << st.nodeLocalChunks
+             << " capacity=" << st.capacityBlocks << endl;
+    };
+    printStats("packets", packets.stats());
+    MemoryPool<LargeFrame> frames;
+    LargeFrame* frame = frames.allocate();
+    frames.deallocate(frame);
+    printStats("frames ", frames.stats());
+
+    MemoryPool<Message> hugePool(ChunkBacking::HugePages);
+    for (int i = 0; i < 1000; ++i) hugePool.allocate();
+    printStats("huge   ", hugePool.stats());
+
+    const topology::Topology& topo = topology::system();
+    unsigned lastNode = topo.nodes().back().id;
+    MemoryPool<Message> nodePool(ChunkBacking::NodeLocal, lastNode);
+    Message* local = nodePool.allocate();
+    local->id = 1;
+    printStats("node   ", nodePool.stats());
+    cout << "  node " << lastNode << " pool: block on node " << topology::addressNode(local) << " ("
+         << topo.nodeCount() << " NUMA node(s))" << endl;
+    nodePool.deallocate(local);
+    for (auto* p : held) packets.deallocate(p);
+    cout << "  packets reset: " << (packets.reset() ? "ok" : "blocks still live") << endl;
+    
+    cout << "\n=== Thread-caching Pool: cross-thread free ===" << endl;
+    ConcurrentMemoryPool<Message> shared;
+    {
+        vector<Message*> handoff(1000);
+        thread producer([&]() {
+            ConcurrentMemoryPool<Message>::LocalCache cache(shared);
+            for (size_t i = 0; i < handoff.size(); ++i) {
+                handoff[i] = cache.allocate();
+                handoff[i]->id = i;
+            }
+        });
+        producer.join();
+        thread consumer([&]() {
+            ConcurrentMemoryPool<Message>::LocalCache cache(shared);    // 다른 스레드가 할당한 블록 해제
+            uint64_t sum = 0;
+            for (Message* m : handoff) { sum += m->id; cache.deallocate(m); }
+            cout << "  consumer freed " << handoff.size() << " messages (id sum " << sum << ")" << endl;
+        });
+        consumer.join();
+    }
+
+    cout << "\n=== Scaling Benchmark (alloc+free) ===" << endl;
+    benchmarkScaling("new/delete     ", []() {
+        return pair([]() { return new Message; }, [](Message* m) { delete m; });
+    });
+    LockedMemoryPool<Message> locked;
+    benchmarkScaling("mutex pool     ", [&locked]() {
+        return pair([&locked]() { return locked.allocate(); }, [&locked](Message* m) { locked.deallocate(m); });
+    });
+    ConcurrentMemoryPool<Message> concurrent;
+    benchmarkScaling("magazine pool  ", [&concurrent]() {
+        auto cache = make_shared<ConcurrentMemoryPool<Message>::LocalCache>(concurrent);
+        return pair([cache]() { return cache->allocate(); }, [cache](Message* m) { cache->deallocate(m); });
+    });
+
+    cout << "\n=== pmr: Size-class PoolResource ===" << endl;
+    MessageResource poolResource;
+    {
+        pmr::unordered_map<int, pmr::string> sessions(&poolResource);
+        sessions.reserve(512);
+        for (int i = 0; i < 256; ++i) sessions.emplace(i, "session-payload-over-sso-limit");     // 워밍업
+        size_t before = g_globalAllocations;
+        for (int round = 0; round < 1000; ++round) {
+            int key = round % 256;
+            sessions.erase(key);
+            sessions.emplace(key, "session-payload-over-sso-limit");     // 노드 + 문자열 모두 풀에서 재사용
+        }
+        cout << "  steady-state insert/erase x1000: global allocations = "
+             << g_globalAllocations - before << endl;
+    }
+    cout << "  pooled=" << poolResource.pooledCount()
+         << " forwarded upstream=" << poolResource.forwardedCount() << endl;
+
+    cout << "\n=== pmr: Per-request ScratchArena ===" << endl;
+    {
+        const char* request = "get sensor temp get sensor rpm set motor speed get sensor temp "
+                              "set motor torque limit get status of the motor controller now";
+        ScratchArena<> arena(&poolResource);
+        size_t before = g_globalAllocations;
+        size_t unique = 0;
+        for (int i = 0; i < 1000; ++i) {
+            unique = handleRequest(request, &arena);
+            if (i == 0) cout << "  arena used per request: " << arena.used() << " bytes" << endl;
+            arena.release();    // 요청 종료 → 전부 한 번에 해제
+        }
+        cout << "  1000 requests (" << unique << " unique words): global allocations = "
+             << g_globalAllocations - before << endl;
+    }
+    
     return 0;
 }
@@ -2,6 +2,16 @@
 #include <iostream>
 #include <vector>
 #include <memory>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <utility>
+#include "topology/topology.h"
 using namespace std;
 
 template<typename T>
@@ -29,7 +39,271 @@ public:
     }
 };
 
-struct Packet { int id; string data; };
+/*
+ * ConcurrentObjectPool - lock-free 고정 용량 객체 풀
+ *  - free list는 Treiber 스택, head = [32비트 태그 | 32비트 슬롯 인덱스]
+ *    → pop/push마다 태그 증가, 같은 인덱스가 돌아와도 CAS 실패 (ABA 방지)
+ *  - 포인터 대신 인덱스를 써서 64비트 CAS 하나로 충분 (16바이트 CAS 불필요)
+ *  - acquire()는 move-only Handle 반환, 소멸 시 자동 반환 → 이중 반환/누수 불가
+ *  - node를 주면 슬롯 배열을 그 NUMA node 페이지에 배치 (topology::NodeMemory 위에 placement new)
+ */
+template<typename T>
+class ConcurrentObjectPool {
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    struct Slot {
+        T object;
+        atomic<uint32_t> next{NONE};
+    };
+
+    unique_ptr<Slot[]> heapSlots;       // 기본: 힙 배열
+    topology::NodeMemory nodeSlots;     // node 지정 시
+    Slot* slots;
+    size_t capacity;
+    alignas(64) atomic<uint64_t> head;
+
+    static uint64_t pack(uint32_t index, uint64_t previous) {
+        return ((previous >> 32) + 1) << 32 | index;
+    }
+    static uint32_t indexOf(uint64_t tagged) { return static_cast<uint32_t>(tagged); }
+
+    void push(uint32_t index) {
+        uint64_t top = head.load(memory_order_relaxed);
+        do {
+            slots[index].next.store(indexOf(top), memory_order_relaxed);
+        } while (!head.compare_exchange_weak(top, pack(index, top),
+                                             memory_order_release, memory_order_relaxed));
+    }
+
+    uint32_t pop() {
+        uint64_t top = head.load(memory_order_acquire);
+        while (indexOf(top) != NONE) {
+            // 다른 스레드가 먼저 pop해도 next 읽기는 안전 (슬롯은 풀 수명 동안 유효), 태그로 CAS 실패
+            uint32_t next = slots[indexOf(top)].next.load(memory_order_relaxed);
+            if (head.compare_exchange_weak(top, pack(next, top),
+                                           memory_order_acquire, memory_order_acquire)) {
+                return indexOf(top);
+            }
+        }
+        return NONE;
+    }
+
+public:
+    class Handle {
+        ConcurrentObjectPool* pool = nullptr;
+        uint32_t index = NONE;
+    public:
+        Handle() = default;
+        Handle(ConcurrentObjectPool* pool, uint32_t index) : pool(pool), index(index) {}
+        Handle(Handle&& other) noexcept
+            : pool(exchange(other.pool, nullptr)), index(exchange(other.index, NONE)) {}
+        Handle& operator=(Handle&& other) noexcept {
+            if (this != &other) {
+                reset();
+                pool = exchange(other.pool, nullptr);
+                index = exchange(other.index, NONE);
+            }
+            return *this;
+        }
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+        ~Handle() { reset(); }
+
+        // 명시적 조기 반환 (이후 핸들은 비어 있음)
+        void reset() {
+            if (pool) {
+                pool->push(index);
+                pool = nullptr;
+            }
+        }
+
+        T* get() const { return pool ? &pool->slots[index].object : nullptr; }
+        T* operator->() const { return get(); }
+        T& operator*() const { return *get(); }
+        explicit operator bool() const { return pool != nullptr; }
+    };
+
+    explicit ConcurrentObjectPool(size_t size)
+        : heapSlots(make_unique<Slot[]>(size)), slots(heapSlots.get()), capacity(size), head(pack(NONE, 0)) {
+        for (size_t i = size; i-- > 0;) push(static_cast<uint32_t>(i));
+    }
+
+    ConcurrentObjectPool(size_t size, unsigned node)
+        : nodeSlots(size * sizeof(Slot), node), slots(static_cast<Slot*>(nodeSlots.data())),
+          capacity(size), head(pack(NONE, 0)) {
+        static_assert(alignof(Slot) <= 4096, "slot alignment exceeds page alignment");
+        for (size_t i = 0; i < size; ++i) new (&slots[i]) Slot();
+        for (size_t i = size; i-- > 0;) push(static_cast<uint32_t>(i));
+    }
+
+    ~ConcurrentObjectPool() {
+        if (!heapSlots)
+            for (size_t i = 0; i < capacity; ++i) slots[i].~Slot();
+    }
+
+    ConcurrentObjectPool(const ConcurrentObjectPool&) = delete;
+    ConcurrentObjectPool& operator=(const ConcurrentObjectPool&) = delete;
+
+    // 비어 있으면 빈 Handle
+    Handle acquire() {
+        uint32_t index = pop();
+        return index == NONE ? Handle() : Handle(this, index);
+    }
+
+    size_t size() const { return capacity; }
+};
+
+/*
+ * SlabObjectPool - 지연 생성 + slab 단위 성장/반환
+ *  - 용량을 SlabSize개짜리 연속 slab으로 확보, 객체는 처음 acquire될 때 생성
+ *  - 모든 slab이 차면 slab 하나를 추가 (acquire가 nullptr을 반환하지 않음)
+ *  - T에 reset()이 있으면 release 시 reset()만 호출하고 객체 유지 → string 용량 재사용
+ *    없으면 release 시 소멸, 다음 acquire 때 다시 생성
+ *  - acquire는 앞쪽 slab부터 채움 → 버스트 후 뒤쪽 slab이 비게 되고 trim()으로 반환
+ */
+template<typename T>
+concept Resettable = requires(T& t) { t.reset(); };
+
+template<typename T, size_t SlabSize = 64>
+class SlabObjectPool {
+    static_assert(SlabSize <= UINT16_MAX, "slot index is 16-bit");
+    struct Slab;
+
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        Slab* owner;
+        uint16_t nextFree;
+        bool constructed;
+        T* object() { return launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    struct Slab {
+        Slot slots[SlabSize];
+        size_t index;           // slabs 안에서의 위치 (trim 시 갱신)
+        uint16_t freeHead = 0;
+        uint16_t inUse = 0;
+
+        explicit Slab(size_t index) : index(index) {
+            for (size_t i = 0; i < SlabSize; ++i) {
+                slots[i].owner = this;
+                slots[i].nextFree = static_cast<uint16_t>(i + 1);
+                slots[i].constructed = false;
+            }
+        }
+        ~Slab() {
+            for (Slot& slot : slots) {
+                if (slot.constructed) slot.object()->~T();
+            }
+        }
+        bool full() const { return inUse == SlabSize; }
+    };
+
+    vector<unique_ptr<Slab>> slabs;
+    size_t firstAvailable = 0;      // 이 앞의 slab은 모두 가득 참
+    size_t live = 0;
+
+    static Slot* slotOf(T* obj) {
+        // storage가 Slot의 첫 멤버 → 주소 동일
+        return reinterpret_cast<Slot*>(reinterpret_cast<unsigned char*>(obj));
+    }
+
+public:
+    explicit SlabObjectPool(size_t reserveSlabs = 0) {
+        for (size_t i = 0; i < reserveSlabs; ++i) slabs.push_back(make_unique<Slab>(i));
+    }
+
+    T* acquire() {
+        while (firstAvailable < slabs.size() && slabs[firstAvailable]->full()) ++firstAvailable;
+        if (firstAvailable == slabs.size()) slabs.push_back(make_unique<Slab>(slabs.size()));     // slab 단위 성장
+        Slab& slab = *slabs[firstAvailable];
+        Slot& slot = slab.slots[slab.freeHead];
+        slab.freeHead = slot.nextFree;
+        ++slab.inUse;
+        ++live;
+        if (!slot.constructed) {
+            ::new (static_cast<void*>(slot.storage)) T();   // 최초 사용 시 생성
+            slot.constructed = true;
+        }
+        return slot.object();
+    }
+
+    void release(T* obj) {
+        Slot* slot = slotOf(obj);
+        Slab* slab = slot->owner;
+        if constexpr (Resettable<T>) {
+            obj->reset();       // 객체 유지, 내부 버퍼 재사용
+        } else {
+            obj->~T();
+            slot->constructed = false;
+        }
+        size_t slotIndex = static_cast<size_t>(slot - slab->slots);
+        slot->nextFree = slab->freeHead;
+        slab->freeHead = static_cast<uint16_t>(slotIndex);
+        --slab->inUse;
+        --live;
+        firstAvailable = min(firstAvailable, slab->index);
+    }
+
+    // 비어 있는 slab을 keepSlabs개만 남기고 반환, 반환한 개수 리턴
+    size_t trim(size_t keepSlabs = 1) {
+        size_t kept = 0;
+        size_t freed = 0;
+        vector<unique_ptr<Slab>> remaining;
+        for (auto& slab : slabs) {
+            if (slab->inUse == 0 && kept >= keepSlabs) {
+                ++freed;
+                continue;       // unique_ptr 소멸 → 생성된 객체 소멸 후 메모리 반환
+            }
+            if (slab->inUse == 0) ++kept;
+            slab->index = remaining.size();
+            remaining.push_back(std::move(slab));
+        }
+        slabs = std::move(remaining);
+        firstAvailable = 0;
+        return freed;
+    }
+
+    size_t slabCount() const { return slabs.size(); }
+    size_t liveCount() const { return live; }
+    size_t capacity() const { return slabs.size() * SlabSize; }
+};
+
+struct Packet {
+    int id;
+    string data;
+    void reset() { id = 0; data.clear(); }   // clear()는 용량 유지
+};
+
+// 비교용: 기존 ObjectPool + mutex
+template<typename T>
+class LockedObjectPool {
+    ObjectPool<T> pool;
+    mutex lock;
+public:
+    explicit LockedObjectPool(size_t size) : pool(size) {}
+    T* acquire() { lock_guard<mutex> guard(lock); return pool.acquire(); }
+    void release(T* obj) { lock_guard<mutex> guard(lock); pool.release(obj); }
+};
+
+// 스레드마다 패킷 4개 acquire → 기록 → release 반복
+template<typename Cycle>
+void benchmarkContention(const char* name, Cycle cycle) {
+    constexpr int ITERATIONS = 20000;
+    cout << "  " << name << ":";
+    for (int threads : {1, 2, 4, 8, 16}) {
+        auto start = chrono::steady_clock::now();
+        vector<thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&cycle, t]() {
+                for (int i = 0; i < ITERATIONS; ++i) cycle(t, i);
+            });
+        }
+        for (auto& w : workers) w.join();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "  " << threads << "T=" << static_cast<long long>(threads * ITERATIONS * 4 / seconds / 1e3) << "k";
+    }
+    cout << " acq+rel/sec" << endl;
+}
 
 int main() {
     cout << "=== C++ Object Pool ===" << endl;
@@ -42,5 +316,72 @@ int main() {
     pool.release(p1);
     cout << "Released" << endl;
     
+    cout << "\n=== Lock-free Object Pool (RAII Handle) ===" << endl;
+    ConcurrentObjectPool<Packet> shared(2);
+    {
+        auto h1 = shared.acquire();
+        auto h2 = shared.acquire();
+        auto h3 = shared.acquire();     // 용량 2 → 빈 핸들
+        h1->id = 10;
+        cout << "  h1=" << h1->id << " h2=" << (h2 ? "ok" : "empty")
+             << " h3=" << (h3 ? "ok" : "empty") << endl;
+        auto moved = std::move(h1);     // 소유권 이동, h1은 비어 있음
+        cout << "  moved=" << moved->id << " h1=" << (h1 ? "ok" : "empty") << endl;
+    }   // 스코프 종료 → 자동 반환
+    auto again = shared.acquire();
+    cout << "  after scope: " << (again ? "reacquired" : "leaked") << endl;
+    again.reset();
+    {
+        unsigned node = topology::currentNode();
+        ConcurrentObjectPool<Packet> local(256, node);     // 이 스레드의 node 페이지에 슬롯 배치
+        auto h = local.acquire();
+        cout << "  node-local pool: slot on node " << topology::addressNode(h.get()) << " (requested " << node << ")"
+             << endl;
+    }
+
+    cout << "\n=== Slab Pool: lazy construction / growth / trim ===" << endl;
+    {
+        constexpr size_t OBJECTS = 100000;
+        auto start = chrono::steady_clock::now();
+        ObjectPool<Packet> eager(OBJECTS);
+        auto eagerUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+        start = chrono::steady_clock::now();
+        SlabObjectPool<Packet> lazy(OBJECTS / 64);
+        auto lazyUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+        cout << "  startup for " << OBJECTS << " packets: eager=" << static_cast<long long>(eagerUs)
+             << "us, slab reserve=" << static_cast<long long>(lazyUs) << "us" << endl;
+    }
+    {
+        SlabObjectPool<Packet, 64> slabPool;
+        vector<Packet*> burst;
+        for (int i = 0; i < 1000; ++i) {           // 버스트: slab이 필요한 만큼 늘어남
+            Packet* p = slabPool.acquire();
+            p->id = i;
+            p->data.assign(200, 'x');
+            burst.push_back(p);
+        }
+        cout << "  burst: live=" << slabPool.liveCount() << " slabs=" << slabPool.slabCount() << endl;
+        for (Packet* p : burst) slabPool.release(p);
+        Packet* reused = slabPool.acquire();
+        cout << "  reused packet: id=" << reused->id << " data.size=" << reused->data.size()
+             << " data.capacity=" << reused->data.capacity() << " (reset으로 용량 유지)" << endl;
+        slabPool.release(reused);
+        size_t freed = slabPool.trim();
+        cout << "  trim: freed " << freed << " slabs, remaining=" << slabPool.slabCount() << endl;
+    }
+
+    cout << "\n=== Contention Benchmark (Packet) ===" << endl;
+    LockedObjectPool<Packet> locked(64);
+    benchmarkContention("mutex pool    ", [&locked](int t, int i) {
+        Packet* p[4];
+        for (auto& x : p) { x = locked.acquire(); x->id = t + i; }
+        for (auto* x : p) locked.release(x);
+    });
+    ConcurrentObjectPool<Packet> lockFree(64);
+    benchmarkContention("lock-free pool", [&lockFree](int t, int i) {
+        ConcurrentObjectPool<Packet>::Handle p[4];
+        for (auto& x : p) { x = lockFree.acquire(); x->id = t + i; }
+    });     // 배열 소멸 시 반환
+    
     return 0;
 }
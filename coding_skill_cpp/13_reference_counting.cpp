@@ -1,6 +1,16 @@
 /* C++ Reference Counting - shared_ptr */
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <utility>
+#include <vector>
 using namespace std;
 
 struct Buffer {
@@ -9,6 +19,232 @@ struct Buffer {
     int data[100];
 };
 
+/*
+ * 카운트 정책 - 참조 카운터 타입과 증감 방식
+ *  - SingleThreadCount: 일반 정수 (스레드를 벗어나지 않는 객체용)
+ *  - AtomicCount: 증가는 relaxed (이미 참조를 가진 쪽만 증가시키므로 순서 불필요)
+ *                 감소는 acq_rel (마지막 해제 스레드가 다른 스레드의 쓰기를 모두 본 뒤 삭제)
+ */
+struct SingleThreadCount {
+    using Counter = uint32_t;
+    static void increment(Counter& c) { ++c; }
+    static bool decrement(Counter& c) { return --c == 0; }
+    static uint32_t load(const Counter& c) { return c; }
+};
+
+struct AtomicCount {
+    using Counter = atomic<uint32_t>;
+    static void increment(Counter& c) { c.fetch_add(1, memory_order_relaxed); }
+    static bool decrement(Counter& c) { return c.fetch_sub(1, memory_order_acq_rel) == 1; }
+    static uint32_t load(const Counter& c) { return c.load(memory_order_relaxed); }
+};
+
+/*
+ * RefCounted - 카운트를 객체 안에 두는 CRTP 베이스 (별도 control block 없음)
+ * IntrusivePtr - 포인터 하나(8바이트)짜리 핸들
+ */
+template<typename Derived, typename Policy = AtomicCount>
+class RefCounted {
+    mutable typename Policy::Counter refs{0};
+public:
+    using CountPolicy = Policy;
+
+    RefCounted() = default;
+    RefCounted(const RefCounted&) {}                // 객체를 복사해도 카운트는 새로 시작
+    RefCounted& operator=(const RefCounted&) { return *this; }
+
+    void addRef() const { Policy::increment(refs); }
+    void release() const {
+        if (Policy::decrement(refs)) delete static_cast<const Derived*>(this);
+    }
+    uint32_t refCount() const { return Policy::load(refs); }
+
+protected:
+    ~RefCounted() = default;
+};
+
+template<typename T>
+class IntrusivePtr {
+    T* ptr = nullptr;
+public:
+    IntrusivePtr() = default;
+    explicit IntrusivePtr(T* p) : ptr(p) { if (ptr) ptr->addRef(); }
+    IntrusivePtr(const IntrusivePtr& other) : ptr(other.ptr) { if (ptr) ptr->addRef(); }
+    IntrusivePtr(IntrusivePtr&& other) noexcept : ptr(exchange(other.ptr, nullptr)) {}
+    ~IntrusivePtr() { if (ptr) ptr->release(); }
+
+    IntrusivePtr& operator=(IntrusivePtr other) noexcept {   // copy-and-swap
+        std::swap(ptr, other.ptr);
+        return *this;
+    }
+
+    void reset() { IntrusivePtr().swap(*this); }
+    void swap(IntrusivePtr& other) noexcept { std::swap(ptr, other.ptr); }
+
+    T* get() const { return ptr; }
+    T* operator->() const { return ptr; }
+    T& operator*() const { return *ptr; }
+    explicit operator bool() const { return ptr != nullptr; }
+    uint32_t use_count() const { return ptr ? ptr->refCount() : 0; }
+};
+
+template<typename T, typename... Args>
+IntrusivePtr<T> makeIntrusive(Args&&... args) {
+    return IntrusivePtr<T>(new T(std::forward<Args>(args)...));
+}
+
+template<typename Policy>
+struct CountedBuffer : RefCounted<CountedBuffer<Policy>, Policy> {
+    int data[100];
+};
+
+/*
+ * BufferSlab - 풀에서 할당되는 고정 크기 수신 버퍼 (카운트 내장)
+ *  - 마지막 참조가 사라지면 destroying delete(C++20)가 소유 풀로 반환
+ * Slice - (slab 참조, 포인터, 길이) 3워드 → 값으로 전달, 바이트 복사 없음
+ * SliceChain - 여러 slab에 걸친 메시지를 복사 없이 이어붙인 뷰
+ */
+class SlabPool;
+
+class BufferSlab : public RefCounted<BufferSlab, AtomicCount> {
+    friend class SlabPool;
+    SlabPool* owner;
+    explicit BufferSlab(SlabPool* owner) : owner(owner) {}
+public:
+    static constexpr size_t CAPACITY = 2048;
+    size_t length = 0;                          // 채워진 바이트 수
+    alignas(16) uint8_t bytes[CAPACITY];
+
+    static void operator delete(BufferSlab* slab, destroying_delete_t);
+};
+
+class SlabPool {
+    struct alignas(BufferSlab) Storage { unsigned char raw[sizeof(BufferSlab)]; };
+    vector<unique_ptr<Storage>> storage;
+    vector<void*> freeSlots;
+    mutex lock;                                 // 다른 스레드에서 마지막 slice가 해제될 수 있음
+    size_t outstanding = 0;
+public:
+    IntrusivePtr<BufferSlab> allocate() {
+        void* slot;
+        {
+            lock_guard<mutex> guard(lock);
+            if (freeSlots.empty()) {
+                storage.push_back(make_unique<Storage>());
+                freeSlots.push_back(storage.back().get());
+            }
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+            ++outstanding;
+        }
+        return IntrusivePtr<BufferSlab>(::new (slot) BufferSlab(this));
+    }
+
+    void recycle(BufferSlab* slab) {
+        slab->~BufferSlab();
+        lock_guard<mutex> guard(lock);
+        freeSlots.push_back(slab);
+        --outstanding;
+    }
+
+    size_t outstandingCount() { lock_guard<mutex> guard(lock); return outstanding; }
+    size_t allocatedCount() { lock_guard<mutex> guard(lock); return storage.size(); }
+};
+
+inline void BufferSlab::operator delete(BufferSlab* slab, destroying_delete_t) {
+    slab->owner->recycle(slab);
+}
+
+class Slice {
+    IntrusivePtr<BufferSlab> slab;
+    const uint8_t* ptr = nullptr;
+    size_t len = 0;
+public:
+    Slice() = default;
+    explicit Slice(IntrusivePtr<BufferSlab> whole)
+        : slab(std::move(whole)), ptr(slab->bytes), len(slab->length) {}
+    Slice(IntrusivePtr<BufferSlab> owner, const uint8_t* ptr, size_t len)
+        : slab(std::move(owner)), ptr(ptr), len(len) {}
+
+    // 하위 slice: 같은 slab 참조를 공유 (카운트 +1, 복사 없음)
+    Slice sub(size_t offset, size_t count = SIZE_MAX) const {
+        offset = min(offset, len);
+        return Slice(slab, ptr + offset, min(count, len - offset));
+    }
+
+    const uint8_t* data() const { return ptr; }
+    size_t size() const { return len; }
+    bool empty() const { return len == 0; }
+    uint8_t operator[](size_t i) const { return ptr[i]; }
+    string_view view() const { return {reinterpret_cast<const char*>(ptr), len}; }
+    uint32_t slabRefs() const { return slab.use_count(); }
+};
+static_assert(sizeof(Slice) <= 3 * sizeof(void*), "Slice must stay pass-by-value cheap");
+
+class SliceChain {
+    vector<Slice> parts;
+    size_t total = 0;
+public:
+    void append(Slice part) {
+        total += part.size();
+        if (!part.empty()) parts.push_back(std::move(part));
+    }
+
+    size_t size() const { return total; }
+
+    uint8_t at(size_t i) const {
+        for (const Slice& part : parts) {
+            if (i < part.size()) return part[i];
+            i -= part.size();
+        }
+        return 0;
+    }
+
+    // 연속 메모리가 꼭 필요할 때만 복사
+    size_t copyTo(uint8_t* dst, size_t capacity) const {
+        size_t written = 0;
+        for (const Slice& part : parts) {
+            size_t n = min(part.size(), capacity - written);
+            memcpy(dst + written, part.data(), n);
+            written += n;
+            if (written == capacity) break;
+        }
+        return written;
+    }
+
+    template<typename Fn>
+    void forEachSegment(Fn&& fn) const {
+        for (const Slice& part : parts) fn(part);
+    }
+};
+
+// TLV 프레임 파싱: [type 1B][len 1B][payload] 반복 → payload slice들 (복사 없음)
+vector<Slice> parseFrames(const Slice& packet) {
+    vector<Slice> frames;
+    size_t offset = 0;
+    while (offset + 2 <= packet.size()) {
+        size_t len = packet[offset + 1];
+        if (offset + 2 + len > packet.size()) break;
+        frames.push_back(packet.sub(offset + 2, len));
+        offset += 2 + len;
+    }
+    return frames;
+}
+
+// 핸들 복사 + 소멸을 hot loop에서 반복
+template<typename Handle>
+void benchmarkCopies(const char* name, const Handle& source) {
+    constexpr int ITERATIONS = 2000000;
+    long long sink = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        Handle copy = source;
+        sink += copy->data[i % 100];
+    }
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / ITERATIONS;
+    cout << "  " << name << ": " << ns << " ns/copy (sink " << sink << ")" << endl;
+}
+
 int main() {
     cout << "=== C++ Reference Counting ===" << endl;
     
@@ -22,5 +258,65 @@ int main() {
     
     cout << "ref_count: " << buf1.use_count() << endl;
     
+    cout << "\n=== Intrusive Reference Counting ===" << endl;
+    auto local = makeIntrusive<CountedBuffer<SingleThreadCount>>();
+    cout << "sizeof(shared_ptr)=" << sizeof(shared_ptr<Buffer>)
+         << " sizeof(IntrusivePtr)=" << sizeof(local) << endl;
+    {
+        auto copy = local;
+        cout << "ref_count: " << local.use_count() << endl;
+    }
+    cout << "ref_count: " << local.use_count() << endl;
+
+    cout << "\n=== Benchmark: copy/destroy hot loop ===" << endl;
+    struct PlainBuffer { int data[100] = {}; };
+    auto shared = make_shared<PlainBuffer>();
+    auto atomicCounted = makeIntrusive<CountedBuffer<AtomicCount>>();
+    for (int i = 0; i < 100; ++i) local->data[i] = atomicCounted->data[i] = shared->data[i] = i;
+    benchmarkCopies("shared_ptr              ", shared);
+    benchmarkCopies("IntrusivePtr<atomic>    ", atomicCounted);
+    benchmarkCopies("IntrusivePtr<single>    ", local);
+
+    cout << "\n=== Ref-counted Slab + Zero-copy Slices ===" << endl;
+    SlabPool slabPool;
+    vector<Slice> frames;
+    {
+        auto rx = slabPool.allocate();      // 수신 버퍼 (DMA/recv가 채웠다고 가정)
+        const char* words[] = {"temp=21.5", "rpm=3000", "status=OK"};
+        for (const char* w : words) {
+            size_t n = strlen(w);
+            rx->bytes[rx->length++] = 0x01;
+            rx->bytes[rx->length++] = static_cast<uint8_t>(n);
+            memcpy(rx->bytes + rx->length, w, n);
+            rx->length += n;
+        }
+        Slice packet(std::move(rx));
+        frames = parseFrames(packet);
+        cout << "sizeof(Slice)=" << sizeof(Slice) << ", frames=" << frames.size()
+             << ", slab refs=" << packet.slabRefs() << endl;
+    }   // 원본 packet slice 소멸 → frame slice들이 slab 유지
+    for (const Slice& f : frames) cout << "  frame: " << f.view() << " (key=" << f.sub(0, f.view().find('=')).view() << ")" << endl;
+    cout << "outstanding slabs: " << slabPool.outstandingCount() << endl;
+    frames.clear();                     // 마지막 slice → slab이 풀로 반환
+    cout << "outstanding slabs after drop: " << slabPool.outstandingCount() << endl;
+
+    // 두 수신 버퍼에 걸친 메시지 → 복사 없이 연결 뷰
+    auto first = slabPool.allocate();
+    auto second = slabPool.allocate();
+    memcpy(first->bytes, "....HELLO, ", 11);
+    first->length = 11;
+    memcpy(second->bytes, "WORLD!....", 10);
+    second->length = 10;
+    SliceChain message;
+    message.append(Slice(first).sub(4));
+    message.append(Slice(second).sub(0, 6));
+    first.reset();
+    second.reset();
+    uint8_t flat[32];
+    size_t n = message.copyTo(flat, sizeof(flat));
+    cout << "chain size=" << message.size() << " at(7)='" << static_cast<char>(message.at(7))
+         << "' flat=\"" << string_view(reinterpret_cast<char*>(flat), n) << "\""
+         << " (pool slabs allocated=" << slabPool.allocatedCount() << ")" << endl;
+    
     return 0;
 }
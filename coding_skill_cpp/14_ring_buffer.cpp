@@ -1,33 +1,832 @@
 /* C++ Ring Buffer - template */
 #include <iostream>
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#include "topology/topology.h"
 using namespace std;
 
-template<typename T, size_t Size>
+// 버퍼 가득 참 정책 (circular_buffer.c의 POLICY_* 와 동일한 개념, 컴파일 타임 선택)
+enum class OverflowPolicy {
+    OverwriteOldest,    // 가장 오래된 데이터 덮어쓰기 (최신 센서 데이터 우선)
+    Reject,             // 새 데이터 거부 (기본값)
+    Block               // 공간이 생길 때까지 대기 (내부 mutex + condvar)
+};
+
+// 인덱스 래핑: Size가 2^n이면 비트 마스크, 아니면 modulo (컴파일 타임 선택)
+template<size_t Size>
+constexpr size_t wrapIndex(size_t index) {
+    static_assert(Size > 0, "Ring size must be non-zero");
+    if constexpr ((Size & (Size - 1)) == 0) {
+        return index & (Size - 1);
+    } else {
+        return index % Size;
+    }
+}
+
+template<typename T, size_t Size, OverflowPolicy Policy = OverflowPolicy::Reject>
 class RingBuffer {
+    struct BlockingState {
+        mutable mutex mtx;
+        condition_variable notFull, notEmpty;
+    };
+    struct NoBlockingState {};
+
     array<T, Size> buffer;
     size_t head = 0, tail = 0, count = 0;
+    // Block 정책일 때만 동기화 객체를 가짐 (나머지 정책은 크기 0)
+    [[no_unique_address]] conditional_t<Policy == OverflowPolicy::Block,
+                                        BlockingState, NoBlockingState> sync;
     
 public:
     bool push(const T& item) {
-        if (count >= Size) return false;
-        buffer[tail] = item;
-        tail = (tail + 1) % Size;
-        count++;
+        if constexpr (Policy == OverflowPolicy::Block) {
+            unique_lock<mutex> lock(sync.mtx);
+            sync.notFull.wait(lock, [this] { return count < Size; });
+            pushUnchecked(item);
+            lock.unlock();
+            sync.notEmpty.notify_one();
+        } else if constexpr (Policy == OverflowPolicy::OverwriteOldest) {
+            if (count == Size) {
+                head = wrapIndex<Size>(head + 1);   // 가장 오래된 데이터 버림
+                count--;
+            }
+            pushUnchecked(item);
+        } else {
+            if (count >= Size) return false;
+            pushUnchecked(item);
+        }
         return true;
     }
     
     bool pop(T& item) {
-        if (count == 0) return false;
+        if constexpr (Policy == OverflowPolicy::Block) {
+            unique_lock<mutex> lock(sync.mtx);
+            if (count == 0) return false;
+            popUnchecked(item);
+            lock.unlock();
+            sync.notFull.notify_one();
+        } else {
+            if (count == 0) return false;
+            popUnchecked(item);
+        }
+        return true;
+    }
+
+    // Block 정책 전용: 데이터가 들어올 때까지 대기
+    void pop_wait(T& item) {
+        static_assert(Policy == OverflowPolicy::Block, "pop_wait() requires OverflowPolicy::Block");
+        unique_lock<mutex> lock(sync.mtx);
+        sync.notEmpty.wait(lock, [this] { return count > 0; });
+        popUnchecked(item);
+        lock.unlock();
+        sync.notFull.notify_one();
+    }
+    
+    size_t size() const {
+        if constexpr (Policy == OverflowPolicy::Block) {
+            lock_guard<mutex> lock(sync.mtx);
+            return count;
+        } else {
+            return count;
+        }
+    }
+
+    /*
+     * Bulk API - UART/DMA 버스트용
+     *  - 래핑 지점에서 최대 2개의 연속 구간으로 나눠 복사
+     *  - trivially copyable 타입이면 memcpy, 아니면 copy
+     *  - 반환값: 실제로 옮긴 원소 개수
+     *  - OverwriteOldest 정책이면 모자란 만큼 오래된 데이터를 버리고 전부 기록
+     *  - Block 정책은 단일 push/pop만 지원
+     */
+    size_t push_bulk(span<const T> items) {
+        static_assert(Policy != OverflowPolicy::Block, "Bulk API is not available with OverflowPolicy::Block");
+        if constexpr (Policy == OverflowPolicy::OverwriteOldest) {
+            if (items.size() > Size) items = items.last(Size);
+            const size_t overflow = items.size() > Size - count ? items.size() - (Size - count) : 0;
+            head = wrapIndex<Size>(head + overflow);
+            count -= overflow;
+        }
+        const size_t n = min(items.size(), Size - count);
+        const size_t first = min(n, Size - tail);
+        copySegment(&buffer[tail], items.data(), first);
+        copySegment(&buffer[0], items.data() + first, n - first);
+        tail = wrapIndex<Size>(tail + n);
+        count += n;
+        return n;
+    }
+
+    size_t pop_bulk(span<T> out) {
+        static_assert(Policy != OverflowPolicy::Block, "Bulk API is not available with OverflowPolicy::Block");
+        const size_t n = min(out.size(), count);
+        const size_t first = min(n, Size - head);
+        copySegment(out.data(), &buffer[head], first);
+        copySegment(out.data() + first, &buffer[0], n - first);
+        head = wrapIndex<Size>(head + n);
+        count -= n;
+        return n;
+    }
+
+    // 복사 없이 읽을 수 있는 첫 번째 연속 구간 (래핑 전까지)
+    span<const T> peek_contiguous() const {
+        static_assert(Policy != OverflowPolicy::Block, "Bulk API is not available with OverflowPolicy::Block");
+        return span<const T>(buffer.data() + head, min(count, Size - head));
+    }
+
+    // peek_contiguous()로 처리한 원소 버리기
+    size_t consume(size_t n) {
+        static_assert(Policy != OverflowPolicy::Block, "Bulk API is not available with OverflowPolicy::Block");
+        n = min(n, count);
+        head = wrapIndex<Size>(head + n);
+        count -= n;
+        return n;
+    }
+
+private:
+    void pushUnchecked(const T& item) {
+        buffer[tail] = item;
+        tail = wrapIndex<Size>(tail + 1);
+        count++;
+    }
+
+    void popUnchecked(T& item) {
         item = buffer[head];
-        head = (head + 1) % Size;
+        head = wrapIndex<Size>(head + 1);
         count--;
+    }
+
+    static void copySegment(T* dst, const T* src, size_t n) {
+        if (n == 0) return;
+        if constexpr (is_trivially_copyable_v<T>) {
+            memcpy(dst, src, n * sizeof(T));
+        } else {
+            copy(src, src + n, dst);
+        }
+    }
+};
+
+// 캐시 라인 크기 (x86/ARM 대부분 64바이트)
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+/*
+ * 락-프리 SPSC (단일 생산자 / 단일 소비자) Ring Buffer
+ *  - 공유 count 없음: head/tail 두 인덱스만으로 상태 판단
+ *  - tail은 생산자만, head는 소비자만 쓴다 (acquire/release로 동기화)
+ *  - 인덱스는 계속 증가하고 슬롯 위치만 wrapIndex로 계산 → 가득 참/비어있음 구분 가능
+ *  - 각 쪽은 상대 인덱스의 캐시 사본을 들고 있다가 필요할 때만 다시 읽음
+ *    → 평소에는 상대 코어의 캐시 라인을 건드리지 않음
+ */
+template<typename T, size_t Size>
+class SpscRingBuffer {
+    alignas(CACHE_LINE_SIZE) array<T, Size> buffer;
+
+    // 소비자 전용 캐시 라인
+    alignas(CACHE_LINE_SIZE) atomic<size_t> head{0};
+    size_t cachedTail = 0;
+
+    // 생산자 전용 캐시 라인
+    alignas(CACHE_LINE_SIZE) atomic<size_t> tail{0};
+    size_t cachedHead = 0;
+    // alignas 멤버 덕분에 sizeof도 64의 배수 → 뒤 객체와 캐시 라인 공유 없음
+
+public:
+    // 생산자 스레드에서만 호출
+    bool push(const T& item) {
+        const size_t t = tail.load(memory_order_relaxed);
+        if (t - cachedHead == Size) {
+            cachedHead = head.load(memory_order_acquire);
+            if (t - cachedHead == Size) return false;  // 가득 참
+        }
+        buffer[wrapIndex<Size>(t)] = item;
+        tail.store(t + 1, memory_order_release);
         return true;
     }
-    
-    size_t size() const { return count; }
+
+    // 소비자 스레드에서만 호출
+    bool pop(T& item) {
+        const size_t h = head.load(memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(memory_order_acquire);
+            if (h == cachedTail) return false;  // 비어있음
+        }
+        item = buffer[wrapIndex<Size>(h)];
+        head.store(h + 1, memory_order_release);
+        return true;
+    }
+
+    // 다른 스레드가 동작 중이면 근사값
+    size_t size() const {
+        return tail.load(memory_order_acquire) - head.load(memory_order_acquire);
+    }
+};
+
+/*
+ * Bounded MPMC (다중 생산자 / 다중 소비자) Queue - Vyukov 설계
+ *  - 슬롯마다 sequence 번호를 두어 슬롯 상태를 표현
+ *      sequence == pos      → 생산자가 쓸 수 있음
+ *      sequence == pos + 1  → 소비자가 읽을 수 있음
+ *  - enqueue/dequeue 각각 위치 확보용 CAS 1회, 락 없음
+ *  - 저장소는 RingBuffer와 같은 고정 크기 array
+ */
+template<typename T, size_t Size>
+class MpmcQueue {
+    struct Slot {
+        atomic<size_t> sequence;
+        T data;
+    };
+
+    array<Slot, Size> slots;
+    alignas(CACHE_LINE_SIZE) atomic<size_t> enqueuePos{0};
+    alignas(CACHE_LINE_SIZE) atomic<size_t> dequeuePos{0};
+
+public:
+    MpmcQueue() {
+        for (size_t i = 0; i < Size; ++i) {
+            slots[i].sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    bool push(const T& item) {
+        Slot* slot;
+        size_t pos = enqueuePos.load(memory_order_relaxed);
+        for (;;) {
+            slot = &slots[wrapIndex<Size>(pos)];
+            const size_t seq = slot->sequence.load(memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // 가득 참 (한 바퀴 전 데이터가 아직 안 빠짐)
+            } else {
+                pos = enqueuePos.load(memory_order_relaxed);  // 다른 생산자가 먼저 가져감
+            }
+        }
+        slot->data = item;
+        slot->sequence.store(pos + 1, memory_order_release);
+        return true;
+    }
+
+    bool pop(T& item) {
+        Slot* slot;
+        size_t pos = dequeuePos.load(memory_order_relaxed);
+        for (;;) {
+            slot = &slots[wrapIndex<Size>(pos)];
+            const size_t seq = slot->sequence.load(memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // 비어있음
+            } else {
+                pos = dequeuePos.load(memory_order_relaxed);
+            }
+        }
+        item = slot->data;
+        slot->sequence.store(pos + Size, memory_order_release);  // 다음 바퀴 생산자에게 반환
+        return true;
+    }
+};
+
+#ifdef __linux__
+/*
+ * SharedRingBuffer - 프로세스 간 공유 메모리 Ring Buffer
+ *  - shm_open 매핑 안에 헤더 + 인덱스 + 슬롯을 직접 배치 (포인터 없음 → 매핑 주소가 달라도 동작)
+ *  - 헤더: magic / version / 레코드 크기 / 용량 / 생산자 모드 → open() 때 하나라도 다르면 거부
+ *  - ShmProducers::Single: SpscRingBuffer와 같은 head/tail 프로토콜
+ *    ShmProducers::Multi:  MpmcQueue와 같은 슬롯 sequence 프로토콜 (소비자는 하나)
+ *  - T는 trivially copyable만 허용 (다른 프로세스에서 바이트 그대로 읽어도 의미가 같은 타입)
+ *  - 빠른 경로는 공유 메모리 load/store뿐, syscall 없음
+ *    상대가 잠들어 있을 때만 futex wake (프로세스 간 공유 → FUTEX_*_PRIVATE 아님)
+ *  - write()/drain()은 슬롯 안에서 바로 쓰고 읽음 → 직렬화 / 중간 버퍼 없음
+ */
+enum class ShmProducers : uint32_t { Single = 1, Multi = 2 };
+
+struct ShmRingHeader {
+    static constexpr uint32_t MAGIC = 0x53524231;   // "SRB1"
+    static constexpr uint32_t VERSION = 1;
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t capacity;
+    uint32_t producers;
+    atomic<uint32_t> ready;     // 생성한 쪽이 초기화를 끝내면 1
+};
+
+/*
+ * 잠든 상대를 깨우는 futex 워드 + 대기자 수 (18_semaphore_pattern.cpp의 FastSemaphore와 같은 방식)
+ *  - wakePending: 잠든 뒤 wake를 이미 보냈으면 1 → 깨어난 쪽이 실행되기 전까지 추가 wake 생략
+ *    (코어가 하나면 깨운 프로세스가 곧바로 실행되지 않으므로 레코드마다 syscall이 나가는 것을 막음)
+ */
+struct ShmWaker {
+    static inline const int SPIN_LIMIT = thread::hardware_concurrency() > 1 ? 256 : 0;
+    atomic<uint32_t> signal{0};
+    atomic<uint32_t> waiters{0};
+    atomic<uint32_t> wakePending{0};
+
+    template<typename Ready>
+    void wait(Ready ready) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            if (ready()) return;
+        }
+        while (!ready()) {
+            const uint32_t seen = signal.load(memory_order_acquire);
+            wakePending.store(0, memory_order_relaxed);
+            waiters.fetch_add(1, memory_order_seq_cst);
+            atomic_thread_fence(memory_order_seq_cst);
+            if (!ready()) {
+                syscall(SYS_futex, reinterpret_cast<uint32_t*>(&signal), FUTEX_WAIT, seen, nullptr, nullptr, 0);
+            }
+            waiters.fetch_sub(1, memory_order_relaxed);
+        }
+    }
+
+    // 상태를 바꾼 직후 호출: 대기자가 없으면 load 한 번으로 끝, syscall 했으면 true
+    //  - waiters는 seq_cst로 읽어 대기자의 fetch_add와 짝지음 → 그 전에 한 wakePending = 0이 아래 exchange에 보임
+    //    (relaxed면 새 대기자를 보고도 지난 wake의 1을 읽어 wake를 건너뛸 수 있음)
+    bool notify() {
+        atomic_thread_fence(memory_order_seq_cst);
+        if (waiters.load(memory_order_seq_cst) == 0) return false;
+        if (wakePending.exchange(1, memory_order_acq_rel) != 0) return false;
+        signal.fetch_add(1, memory_order_release);
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&signal), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+        return true;
+    }
+};
+
+template<typename T, size_t Size, ShmProducers Producers = ShmProducers::Single>
+class SharedRingBuffer {
+    static_assert(is_trivially_copyable_v<T>, "records cross process boundaries as raw bytes");
+    static_assert((Size & (Size - 1)) == 0 && Size <= (size_t{1} << 31), "Size must be a power of two");
+    static_assert(atomic<uint32_t>::is_always_lock_free && sizeof(atomic<uint32_t>) == sizeof(uint32_t),
+                  "futex needs a plain 32-bit word");
+
+    struct Slot {
+        atomic<uint32_t> sequence;  // Multi 모드 전용
+        T data;
+    };
+
+    struct Layout {
+        ShmRingHeader header;
+        // 소비자 쪽 캐시 라인
+        alignas(CACHE_LINE_SIZE) atomic<uint32_t> head;
+        ShmWaker spaceFreed;        // 가득 차서 잠든 생산자
+        // 생산자 쪽 캐시 라인
+        alignas(CACHE_LINE_SIZE) atomic<uint32_t> tail;
+        ShmWaker dataReady;         // 비어서 잠든 소비자
+        atomic<uint64_t> wakeups;   // 실제로 호출한 futex wake 횟수
+        alignas(CACHE_LINE_SIZE) Slot slots[Size];
+    };
+
+    Layout* shm = nullptr;
+    string shmName;
+    bool owner = false;
+
+    SharedRingBuffer(Layout* mapping, string name, bool creator)
+        : shm(mapping), shmName(move(name)), owner(creator) {}
+
+    static constexpr uint32_t MASK = static_cast<uint32_t>(Size - 1);
+
+    static Layout* mapFd(int fd) {
+        void* addr = mmap(nullptr, sizeof(Layout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        return addr == MAP_FAILED ? nullptr : static_cast<Layout*>(addr);
+    }
+
+    static optional<SharedRingBuffer> fail(string* error, string why) {
+        if (error) *error = move(why);
+        return nullopt;
+    }
+
+    void published() {
+        if (shm->dataReady.notify()) shm->wakeups.fetch_add(1, memory_order_relaxed);
+    }
+
+public:
+    // 새 공유 메모리 객체 생성 (이미 있으면 실패)
+    static optional<SharedRingBuffer> create(const string& name, string* error = nullptr) {
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) return fail(error, "shm_open: " + string(strerror(errno)));
+        if (ftruncate(fd, sizeof(Layout)) != 0) {
+            close(fd);
+            shm_unlink(name.c_str());
+            return fail(error, "ftruncate: " + string(strerror(errno)));
+        }
+        Layout* layout = mapFd(fd);
+        if (!layout) {
+            shm_unlink(name.c_str());
+            return fail(error, "mmap failed");
+        }
+        new (layout) Layout{};
+        layout->header.magic = ShmRingHeader::MAGIC;
+        layout->header.version = ShmRingHeader::VERSION;
+        layout->header.recordSize = sizeof(T);
+        layout->header.capacity = static_cast<uint32_t>(Size);
+        layout->header.producers = static_cast<uint32_t>(Producers);
+        for (uint32_t i = 0; i < Size; ++i) layout->slots[i].sequence.store(i, memory_order_relaxed);
+        layout->header.ready.store(1, memory_order_release);
+        return SharedRingBuffer(layout, name, true);
+    }
+
+    // 다른 프로세스가 만든 객체에 연결 (헤더가 이 타입과 맞아야 함)
+    static optional<SharedRingBuffer> open(const string& name, string* error = nullptr) {
+        int fd = shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd < 0) return fail(error, "shm_open: " + string(strerror(errno)));
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Layout)) {
+            close(fd);
+            return fail(error, "mapping smaller than layout");
+        }
+        Layout* layout = mapFd(fd);
+        if (!layout) return fail(error, "mmap failed");
+        const ShmRingHeader& h = layout->header;
+        const char* mismatch =
+            h.ready.load(memory_order_acquire) != 1 ? "not initialized" :
+            h.magic != ShmRingHeader::MAGIC ? "bad magic" :
+            h.version != ShmRingHeader::VERSION ? "version mismatch" :
+            h.recordSize != sizeof(T) ? "record size mismatch" :
+            h.capacity != Size ? "capacity mismatch" :
+            h.producers != static_cast<uint32_t>(Producers) ? "producer mode mismatch" : nullptr;
+        if (mismatch) {
+            munmap(layout, sizeof(Layout));
+            return fail(error, mismatch);
+        }
+        return SharedRingBuffer(layout, name, false);
+    }
+
+    SharedRingBuffer(SharedRingBuffer&& other) noexcept
+        : shm(exchange(other.shm, nullptr)), shmName(move(other.shmName)), owner(exchange(other.owner, false)) {}
+    SharedRingBuffer(const SharedRingBuffer&) = delete;
+    SharedRingBuffer& operator=(const SharedRingBuffer&) = delete;
+    SharedRingBuffer& operator=(SharedRingBuffer&&) = delete;
+
+    // 매핑 해제, 생성한 쪽은 이름도 제거 (이미 연결된 프로세스의 매핑은 유지됨)
+    ~SharedRingBuffer() {
+        if (!shm) return;
+        munmap(shm, sizeof(Layout));
+        if (owner) shm_unlink(shmName.c_str());
+    }
+
+    // 생산자: 슬롯 안에 직접 기록 (fill(T&)), 가득 차면 false
+    template<typename Fill>
+    bool tryWrite(Fill&& fill) {
+        if constexpr (Producers == ShmProducers::Single) {
+            const uint32_t t = shm->tail.load(memory_order_relaxed);
+            if (t - shm->head.load(memory_order_acquire) == Size) return false;
+            fill(shm->slots[t & MASK].data);
+            shm->tail.store(t + 1, memory_order_release);
+        } else {
+            Slot* slot;
+            uint32_t pos = shm->tail.load(memory_order_relaxed);
+            for (;;) {
+                slot = &shm->slots[pos & MASK];
+                const int32_t diff = static_cast<int32_t>(slot->sequence.load(memory_order_acquire) - pos);
+                if (diff == 0) {
+                    if (shm->tail.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = shm->tail.load(memory_order_relaxed);
+                }
+            }
+            fill(slot->data);
+            slot->sequence.store(pos + 1, memory_order_release);
+        }
+        published();
+        return true;
+    }
+
+    bool tryPush(const T& item) {
+        return tryWrite([&item](T& slot) { slot = item; });
+    }
+
+    // 가득 차 있으면 소비자가 공간을 비울 때까지 잠듦
+    template<typename Fill>
+    void write(Fill&& fill) {
+        while (!tryWrite(fill)) {
+            shm->spaceFreed.wait([this]() { return !full(); });
+        }
+    }
+
+    void push(const T& item) {
+        write([&item](T& slot) { slot = item; });
+    }
+
+    // 소비자: 슬롯을 제자리에서 최대 max개 방문 (visit(const T&)), 방문 개수 반환
+    template<typename Visit>
+    size_t tryDrain(Visit&& visit, size_t max = Size) {
+        uint32_t h = shm->head.load(memory_order_relaxed);
+        size_t n = 0;
+        if constexpr (Producers == ShmProducers::Single) {
+            const uint32_t available = shm->tail.load(memory_order_acquire) - h;
+            n = min<size_t>(available, max);
+            for (size_t i = 0; i < n; ++i) visit(static_cast<const T&>(shm->slots[(h + i) & MASK].data));
+            h += static_cast<uint32_t>(n);
+        } else {
+            while (n < max) {
+                Slot& slot = shm->slots[h & MASK];
+                if (slot.sequence.load(memory_order_acquire) != h + 1) break;
+                visit(static_cast<const T&>(slot.data));
+                slot.sequence.store(h + static_cast<uint32_t>(Size), memory_order_release);
+                ++h;
+                ++n;
+            }
+        }
+        if (n == 0) return 0;
+        shm->head.store(h, memory_order_release);
+        shm->spaceFreed.notify();
+        return n;
+    }
+
+    // 최소 한 개가 들어올 때까지 잠든 뒤 drain
+    template<typename Visit>
+    size_t drain(Visit&& visit, size_t max = Size) {
+        for (;;) {
+            if (size_t n = tryDrain(visit, max)) return n;
+            shm->dataReady.wait([this]() { return !empty(); });
+        }
+    }
+
+    bool tryPop(T& item) {
+        return tryDrain([&item](const T& slot) { item = slot; }, 1) == 1;
+    }
+
+    bool empty() const {
+        const uint32_t h = shm->head.load(memory_order_acquire);
+        if constexpr (Producers == ShmProducers::Single) {
+            return shm->tail.load(memory_order_acquire) == h;
+        } else {
+            return shm->slots[h & MASK].sequence.load(memory_order_acquire) != h + 1;
+        }
+    }
+
+    bool full() const {
+        return shm->tail.load(memory_order_acquire) - shm->head.load(memory_order_acquire) >= Size;
+    }
+
+    uint64_t wakeups() const { return shm->wakeups.load(memory_order_relaxed); }
+    static constexpr size_t mappingBytes() { return sizeof(Layout); }
+};
+
+// 프로세스 간에 넘길 센서 레코드 (trivially copyable)
+struct SensorRecord {
+    uint64_t sequence;
+    uint32_t producer;
+    float value;
+    uint64_t timestampNs;
 };
 
+static string shmRingName(const char* tag) {
+    return string("/cpp_ring_") + tag + "_" + to_string(getpid());
+}
+
+// 부모 = 생산자, 자식 = 소비자 (fork 후 이름으로 open)
+static void benchmarkSharedSpsc(size_t items) {
+    using Ring = SharedRingBuffer<SensorRecord, 4096>;
+    const string name = shmRingName("spsc");
+    string error;
+    auto ring = Ring::create(name, &error);
+    if (!ring) {
+        cout << "  create failed: " << error << endl;
+        return;
+    }
+
+    // 자식이 open 결과를 파이프로 알림: 실패했는데 생산을 시작하면 링이 차서 부모가 영원히 잠듦
+    int attach[2];
+    if (pipe(attach) != 0) {
+        cout << "  pipe failed: " << strerror(errno) << endl;
+        return;
+    }
+    auto start = chrono::steady_clock::now();
+    pid_t child = fork();
+    if (child == 0) {
+        close(attach[0]);
+        auto peer = Ring::open(name, &error);
+        const char attached = peer ? 1 : 0;
+        ssize_t sent = write(attach[1], &attached, 1);
+        close(attach[1]);
+        if (!peer || sent != 1) _exit(2);
+        uint64_t expected = 0;
+        bool ordered = true;
+        while (expected < items) {
+            peer->drain([&](const SensorRecord& r) {
+                ordered &= r.sequence == expected++;
+            });
+        }
+        _exit(ordered ? 0 : 1);
+    }
+
+    close(attach[1]);
+    char attached = 0;
+    ssize_t got;
+    do {
+        got = read(attach[0], &attached, 1);
+    } while (got < 0 && errno == EINTR);
+    close(attach[0]);
+    if (child < 0 || got != 1 || !attached) {     // fork 실패 / 자식이 open 전에 죽음 / open 실패
+        if (child > 0) waitpid(child, nullptr, 0);
+        cout << "  consumer could not attach to " << name << endl;
+        return;
+    }
+
+    for (size_t i = 0; i < items; ++i) {
+        ring->write([i](SensorRecord& r) {
+            r.sequence = i;
+            r.producer = 0;
+            r.value = static_cast<float>(i) * 0.5f;
+            r.timestampNs = 0;
+        });
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  shm SPSC  : " << static_cast<long long>(items / elapsed) << " records/sec, "
+         << ring->wakeups() << " futex wakes (" << ring->wakeups() * 100.0 / items << "% of records)"
+         << ", consumer " << (WIFEXITED(status) && WEXITSTATUS(status) == 0 ? "in order" : "FAILED") << endl;
+}
+
+// 비교용: 지금 방식 - socketpair로 레코드마다 write/read
+static void benchmarkSocketTransfer(size_t items) {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) return;
+    auto start = chrono::steady_clock::now();
+    pid_t child = fork();
+    if (child == 0) {
+        close(fds[0]);
+        SensorRecord r;
+        uint64_t expected = 0;
+        bool ordered = true;
+        while (expected < items) {
+            size_t got = 0;
+            while (got < sizeof(r)) {
+                ssize_t n = read(fds[1], reinterpret_cast<char*>(&r) + got, sizeof(r) - got);
+                if (n <= 0) _exit(2);
+                got += static_cast<size_t>(n);
+            }
+            ordered &= r.sequence == expected++;
+        }
+        _exit(ordered ? 0 : 1);
+    }
+    close(fds[1]);
+    for (size_t i = 0; i < items; ++i) {
+        SensorRecord r{i, 0, static_cast<float>(i) * 0.5f, 0};
+        if (write(fds[0], &r, sizeof(r)) != static_cast<ssize_t>(sizeof(r))) break;
+    }
+    close(fds[0]);
+    int status = 0;
+    waitpid(child, &status, 0);
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  socketpair: " << static_cast<long long>(items / elapsed) << " records/sec, "
+         << items << " write syscalls, consumer "
+         << (WIFEXITED(status) && WEXITSTATUS(status) == 0 ? "in order" : "FAILED") << endl;
+}
+
+// 자식 N개 = 생산자, 부모 = 소비자, 생산자별 순서 확인
+static void demoSharedMpsc(uint32_t producers, size_t perProducer) {
+    using Ring = SharedRingBuffer<SensorRecord, 1024, ShmProducers::Multi>;
+    const string name = shmRingName("mpsc");
+    string error;
+    auto ring = Ring::create(name, &error);
+    if (!ring) {
+        cout << "  create failed: " << error << endl;
+        return;
+    }
+
+    vector<pid_t> children;
+    for (uint32_t p = 0; p < producers; ++p) {
+        pid_t child = fork();
+        if (child == 0) {
+            auto peer = Ring::open(name, &error);
+            if (!peer) _exit(2);
+            for (size_t i = 0; i < perProducer; ++i) peer->push(SensorRecord{i, p, 1.0f, 0});
+            _exit(0);
+        }
+        children.push_back(child);
+    }
+
+    vector<uint64_t> next(producers, 0);
+    size_t received = 0, outOfOrder = 0;
+    while (received < producers * perProducer) {
+        received += ring->drain([&](const SensorRecord& r) {
+            if (r.sequence != next[r.producer]++) ++outOfOrder;
+        });
+    }
+    for (pid_t child : children) waitpid(child, nullptr, 0);
+    cout << "  " << producers << " producer processes -> " << received << " records, "
+         << outOfOrder << " out of order per producer" << endl;
+
+    // 헤더 검증: 다른 레코드 타입으로 열면 거부
+    auto wrongType = SharedRingBuffer<uint64_t, 1024, ShmProducers::Multi>::open(name, &error);
+    cout << "  open with wrong record type: " << (wrongType ? "accepted" : "rejected (" + error + ")") << endl;
+}
+#endif
+
+// 비교용: 외부 mutex로 감싼 RingBuffer
+template<typename T, size_t Size>
+class LockedRingBuffer {
+    RingBuffer<T, Size> rb;
+    mutex mtx;
+public:
+    bool push(const T& item) { lock_guard<mutex> lock(mtx); return rb.push(item); }
+    bool pop(T& item) { lock_guard<mutex> lock(mtx); return rb.pop(item); }
+};
+
+// 생산자 1 + 소비자 1 스레드 처리량 측정
+template<typename Queue>
+void benchmarkTwoThreads(const char* name, size_t items) {
+    Queue queue;
+    auto start = chrono::steady_clock::now();
+
+    thread producer([&]() {
+        for (size_t i = 0; i < items; ++i) {
+            while (!queue.push(static_cast<int>(i))) this_thread::yield();
+        }
+    });
+
+    long long sum = 0;
+    thread consumer([&]() {
+        int val;
+        for (size_t i = 0; i < items; ++i) {
+            while (!queue.pop(val)) this_thread::yield();
+            sum += val;
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    auto elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << ": " << static_cast<long long>(items / elapsed)
+         << " items/sec (checksum " << sum << ")" << endl;
+}
+
+// 생산자 N + 소비자 N 스레드 확장성 측정
+template<typename Queue>
+double benchmarkScaling(size_t threads, size_t items) {
+    Queue queue;
+    const size_t perThread = items / threads;
+    vector<thread> workers;
+    auto start = chrono::steady_clock::now();
+
+    for (size_t p = 0; p < threads; ++p) {
+        workers.emplace_back([&]() {
+            for (size_t i = 0; i < perThread; ++i) {
+                while (!queue.push(static_cast<int>(i))) this_thread::yield();
+            }
+        });
+    }
+    for (size_t c = 0; c < threads; ++c) {
+        workers.emplace_back([&]() {
+            int val;
+            for (size_t i = 0; i < perThread; ++i) {
+                while (!queue.pop(val)) this_thread::yield();
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    auto elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return (perThread * threads) / elapsed;
+}
+
+// 단일 스레드 push/pop 핫 루프 (래핑 방식 / 정책별 비교)
+template<typename Buffer>
+void benchmarkHotLoop(const char* name, size_t ops) {
+    Buffer rb;
+    int val = 0;
+    long long sum = 0;
+    auto start = chrono::steady_clock::now();
+    for (size_t i = 0; i < ops; ++i) {
+        rb.push(static_cast<int>(i));
+        if (rb.pop(val)) sum += val;
+    }
+    auto elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << ": " << elapsed * 1e9 / ops << " ns/op (checksum " << sum << ")" << endl;
+}
+
 int main() {
     cout << "=== C++ Ring Buffer ===" << endl;
     RingBuffer<int, 5> rb;
@@ -39,5 +838,92 @@ int main() {
         cout << "Pop: " << val << endl;
     }
     
+    cout << "\n=== Bulk push/pop (wraparound) ===" << endl;
+    RingBuffer<int, 8> burst;
+    array<int, 6> dma{};
+    for (int i = 0; i < 6; ++i) dma[i] = i + 1;
+    burst.push_bulk(dma);                   // [1..6]
+    array<int, 4> drained{};
+    burst.pop_bulk(drained);                // head → 4
+    size_t moved = burst.push_bulk(dma);    // tail 래핑: 2개 구간 복사
+    cout << "Pushed " << moved << " (size: " << burst.size() << ")" << endl;
+
+    auto region = burst.peek_contiguous();  // 복사 없이 래핑 전 구간만
+    cout << "Peek contiguous:";
+    for (int v : region) cout << " " << v;
+    cout << endl;
+    burst.consume(region.size());
+
+    array<int, 8> rest{};
+    size_t popped = burst.pop_bulk(rest);
+    cout << "Pop bulk:";
+    for (size_t i = 0; i < popped; ++i) cout << " " << rest[i];
+    cout << endl;
+
+    cout << "\n=== Overflow Policy ===" << endl;
+    RingBuffer<int, 4, OverflowPolicy::OverwriteOldest> latest;
+    for (int i = 1; i <= 6; ++i) latest.push(i);      // 1, 2는 덮어써짐
+    cout << "OverwriteOldest:";
+    while (latest.pop(val)) cout << " " << val;
+    cout << endl;
+
+    RingBuffer<int, 2, OverflowPolicy::Block> blocking;
+    thread blockingProducer([&blocking]() {
+        for (int i = 1; i <= 5; ++i) blocking.push(i);  // 가득 차면 대기
+    });
+    cout << "Block:";
+    for (int i = 0; i < 5; ++i) {
+        blocking.pop_wait(val);
+        cout << " " << val;
+    }
+    cout << endl;
+    blockingProducer.join();
+
+    cout << "\n=== Index Wrapping (push+pop hot loop) ===" << endl;
+    constexpr size_t HOT_OPS = 10000000;
+    benchmarkHotLoop<RingBuffer<int, 1000>>("modulo  (Size=1000)", HOT_OPS);
+    benchmarkHotLoop<RingBuffer<int, 1024>>("bitmask (Size=1024)", HOT_OPS);
+    benchmarkHotLoop<RingBuffer<int, 1024, OverflowPolicy::OverwriteOldest>>("bitmask + overwrite", HOT_OPS);
+
+    cout << "\n=== SPSC Lock-free Ring Buffer ===" << endl;
+    SpscRingBuffer<int, 5> spsc;
+    for (int i = 1; i <= 3; ++i) spsc.push(i * 100);
+    while (spsc.pop(val)) {
+        cout << "Pop: " << val << endl;
+    }
+
+    cout << "\n=== 2-Thread Throughput ===" << endl;
+    constexpr size_t ITEMS = 2000000;
+    benchmarkTwoThreads<LockedRingBuffer<int, 1024>>("mutex RingBuffer", ITEMS);
+    benchmarkTwoThreads<SpscRingBuffer<int, 1024>>("SPSC RingBuffer ", ITEMS);
+
+    cout << "\n=== Node-local ring storage ===" << endl;
+    {
+        // 저장소가 멤버 배열이라 객체 자체를 소비자 node 페이지에 생성 (스택/힙 위치는 할당한 스레드에 달림)
+        unsigned node = topology::currentNode();
+        auto ring = topology::makeOnNode<SpscRingBuffer<int, 65536>>(node);
+        ring->push(42);
+        cout << "  SpscRingBuffer<int, 65536> (" << sizeof(*ring) / 1024 << " KB) on node "
+             << topology::addressNode(ring.get()) << " (requested " << node << ", "
+             << topology::system().nodeCount() << " NUMA node(s))" << endl;
+    }
+
+    cout << "\n=== MPMC Scaling (N producers + N consumers, items/sec) ===" << endl;
+    constexpr size_t SCALING_ITEMS = 400000;
+    for (size_t n : {1, 2, 4, 8, 16}) {
+        double locked = benchmarkScaling<LockedRingBuffer<int, 1024>>(n, SCALING_ITEMS);
+        double mpmc = benchmarkScaling<MpmcQueue<int, 1024>>(n, SCALING_ITEMS);
+        cout << "  N=" << n << "\tmutex: " << static_cast<long long>(locked)
+             << "\tMPMC: " << static_cast<long long>(mpmc) << endl;
+    }
+
+#ifdef __linux__
+    cout << "\n=== Shared-memory Ring (process -> process) ===" << endl;
+    cout << "  mapping: " << SharedRingBuffer<SensorRecord, 4096>::mappingBytes() << " bytes for 4096 records" << endl;
+    benchmarkSharedSpsc(2000000);
+    benchmarkSocketTransfer(200000);
+    demoSharedMpsc(3, 100000);
+#endif
+
     return 0;
 }
@@ -1,9 +1,747 @@
 /* C++ Linked List - std::list 사용 */
 #include <iostream>
 #include <list>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "mempool/concurrent_pool.h"
+#include "reclaim/reclaim.h"
 using namespace std;
 
-int main() {
+/*
+ * ListHook - 요소 안에 들어가는 prev/next 링크 (intrusive)
+ *  - 노드 할당이 따로 없음, 요소에서 바로 O(1) unlink (리스트 탐색 불필요)
+ *  - Tag로 한 요소를 여러 리스트에 동시에 넣을 수 있음
+ */
+template<typename Tag = void>
+struct ListHook {
+    ListHook* prev = nullptr;
+    ListHook* next = nullptr;
+
+    bool linked() const { return next != nullptr; }
+    void unlink() {
+        if (!linked()) return;
+        prev->next = next;
+        next->prev = prev;
+        prev = next = nullptr;
+    }
+};
+
+template<typename T, typename Tag = void>
+class IntrusiveList {
+    using Hook = ListHook<Tag>;
+    Hook head;      // 원형 sentinel
+
+    static T& owner(Hook* hook) { return static_cast<T&>(*hook); }
+
+    static void linkBefore(Hook* pos, Hook* hook) {
+        hook->next = pos;
+        hook->prev = pos->prev;
+        pos->prev->next = hook;
+        pos->prev = hook;
+    }
+
+public:
+    class iterator {
+        friend class IntrusiveList;
+        Hook* node;
+    public:
+        explicit iterator(Hook* node) : node(node) {}
+        T& operator*() const { return owner(node); }
+        T* operator->() const { return &owner(node); }
+        iterator& operator++() { node = node->next; return *this; }
+        iterator& operator--() { node = node->prev; return *this; }
+        bool operator==(const iterator& other) const { return node == other.node; }
+        bool operator!=(const iterator& other) const { return node != other.node; }
+    };
+
+    IntrusiveList() { head.prev = head.next = &head; }
+    ~IntrusiveList() { clear(); }
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    void push_back(T& item) { linkBefore(&head, static_cast<Hook*>(&item)); }
+    void push_front(T& item) { linkBefore(head.next, static_cast<Hook*>(&item)); }
+    void insert(iterator pos, T& item) { linkBefore(pos.node, static_cast<Hook*>(&item)); }   // pos 앞에 삽입
+    static void erase(T& item) { static_cast<Hook&>(item).unlink(); }
+
+    // 요소는 리스트가 소유하지 않음 → 링크만 끊음
+    void clear() {
+        while (!empty()) head.next->unlink();
+    }
+
+    bool empty() const { return head.next == &head; }
+    T& front() { return owner(head.next); }
+    T& back() { return owner(head.prev); }
+    iterator begin() { return iterator(head.next); }
+    iterator end() { return iterator(&head); }
+};
+
+// 11_memory_pool.cpp의 MemoryPool과 같은 구조 (free 블록의 저장 공간을 next 링크로 재사용)
+template<typename T, size_t BlockSize = 4096>
+class MemoryPool {
+    union alignas(alignof(T) > alignof(void*) ? alignof(T) : alignof(void*)) Block {
+        uint8_t data[sizeof(T)];
+        Block* next;
+    };
+    static constexpr size_t BLOCKS_PER_CHUNK = BlockSize / sizeof(Block) ? BlockSize / sizeof(Block) : 1;
+    Block* freeList = nullptr;
+    vector<unique_ptr<Block[]>> chunks;
+public:
+    T* allocate() {
+        if (!freeList) {
+            chunks.push_back(make_unique<Block[]>(BLOCKS_PER_CHUNK));
+            Block* block = chunks.back().get();
+            for (size_t i = 0; i < BLOCKS_PER_CHUNK - 1; ++i) block[i].next = &block[i + 1];
+            block[BLOCKS_PER_CHUNK - 1].next = nullptr;
+            freeList = block;
+        }
+        Block* block = freeList;
+        freeList = block->next;
+        return reinterpret_cast<T*>(block);
+    }
+
+    void deallocate(T* ptr) {
+        Block* block = reinterpret_cast<Block*>(ptr);
+        block->next = freeList;
+        freeList = block;
+    }
+};
+
+// 스레드별 magazine + lock-free depot (11_memory_pool.cpp와 같은 구현)
+using mempool::ConcurrentMemoryPool;
+
+// 타이머 리스트 요소 - 훅이 요소 안에 내장
+struct TimerEntry : ListHook<> {
+    uint64_t deadline;
+    int id;
+    TimerEntry(uint64_t deadline, int id) : deadline(deadline), id(id) {}
+};
+
+struct PlainTimer {
+    uint64_t deadline;
+    int id;
+};
+
+// insert N개 → 순회 → 절반 무작위 erase → 순회
+constexpr int BENCH_TIMERS = 10000;
+constexpr int BENCH_PASSES = 20;
+
+static vector<int> eraseOrder() {
+    vector<int> order;
+    for (int i = 0; i < BENCH_TIMERS; i += 2) order.push_back(i);
+    shuffle(order.begin(), order.end(), mt19937(7));
+    return order;
+}
+
+template<typename Fn>
+static double timeUs(Fn&& fn) {
+    auto start = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* name, double insertUs, double eraseUs, double iterateUs, uint64_t sum) {
+    cout << "  " << name << ": insert=" << static_cast<long long>(insertUs) << "us erase="
+         << static_cast<long long>(eraseUs) << "us iterate=" << static_cast<long long>(iterateUs)
+         << "us (sum " << sum << ")" << endl;
+}
+
+static void benchStdList(const vector<int>& order) {
+    list<PlainTimer> timers;
+    vector<list<PlainTimer>::iterator> handles;
+    uint64_t sum = 0;
+    double insertUs = timeUs([&]() {
+        for (int i = 0; i < BENCH_TIMERS; ++i) handles.push_back(timers.insert(timers.end(), {uint64_t(i), i}));
+    });
+    double eraseUs = timeUs([&]() { for (int i : order) timers.erase(handles[i]); });
+    double iterateUs = timeUs([&]() {
+        for (int p = 0; p < BENCH_PASSES; ++p) for (auto& t : timers) sum += t.deadline;
+    });
+    report("std::list        ", insertUs, eraseUs, iterateUs, sum);
+}
+
+static void benchVector(const vector<int>& order) {
+    vector<PlainTimer> timers;
+    uint64_t sum = 0;
+    double insertUs = timeUs([&]() {
+        for (int i = 0; i < BENCH_TIMERS; ++i) timers.push_back({uint64_t(i), i});
+    });
+    double eraseUs = timeUs([&]() {     // 순서 유지가 필요하므로 id 탐색 + 중간 erase (O(n))
+        for (int id : order) {
+            timers.erase(find_if(timers.begin(), timers.end(), [id](const PlainTimer& t) { return t.id == id; }));
+        }
+    });
+    double iterateUs = timeUs([&]() {
+        for (int p = 0; p < BENCH_PASSES; ++p) for (auto& t : timers) sum += t.deadline;
+    });
+    report("std::vector      ", insertUs, eraseUs, iterateUs, sum);
+}
+
+template<typename Alloc, typename Free>
+static void benchIntrusive(const char* name, const vector<int>& order, Alloc alloc, Free release) {
+    IntrusiveList<TimerEntry> timers;
+    vector<TimerEntry*> entries;
+    uint64_t sum = 0;
+    double insertUs = timeUs([&]() {
+        for (int i = 0; i < BENCH_TIMERS; ++i) {
+            entries.push_back(alloc(uint64_t(i), i));
+            timers.push_back(*entries.back());
+        }
+    });
+    double eraseUs = timeUs([&]() {     // 요소에서 바로 unlink
+        for (int i : order) {
+            IntrusiveList<TimerEntry>::erase(*entries[i]);
+            release(entries[i]);
+        }
+    });
+    double iterateUs = timeUs([&]() {
+        for (int p = 0; p < BENCH_PASSES; ++p) for (auto& t : timers) sum += t.deadline;
+    });
+    report(name, insertUs, eraseUs, iterateUs, sum);
+    timers.clear();
+    for (int i = 1; i < BENCH_TIMERS; i += 2) release(entries[i]);
+}
+
+/*
+ * UnrolledList - 노드마다 캐시 라인 크기 배열을 가진 연결 리스트
+ *  - 순회: 노드 하나(캐시 라인)에 요소 여러 개 → std::list 대비 캐시 미스 1/CAPACITY
+ *  - 중간 삽입: 노드 안에서만 memmove, 가득 차면 절반씩 split
+ *  - 삭제: 절반 미만이 되면 다음 노드와 merge 또는 하나 빌려옴 → 노드 점유율 1/2 ~ 1
+ *  - 요소는 trivially copyable 타입으로 제한 (memmove로 이동)
+ */
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+template<typename T, size_t NodeLines = 1>
+class UnrolledList {
+    static_assert(is_trivially_copyable_v<T>, "elements are moved with memmove");
+
+    struct NodeHeader {     // Node의 next + count 부분 크기 계산용
+        void* next;
+        uint32_t count;
+    };
+public:
+    static constexpr size_t CAPACITY =
+        (CACHE_LINE_SIZE * NodeLines - sizeof(NodeHeader)) / sizeof(T) < 4
+            ? 4 : (CACHE_LINE_SIZE * NodeLines - sizeof(NodeHeader)) / sizeof(T);
+private:
+    struct alignas(CACHE_LINE_SIZE) Node {
+        Node* next = nullptr;
+        uint32_t count = 0;
+        T items[CAPACITY];
+    };
+
+    Node* head = nullptr;
+    Node* tail = nullptr;
+    size_t total = 0;
+
+    // node 뒤에 새 노드를 만들고 뒤쪽 절반을 옮김
+    Node* split(Node* node) {
+        Node* fresh = new Node;
+        uint32_t keep = node->count / 2;
+        fresh->count = node->count - keep;
+        memcpy(fresh->items, node->items + keep, fresh->count * sizeof(T));
+        node->count = keep;
+        fresh->next = node->next;
+        node->next = fresh;
+        if (tail == node) tail = fresh;
+        return fresh;
+    }
+
+    // 절반 미만 노드 보정: 다음 노드와 합치거나 맨 앞 요소 하나를 빌려옴
+    void rebalance(Node* prev, Node* node) {
+        if (node->count == 0) {
+            unlinkNode(prev, node);
+            return;
+        }
+        Node* next = node->next;
+        if (!next || node->count >= CAPACITY / 2) return;
+        if (node->count + next->count <= CAPACITY) {
+            memcpy(node->items + node->count, next->items, next->count * sizeof(T));
+            node->count += next->count;
+            unlinkNode(node, next);
+        } else {
+            node->items[node->count++] = next->items[0];
+            memmove(next->items, next->items + 1, --next->count * sizeof(T));
+        }
+    }
+
+    void unlinkNode(Node* prev, Node* node) {
+        (prev ? prev->next : head) = node->next;
+        if (tail == node) tail = prev;
+        delete node;
+    }
+
+public:
+    class iterator {
+        friend class UnrolledList;
+        Node* node = nullptr;
+        uint32_t index = 0;
+        iterator(Node* node, uint32_t index) : node(node), index(index) {}
+    public:
+        using iterator_category = forward_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() = default;
+        T& operator*() const { return node->items[index]; }
+        T* operator->() const { return &node->items[index]; }
+        iterator& operator++() {
+            if (++index == node->count) { node = node->next; index = 0; }
+            return *this;
+        }
+        iterator operator++(int) { iterator old = *this; ++*this; return old; }
+        bool operator==(const iterator& other) const { return node == other.node && index == other.index; }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+    };
+
+    UnrolledList() = default;
+    ~UnrolledList() { clear(); }
+    UnrolledList(const UnrolledList&) = delete;
+    UnrolledList& operator=(const UnrolledList&) = delete;
+
+    iterator begin() { return head ? iterator(head, 0) : end(); }
+    iterator end() { return iterator(nullptr, 0); }
+    size_t size() const { return total; }
+    bool empty() const { return total == 0; }
+
+    void push_back(const T& value) {
+        if (!tail || tail->count == CAPACITY) {
+            Node* fresh = new Node;
+            (tail ? tail->next : head) = fresh;
+            tail = fresh;
+        }
+        tail->items[tail->count++] = value;
+        ++total;
+    }
+
+    // index 위치의 iterator (노드 단위로 건너뜀 → O(n / CAPACITY))
+    iterator at(size_t index) {
+        for (Node* node = head; node; node = node->next) {
+            if (index < node->count) return iterator(node, static_cast<uint32_t>(index));
+            index -= node->count;
+        }
+        return end();
+    }
+
+    // pos 앞에 삽입, 삽입된 요소의 iterator 반환
+    iterator insert(iterator pos, const T& value) {
+        if (pos == end()) {
+            push_back(value);
+            return iterator(tail, tail->count - 1);
+        }
+        Node* node = pos.node;
+        uint32_t index = pos.index;
+        if (node->count == CAPACITY) {
+            Node* fresh = split(node);
+            if (index > node->count) {
+                index -= node->count;
+                node = fresh;
+            }
+        }
+        memmove(node->items + index + 1, node->items + index, (node->count - index) * sizeof(T));
+        node->items[index] = value;
+        ++node->count;
+        ++total;
+        return iterator(node, index);
+    }
+
+    void erase_at(size_t index) {
+        Node* prev = nullptr;
+        Node* node = head;
+        while (node && index >= node->count) {
+            index -= node->count;
+            prev = node;
+            node = node->next;
+        }
+        if (!node) return;
+        memmove(node->items + index, node->items + index + 1, (node->count - index - 1) * sizeof(T));
+        --node->count;
+        --total;
+        rebalance(prev, node);
+    }
+
+    void clear() {
+        while (head) {
+            Node* next = head->next;
+            delete head;
+            head = next;
+        }
+        tail = nullptr;
+        total = 0;
+    }
+
+    // 점유율 확인용 (node 수)
+    size_t nodeCount() const {
+        size_t n = 0;
+        for (Node* node = head; node; node = node->next) ++n;
+        return n;
+    }
+};
+
+// 순회 + 중간 삽입 벤치마크 (vector / list / unrolled)
+static void benchmarkSequence(size_t elements, bool includeList) {
+    constexpr int INSERTS = 100;
+    constexpr int PASSES = 3;
+    mt19937 rng(11);
+    vector<size_t> positions;
+    for (int i = 0; i < INSERTS; ++i) positions.push_back(rng() % elements);
+
+    cout << "  N=" << elements << endl;
+    {
+        vector<int> v;
+        for (size_t i = 0; i < elements; ++i) v.push_back(static_cast<int>(i));
+        long long sum = 0;
+        double traverse = timeUs([&]() { for (int p = 0; p < PASSES; ++p) for (int x : v) sum += x; });
+        double inserts = timeUs([&]() { for (size_t pos : positions) v.insert(v.begin() + pos, -1); });
+        cout << "    vector  : traverse=" << static_cast<long long>(traverse / PASSES) << "us  "
+             << INSERTS << " inserts=" << static_cast<long long>(inserts) << "us  (sum " << sum << ")" << endl;
+    }
+    if (includeList) {
+        list<int> l;
+        for (size_t i = 0; i < elements; ++i) l.push_back(static_cast<int>(i));
+        long long sum = 0;
+        double traverse = timeUs([&]() { for (int p = 0; p < PASSES; ++p) for (int x : l) sum += x; });
+        double inserts = timeUs([&]() {
+            for (size_t pos : positions) l.insert(next(l.begin(), static_cast<ptrdiff_t>(pos)), -1);
+        });
+        cout << "    list    : traverse=" << static_cast<long long>(traverse / PASSES) << "us  "
+             << INSERTS << " inserts=" << static_cast<long long>(inserts) << "us  (sum " << sum << ")" << endl;
+    } else {
+        cout << "    list    : skipped (노드당 ~32바이트, 메모리 부족)" << endl;
+    }
+    {
+        UnrolledList<int> u;
+        for (size_t i = 0; i < elements; ++i) u.push_back(static_cast<int>(i));
+        long long sum = 0;
+        double traverse = timeUs([&]() { for (int p = 0; p < PASSES; ++p) for (int x : u) sum += x; });
+        double inserts = timeUs([&]() { for (size_t pos : positions) u.insert(u.at(pos), -1); });
+        cout << "    unrolled: traverse=" << static_cast<long long>(traverse / PASSES) << "us  "
+             << INSERTS << " inserts=" << static_cast<long long>(inserts) << "us  (sum " << sum << ")" << endl;
+    }
+}
+
+/*
+ * SkipList - lock-free 정렬 맵 (Herlihy-Shavit 방식)
+ *  - level마다 정렬된 단방향 리스트, 노드 높이는 기하 분포 (p = 1/2, 최대 MAX_LEVEL)
+ *  - next 포인터 최하위 비트 = 삭제 표시 (그 노드가 지워졌다는 뜻, 포인터와 함께 CAS)
+ *  - insert: level 0 CAS 성공 = 삽입 완료(선형화 지점), 나머지 level은 그 뒤에 연결
+ *  - erase : 위 level부터 표시, level 0 표시 성공 = 삭제 완료, 이어서 search로 모든 level에서 떼어 냄
+ *  - find / 범위 순회: 쓰기 없음, 표시된 노드는 건너뜀 (범위는 약한 일관성: 순회 중 변경은 보일 수도 안 보일 수도)
+ *  - 노드는 높이별 크기 클래스(1/2/4/8/16 level)의 ConcurrentMemoryPool에서 할당
+ *  - 회수는 reclaim::EpochDomain: 삽입 쪽과 삭제 쪽이 모두 끝난 노드만 retire (연결 중인 level이 남지 않음)
+ *  - 마크 비트가 붙은 포인터를 그대로 보호할 수 없어서 HazardDomain은 지원하지 않음
+ */
+template<typename K, typename V>
+class SkipList {
+public:
+    static constexpr int MAX_LEVEL = 16;
+
+private:
+    // next 배열이 8바이트 경계에 오도록 정렬 (어긋난 atomic RMW는 split lock → 커널 trap)
+    struct alignas(atomic<uintptr_t>) Node {
+        K key;
+        V value;
+        uint8_t height;
+        atomic<uint8_t> finished{0};        // INSERTED | ERASED, 둘 다 모이면 retire
+
+        Node(const K& key, const V& value, int height)
+            : key(key), value(value), height(static_cast<uint8_t>(height)) {}
+        // 노드 바로 뒤에 height개의 next가 붙어 있음
+        atomic<uintptr_t>& next(int level) { return reinterpret_cast<atomic<uintptr_t>*>(this + 1)[level]; }
+    };
+    static constexpr uint8_t INSERTED = 1;
+    static constexpr uint8_t ERASED = 2;
+    static_assert(sizeof(Node) % alignof(atomic<uintptr_t>) == 0, "next array must be aligned");
+
+    template<size_t Levels>
+    struct alignas(Node) NodeStorage {
+        unsigned char bytes[sizeof(Node) + Levels * sizeof(atomic<uintptr_t>)];
+    };
+
+    // 크기 클래스 풀은 노드 타입마다 하나 (retire deleter가 함수 포인터라 인스턴스를 못 받음)
+    template<size_t Levels>
+    static auto& localPool() {
+        using Pool = ConcurrentMemoryPool<NodeStorage<Levels>>;
+        static Pool pool;
+        thread_local typename Pool::LocalCache cache(pool);
+        return cache;
+    }
+
+    static int sizeClass(int height) { return bit_width(static_cast<unsigned>(height - 1)); }
+
+    static void* allocateStorage(int height) {
+        switch (sizeClass(height)) {
+        case 0: return localPool<1>().allocate();
+        case 1: return localPool<2>().allocate();
+        case 2: return localPool<4>().allocate();
+        case 3: return localPool<8>().allocate();
+        default: return localPool<16>().allocate();
+        }
+    }
+
+    static Node* createNode(const K& key, const V& value, int height) {
+        Node* node = new (allocateStorage(height)) Node(key, value, height);
+        for (int level = 0; level < height; ++level) new (&node->next(level)) atomic<uintptr_t>(0);
+        return node;
+    }
+
+    static void destroyNode(void* p) {
+        Node* node = static_cast<Node*>(p);
+        int height = node->height;
+        node->~Node();
+        switch (sizeClass(height)) {
+        case 0: localPool<1>().deallocate(static_cast<NodeStorage<1>*>(p)); break;
+        case 1: localPool<2>().deallocate(static_cast<NodeStorage<2>*>(p)); break;
+        case 2: localPool<4>().deallocate(static_cast<NodeStorage<4>*>(p)); break;
+        case 3: localPool<8>().deallocate(static_cast<NodeStorage<8>*>(p)); break;
+        default: localPool<16>().deallocate(static_cast<NodeStorage<16>*>(p)); break;
+        }
+    }
+
+    static Node* pointerOf(uintptr_t link) { return reinterpret_cast<Node*>(link & ~uintptr_t{1}); }
+    static uintptr_t address(Node* node) { return reinterpret_cast<uintptr_t>(node); }
+    static bool isMarked(uintptr_t link) { return link & 1; }
+
+    static int randomHeight() {
+        thread_local uint64_t state = 0x9E3779B97F4A7C15ULL ^ hash<thread::id>{}(this_thread::get_id());
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return 1 + countr_zero(state | (uint64_t{1} << (MAX_LEVEL - 1)));
+    }
+
+    mutable reclaim::EpochDomain domain;    // 리스트마다 하나 → 소멸 시 남은 retire 노드까지 해제
+    Node* head;                             // key 없는 시작 노드 (MAX_LEVEL 높이)
+    atomic<size_t> count{0};
+
+    // level마다 key 바로 앞(preds)과 key 이상 첫 노드(succs), 지나가며 표시된 노드는 떼어 냄
+    bool search(const K& key, Node** preds, Node** succs) {
+    retry:
+        Node* pred = head;
+        for (int level = MAX_LEVEL - 1; level >= 0; --level) {
+            Node* curr = pointerOf(pred->next(level).load());
+            while (curr) {
+                uintptr_t succ = curr->next(level).load();
+                if (isMarked(succ)) {
+                    uintptr_t expected = address(curr);
+                    // pred도 지워졌거나 pred 뒤가 바뀌었으면 처음부터
+                    if (!pred->next(level).compare_exchange_strong(expected, succ & ~uintptr_t{1})) goto retry;
+                    curr = pointerOf(succ);
+                    continue;
+                }
+                if (!(curr->key < key)) break;
+                pred = curr;
+                curr = pointerOf(succ);
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        return succs[0] && !(key < succs[0]->key);
+    }
+
+    // 쓰기 없이 key 이상 첫 노드 (표시된 노드는 건너뜀)
+    Node* lowerBound(const K& key) const {
+        Node* pred = head;
+        Node* curr = nullptr;
+        for (int level = MAX_LEVEL - 1; level >= 0; --level) {
+            curr = pointerOf(pred->next(level).load(memory_order_acquire));
+            while (curr) {
+                uintptr_t succ = curr->next(level).load(memory_order_acquire);
+                if (!isMarked(succ)) {
+                    if (!(curr->key < key)) break;
+                    pred = curr;
+                }
+                curr = pointerOf(succ);
+            }
+        }
+        return curr;
+    }
+
+    void finish(Node* node, uint8_t side) {
+        if (node->finished.fetch_or(side, memory_order_acq_rel) == (INSERTED | ERASED) - side)
+            domain.retire(node, &destroyNode);
+    }
+
+public:
+    SkipList() : head(createNode(K{}, V{}, MAX_LEVEL)) {}
+    // 다른 스레드의 연산이 모두 끝난 뒤 (연결된 노드는 여기서, retire된 노드는 domain 소멸자가 해제)
+    ~SkipList() {
+        for (Node* node = head; node;) {
+            Node* next = pointerOf(node->next(0).load(memory_order_relaxed));
+            destroyNode(node);
+            node = next;
+        }
+    }
+    SkipList(const SkipList&) = delete;
+    SkipList& operator=(const SkipList&) = delete;
+
+    // key가 이미 있으면 false (값은 바꾸지 않음)
+    bool insert(const K& key, const V& value) {
+        reclaim::EpochDomain::Guard guard(domain);
+        Node* preds[MAX_LEVEL];
+        Node* succs[MAX_LEVEL];
+        const int height = randomHeight();
+        Node* node = nullptr;
+        for (;;) {
+            if (search(key, preds, succs)) {
+                if (node) destroyNode(node);        // 아직 아무도 못 본 노드
+                return false;
+            }
+            if (!node) node = createNode(key, value, height);
+            for (int level = 0; level < height; ++level) node->next(level).store(address(succs[level]), memory_order_relaxed);
+            uintptr_t expected = address(succs[0]);
+            if (preds[0]->next(0).compare_exchange_strong(expected, address(node))) break;
+        }
+        count.fetch_add(1, memory_order_relaxed);
+
+        for (int level = 1; level < height; ++level) {
+            for (;;) {
+                // 자기 next를 최신 succ로 (표시돼 있으면 그 사이 지워짐 → 더 연결하지 않음)
+                uintptr_t link = node->next(level).load();
+                if (isMarked(link)) goto linked;
+                if (link != address(succs[level]) && !node->next(level).compare_exchange_strong(link, address(succs[level])))
+                    goto linked;
+                uintptr_t expected = address(succs[level]);
+                if (preds[level]->next(level).compare_exchange_strong(expected, address(node))) break;
+                search(key, preds, succs);
+            }
+        }
+    linked:
+        // 연결 도중 지워졌으면 방금 연결한 level이 남았을 수 있음 → 한 번 더 떼어 냄
+        if (isMarked(node->next(0).load())) search(key, preds, succs);
+        finish(node, INSERTED);
+        return true;
+    }
+
+    bool erase(const K& key) {
+        reclaim::EpochDomain::Guard guard(domain);
+        Node* preds[MAX_LEVEL];
+        Node* succs[MAX_LEVEL];
+        if (!search(key, preds, succs)) return false;
+        Node* victim = succs[0];
+        for (int level = victim->height - 1; level >= 1; --level) victim->next(level).fetch_or(1);
+        if (isMarked(victim->next(0).fetch_or(1))) return false;      // 다른 erase가 먼저
+        count.fetch_sub(1, memory_order_relaxed);
+        search(key, preds, succs);          // 모든 level에서 떼어 냄
+        finish(victim, ERASED);
+        return true;
+    }
+
+    bool find(const K& key, V& value) const {
+        reclaim::EpochDomain::Guard guard(domain);
+        Node* node = lowerBound(key);
+        if (!node || key < node->key) return false;
+        value = node->value;
+        return true;
+    }
+
+    bool contains(const K& key) const {
+        V ignored;
+        return find(key, ignored);
+    }
+
+    // [from, to) 를 key 순서로 fn(key, value), 방문한 개수 반환
+    template<typename Fn>
+    size_t forEachInRange(const K& from, const K& to, Fn&& fn) const {
+        reclaim::EpochDomain::Guard guard(domain);
+        size_t visited = 0;
+        for (Node* node = lowerBound(from); node && node->key < to;) {
+            uintptr_t succ = node->next(0).load(memory_order_acquire);
+            if (!isMarked(succ)) {
+                fn(node->key, node->value);
+                ++visited;
+            }
+            node = pointerOf(succ);
+        }
+        return visited;
+    }
+
+    size_t size() const { return count.load(memory_order_relaxed); }
+    size_t pendingReclaim() const { return domain.pending(); }
+};
+
+// 비교용: mutex로 감싼 std::map
+template<typename K, typename V>
+class LockedOrderedMap {
+    mutable mutex lock;
+    map<K, V> entries;
+public:
+    bool insert(const K& key, const V& value) {
+        lock_guard<mutex> guard(lock);
+        return entries.emplace(key, value).second;
+    }
+    bool erase(const K& key) {
+        lock_guard<mutex> guard(lock);
+        return entries.erase(key) > 0;
+    }
+    bool find(const K& key, V& value) const {
+        lock_guard<mutex> guard(lock);
+        auto it = entries.find(key);
+        if (it == entries.end()) return false;
+        value = it->second;
+        return true;
+    }
+    template<typename Fn>
+    size_t forEachInRange(const K& from, const K& to, Fn&& fn) const {
+        lock_guard<mutex> guard(lock);
+        size_t visited = 0;
+        for (auto it = entries.lower_bound(from); it != entries.end() && it->first < to; ++it, ++visited)
+            fn(it->first, it->second);
+        return visited;
+    }
+};
+
+// 혼합 부하: 키 64K 중 절반을 미리 채움, readPercent% find, 나머지는 insert/erase 반반 (+ 1%는 길이 64 범위 순회)
+template<typename Map>
+static void benchmarkOrderedMap(const char* name, int threads, int readPercent) {
+    constexpr int KEY_RANGE = 1 << 16;
+    constexpr size_t TOTAL_OPS = 100000;
+    Map ordered;
+    for (int k = 0; k < KEY_RANGE; k += 2) ordered.insert(k, k);
+    const size_t perThread = TOTAL_OPS / threads;
+    atomic<long long> checksum{0};
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            mt19937 rng(static_cast<unsigned>(t * 7919 + 1));
+            long long local = 0;
+            int value = 0;
+            for (size_t i = 0; i < perThread; ++i) {
+                uint32_t r = rng();
+                int key = static_cast<int>(r % KEY_RANGE);
+                uint32_t op = (r >> 16) % 100;
+                if (op == 0) local += static_cast<long long>(ordered.forEachInRange(key, key + 64, [](int, int) {}));
+                else if (static_cast<int>(op) < readPercent) local += ordered.find(key, value);
+                else if (op & 1) local += ordered.insert(key, key);
+                else local += ordered.erase(key);
+            }
+            checksum += local;
+        });
+    }
+    for (auto& w : workers) w.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << " x" << threads << ": " << perThread * threads / seconds / 1e6 << " Mops/s" << endl;
+}
+
+int main(int argc, char** argv) {
     cout << "=== C++ Linked List (std::list) ===" << endl;
     
     list<int> mylist;
@@ -16,5 +754,93 @@ int main() {
     }
     cout << endl;
     
+    cout << "\n=== Intrusive List ===" << endl;
+    TimerEntry a(100, 1), b(200, 2), c(50, 3);
+    IntrusiveList<TimerEntry> timerList;
+    timerList.push_back(a);
+    timerList.push_back(b);
+    timerList.push_front(c);
+    TimerEntry d(150, 4);
+    timerList.insert(++timerList.begin(), d);   // c 다음에 삽입
+    IntrusiveList<TimerEntry>::erase(a);      // 요소에서 직접 O(1) 제거
+    for (auto& t : timerList) cout << "timer " << t.id << " @" << t.deadline << "  ";
+    cout << endl;
+    timerList.clear();
+
+    cout << "\n=== Benchmark: " << BENCH_TIMERS << " timers ===" << endl;
+    auto order = eraseOrder();
+    benchStdList(order);
+    benchVector(order);
+    benchIntrusive("intrusive + new  ", order,
+        [](uint64_t d, int id) { return new TimerEntry(d, id); },
+        [](TimerEntry* t) { delete t; });
+    MemoryPool<TimerEntry> pool;
+    benchIntrusive("intrusive + pool ", order,
+        [&pool](uint64_t d, int id) { return new (pool.allocate()) TimerEntry(d, id); },
+        [&pool](TimerEntry* t) { t->~TimerEntry(); pool.deallocate(t); });
+
+    cout << "\n=== Unrolled Linked List ===" << endl;
+    UnrolledList<int> unrolled;
+    for (int i = 0; i < 40; ++i) unrolled.push_back(i);
+    unrolled.insert(unrolled.at(5), 100);       // 가득 찬 노드 → split
+    for (int i = 0; i < 20; ++i) unrolled.erase_at(10);    // 절반 미만 → merge/borrow
+    cout << "capacity/node=" << UnrolledList<int>::CAPACITY << " size=" << unrolled.size()
+         << " nodes=" << unrolled.nodeCount() << " first:";
+    int shown = 0;
+    for (auto it = unrolled.begin(); it != unrolled.end() && shown < 8; ++it, ++shown) cout << " " << *it;
+    cout << endl;
+
+    cout << "\n=== Lock-free SkipList ===" << endl;
+    {
+        SkipList<int, int> skip;
+        for (int k : {50, 10, 90, 30, 70}) skip.insert(k, k * 10);
+        bool duplicate = skip.insert(30, 0);
+        skip.erase(30);
+        int value = 0;
+        cout << "insert 50,10,90,30,70 / erase 30: size " << skip.size() << ", insert(30) again before erase="
+             << duplicate << ", find(70)=" << (skip.find(70, value) ? value : -1) << ", contains(30)="
+             << skip.contains(30) << endl;
+        cout << "range [20, 80):";
+        skip.forEachInRange(20, 80, [](int key, int v) { cout << " " << key << "=" << v; });
+        cout << endl;
+
+        // 스레드마다 자기 키 구간을 넣고 절반을 지움 → 남은 개수와 순서 확인
+        constexpr int THREADS = 8;
+        constexpr int PER_THREAD = 5000;
+        vector<thread> workers;
+        for (int t = 0; t < THREADS; ++t) {
+            workers.emplace_back([&skip, t]() {
+                for (int i = 0; i < PER_THREAD; ++i) skip.insert(1000 + i * THREADS + t, t);
+                for (int i = 0; i < PER_THREAD; i += 2) skip.erase(1000 + i * THREADS + t);
+            });
+        }
+        for (auto& w : workers) w.join();
+        int previous = -1;
+        bool ordered = true;
+        size_t visited = skip.forEachInRange(1000, 1 << 30, [&](int key, int) {
+            ordered = ordered && key > previous;
+            previous = key;
+        });
+        cout << THREADS << " threads x " << PER_THREAD << " inserts, half erased: " << visited << " left (expected "
+             << THREADS * PER_THREAD / 2 << "), ordered=" << ordered << ", awaiting reclaim " << skip.pendingReclaim()
+             << endl;
+    }
+
+    cout << "\n=== Benchmark: ordered map, mixed read/write (64K keys) ===" << endl;
+    for (int readPercent : {90, 50}) {
+        cout << readPercent << "% find" << endl;
+        for (int threads : {1, 2, 4, 8, 16, 32}) {
+            benchmarkOrderedMap<SkipList<int, int>>("SkipList       ", threads, readPercent);
+            benchmarkOrderedMap<LockedOrderedMap<int, int>>("mutex std::map ", threads, readPercent);
+        }
+    }
+
+    // 기본 1K / 1M, "--large" 인자를 주면 100M (vector·unrolled 각 ~400MB)
+    bool large = argc > 1 && string(argv[1]) == "--large";
+    cout << "\n=== Benchmark: traverse / middle insert ===" << endl;
+    benchmarkSequence(1000, true);
+    benchmarkSequence(1000000, true);
+    if (large) benchmarkSequence(100000000, false);
+    
     return 0;
 }
@@ -2,6 +2,20 @@
 #include <iostream>
 #include <array>
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#endif
 using namespace std;
 
 template<typename T, size_t Size>
@@ -25,6 +39,356 @@ public:
     }
 };
 
+/*
+ * TripleBuffer - lock-free 단일 writer / 단일 reader
+ *  - back(writer 전용) / middle(공유) / front(reader 전용) 세 버퍼
+ *  - publish(): back과 middle을 atomic exchange 한 번으로 교환 (+dirty 비트)
+ *  - update(): dirty일 때만 front와 middle 교환 → 항상 가장 최근의 완성된 프레임
+ *  - 어느 쪽도 기다리지 않음 (writer가 빠르면 중간 프레임은 덮어써짐)
+ */
+template<typename T, size_t Size>
+class TripleBuffer {
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t DIRTY = 0x4;
+
+    struct alignas(64) Slot { array<T, Size> data{}; };   // 버퍼 간 false sharing 방지
+    array<Slot, 3> slots;
+    uint8_t back = 0;                           // writer 전용
+    alignas(64) atomic<uint8_t> middle{1};
+    alignas(64) uint8_t front = 2;              // reader 전용
+    
+public:
+    // writer 쪽
+    void write(const T& data, size_t index) {
+        if (index < Size) slots[back].data[index] = data;
+    }
+    array<T, Size>& backBuffer() { return slots[back].data; }
+    void publish() {
+        back = middle.exchange(back | DIRTY, memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    // reader 쪽: 새 프레임이 있으면 true
+    bool update() {
+        if (!(middle.load(memory_order_relaxed) & DIRTY)) return false;
+        front = middle.exchange(front, memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+    const array<T, Size>& frontBuffer() const { return slots[front].data; }
+    T read(size_t index) const {
+        return (index < Size) ? slots[front].data[index] : T{};
+    }
+};
+
+/*
+ * TrackedDoubleBuffer - 블록 단위 dirty 비트맵으로 증분 갱신
+ *  - write()가 해당 블록(BlockElems개) 비트를 표시
+ *  - swap() 후 새 back 버퍼는 두 틱 전 프레임 → 방금 publish된 프레임의 dirty 블록만 복사
+ *  - 소비자는 forEachChangedRange()로 직전 프레임 대비 바뀐 구간만 처리
+ */
+template<typename T, size_t Size, size_t BlockElems = 64>
+class TrackedDoubleBuffer {
+    static constexpr size_t BLOCKS = (Size + BlockElems - 1) / BlockElems;
+    static constexpr size_t WORDS = (BLOCKS + 63) / 64;
+    using Bitmap = array<uint64_t, WORDS>;
+
+    array<T, Size> bufferA{}, bufferB{};
+    array<T, Size>* front = &bufferA;
+    array<T, Size>* back = &bufferB;
+    Bitmap backDirty{};         // 현재 back 프레임에서 쓴 블록
+    Bitmap frontChanged{};      // front 프레임이 직전 프레임 대비 바뀐 블록
+    size_t carriedBytes = 0;
+
+    // 연속된 dirty 블록 구간마다 fn(firstBlock, lastBlockExclusive)
+    template<typename Fn>
+    static void forEachRun(const Bitmap& bits, Fn&& fn) {
+        size_t block = 0;
+        while (block < BLOCKS) {
+            size_t word = block / 64;
+            uint64_t pending = bits[word] >> (block % 64);
+            if (!pending) { block = (word + 1) * 64; continue; }
+            block += countr_zero(pending);
+            size_t end = block;
+            while (end < BLOCKS && (bits[end / 64] >> (end % 64) & 1)) ++end;
+            fn(block, end);
+            block = end;
+        }
+    }
+
+public:
+    void write(const T& data, size_t index) {
+        if (index >= Size) return;
+        (*back)[index] = data;
+        size_t block = index / BlockElems;
+        backDirty[block / 64] |= uint64_t{1} << (block % 64);
+    }
+
+    void writeRange(size_t start, const T* data, size_t count) {
+        if (start >= Size || count == 0) return;     // 빈 쓰기: 아래 (start + count - 1) 계산이 underflow
+        count = min(count, Size - start);
+        memcpy(back->data() + start, data, count * sizeof(T));
+        for (size_t block = start / BlockElems; block <= (start + count - 1) / BlockElems; ++block) {
+            backDirty[block / 64] |= uint64_t{1} << (block % 64);
+        }
+    }
+
+    T read(size_t index) const {
+        return (index < Size) ? (*front)[index] : T{};
+    }
+
+    void swap() {
+        std::swap(front, back);
+        frontChanged = backDirty;
+        backDirty = {};
+        // 새 back을 최신 프레임으로 맞춤 - 바뀐 블록만 복사
+        forEachRun(frontChanged, [this](size_t first, size_t last) {
+            size_t begin = first * BlockElems;
+            size_t end = min(last * BlockElems, Size);
+            memcpy(back->data() + begin, front->data() + begin, (end - begin) * sizeof(T));
+            carriedBytes += (end - begin) * sizeof(T);
+        });
+    }
+
+    // 직전 프레임 대비 바뀐 요소 구간 [begin, end)
+    template<typename Fn>
+    void forEachChangedRange(Fn&& fn) const {
+        forEachRun(frontChanged, [&fn](size_t first, size_t last) {
+            fn(first * BlockElems, min(last * BlockElems, Size));
+        });
+    }
+
+    size_t bytesCarried() const { return carriedBytes; }
+    const array<T, Size>& frontBuffer() const { return *front; }
+};
+
+// 512KB 프레임, 틱마다 작은 영역 3곳만 변경: 전체 복사 vs dirty 블록 복사
+static void benchmarkDirtyTracking() {
+    constexpr size_t ELEMS = 128 * 1024;   // uint32_t × 128K = 512KB
+    constexpr int TICKS = 200;
+    constexpr size_t REGION = 256;          // 1KB
+    vector<uint32_t> patch(REGION);
+
+    vector<uint32_t> frontFull(ELEMS), backFull(ELEMS);
+    size_t fullBytes = 0;
+    auto start = chrono::steady_clock::now();
+    for (int tick = 0; tick < TICKS; ++tick) {
+        fill(patch.begin(), patch.end(), tick);
+        for (size_t r = 0; r < 3; ++r) {
+            memcpy(backFull.data() + (tick * 997 + r * 40000) % (ELEMS - REGION), patch.data(), REGION * 4);
+        }
+        frontFull.swap(backFull);
+        memcpy(backFull.data(), frontFull.data(), ELEMS * 4);     // 매 틱 전체 복사
+        fullBytes += ELEMS * 4;
+    }
+    double fullUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+
+    auto tracked = make_unique<TrackedDoubleBuffer<uint32_t, ELEMS>>();
+    size_t changedElems = 0;
+    start = chrono::steady_clock::now();
+    for (int tick = 0; tick < TICKS; ++tick) {
+        fill(patch.begin(), patch.end(), tick);
+        for (size_t r = 0; r < 3; ++r) {
+            tracked->writeRange((tick * 997 + r * 40000) % (ELEMS - REGION), patch.data(), REGION);
+        }
+        tracked->swap();
+        tracked->forEachChangedRange([&](size_t b, size_t e) { changedElems += e - b; });
+    }
+    double trackedUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+
+    bool same = memcmp(frontFull.data(), tracked->frontBuffer().data(), ELEMS * 4) == 0;
+    cout << "  full copy : " << fullBytes / TICKS / 1024 << " KB/tick, " << static_cast<long long>(fullUs / TICKS) << " us/tick" << endl;
+    cout << "  dirty copy: " << tracked->bytesCarried() / TICKS / 1024 << " KB/tick, " << static_cast<long long>(trackedUs / TICKS)
+         << " us/tick (changed " << changedElems / TICKS << " elems/tick, frames equal=" << (same ? "yes" : "NO") << ")" << endl;
+
+    // 빈 쓰기 / 끝 위치 쓰기는 아무 블록도 더럽히지 않아야 함
+    tracked->writeRange(0, patch.data(), 0);
+    tracked->writeRange(ELEMS, patch.data(), REGION);
+    tracked->swap();
+    size_t emptyChanged = 0;
+    tracked->forEachChangedRange([&](size_t b, size_t e) { emptyChanged += e - b; });
+    cout << "  zero-length / end-of-buffer writes: changed " << emptyChanged << " elems" << endl;
+}
+
+/*
+ * Seqlock - writer 1 / reader 다수, reader는 공유 메모리에 쓰지 않음
+ *  - writer: seq를 홀수로 → 값 갱신 → 짝수로
+ *  - reader: seq(짝수) 읽기 → 값 복사 → seq 재확인, 바뀌었으면 재시도
+ *  - 값은 relaxed atomic 워드 배열로 저장 → 재시도 중 찢어진 읽기도 data race가 아님
+ */
+template<typename T>
+class Seqlock {
+    static_assert(is_trivially_copyable_v<T>, "Seqlock copies T word by word");
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    alignas(64) atomic<uint64_t> seq{0};
+    array<atomic<uint64_t>, WORDS> words{};
+    
+public:
+    explicit Seqlock(const T& initial = T{}) { store(initial); }
+
+    // writer는 하나만 (여러 writer면 외부에서 직렬화)
+    void store(const T& value) {
+        uint64_t words_[WORDS] = {};
+        memcpy(words_, &value, sizeof(T));
+        uint64_t s = seq.load(memory_order_relaxed);
+        seq.store(s + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+        for (size_t i = 0; i < WORDS; ++i) words[i].store(words_[i], memory_order_relaxed);
+        seq.store(s + 2, memory_order_release);
+    }
+
+    T load() const {
+        uint64_t words_[WORDS];
+        uint64_t before, after;
+        do {
+            before = seq.load(memory_order_acquire);
+            for (size_t i = 0; i < WORDS; ++i) words_[i] = words[i].load(memory_order_relaxed);
+            atomic_thread_fence(memory_order_acquire);
+            after = seq.load(memory_order_relaxed);
+        } while ((before & 1) || before != after);
+        T value;
+        memcpy(&value, words_, sizeof(T));
+        return value;
+    }
+};
+
+// 센서 상태 스냅샷 (64바이트), 모든 필드가 같은 값이면 일관된 스냅샷
+struct Snapshot {
+    double values[8];
+    bool consistent() const {
+        return all_of(begin(values), end(values), [this](double v) { return v == values[0]; });
+    }
+};
+
+// reader N개가 30ms 동안 읽기 반복, writer 하나가 계속 갱신
+template<typename Write, typename Read>
+static void benchmarkReaders(const char* name, int readers, Write write, Read read) {
+    atomic<bool> running{true};
+    atomic<uint64_t> reads{0}, torn{0};
+    thread writer([&]() {
+        for (double v = 1; running.load(memory_order_relaxed); v += 1) {
+            write(v);
+            this_thread::yield();
+        }
+    });
+    vector<thread> pool;
+    for (int r = 0; r < readers; ++r) {
+        pool.emplace_back([&]() {
+            uint64_t local = 0, bad = 0;
+            while (running.load(memory_order_relaxed)) {
+                if (!read().consistent()) ++bad;
+                ++local;
+                if ((local & 255) == 0) this_thread::yield();
+            }
+            reads += local;
+            torn += bad;
+        });
+    }
+    auto duration = chrono::milliseconds(30);
+    this_thread::sleep_for(duration);
+    running = false;
+    writer.join();
+    for (auto& t : pool) t.join();
+    cout << "    " << name << ": " << static_cast<long long>(reads / chrono::duration<double>(duration).count() / 1e3)
+         << "k reads/s, torn=" << torn << endl;
+}
+
+static Snapshot makeSnapshot(double v) {
+    Snapshot s;
+    fill(begin(s.values), end(s.values), v);
+    return s;
+}
+
+static void benchmarkSnapshots() {
+    for (int readers : {1, 2, 4, 8, 16, 32}) {
+        cout << "  readers=" << readers << endl;
+        Seqlock<Snapshot> seqlock(makeSnapshot(0));
+        benchmarkReaders("seqlock     ", readers,
+            [&](double v) { seqlock.store(makeSnapshot(v)); },
+            [&]() { return seqlock.load(); });
+
+        shared_mutex rw;
+        Snapshot guarded = makeSnapshot(0);
+        benchmarkReaders("shared_mutex", readers,
+            [&](double v) { unique_lock<shared_mutex> lock(rw); guarded = makeSnapshot(v); },
+            [&]() { shared_lock<shared_mutex> lock(rw); return guarded; });
+
+        if (readers == 1) {     // TripleBuffer는 단일 reader 전용
+            TripleBuffer<Snapshot, 1> triple;
+            benchmarkReaders("triple buf  ", readers,
+                [&](double v) { triple.backBuffer()[0] = makeSnapshot(v); triple.publish(); },
+                [&]() { triple.update(); return triple.frontBuffer()[0]; });
+        }
+    }
+}
+
+// 가능하면 스레드를 지정 코어에 고정 (코어가 하나뿐이면 같은 코어에서 번갈아 실행)
+static void pinToCore(thread& t, unsigned core) {
+#ifdef __linux__
+    unsigned cores = thread::hardware_concurrency();
+    if (cores < 2) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % cores, &set);
+    pthread_setaffinity_np(t.native_handle(), sizeof(set), &set);
+#else
+    (void)t; (void)core;
+#endif
+}
+
+static uint64_t nowNs() {
+    return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(
+        chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// writer: 프레임 번호로 채우고 마지막 칸에 publish 시각 기록
+// reader: 새 프레임마다 찢어짐(torn) 검사 + publish→관측 지연 측정
+static void benchmarkTripleBuffer() {
+    constexpr size_t FRAME = 256;
+    TripleBuffer<uint64_t, FRAME> tb;
+    atomic<bool> running{true};
+    uint64_t published = 0;
+    uint64_t observed = 0, torn = 0;
+    vector<uint64_t> latencies;
+    latencies.reserve(1 << 20);
+
+    thread writer([&]() {
+        for (uint64_t seq = 1; running.load(memory_order_relaxed); ++seq) {
+            auto& frame = tb.backBuffer();
+            fill(frame.begin(), frame.end() - 1, seq);
+            frame[FRAME - 1] = nowNs();
+            tb.publish();
+            published = seq;
+            this_thread::yield();
+        }
+    });
+    thread reader([&]() {
+        while (running.load(memory_order_relaxed)) {
+            if (!tb.update()) { this_thread::yield(); continue; }
+            const auto& frame = tb.frontBuffer();
+            uint64_t seen = nowNs();
+            if (any_of(frame.begin(), frame.end() - 1, [&](uint64_t v) { return v != frame[0]; })) ++torn;
+            latencies.push_back(seen - frame[FRAME - 1]);
+            ++observed;
+        }
+    });
+    pinToCore(writer, 0);
+    pinToCore(reader, 1);
+
+    auto duration = chrono::milliseconds(200);
+    this_thread::sleep_for(duration);
+    running = false;
+    writer.join();
+    reader.join();
+
+    sort(latencies.begin(), latencies.end());
+    double seconds = chrono::duration<double>(duration).count();
+    auto pct = [&](double p) { return latencies.empty() ? 0 : latencies[static_cast<size_t>(p * (latencies.size() - 1))]; };
+    cout << "  writer " << static_cast<long long>(published / seconds) << " frames/s, reader "
+         << static_cast<long long>(observed / seconds) << " frames/s, torn=" << torn << endl;
+    cout << "  publish latency p50=" << pct(0.5) / 1000.0 << "us p99=" << pct(0.99) / 1000.0
+         << "us (cores=" << thread::hardware_concurrency() << ")" << endl;
+}
+
 int main() {
     cout << "=== C++ Double Buffer ===" << endl;
     DoubleBuffer<int, 5> db;
@@ -35,5 +399,35 @@ int main() {
     
     cout << "Read: " << db.read(0) << ", " << db.read(1) << endl;
     
+    cout << "\n=== Lock-free Triple Buffer ===" << endl;
+    TripleBuffer<int, 5> tb;
+    tb.write(10, 0);
+    tb.write(20, 1);
+    tb.publish();
+    cout << "update=" << tb.update() << " Read: " << tb.read(0) << ", " << tb.read(1) << endl;
+    cout << "update again=" << tb.update() << " (새 프레임 없음, 같은 프레임 유지)" << endl;
+
+    cout << "\n=== Benchmark: writer/reader threads (200ms) ===" << endl;
+    benchmarkTripleBuffer();
+
+    cout << "\n=== Dirty-range Tracking ===" << endl;
+    TrackedDoubleBuffer<int, 1024, 64> tracked;
+    tracked.write(1, 10);
+    tracked.write(2, 700);
+    tracked.write(3, 701);
+    tracked.swap();
+    tracked.forEachChangedRange([](size_t b, size_t e) { cout << "changed [" << b << ", " << e << ")" << endl; });
+    cout << "carried " << tracked.bytesCarried() << " bytes (전체 " << sizeof(int) * 1024 << " bytes 대신)" << endl;
+
+    cout << "\n=== Benchmark: 512KB frame, 3 small regions/tick ===" << endl;
+    benchmarkDirtyTracking();
+
+    cout << "\n=== Seqlock Snapshot ===" << endl;
+    Seqlock<Snapshot> config(makeSnapshot(1.5));
+    cout << "load: " << config.load().values[0] << " consistent=" << config.load().consistent() << endl;
+
+    cout << "\n=== Benchmark: 1 writer, N readers (30ms each) ===" << endl;
+    benchmarkSnapshots();
+    
     return 0;
 }
@@ -1,6 +1,37 @@
 /* C++ RAII - 소멸자 자동 호출 */
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#define HAVE_POSIX_IO 1
+#endif
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define HAVE_IO_URING 1
+#endif
+#endif
 using namespace std;
 
 class FileResource {
@@ -16,11 +47,700 @@ public:
     }
 };
 
+#ifdef HAVE_POSIX_IO
+/*
+ * 파일 writer 옵션
+ *  - bufferSize: 사용자 공간 버퍼 (페이지 배수로 올림)
+ *  - flushOnDestroy: 소멸 시 마무리 기록
+ *      BufferedFileWriter: 버퍼에 남은 데이터를 write (false면 마지막 flush/sync 뒤의 데이터는 버림)
+ *      MappedFileWriter  : msync(MS_ASYNC)로 write-back만 앞당김 (false여도 MAP_SHARED라 데이터는 파일에 남음)
+ */
+struct WriterOptions {
+    size_t bufferSize = 1 << 20;
+    bool flushOnDestroy = true;
+};
+
+static size_t pageSize() {
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+static size_t roundUpToPage(size_t n) {
+    return (n + pageSize() - 1) / pageSize() * pageSize();
+}
+
+[[noreturn]] static void throwErrno(const char* what) {
+    throw system_error(errno, generic_category(), what);
+}
+
+/*
+ * BufferedFileWriter - 큰 사용자 공간 버퍼 + 페이지 정렬 단위 write(2)
+ *  - 작은 레코드는 버퍼에 memcpy만, 버퍼가 차면 한 번에 기록
+ *  - 버퍼보다 큰 쓰기는 버퍼가 비어 있으면 페이지 배수만큼 바로 기록
+ */
+class BufferedFileWriter {
+    int fd;
+    uint8_t* buffer;
+    size_t capacity;
+    size_t used = 0;
+    bool flushOnDestroy;
+
+    void writeAll(const uint8_t* data, size_t n) {
+        while (n > 0) {
+            ssize_t written = ::write(fd, data, n);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throwErrno("write");
+            }
+            data += written;
+            n -= static_cast<size_t>(written);
+        }
+    }
+
+public:
+    explicit BufferedFileWriter(const char* path, WriterOptions options = {})
+        : capacity(roundUpToPage(options.bufferSize)), flushOnDestroy(options.flushOnDestroy) {
+        fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) throwErrno("open");
+        buffer = static_cast<uint8_t*>(aligned_alloc(pageSize(), capacity));
+        if (!buffer) {
+            ::close(fd);
+            throw bad_alloc();
+        }
+    }
+    ~BufferedFileWriter() {
+        if (flushOnDestroy) {
+            try { flush(); } catch (const system_error&) {}    // 소멸자에서는 예외를 삼킴
+        }
+        free(buffer);
+        ::close(fd);
+    }
+    BufferedFileWriter(const BufferedFileWriter&) = delete;
+    BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+
+    void write(const void* data, size_t n) {
+        auto* bytes = static_cast<const uint8_t*>(data);
+        if (used == 0 && n >= capacity) {       // 큰 쓰기: 버퍼 우회
+            size_t direct = n / pageSize() * pageSize();
+            writeAll(bytes, direct);
+            bytes += direct;
+            n -= direct;
+        }
+        while (n > 0) {
+            size_t chunk = min(n, capacity - used);
+            memcpy(buffer + used, bytes, chunk);
+            used += chunk;
+            bytes += chunk;
+            n -= chunk;
+            if (used == capacity) {
+                writeAll(buffer, capacity);
+                used = 0;
+            }
+        }
+    }
+
+    void flush() {
+        writeAll(buffer, used);
+        used = 0;
+    }
+
+    // 디스크까지 내려보냄
+    void sync() {
+        flush();
+        if (::fsync(fd) < 0) throwErrno("fsync");
+    }
+};
+
+/*
+ * MappedFileWriter - 파일을 mmap하고 append를 memcpy로 처리
+ *  - 공간이 모자라면 ftruncate로 파일을 2배 키우고 다시 매핑
+ *  - 닫을 때 실제 기록한 길이로 ftruncate
+ */
+class MappedFileWriter {
+    int fd;
+    uint8_t* base = nullptr;
+    size_t mapped = 0;
+    size_t size = 0;
+    bool flushOnDestroy;
+
+    void grow(size_t needed) {
+        size_t next = max(roundUpToPage(needed), mapped * 2);
+        if (::ftruncate(fd, static_cast<off_t>(next)) < 0) throwErrno("ftruncate");
+#ifdef __linux__
+        void* p = mapped ? mremap(base, mapped, next, MREMAP_MAYMOVE)
+                         : mmap(nullptr, next, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+#else
+        if (mapped) munmap(base, mapped);
+        void* p = mmap(nullptr, next, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+#endif
+        if (p == MAP_FAILED) throwErrno("mmap");
+        base = static_cast<uint8_t*>(p);
+        mapped = next;
+    }
+
+public:
+    explicit MappedFileWriter(const char* path, WriterOptions options = {})
+        : flushOnDestroy(options.flushOnDestroy) {
+        fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) throwErrno("open");
+        try {
+            grow(options.bufferSize);
+        } catch (...) {
+            ::close(fd);            // 생성자가 실패하면 소멸자가 불리지 않음
+            throw;
+        }
+    }
+    ~MappedFileWriter() {
+        if (flushOnDestroy && base) msync(base, size, MS_ASYNC);   // 커널에 write-back 요청
+        if (base) munmap(base, mapped);
+        if (::ftruncate(fd, static_cast<off_t>(size)) < 0) { /* 늘어난 꼬리가 남음 */ }
+        ::close(fd);
+    }
+    MappedFileWriter(const MappedFileWriter&) = delete;
+    MappedFileWriter& operator=(const MappedFileWriter&) = delete;
+
+    void write(const void* data, size_t n) {
+        if (size + n > mapped) grow(size + n);
+        memcpy(base + size, data, n);
+        size += n;
+    }
+
+    void sync() {
+        if (size && msync(base, size, MS_SYNC) < 0) throwErrno("msync");
+    }
+
+    size_t bytesWritten() const { return size; }
+};
+
+// 총 64MB를 recordSize 단위로 기록 → GB/s (page cache 기준, fsync 제외)
+template<typename Writer>
+static double measureGBps(size_t recordSize, Writer&& writeAll) {
+    constexpr size_t TOTAL = 64 << 20;
+    vector<uint8_t> record(recordSize, 'x');
+    auto start = chrono::steady_clock::now();
+    writeAll(record.data(), recordSize, TOTAL / recordSize);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return TOTAL / seconds / 1e9;
+}
+
+static void benchmarkWriters() {
+    const char* path = "raii_bench.bin";
+    for (size_t recordSize : {size_t{64}, size_t{64 * 1024}}) {
+        double stdio = measureGBps(recordSize, [&](const uint8_t* r, size_t n, size_t count) {
+            FILE* f = fopen(path, "wb");
+            if (!f) throwErrno("fopen");
+            for (size_t i = 0; i < count; ++i) fwrite(r, 1, n, f);
+            fclose(f);
+        });
+        double buffered = measureGBps(recordSize, [&](const uint8_t* r, size_t n, size_t count) {
+            BufferedFileWriter w(path);
+            for (size_t i = 0; i < count; ++i) w.write(r, n);
+        });
+        double mapped = measureGBps(recordSize, [&](const uint8_t* r, size_t n, size_t count) {
+            MappedFileWriter w(path);
+            for (size_t i = 0; i < count; ++i) w.write(r, n);
+        });
+        cout << "  record " << recordSize << "B: stdio=" << stdio << " buffered=" << buffered
+             << " mmap=" << mapped << " GB/s" << endl;
+    }
+    remove(path);
+}
+
+/*
+ * AsyncFile - 호출 스레드를 막지 않는 파일 I/O
+ *  - io_uring 백엔드: SQE를 모아 batch 단위로 io_uring_enter, 등록 버퍼는 READ/WRITE_FIXED
+ *    reaper 스레드가 CQE를 꺼내 콜백 실행 (future 버전은 promise를 채움)
+ *  - io_uring이 없거나 막혀 있으면 (ENOSYS/EPERM) pread/pwrite 스레드 풀로 대체
+ *  - 소멸자는 제출 대기·진행 중인 요청이 모두 끝날 때까지 기다림 (RAII)
+ *  - 버퍼는 완료 콜백이 호출될 때까지 호출자가 유지
+ */
+struct AsyncOptions {
+    unsigned queueDepth = 64;
+    unsigned batchSize = 8;             // 이만큼 쌓이면 자동 제출
+    unsigned fixedBuffers = 8;
+    size_t fixedBufferSize = 64 * 1024;
+    bool forceThreadPool = false;
+};
+
+using IoCallback = function<void(ssize_t result)>;     // 바이트 수 또는 -errno
+
+struct FixedBuffer {
+    uint8_t* data = nullptr;
+    size_t size = 0;
+    int index = -1;
+    explicit operator bool() const { return data != nullptr; }
+};
+
+class AsyncBackend {
+public:
+    virtual ~AsyncBackend() = default;
+    // fixedIndex >= 0 이면 등록 버퍼 사용
+    virtual void enqueue(bool isWrite, int fd, void* buffer, size_t n, off_t offset,
+                         int fixedIndex, IoCallback done) = 0;
+    virtual void submit() = 0;
+    virtual const char* name() const = 0;
+};
+
+class ThreadPoolBackend : public AsyncBackend {
+    struct Request {
+        bool isWrite;
+        int fd;
+        void* buffer;
+        size_t n;
+        off_t offset;
+        IoCallback done;
+    };
+    mutex lock;
+    condition_variable ready;
+    deque<Request> requests;
+    bool stopping = false;
+    vector<thread> workers;
+
+    void run() {
+        for (;;) {
+            Request r;
+            {
+                unique_lock<mutex> guard(lock);
+                ready.wait(guard, [this]() { return stopping || !requests.empty(); });
+                if (requests.empty()) return;
+                r = std::move(requests.front());
+                requests.pop_front();
+            }
+            ssize_t result = r.isWrite ? ::pwrite(r.fd, r.buffer, r.n, r.offset)
+                                       : ::pread(r.fd, r.buffer, r.n, r.offset);
+            r.done(result < 0 ? -errno : result);
+        }
+    }
+
+public:
+    explicit ThreadPoolBackend(unsigned threads = 2) {
+        for (unsigned i = 0; i < threads; ++i) workers.emplace_back([this]() { run(); });
+    }
+    ~ThreadPoolBackend() override {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;        // 남은 요청은 모두 처리한 뒤 종료
+        }
+        ready.notify_all();
+        for (auto& w : workers) w.join();
+    }
+
+    void enqueue(bool isWrite, int fd, void* buffer, size_t n, off_t offset, int, IoCallback done) override {
+        {
+            lock_guard<mutex> guard(lock);
+            requests.push_back({isWrite, fd, buffer, n, offset, std::move(done)});
+        }
+        ready.notify_one();
+    }
+    void submit() override {}
+    const char* name() const override { return "thread pool"; }
+};
+
+#ifdef HAVE_IO_URING
+class UringBackend : public AsyncBackend {
+    static constexpr uint64_t WAKE_TOKEN = 0;   // 종료 시 reaper를 깨우는 NOP
+
+    // 제출한 요청 하나 (user_data), reaper가 멈추면 목록에 남은 것을 모두 -errno로 완료
+    struct Op {
+        IoCallback done;
+        Op* prev = nullptr;
+        Op* next = nullptr;
+    };
+
+    int ringFd = -1;
+    io_uring_params params{};
+    void* sqRing = MAP_FAILED;
+    void* cqRing = MAP_FAILED;
+    size_t sqRingBytes = 0, cqRingBytes = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+
+    // 링 포인터 (커널과 공유)
+    unsigned* sqHead; unsigned* sqTail; unsigned* sqMask; unsigned* sqArray;
+    unsigned* cqHead; unsigned* cqTail; unsigned* cqMask; io_uring_cqe* cqes;
+
+    mutex submitLock;
+    condition_variable slotFree;
+    unsigned unsubmitted = 0;
+    unsigned inFlight = 0;              // 제출 + 미완료 (CQ 크기를 넘지 않게 제한)
+    Op* outstanding = nullptr;          // 아직 완료되지 않은 Op 목록 (submitLock)
+    int fatalError = 0;                 // reaper가 멈춘 원인 errno, 이후 요청은 바로 실패 (submitLock)
+    unsigned batchSize;
+    bool fixedRegistered = false;
+    atomic<bool> stopping{false};
+    thread reaper;
+
+    template<typename T>
+    static T* at(void* base, unsigned offset) {
+        return reinterpret_cast<T*>(static_cast<uint8_t*>(base) + offset);
+    }
+
+    static int enter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+        return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    void submitLocked() {
+        while (unsubmitted) {
+            int n = enter(ringFd, unsubmitted, 0, 0);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                throwErrno("io_uring_enter");
+            }
+            unsubmitted -= static_cast<unsigned>(n);
+        }
+    }
+
+    void link(Op* op) {
+        op->next = outstanding;
+        if (outstanding) outstanding->prev = op;
+        outstanding = op;
+    }
+
+    void unlink(Op* op) {
+        (op->prev ? op->prev->next : outstanding) = op->next;
+        if (op->next) op->next->prev = op->prev;
+    }
+
+    // false면 링이 고장 나서 넣지 못함 (fatalError)
+    bool pushSqe(const io_uring_sqe& sqe, unique_lock<mutex>& guard) {
+        slotFree.wait(guard, [this]() { return inFlight < params.cq_entries || fatalError; });
+        if (fatalError) return false;
+        unsigned tail = *sqTail;
+        unsigned head = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+        if (tail - head == params.sq_entries) {    // SQ가 가득 → 먼저 제출
+            submitLocked();
+        }
+        unsigned index = tail & *sqMask;
+        sqes[index] = sqe;
+        sqArray[index] = index;
+        __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+        ++unsubmitted;
+        ++inFlight;
+        if (unsubmitted >= batchSize) submitLocked();
+        return true;
+    }
+
+    // io_uring_enter가 회복할 수 없는 오류 → 남은 요청을 모두 실패로 완료하고 대기자를 깨움
+    // (reaper가 조용히 끝나면 drain()과 소멸자가 영원히 기다림)
+    void failOutstanding(int err) {
+        Op* ops;
+        {
+            lock_guard<mutex> guard(submitLock);
+            fatalError = err;
+            ops = outstanding;
+            outstanding = nullptr;
+            inFlight = 0;
+            unsubmitted = 0;
+        }
+        slotFree.notify_all();
+        while (ops) {
+            unique_ptr<Op> op(ops);
+            ops = ops->next;
+            op->done(-err);
+        }
+    }
+
+    void reap() {
+        vector<io_uring_cqe> completed;     // reaper 전용, 재사용
+        completed.reserve(params.cq_entries);
+        for (;;) {
+            if (enter(ringFd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) {
+                failOutstanding(errno);
+                return;
+            }
+            unsigned head = *cqHead;
+            unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+            completed.clear();
+            for (; head != tail; ++head) completed.push_back(cqes[head & *cqMask]);
+            __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+            if (completed.empty()) continue;
+            {
+                lock_guard<mutex> guard(submitLock);
+                inFlight -= static_cast<unsigned>(completed.size());
+                for (const io_uring_cqe& cqe : completed)
+                    if (cqe.user_data != WAKE_TOKEN) unlink(reinterpret_cast<Op*>(cqe.user_data));
+            }
+            slotFree.notify_all();
+            // 슬롯을 먼저 돌려준 뒤 콜백 실행 → 콜백 안에서 다시 enqueue해도 막히지 않음
+            bool wake = false;
+            for (const io_uring_cqe& cqe : completed) {
+                if (cqe.user_data == WAKE_TOKEN) {
+                    wake = true;
+                    continue;
+                }
+                unique_ptr<Op> op(reinterpret_cast<Op*>(cqe.user_data));
+                op->done(cqe.res);
+            }
+            if (wake && stopping) return;
+        }
+    }
+
+public:
+    // 실패 시 system_error → 호출자가 스레드 풀로 대체
+    UringBackend(const AsyncOptions& options, vector<iovec>& buffers) : batchSize(max(1u, options.batchSize)) {
+        ringFd = static_cast<int>(syscall(__NR_io_uring_setup, options.queueDepth, &params));
+        if (ringFd < 0) throwErrno("io_uring_setup");
+        sqRingBytes = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingBytes = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single) sqRingBytes = cqRingBytes = max(sqRingBytes, cqRingBytes);
+        sqRing = mmap(nullptr, sqRingBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+        cqRing = single ? sqRing
+                        : mmap(nullptr, cqRingBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+        sqes = static_cast<io_uring_sqe*>(mmap(nullptr, params.sq_entries * sizeof(io_uring_sqe),
+                                               PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES));
+        if (sqRing == MAP_FAILED || cqRing == MAP_FAILED || sqes == MAP_FAILED) {
+            int err = errno;
+            release();
+            throw system_error(err, generic_category(), "io_uring mmap");
+        }
+        sqHead = at<unsigned>(sqRing, params.sq_off.head);
+        sqTail = at<unsigned>(sqRing, params.sq_off.tail);
+        sqMask = at<unsigned>(sqRing, params.sq_off.ring_mask);
+        sqArray = at<unsigned>(sqRing, params.sq_off.array);
+        cqHead = at<unsigned>(cqRing, params.cq_off.head);
+        cqTail = at<unsigned>(cqRing, params.cq_off.tail);
+        cqMask = at<unsigned>(cqRing, params.cq_off.ring_mask);
+        cqes = at<io_uring_cqe>(cqRing, params.cq_off.cqes);
+
+        // 등록 버퍼: 커널이 매 요청마다 페이지를 고정/해제하지 않음 (memlock 한도 초과 시 일반 I/O)
+        if (!buffers.empty()) {
+            fixedRegistered = syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_BUFFERS,
+                                      buffers.data(), static_cast<unsigned>(buffers.size())) == 0;
+        }
+        reaper = thread([this]() { reap(); });
+    }
+
+    ~UringBackend() override {
+        {
+            unique_lock<mutex> guard(submitLock);
+            if (!fatalError) submitLocked();
+            slotFree.wait(guard, [this]() { return inFlight == 0 || fatalError; });   // 진행 중인 요청 완료 대기
+            stopping = true;
+            io_uring_sqe nop{};
+            nop.opcode = IORING_OP_NOP;
+            nop.user_data = WAKE_TOKEN;
+            if (pushSqe(nop, guard)) submitLocked();          // 고장 났으면 reaper는 이미 끝남
+        }
+        reaper.join();
+        release();
+    }
+
+    void release() {
+        if (sqes != MAP_FAILED) munmap(sqes, params.sq_entries * sizeof(io_uring_sqe));
+        if (cqRing != MAP_FAILED && cqRing != sqRing) munmap(cqRing, cqRingBytes);
+        if (sqRing != MAP_FAILED) munmap(sqRing, sqRingBytes);
+        sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+        sqRing = cqRing = MAP_FAILED;
+        if (ringFd >= 0) ::close(ringFd);      // 등록 버퍼도 함께 해제
+        ringFd = -1;
+    }
+
+    void enqueue(bool isWrite, int fd, void* buffer, size_t n, off_t offset, int fixedIndex, IoCallback done) override {
+        io_uring_sqe sqe{};
+        bool fixed = fixedIndex >= 0 && fixedRegistered;
+        sqe.opcode = fixed ? (isWrite ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED)
+                           : (isWrite ? IORING_OP_WRITE : IORING_OP_READ);
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<uint64_t>(buffer);
+        sqe.len = static_cast<uint32_t>(n);
+        sqe.off = static_cast<uint64_t>(offset);
+        if (fixed) sqe.buf_index = static_cast<uint16_t>(fixedIndex);
+        Op* op = new Op{std::move(done)};
+        sqe.user_data = reinterpret_cast<uint64_t>(op);
+        unique_lock<mutex> guard(submitLock);
+        if (!pushSqe(sqe, guard)) {
+            int err = fatalError;
+            guard.unlock();
+            unique_ptr<Op>(op)->done(-err);
+            return;
+        }
+        link(op);
+    }
+
+    void submit() override {
+        lock_guard<mutex> guard(submitLock);
+        if (!fatalError) submitLocked();
+    }
+
+    const char* name() const override { return fixedRegistered ? "io_uring (registered buffers)" : "io_uring"; }
+};
+#endif
+
+class AsyncFile {
+    int fd;
+    unique_ptr<uint8_t, void (*)(void*)> bufferArena{nullptr, free};
+    vector<iovec> bufferViews;
+    vector<int> freeBuffers;
+    mutex bufferLock;
+    condition_variable bufferReturned;
+    mutex drainLock;
+    condition_variable drained;
+    size_t pending = 0;
+    unique_ptr<AsyncBackend> backend;       // 마지막에 선언 → 가장 먼저 소멸 (버퍼보다 먼저 drain)
+
+    IoCallback track(IoCallback done, int fixedIndex) {
+        {
+            lock_guard<mutex> guard(drainLock);
+            ++pending;
+        }
+        return [this, done = std::move(done), fixedIndex](ssize_t result) {
+            if (done) done(result);
+            if (fixedIndex >= 0) {
+                {
+                    lock_guard<mutex> guard(bufferLock);
+                    freeBuffers.push_back(fixedIndex);
+                }
+                bufferReturned.notify_one();
+            }
+            lock_guard<mutex> guard(drainLock);
+            if (--pending == 0) drained.notify_all();
+        };
+    }
+
+public:
+    explicit AsyncFile(const char* path, AsyncOptions options = {}) {
+        fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) throwErrno("open");
+        size_t bufferBytes = roundUpToPage(options.fixedBufferSize);
+        if (options.fixedBuffers) {
+            bufferArena.reset(static_cast<uint8_t*>(aligned_alloc(pageSize(), bufferBytes * options.fixedBuffers)));
+            for (unsigned i = 0; i < options.fixedBuffers; ++i) {
+                bufferViews.push_back({bufferArena.get() + i * bufferBytes, bufferBytes});
+                freeBuffers.push_back(static_cast<int>(i));
+            }
+        }
+#ifdef HAVE_IO_URING
+        if (!options.forceThreadPool) {
+            try {
+                backend = make_unique<UringBackend>(options, bufferViews);
+            } catch (const system_error&) {
+                // 커널/seccomp가 io_uring을 막음 → 스레드 풀
+            }
+        }
+#endif
+        if (!backend) backend = make_unique<ThreadPoolBackend>();
+    }
+
+    ~AsyncFile() {
+        drain();
+        backend.reset();
+        ::close(fd);
+    }
+    AsyncFile(const AsyncFile&) = delete;
+    AsyncFile& operator=(const AsyncFile&) = delete;
+
+    void write(const void* data, size_t n, off_t offset, IoCallback done) {
+        backend->enqueue(true, fd, const_cast<void*>(data), n, offset, -1, track(std::move(done), -1));
+    }
+    void read(void* data, size_t n, off_t offset, IoCallback done) {
+        backend->enqueue(false, fd, data, n, offset, -1, track(std::move(done), -1));
+    }
+
+    future<ssize_t> write(const void* data, size_t n, off_t offset) {
+        auto promise = make_shared<std::promise<ssize_t>>();
+        auto result = promise->get_future();
+        write(data, n, offset, [promise](ssize_t r) { promise->set_value(r); });
+        submit();
+        return result;
+    }
+    future<ssize_t> read(void* data, size_t n, off_t offset) {
+        auto promise = make_shared<std::promise<ssize_t>>();
+        auto result = promise->get_future();
+        read(data, n, offset, [promise](ssize_t r) { promise->set_value(r); });
+        submit();
+        return result;
+    }
+
+    // 등록 버퍼 하나를 빌림 (모두 사용 중이면 반환될 때까지 대기)
+    FixedBuffer acquireBuffer() {
+        if (bufferViews.empty()) return {};
+        unique_lock<mutex> guard(bufferLock);
+        if (freeBuffers.empty()) {
+            guard.unlock();
+            submit();       // 제출 대기 중인 요청이 버퍼를 잡고 있을 수 있음
+            guard.lock();
+        }
+        bufferReturned.wait(guard, [this]() { return !freeBuffers.empty(); });
+        int index = freeBuffers.back();
+        freeBuffers.pop_back();
+        return {static_cast<uint8_t*>(bufferViews[index].iov_base), bufferViews[index].iov_len, index};
+    }
+
+    // 등록 버퍼에서 기록, 완료 후 버퍼는 자동 반환
+    void writeFixed(const FixedBuffer& buffer, size_t n, off_t offset, IoCallback done = {}) {
+        backend->enqueue(true, fd, buffer.data, min(n, buffer.size), offset, buffer.index,
+                         track(std::move(done), buffer.index));
+    }
+
+    void submit() { backend->submit(); }
+
+    // 제출 대기 중인 요청까지 보내고 모두 완료될 때까지 대기
+    void drain() {
+        submit();
+        unique_lock<mutex> guard(drainLock);
+        drained.wait(guard, [this]() { return pending == 0; });
+    }
+
+    const char* backendName() const { return backend->name(); }
+};
+
+static void demoAsyncFile(bool forceThreadPool) {
+    const char* path = "raii_async.log";
+    AsyncOptions options;
+    options.forceThreadPool = forceThreadPool;
+    atomic<size_t> written{0};
+    auto start = chrono::steady_clock::now();
+    {
+        AsyncFile file(path, options);
+        constexpr int RECORDS = 256;
+        constexpr size_t RECORD = 16 * 1024;
+        for (int i = 0; i < RECORDS; ++i) {
+            FixedBuffer buffer = file.acquireBuffer();
+            memset(buffer.data, 'a' + i % 26, RECORD);
+            file.writeFixed(buffer, RECORD, static_cast<off_t>(i) * RECORD,
+                            [&written](ssize_t r) { if (r > 0) written += static_cast<size_t>(r); });
+        }
+        file.drain();
+        char check[4] = {};
+        auto n = file.read(check, 3, static_cast<off_t>(RECORD) * 2).get();   // 세 번째 레코드 = 'c'
+        cout << "  [" << file.backendName() << "] wrote " << written / 1024 << " KB, read back "
+             << n << " bytes: \"" << check << "\"";
+    }   // 소멸자: 남은 요청 drain 후 닫힘
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << " (" << ms << " ms)" << endl;
+    remove(path);
+}
+#endif
+
 int main() {
     cout << "=== C++ RAII ===" << endl;
     {
         FileResource res("test.txt");
     }  // 자동 소멸
     cout << "블록 종료!" << endl;
+#ifdef HAVE_POSIX_IO
+    cout << "\n=== RAII File Writers ===" << endl;
+    {
+        BufferedFileWriter log("raii_buffered.log");
+        const char line[] = "buffered record\n";
+        for (int i = 0; i < 3; ++i) log.write(line, sizeof(line) - 1);
+        log.sync();     // 명시적 fsync
+    }
+    {
+        MappedFileWriter log("raii_mapped.log", {4096, true});
+        const char line[] = "mapped record\n";
+        for (int i = 0; i < 1000; ++i) log.write(line, sizeof(line) - 1);     // 4KB 초과 → 파일 확장
+        cout << "mapped bytes: " << log.bytesWritten() << endl;
+    }   // 소멸 시 msync + 실제 길이로 ftruncate
+    remove("raii_buffered.log");
+    remove("raii_mapped.log");
+
+    cout << "\n=== Benchmark: 64MB write ===" << endl;
+    benchmarkWriters();
+
+    cout << "\n=== Async File (io_uring / thread pool) ===" << endl;
+    demoAsyncFile(false);
+    demoAsyncFile(true);
+#endif
     return 0;
 }
@@ -1,5 +1,19 @@
 /* C++ Semaphore - std::counting_semaphore (C++20) */
 #include <iostream>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <semaphore>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 using namespace std;
 
 // 간단한 Semaphore 구현
@@ -12,6 +26,156 @@ public:
     int getCount() const { return count; }
 };
 
+/*
+ * FastSemaphore - 스레드 안전 카운팅 세마포어
+ *  - 비경합: acquire/release 모두 atomic RMW 한 번
+ *  - 경합: 짧게 spin → futex(Linux) / atomic::wait 로 park
+ *  - waiters가 0이면 release는 깨우기 syscall을 생략
+ *  - bulk acquire(n)이 섞여 있으므로 release는 notify_all (필요 개수가 모자란 waiter는 다시 잠듦)
+ */
+static inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+class FastSemaphore {
+    // 코어가 하나면 spin해도 상대가 실행될 수 없음 → 바로 park
+    static inline const int SPIN_LIMIT = thread::hardware_concurrency() > 1 ? 64 : 0;
+    atomic<int32_t> count;
+    atomic<int32_t> waiters{0};
+
+    bool tryTake(int32_t n) {
+        int32_t c = count.load(memory_order_relaxed);
+        while (c >= n) {
+            if (count.compare_exchange_weak(c, c - n, memory_order_acquire, memory_order_relaxed)) return true;
+        }
+        return false;
+    }
+
+    // count가 아직 expected이면 잠듦, timeout(ns) < 0 이면 무한 대기
+    void park(int32_t expected, int64_t timeoutNs) {
+#ifdef __linux__
+        timespec ts{static_cast<time_t>(timeoutNs / 1000000000), static_cast<long>(timeoutNs % 1000000000)};
+        syscall(SYS_futex, reinterpret_cast<int32_t*>(&count), FUTEX_WAIT_PRIVATE, expected,
+                timeoutNs < 0 ? nullptr : &ts, nullptr, 0);
+#else
+        if (timeoutNs < 0) count.wait(expected, memory_order_relaxed);
+        else this_thread::yield();      // atomic::wait에는 timeout이 없음 → polling
+#endif
+    }
+
+    void wake() {
+#ifdef __linux__
+        syscall(SYS_futex, reinterpret_cast<int32_t*>(&count), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+        count.notify_all();
+#endif
+    }
+
+    bool acquireUntil(int32_t n, chrono::steady_clock::time_point deadline, bool timed) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            if (tryTake(n)) return true;
+            cpuRelax();
+        }
+        for (;;) {
+            if (tryTake(n)) return true;
+            int64_t remaining = -1;
+            if (timed) {
+                remaining = chrono::duration_cast<chrono::nanoseconds>(deadline - chrono::steady_clock::now()).count();
+                if (remaining <= 0) return false;
+            }
+            waiters.fetch_add(1, memory_order_seq_cst);
+            int32_t c = count.load(memory_order_seq_cst);
+            if (c < n) park(c, remaining);
+            waiters.fetch_sub(1, memory_order_relaxed);
+        }
+    }
+
+    static_assert(sizeof(atomic<int32_t>) == sizeof(int32_t), "futex needs a plain 32-bit word");
+
+public:
+    explicit FastSemaphore(int32_t initial) : count(initial) {}
+    FastSemaphore(const FastSemaphore&) = delete;
+    FastSemaphore& operator=(const FastSemaphore&) = delete;
+
+    void acquire(int32_t n = 1) { acquireUntil(n, {}, false); }
+    bool try_acquire(int32_t n = 1) { return tryTake(n); }
+
+    template<typename Rep, typename Period>
+    bool try_acquire_for(chrono::duration<Rep, Period> timeout, int32_t n = 1) {
+        return acquireUntil(n, chrono::steady_clock::now() + timeout, true);
+    }
+
+    void release(int32_t n = 1) {
+        count.fetch_add(n, memory_order_seq_cst);
+        if (waiters.load(memory_order_seq_cst) > 0) wake();
+    }
+
+    int32_t available() const { return count.load(memory_order_relaxed); }
+};
+
+// 비교용: mutex + condition_variable 세마포어
+class CondvarSemaphore {
+    mutex lock;
+    condition_variable changed;
+    int32_t count;
+public:
+    explicit CondvarSemaphore(int32_t initial) : count(initial) {}
+    void acquire() {
+        unique_lock<mutex> guard(lock);
+        changed.wait(guard, [this]() { return count > 0; });
+        --count;
+    }
+    void release() {
+        {
+            lock_guard<mutex> guard(lock);
+            ++count;
+        }
+        changed.notify_one();
+    }
+};
+
+// ping-pong: 두 스레드가 세마포어 두 개로 번갈아 깨움 → 왕복 지연
+template<typename Sem>
+static void benchmarkPingPong(const char* name) {
+    constexpr int ROUNDS = 20000;
+    Sem ping(0), pong(0);
+    auto start = chrono::steady_clock::now();
+    thread partner([&]() {
+        for (int i = 0; i < ROUNDS; ++i) { ping.acquire(); pong.release(); }
+    });
+    for (int i = 0; i < ROUNDS; ++i) { ping.release(); pong.acquire(); }
+    partner.join();
+    double us = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << ": " << us / ROUNDS << " us/round-trip" << endl;
+}
+
+// throttling: 허가 4개를 8개 스레드가 나눠 씀
+template<typename Sem>
+static void benchmarkThrottle(const char* name) {
+    constexpr int THREADS = 8;
+    constexpr int OPS = 20000;
+    Sem permits(4);
+    atomic<long long> work{0};
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&]() {
+            for (int i = 0; i < OPS; ++i) {
+                permits.acquire();
+                work.fetch_add(i, memory_order_relaxed);
+                permits.release();
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << ": " << static_cast<long long>(THREADS * OPS / seconds / 1e3) << "k acquire/release per sec" << endl;
+}
+
 int main() {
     cout << "=== C++ Semaphore ===" << endl;
     Semaphore sem(2);
@@ -21,5 +185,27 @@ int main() {
     sem.signal();
     cout << "Count: " << sem.getCount() << endl;
     
+    cout << "\n=== FastSemaphore (blocking) ===" << endl;
+    FastSemaphore fast(0);
+    bool timedOut = !fast.try_acquire_for(chrono::milliseconds(5));
+    cout << "try_acquire_for(5ms) on empty: " << (timedOut ? "timeout" : "acquired") << endl;
+    thread producer([&fast]() {
+        this_thread::sleep_for(chrono::milliseconds(2));
+        fast.release(3);        // bulk release → 대기 중인 acquire(3) 깨움
+    });
+    fast.acquire(3);
+    producer.join();
+    cout << "acquire(3) woke, available=" << fast.available() << endl;
+
+    cout << "\n=== Benchmark: ping-pong ===" << endl;
+    benchmarkPingPong<FastSemaphore>("FastSemaphore       ");
+    benchmarkPingPong<counting_semaphore<>>("std::counting_sem   ");
+    benchmarkPingPong<CondvarSemaphore>("mutex+condvar       ");
+
+    cout << "\n=== Benchmark: throttling (4 permits, 8 threads) ===" << endl;
+    benchmarkThrottle<FastSemaphore>("FastSemaphore       ");
+    benchmarkThrottle<counting_semaphore<>>("std::counting_sem   ");
+    benchmarkThrottle<CondvarSemaphore>("mutex+condvar       ");
+    
     return 0;
 }
@@ -1,8 +1,242 @@
 /* C++ Mutex Guard - lock_guard */
 #include <iostream>
 #include <mutex>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <climits>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 using namespace std;
 
+/*
+ * 빌드 플래그: LOCK_PROFILING
+ *  - 1 (기본): ProfiledMutex가 획득/경합 횟수, 대기·보유 시간 히스토그램 기록
+ *  - 0: ProfiledMutex = std::mutex 얇은 래퍼, 계측 코드 전부 제거 (-DLOCK_PROFILING=0)
+ */
+#ifndef LOCK_PROFILING
+#define LOCK_PROFILING 1
+#endif
+
+// 2의 거듭제곱 ns 구간 히스토그램 (bucket i = [2^(i-1), 2^i) ns)
+constexpr size_t HISTOGRAM_BUCKETS = 40;
+
+struct LockStats {
+    string name;
+    uint64_t acquisitions = 0;
+    uint64_t contended = 0;
+    uint64_t waitNsTotal = 0;
+    uint64_t holdNsTotal = 0;
+    array<uint64_t, HISTOGRAM_BUCKETS> waitHistogram{};
+    array<uint64_t, HISTOGRAM_BUCKETS> holdHistogram{};
+
+    // 히스토그램 구간 상한으로 근사한 백분위 (ns)
+    static uint64_t percentile(const array<uint64_t, HISTOGRAM_BUCKETS>& h, double p) {
+        uint64_t total = 0;
+        for (uint64_t c : h) total += c;
+        if (total == 0) return 0;
+        uint64_t target = static_cast<uint64_t>(p * (total - 1)), seen = 0;
+        for (size_t i = 0; i < h.size(); ++i) {
+            seen += h[i];
+            if (seen > target) return uint64_t{1} << i;
+        }
+        return uint64_t{1} << (h.size() - 1);
+    }
+};
+
+#if LOCK_PROFILING
+class ProfiledMutex;
+
+// 살아 있는 ProfiledMutex 목록 (report/dump용)
+class LockRegistry {
+    mutex lock;
+    vector<ProfiledMutex*> locks;
+public:
+    static LockRegistry& instance() {
+        static LockRegistry registry;
+        return registry;
+    }
+    void add(ProfiledMutex* m) { lock_guard<mutex> g(lock); locks.push_back(m); }
+    void remove(ProfiledMutex* m) {
+        lock_guard<mutex> g(lock);
+        locks.erase(std::remove(locks.begin(), locks.end(), m), locks.end());
+    }
+    vector<LockStats> snapshot();
+    void report(ostream& out);
+};
+
+/*
+ * ProfiledMutex - std::mutex 자리에 그대로 사용 (Lockable)
+ *  - try_lock 실패 = 경합으로 집계, 대기 시간 측정 후 블로킹 lock
+ *  - 카운터는 스레드별 shard에만 기록 (쓰는 스레드가 하나라 relaxed로 충분)
+ *    → 계측 자체가 새로운 경합 지점이 되지 않음, 읽을 때 shard를 합침
+ */
+class ProfiledMutex {
+    struct Shard {
+        thread::id owner = this_thread::get_id();
+        atomic<uint64_t> acquisitions{0};
+        atomic<uint64_t> contended{0};
+        atomic<uint64_t> waitNsTotal{0};
+        atomic<uint64_t> holdNsTotal{0};
+        array<atomic<uint64_t>, HISTOGRAM_BUCKETS> waitHistogram{};
+        array<atomic<uint64_t>, HISTOGRAM_BUCKETS> holdHistogram{};
+    };
+
+    struct CacheEntry {
+        uint64_t lockId = 0;            // 0 = 빈 칸 (id는 1부터)
+        Shard* shard = nullptr;
+    };
+    static constexpr size_t CACHE_WAYS = 8;     // 스레드당 캐시 칸 수 (direct-mapped)
+
+    mutex inner;
+    string lockName;
+    uint64_t id;
+    mutex shardsLock;                       // shard 추가(스레드당 1회)와 snapshot에서만 사용
+    vector<unique_ptr<Shard>> shards;
+    Shard* holder = nullptr;                // 보유 중인 스레드의 shard
+    chrono::steady_clock::time_point holdStart;
+
+    static uint64_t nextId() {
+        static atomic<uint64_t> counter{1};
+        return counter.fetch_add(1, memory_order_relaxed);
+    }
+
+    static size_t bucketOf(uint64_t ns) {
+        return min<size_t>(bit_width(ns), HISTOGRAM_BUCKETS - 1);
+    }
+
+    static void bump(atomic<uint64_t>& counter, uint64_t value = 1) {
+        counter.store(counter.load(memory_order_relaxed) + value, memory_order_relaxed);
+    }
+
+    // 주소 재사용에 안전하도록 포인터 대신 고유 id로 thread_local 캐시 조회
+    //  - id % CACHE_WAYS 칸 하나만 확인 → 크기 고정, 파괴된 락의 엔트리는 같은 칸을 쓰는 락이 덮어씀
+    //  - 칸 충돌로 밀려났으면 shard 목록에서 이 스레드 것을 다시 찾음 (없을 때만 새로 만듦)
+    Shard* localShard() {
+        thread_local array<CacheEntry, CACHE_WAYS> cache;
+        CacheEntry& entry = cache[id % CACHE_WAYS];
+        if (entry.lockId == id) return entry.shard;
+        lock_guard<mutex> g(shardsLock);
+        const thread::id self = this_thread::get_id();
+        auto it = find_if(shards.begin(), shards.end(), [&](const unique_ptr<Shard>& s) { return s->owner == self; });
+        if (it == shards.end()) it = shards.insert(shards.end(), make_unique<Shard>());
+        entry = {id, it->get()};
+        return entry.shard;
+    }
+
+    void acquired(Shard* shard, chrono::steady_clock::time_point start, bool wasContended) {
+        auto now = chrono::steady_clock::now();
+        uint64_t waitNs = static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(now - start).count());
+        bump(shard->acquisitions);
+        if (wasContended) bump(shard->contended);
+        bump(shard->waitNsTotal, waitNs);
+        bump(shard->waitHistogram[bucketOf(waitNs)]);
+        holder = shard;
+        holdStart = now;
+    }
+
+public:
+    explicit ProfiledMutex(string name) : lockName(std::move(name)), id(nextId()) {
+        LockRegistry::instance().add(this);
+    }
+    ~ProfiledMutex() { LockRegistry::instance().remove(this); }
+    ProfiledMutex(const ProfiledMutex&) = delete;
+    ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+    void lock() {
+        Shard* shard = localShard();
+        auto start = chrono::steady_clock::now();
+        bool wasContended = !inner.try_lock();
+        if (wasContended) inner.lock();
+        acquired(shard, start, wasContended);
+    }
+
+    bool try_lock() {
+        if (!inner.try_lock()) return false;
+        acquired(localShard(), chrono::steady_clock::now(), false);
+        return true;
+    }
+
+    void unlock() {
+        uint64_t holdNs = static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - holdStart).count());
+        Shard* shard = holder;
+        bump(shard->holdNsTotal, holdNs);
+        bump(shard->holdHistogram[bucketOf(holdNs)]);
+        inner.unlock();
+    }
+
+    LockStats stats() {
+        LockStats total;
+        total.name = lockName;
+        lock_guard<mutex> g(shardsLock);
+        for (const auto& shard : shards) {
+            total.acquisitions += shard->acquisitions.load(memory_order_relaxed);
+            total.contended += shard->contended.load(memory_order_relaxed);
+            total.waitNsTotal += shard->waitNsTotal.load(memory_order_relaxed);
+            total.holdNsTotal += shard->holdNsTotal.load(memory_order_relaxed);
+            for (size_t i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+                total.waitHistogram[i] += shard->waitHistogram[i].load(memory_order_relaxed);
+                total.holdHistogram[i] += shard->holdHistogram[i].load(memory_order_relaxed);
+            }
+        }
+        return total;
+    }
+
+    const string& name() const { return lockName; }
+};
+
+vector<LockStats> LockRegistry::snapshot() {
+    lock_guard<mutex> g(lock);
+    vector<LockStats> all;
+    for (ProfiledMutex* m : locks) all.push_back(m->stats());
+    return all;
+}
+
+void LockRegistry::report(ostream& out) {
+    auto all = snapshot();
+    sort(all.begin(), all.end(), [](const LockStats& a, const LockStats& b) { return a.waitNsTotal > b.waitNsTotal; });
+    for (const LockStats& s : all) {
+        double contendedPct = s.acquisitions ? 100.0 * s.contended / s.acquisitions : 0;
+        out << "  [" << s.name << "] acquisitions=" << s.acquisitions << " contended=" << s.contended
+            << " (" << contendedPct << "%) wait total=" << s.waitNsTotal / 1000 << "us p50<="
+            << LockStats::percentile(s.waitHistogram, 0.5) << "ns p99<=" << LockStats::percentile(s.waitHistogram, 0.99)
+            << "ns hold p50<=" << LockStats::percentile(s.holdHistogram, 0.5) << "ns p99<="
+            << LockStats::percentile(s.holdHistogram, 0.99) << "ns" << '\n';
+    }
+    out.flush();
+}
+#else
+// 계측 제거 빌드: 이름만 받고 std::mutex와 동일하게 동작
+class ProfiledMutex {
+    mutex inner;
+public:
+    explicit ProfiledMutex(const char*) {}
+    void lock() { inner.lock(); }
+    bool try_lock() { return inner.try_lock(); }
+    void unlock() { inner.unlock(); }
+};
+
+struct LockRegistry {
+    static LockRegistry& instance() { static LockRegistry registry; return registry; }
+    vector<LockStats> snapshot() { return {}; }
+    void report(ostream& out) { out << "  (LOCK_PROFILING=0: 계측 비활성)" << '\n'; }
+};
+#endif
+
 mutex mtx;
 
 void critical_section() {
@@ -10,9 +244,260 @@ void critical_section() {
     cout << "[Critical] 보호된 영역" << endl;
 }  // 자동 unlock
 
+static inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+/*
+ * AdaptiveMutex - spin 후 park (futex 3-상태 mutex)
+ *  - state: 0 = 해제, 1 = 잠김, 2 = 잠김 + 대기자 있음 (unlock이 깨워야 함)
+ *  - spin 예산은 자가 조정: spin으로 얻으면 늘리고, 결국 park하면 줄임 (glibc adaptive 방식)
+ *  - spin 중에는 pause 횟수를 지수적으로 늘려 캐시 라인 핑퐁을 줄임
+ *  - 코어가 하나면 spin 생략
+ */
+class AdaptiveMutex {
+    static constexpr int32_t MAX_SPIN = 2000;
+    static inline const bool multiCore = thread::hardware_concurrency() > 1;
+
+    atomic<int32_t> state{0};
+    atomic<int32_t> spinBudget{100};
+
+    void park() {
+#ifdef __linux__
+        syscall(SYS_futex, reinterpret_cast<int32_t*>(&state), FUTEX_WAIT_PRIVATE, 2, nullptr, nullptr, 0);
+#else
+        state.wait(2, memory_order_relaxed);
+#endif
+    }
+
+    void wakeOne() {
+#ifdef __linux__
+        syscall(SYS_futex, reinterpret_cast<int32_t*>(&state), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else
+        state.notify_one();
+#endif
+    }
+
+    void lockSlow() {
+        int32_t budget = multiCore ? spinBudget.load(memory_order_relaxed) : 0;
+        int32_t spins = 0;
+        for (int backoff = 1; spins < budget; backoff = min(backoff * 2, 64)) {
+            for (int i = 0; i < backoff; ++i) cpuRelax();
+            spins += backoff;
+            int32_t expected = 0;
+            if (state.load(memory_order_relaxed) == 0 &&
+                state.compare_exchange_weak(expected, 1, memory_order_acquire, memory_order_relaxed)) {
+                // spin으로 성공 → 예산을 사용량 쪽으로 (조금 여유 있게)
+                spinBudget.store(min(MAX_SPIN, budget + (spins * 2 - budget) / 8), memory_order_relaxed);
+                return;
+            }
+        }
+        if (multiCore) spinBudget.store(max(10, budget - budget / 8), memory_order_relaxed);   // spin 실패 → 예산 감소
+        while (state.exchange(2, memory_order_acquire) != 0) park();
+    }
+
+public:
+    void lock() {
+        int32_t expected = 0;
+        if (!state.compare_exchange_strong(expected, 1, memory_order_acquire, memory_order_relaxed)) lockSlow();
+    }
+    bool try_lock() {
+        int32_t expected = 0;
+        return state.compare_exchange_strong(expected, 1, memory_order_acquire, memory_order_relaxed);
+    }
+    void unlock() {
+        if (state.exchange(0, memory_order_release) == 2) wakeOne();
+    }
+};
+
+/*
+ * DistributedSharedMutex - reader 카운터를 여러 캐시 라인에 분산한 reader-writer lock
+ *  - reader는 자기 슬롯(스레드별로 고정, 코어 수만큼)에만 증감 → reader끼리 같은 라인을 두드리지 않음
+ *  - writer: writer 플래그를 세우고 모든 슬롯이 0이 될 때까지 대기 (writer가 드묾을 가정)
+ *  - reader가 writer 플래그를 보면 물러나고 플래그가 내려갈 때까지 대기 → writer 기아 방지
+ *  - slot은 스레드 id 해시로 고정: unlock_shared가 같은 카운터를 내리도록 (CPU 번호는 마이그레이션으로 바뀜)
+ *  - Dekker식 교차 확인: writer는 플래그 store → 슬롯 load, reader는 슬롯 증가 → 플래그 load
+ *    양쪽 모두 seq_cst여야 "서로 상대의 store를 못 보고 둘 다 진입"이 불가능 (acquire load로는 부족)
+ */
+class DistributedSharedMutex {
+    static constexpr size_t SLOTS = 16;
+    struct alignas(64) Slot { atomic<int32_t> readers{0}; };
+
+    array<Slot, SLOTS> slots;
+    alignas(64) atomic<bool> writer{false};
+    AdaptiveMutex writerLock;               // writer 간 직렬화
+
+    static size_t mySlot() {
+        thread_local const size_t slot = hash<thread::id>{}(this_thread::get_id()) % SLOTS;
+        return slot;
+    }
+
+public:
+    void lock_shared() {
+        atomic<int32_t>& readers = slots[mySlot()].readers;
+        for (;;) {
+            readers.fetch_add(1, memory_order_seq_cst);
+            if (!writer.load(memory_order_seq_cst)) return;
+            readers.fetch_sub(1, memory_order_release);    // writer 진행 중 → 물러남
+            writer.wait(true, memory_order_acquire);
+        }
+    }
+    bool try_lock_shared() {
+        atomic<int32_t>& readers = slots[mySlot()].readers;
+        readers.fetch_add(1, memory_order_seq_cst);
+        if (!writer.load(memory_order_seq_cst)) return true;
+        readers.fetch_sub(1, memory_order_release);
+        return false;
+    }
+    void unlock_shared() {
+        slots[mySlot()].readers.fetch_sub(1, memory_order_release);
+    }
+
+    void lock() {
+        writerLock.lock();
+        writer.store(true, memory_order_seq_cst);
+        for (const Slot& slot : slots) {
+            while (slot.readers.load(memory_order_seq_cst) != 0) this_thread::yield();
+        }
+    }
+    bool try_lock() {
+        if (!writerLock.try_lock()) return false;
+        writer.store(true, memory_order_seq_cst);
+        for (const Slot& slot : slots) {
+            if (slot.readers.load(memory_order_seq_cst) != 0) {
+                unlock();
+                return false;
+            }
+        }
+        return true;
+    }
+    void unlock() {
+        writer.store(false, memory_order_release);
+        writer.notify_all();
+        writerLock.unlock();
+    }
+};
+
+// 임계 구역 결과는 스레드 지역 acc에 모았다가 끝에 한 번 공개
+//  (shared_lock 아래 여러 reader가 전역 변수에 쓰면 그 자체가 data race)
+static atomic<long long> g_sink{0};
+
+static void criticalWork(int length, long long& acc) {
+    long long x = 0;
+    for (int i = 0; i < length; ++i) x += i;
+    acc += x;
+}
+
+// 4 스레드가 임계 구역 길이 length로 lock/unlock 반복
+template<typename Mutex>
+static double mutexOpsPerSec(int length) {
+    constexpr int THREADS = 4;
+    constexpr int OPS = 5000;
+    Mutex m;
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&]() {
+            long long acc = 0;
+            for (int i = 0; i < OPS; ++i) {
+                lock_guard<Mutex> guard(m);
+                criticalWork(length, acc);
+            }
+            g_sink.fetch_add(acc, memory_order_relaxed);
+        });
+    }
+    for (auto& w : workers) w.join();
+    return THREADS * OPS / chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// 8 스레드, 읽기 95% / 쓰기 5%
+template<typename SharedMutex>
+static double rwOpsPerSec(int length) {
+    constexpr int THREADS = 8;
+    constexpr int OPS = 5000;
+    SharedMutex m;
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&, t]() {
+            long long acc = 0;
+            for (int i = 0; i < OPS; ++i) {
+                if ((i + t) % 20 == 0) {
+                    lock_guard<SharedMutex> guard(m);
+                    criticalWork(length, acc);
+                } else {
+                    shared_lock<SharedMutex> guard(m);
+                    criticalWork(length, acc);
+                }
+            }
+            g_sink.fetch_add(acc, memory_order_relaxed);
+        });
+    }
+    for (auto& w : workers) w.join();
+    return THREADS * OPS / chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// 비경합 lock/unlock 비용 (ns)
+template<typename Mutex>
+static double uncontendedNs(Mutex& m) {
+    constexpr int ITERATIONS = 200000;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        lock_guard<Mutex> guard(m);
+    }
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / ITERATIONS;
+}
+
 int main() {
     cout << "=== C++ Mutex Guard ===" << endl;
     critical_section();
     cout << "자동 unlock 완료!" << endl;
+
+    cout << "\n=== Lock Contention Profiling ===" << endl;
+    ProfiledMutex configLock("config");
+    ProfiledMutex queueLock("work-queue");
+    long long queued = 0;           // queueLock이 보호
+    long long configReads = 0;      // configLock이 보호
+    vector<thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&]() {
+            for (int i = 0; i < 5000; ++i) {
+                {
+                    lock_guard<ProfiledMutex> guard(queueLock);     // std::mutex 자리에 그대로
+                    for (int k = 0; k < 50; ++k) queued += k;       // 긴 임계 구역 → 경합
+                }
+                if (i % 100 == 0) {
+                    lock_guard<ProfiledMutex> guard(configLock);
+                    configReads++;
+                }
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    LockRegistry::instance().report(cout);
+    cout << "  (queued " << queued << ", config reads " << configReads << ")" << endl;
+
+    mutex plain;
+    ProfiledMutex profiled("overhead");
+    cout << "  uncontended lock/unlock: std::mutex=" << uncontendedNs(plain)
+         << "ns ProfiledMutex=" << uncontendedNs(profiled) << "ns" << endl;
+
+    cout << "\n=== Adaptive Mutex vs std::mutex (4 threads, ops/sec) ===" << endl;
+    for (int length : {0, 50, 500}) {
+        cout << "  critical section " << length << " iters: std::mutex="
+             << static_cast<long long>(mutexOpsPerSec<mutex>(length)) << " adaptive="
+             << static_cast<long long>(mutexOpsPerSec<AdaptiveMutex>(length)) << endl;
+    }
+
+    cout << "\n=== Distributed RW Lock vs shared_mutex (8 threads, 95% reads, ops/sec) ===" << endl;
+    for (int length : {0, 50, 500}) {
+        cout << "  critical section " << length << " iters: shared_mutex="
+             << static_cast<long long>(rwOpsPerSec<shared_mutex>(length)) << " distributed="
+             << static_cast<long long>(rwOpsPerSec<DistributedSharedMutex>(length)) << endl;
+    }
     return 0;
 }
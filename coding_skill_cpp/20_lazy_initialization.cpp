@@ -1,24 +1,306 @@
 /* C++ Lazy Init - optional */
 #include <iostream>
 #include <optional>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
 using namespace std;
 
+/*
+ * Lazy<T> - 스레드 안전 1회 초기화
+ *  - 초기화 후 get(): acquire load 한 번 + 분기 (fast path)
+ *  - 첫 접근은 mutex 안에서 double-check 후 initializer 실행
+ *  - initializer가 예외를 던지면 상태는 미초기화로 남음 → 다음 get()에서 재시도
+ *  - prefetch(): 워커 스레드에서 미리 초기화, get()은 워밍이 안 끝났을 때만 대기
+ */
+template<typename T>
+class Lazy {
+    atomic<bool> ready{false};
+    alignas(T) unsigned char storage[sizeof(T)];
+    mutex initLock;
+    function<T()> initializer;
+    mutex warmLock;                 // warmer 시작 / 회수
+    thread warmer;
+    atomic<bool> warming{false};    // 워커가 아직 도는 중
+
+    T* object() { return launder(reinterpret_cast<T*>(storage)); }
+
+    T& initializeSlow() {
+        lock_guard<mutex> guard(initLock);
+        if (!ready.load(memory_order_relaxed)) {
+            ::new (static_cast<void*>(storage)) T(initializer());   // 예외 시 ready는 false 유지
+            ready.store(true, memory_order_release);
+        }
+        return *object();
+    }
+
+public:
+    explicit Lazy(function<T()> init) : initializer(std::move(init)) {}
+    ~Lazy() {
+        if (warmer.joinable()) warmer.join();
+        if (ready.load(memory_order_acquire)) object()->~T();
+    }
+    Lazy(const Lazy&) = delete;
+    Lazy& operator=(const Lazy&) = delete;
+
+    T& get() {
+        if (ready.load(memory_order_acquire)) [[likely]] return *object();
+        return initializeSlow();
+    }
+
+    // 백그라운드 워밍 시작 (동시에 여러 번 불러도 워커는 하나)
+    // 워커가 initLock을 잡고 있는 동안 get()은 그 mutex에서 대기 → 완료 즉시 진행
+    // 워밍이 실패하면 예외는 버리고, 다음 get()이 직접 재시도하거나 prefetch()를 다시 부르면 새 워커 시작
+    // (call_once였다면 실패한 뒤에도 플래그가 소모되어 다시 워밍할 수 없음)
+    void prefetch() {
+        if (ready.load(memory_order_acquire)) return;
+        lock_guard<mutex> guard(warmLock);
+        if (ready.load(memory_order_acquire) || warming.load(memory_order_acquire)) return;
+        if (warmer.joinable()) warmer.join();       // 실패하고 끝난 이전 워커
+        warming.store(true, memory_order_relaxed);
+        warmer = thread([this]() {
+            try { initializeSlow(); } catch (...) {}
+            warming.store(false, memory_order_release);
+        });
+    }
+
+    bool initialized() const { return ready.load(memory_order_acquire); }
+};
+
 class LazyResource {
-    optional<int> data;
+    Lazy<int> data{[]() {
+        cout << "[Lazy] 첫 접근! 초기화" << endl;
+        return 100;
+    }};
 public:
-    int& get() {
-        if (!data) {
-            cout << "[Lazy] 첫 접근! 초기화" << endl;
-            data = 100;
+    int& get() { return data.get(); }
+};
+
+// 정상 상태 접근 비용 비교 (초기화 이후)
+static int& viaLocalStatic() {
+    static int value = 42;      // 컴파일러가 guard 변수 + acquire load 생성
+    return value;
+}
+
+template<typename Get>
+static void benchmarkAccess(const char* name, Get get) {
+    constexpr int ITERATIONS = 5000000;
+    long long sum = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) sum += get();
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / ITERATIONS;
+    cout << "  " << name << ": " << ns << " ns/get (sum " << sum << ")" << endl;
+}
+
+/*
+ * StartupRegistry - 선언된 리소스를 의존 순서대로 병렬 워밍
+ *  - add(name, deps, warm): 의존하는 리소스 이름과 워밍 함수 등록
+ *  - warmAll(): 리소스마다 스레드 하나, 의존 리소스의 shared_future를 기다린 뒤 실행
+ *    → 독립 리소스는 동시에, 의존 체인은 순서대로
+ *  - 시작 전에 미등록 의존/순환을 검사 (invalid_argument)
+ *  - 워밍 실패는 의존하는 리소스로 전파되고, 모두 끝난 뒤 첫 예외를 다시 던짐
+ */
+class StartupRegistry {
+    struct Entry {
+        string name;
+        vector<string> deps;
+        function<void()> warm;
+    };
+    vector<Entry> entries;
+
+    size_t indexOf(const string& name) const {
+        for (size_t i = 0; i < entries.size(); ++i)
+            if (entries[i].name == name) return i;
+        throw invalid_argument("unknown startup resource: " + name);
+    }
+
+    // Kahn 위상 정렬로 순환 검사
+    void validate() const {
+        vector<int> pending(entries.size(), 0);
+        vector<vector<size_t>> dependents(entries.size());
+        for (size_t i = 0; i < entries.size(); ++i) {
+            for (const auto& dep : entries[i].deps) {
+                dependents[indexOf(dep)].push_back(i);
+                pending[i]++;
+            }
         }
-        return *data;
+        vector<size_t> readyList;
+        for (size_t i = 0; i < entries.size(); ++i)
+            if (pending[i] == 0) readyList.push_back(i);
+        size_t visited = 0;
+        while (!readyList.empty()) {
+            size_t i = readyList.back();
+            readyList.pop_back();
+            visited++;
+            for (size_t d : dependents[i])
+                if (--pending[d] == 0) readyList.push_back(d);
+        }
+        if (visited != entries.size()) throw invalid_argument("startup dependency cycle");
+    }
+
+public:
+    void add(string name, vector<string> deps, function<void()> warm) {
+        entries.push_back({std::move(name), std::move(deps), std::move(warm)});
+    }
+
+    void warmAll() {
+        validate();
+        vector<promise<void>> done(entries.size());
+        vector<shared_future<void>> finished;
+        for (auto& p : done) finished.push_back(p.get_future().share());
+
+        vector<thread> workers;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            vector<shared_future<void>> waitFor;
+            for (const auto& dep : entries[i].deps) waitFor.push_back(finished[indexOf(dep)]);
+            workers.emplace_back([this, i, &done, waitFor = std::move(waitFor)]() {
+                try {
+                    for (const auto& f : waitFor) f.get();      // 의존 실패 시 여기서 예외
+                    entries[i].warm();
+                    done[i].set_value();
+                } catch (...) {
+                    done[i].set_exception(current_exception());
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+        for (auto& f : finished) f.get();
+    }
+
+    // 비교용: 의존 순서대로 하나씩
+    void warmSequential() {
+        validate();
+        vector<bool> warmed(entries.size(), false);
+        function<void(size_t)> visit = [&](size_t i) {
+            if (warmed[i]) return;
+            for (const auto& dep : entries[i].deps) visit(indexOf(dep));
+            entries[i].warm();
+            warmed[i] = true;
+        };
+        for (size_t i = 0; i < entries.size(); ++i) visit(i);
     }
 };
 
+static double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// 초기화에 ms만큼 걸리는 가짜 리소스
+static function<string()> slowInit(const char* name, int ms) {
+    return [name, ms]() {
+        this_thread::sleep_for(chrono::milliseconds(ms));
+        return string(name);
+    };
+}
+
 int main() {
     cout << "=== C++ Lazy Initialization ===" << endl;
     LazyResource res;
     cout << "1st access: " << res.get() << endl;
     cout << "2nd access: " << res.get() << endl;
+
+    cout << "\n=== Lazy<T>: concurrent first access ===" << endl;
+    atomic<int> initCount{0};
+    Lazy<vector<int>> table([&initCount]() {
+        initCount++;
+        this_thread::sleep_for(chrono::milliseconds(1));   // 느린 초기화 중 다른 스레드 진입
+        return vector<int>(1000, 7);
+    });
+    vector<thread> readers;
+    atomic<long long> total{0};
+    for (int t = 0; t < 8; ++t) readers.emplace_back([&, t]() { total += table.get()[t]; });
+    for (auto& r : readers) r.join();
+    cout << "8 threads, initializer ran " << initCount << " time(s), total=" << total << endl;
+
+    cout << "\n=== Lazy<T>: failing initializer retried ===" << endl;
+    int attempts = 0;
+    Lazy<string> config([&attempts]() -> string {
+        if (++attempts < 3) throw runtime_error("config server unavailable");
+        return "loaded";
+    });
+    for (int i = 0; i < 3; ++i) {
+        try {
+            const string& value = config.get();     // 먼저 평가 → 실패 시 "get(): "가 미리 찍히지 않음
+            cout << "get(): " << value << " (attempt " << attempts << ")" << endl;
+        } catch (const exception& e) {
+            cout << "get() failed: " << e.what() << " (attempt " << attempts << ")" << endl;
+        }
+    }
+
+    cout << "\n=== Benchmark: steady-state access ===" << endl;
+    Lazy<int> lazyValue([]() { return 42; });
+    lazyValue.get();
+    once_flag onceFlag;
+    int onceValue = 0;
+    benchmarkAccess("Lazy<T>          ", [&]() { return lazyValue.get(); });
+    benchmarkAccess("std::call_once   ", [&]() -> int& {
+        call_once(onceFlag, [&]() { onceValue = 42; });
+        return onceValue;
+    });
+    benchmarkAccess("function static  ", []() { return viaLocalStatic(); });
+
+    cout << "\n=== Lazy<T>::prefetch (background warm) ===" << endl;
+    {
+        Lazy<string> cold(slowInit("cold", 30));
+        auto start = chrono::steady_clock::now();
+        cold.get();
+        cout << "no prefetch : first get() " << elapsedMs(start) << " ms" << endl;
+
+        Lazy<string> warm(slowInit("warm", 30));
+        warm.prefetch();
+        this_thread::sleep_for(chrono::milliseconds(20));   // 그동안 다른 시작 작업
+        start = chrono::steady_clock::now();
+        warm.get();
+        cout << "prefetch    : first get() " << elapsedMs(start) << " ms (after 20ms of other work)" << endl;
+
+        int warmAttempts = 0;
+        Lazy<string> flaky([&warmAttempts]() -> string {
+            if (++warmAttempts == 1) throw runtime_error("backend warming up");
+            return "flaky ready";
+        });
+        for (int i = 0; i < 100 && !flaky.initialized(); ++i) {     // 첫 워밍 실패 후 다시 prefetch
+            flaky.prefetch();
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        cout << "failed warm : retried by prefetch(), initialized=" << boolalpha << flaky.initialized() << noboolalpha
+             << " after " << warmAttempts << " attempts" << endl;
+    }
+
+    cout << "\n=== StartupRegistry (dependency-ordered parallel warm) ===" << endl;
+    for (bool parallel : {false, true}) {
+        Lazy<string> config(slowInit("config", 20));
+        Lazy<string> database(slowInit("database", 30));
+        Lazy<string> cache(slowInit("cache", 30));
+        Lazy<string> templates(slowInit("templates", 30));
+        StartupRegistry registry;
+        registry.add("database", {"config"}, [&]() { database.get(); });
+        registry.add("cache", {"config"}, [&]() { cache.get(); });
+        registry.add("config", {}, [&]() { config.get(); });
+        registry.add("templates", {}, [&]() { templates.get(); });
+        auto start = chrono::steady_clock::now();
+        if (parallel) registry.warmAll();
+        else registry.warmSequential();
+        cout << (parallel ? "parallel  " : "sequential") << ": startup " << elapsedMs(start) << " ms, all ready="
+             << (config.initialized() && database.initialized() && cache.initialized() && templates.initialized())
+             << endl;
+    }
+
+    StartupRegistry broken;
+    broken.add("a", {"b"}, []() {});
+    broken.add("b", {"a"}, []() {});
+    try {
+        broken.warmAll();
+    } catch (const invalid_argument& e) {
+        cout << "cycle rejected: " << e.what() << endl;
+    }
     return 0;
 }
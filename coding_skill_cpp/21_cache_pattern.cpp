@@ -1,28 +1,1361 @@
 /* C++ Cache - unordered_map */
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#ifdef __unix__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 using namespace std;
 
-class Cache {
-    unordered_map<int, int> cache;
+/*
+ * FlatHashMap - open addressing (Swiss table 방식)
+ *  - 슬롯 배열 하나 + 슬롯마다 control byte 1개 (EMPTY / DELETED / 해시 하위 7비트)
+ *  - 16개 control byte를 한 그룹으로 SSE2 비교 → 후보 슬롯만 키 비교
+ *  - 그룹 단위 triangular probing, EMPTY가 있는 그룹에서 탐색 종료
+ *  - 노드 할당 없음: int→int면 엔트리당 8바이트 + control 1바이트 (load factor 7/8)
+ *  - unordered_map 부분 API(find/end/operator[]/erase/iterator) 제공 → Cache 저장소로 교체 가능
+ */
+template<typename K, typename V, typename Hash = hash<K>>
+class FlatHashMap {
+    static constexpr size_t GROUP = 16;
+    static constexpr int8_t EMPTY = -128;       // 0x80
+    static constexpr int8_t DELETED = -2;       // 0xFE
+    using Slot = pair<K, V>;
+
+    int8_t* ctrl = nullptr;
+    Slot* slots = nullptr;
+    size_t capacity = 0;        // 슬롯 수 (GROUP의 2의 거듭제곱 배)
+    size_t count = 0;
+    size_t tombstones = 0;
+
+    static uint64_t mix(const K& key) {
+        uint64_t h = Hash{}(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+    static int8_t h2(uint64_t h) { return static_cast<int8_t>(h & 0x7F); }
+
+    // 그룹 안에서 control byte == value인 위치의 비트마스크
+    static uint32_t match(const int8_t* group, int8_t value) {
+#if defined(__SSE2__)
+        __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8(value))));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < GROUP; ++i) mask |= static_cast<uint32_t>(group[i] == value) << i;
+        return mask;
+#endif
+    }
+    // EMPTY 또는 DELETED (둘 다 최상위 비트가 1)
+    static uint32_t matchFree(const int8_t* group) {
+#if defined(__SSE2__)
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < GROUP; ++i) mask |= static_cast<uint32_t>(group[i] < 0) << i;
+        return mask;
+#endif
+    }
+
+    size_t groupMask() const { return capacity / GROUP - 1; }
+
+    Slot* findSlot(const K& key) const {
+        if (count == 0) return nullptr;
+        uint64_t h = mix(key);
+        size_t g = (h >> 7) & groupMask();
+        for (size_t step = 1;; ++step) {
+            const int8_t* group = ctrl + g * GROUP;
+            for (uint32_t m = match(group, h2(h)); m; m &= m - 1) {
+                Slot* slot = slots + g * GROUP + countr_zero(m);
+                if (slot->first == key) return slot;
+            }
+            if (match(group, EMPTY)) return nullptr;
+            g = (g + step) & groupMask();
+        }
+    }
+
+    // 키가 없다는 전제로 빈 자리 찾기
+    size_t findInsertPosition(uint64_t h) const {
+        size_t g = (h >> 7) & groupMask();
+        for (size_t step = 1;; ++step) {
+            if (uint32_t m = matchFree(ctrl + g * GROUP)) return g * GROUP + countr_zero(m);
+            g = (g + step) & groupMask();
+        }
+    }
+
+    void allocate(size_t slotCount) {
+        capacity = slotCount;
+        ctrl = static_cast<int8_t*>(::operator new(capacity));
+        memset(ctrl, EMPTY, capacity);
+        slots = static_cast<Slot*>(::operator new(capacity * sizeof(Slot), align_val_t{alignof(Slot)}));
+    }
+
+    void release() {
+        if (!ctrl) return;
+        for (size_t i = 0; i < capacity; ++i)
+            if (ctrl[i] >= 0) slots[i].~Slot();
+        ::operator delete(ctrl);
+        ::operator delete(slots, align_val_t{alignof(Slot)});
+        ctrl = nullptr;
+        slots = nullptr;
+    }
+
+    void rehash(size_t slotCount) {
+        int8_t* oldCtrl = ctrl;
+        Slot* oldSlots = slots;
+        size_t oldCapacity = capacity;
+        allocate(slotCount);
+        tombstones = 0;
+        for (size_t i = 0; i < oldCapacity; ++i) {
+            if (oldCtrl[i] < 0) continue;
+            uint64_t h = mix(oldSlots[i].first);
+            size_t pos = findInsertPosition(h);
+            ctrl[pos] = h2(h);
+            ::new (slots + pos) Slot(std::move(oldSlots[i]));
+            oldSlots[i].~Slot();
+        }
+        if (oldCtrl) {
+            ::operator delete(oldCtrl);
+            ::operator delete(oldSlots, align_val_t{alignof(Slot)});
+        }
+    }
+
+    // 삽입 전 load factor(7/8) 유지, tombstone이 많으면 같은 크기로 정리
+    void reserveOneMore() {
+        if (capacity == 0) { allocate(GROUP); return; }
+        if ((count + tombstones + 1) * 8 <= capacity * 7) return;
+        rehash((count + 1) * 8 > capacity * 7 / 2 ? capacity * 2 : capacity);
+    }
+
 public:
-    bool get(int key, int& value) {
+    class iterator {
+        friend class FlatHashMap;
+        const FlatHashMap* map = nullptr;
+        size_t pos = 0;
+        iterator(const FlatHashMap* map, size_t pos) : map(map), pos(pos) { skipFree(); }
+        void skipFree() { while (map && pos < map->capacity && map->ctrl[pos] < 0) ++pos; }
+    public:
+        iterator() = default;
+        Slot& operator*() const { return map->slots[pos]; }
+        Slot* operator->() const { return map->slots + pos; }
+        iterator& operator++() { ++pos; skipFree(); return *this; }
+        bool operator==(const iterator& other) const { return pos == other.pos; }
+    };
+
+    FlatHashMap() = default;
+    ~FlatHashMap() { release(); }
+    FlatHashMap(const FlatHashMap&) = delete;
+    FlatHashMap& operator=(const FlatHashMap&) = delete;
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, capacity); }
+
+    iterator find(const K& key) const {
+        Slot* slot = findSlot(key);
+        return slot ? iterator(this, static_cast<size_t>(slot - slots)) : end();
+    }
+
+    V& operator[](const K& key) {
+        if (Slot* slot = findSlot(key)) return slot->second;
+        reserveOneMore();
+        uint64_t h = mix(key);
+        size_t pos = findInsertPosition(h);
+        if (ctrl[pos] == DELETED) tombstones--;
+        ctrl[pos] = h2(h);
+        ::new (slots + pos) Slot(key, V{});
+        count++;
+        return slots[pos].second;
+    }
+
+    bool erase(const K& key) {
+        Slot* slot = findSlot(key);
+        if (!slot) return false;
+        size_t pos = static_cast<size_t>(slot - slots);
+        slot->~Slot();
+        // 그룹에 EMPTY가 이미 있으면 이 그룹을 지나간 probe가 없음 → EMPTY로 되돌려도 안전
+        if (match(ctrl + pos / GROUP * GROUP, EMPTY)) {
+            ctrl[pos] = EMPTY;
+        } else {
+            ctrl[pos] = DELETED;
+            tombstones++;
+        }
+        count--;
+        return true;
+    }
+
+    void reserve(size_t entries) {
+        size_t needed = bit_ceil(max(GROUP, (entries * 8 + 6) / 7));
+        if (needed > capacity) rehash(needed);
+    }
+
+    size_t size() const { return count; }
+    size_t memoryBytes() const { return capacity * (1 + sizeof(Slot)); }
+};
+
+/*
+ * TTL
+ *  - hard: 지나면 엔트리 없음 취급 (조회 시점에 지움 = lazy expiry)
+ *  - soft: 지나면 stale 값을 그대로 돌려주면서 백그라운드 refresh 1회 시작
+ *  - 0 = 만료 없음
+ */
+struct Ttl {
+    chrono::milliseconds soft{0};
+    chrono::milliseconds hard{0};
+};
+
+struct CacheEntry {
+    using Clock = chrono::steady_clock;
+    int value = 0;
+    Clock::time_point softExpiry = Clock::time_point::max();
+    Clock::time_point hardExpiry = Clock::time_point::max();
+};
+
+struct CacheCounters {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t warmHits = 0;          // 저장소에는 없고 스냅샷(warm tier)에서 찾은 hit
+    uint64_t coalescedWaits = 0;    // 다른 스레드의 load를 기다린 miss
+    uint64_t staleHits = 0;         // soft TTL이 지난 값을 돌려준 hit
+    uint64_t expirations = 0;
+    uint64_t loads = 0;
+    uint64_t loadFailures = 0;
+    uint64_t loadNanos = 0;
+    double averageLoadMs() const { return loads ? loadNanos / 1e6 / loads : 0.0; }
+};
+
+/*
+ * CacheSnapshot - 재시작 직후 바로 읽는 읽기 전용 캐시 이미지 (파일 하나)
+ *  - 레이아웃: SnapshotHeader | ctrl[slotCount] | (8바이트 정렬) | SnapshotSlot[slotCount]
+ *  - 파일 자체가 open addressing 테이블 → open은 mmap 한 번, 역직렬화/재삽입 없음
+ *  - ctrl: 0 = 빈 슬롯, 0x80 | 해시 상위 7비트 = 사용 중 (linear probing, load factor ≤ 1/2)
+ *  - TTL은 steady_clock이 프로세스마다 달라서 wall clock(unix ms)으로 저장, 0 = 만료 없음
+ *  - 쓰기: 임시 파일 → fsync → rename, 읽는 쪽은 항상 완전한 옛 파일이나 새 파일 하나를 봄
+ *  - open 검증은 헤더 checksum + 파일 크기만 (본문을 다 읽으면 mmap으로 얻는 시간이 사라짐)
+ */
+struct SnapshotHeader {
+    static constexpr uint32_t MAGIC = 0x314E5343;       // "CSN1"
+    static constexpr uint32_t VERSION = 1;
+    uint32_t magic;
+    uint32_t version;
+    uint64_t slotCount;
+    uint64_t entryCount;
+    uint64_t generation;
+    int64_t createdUnixMs;
+    uint64_t checksum;          // 앞 필드들의 FNV-1a
+};
+
+struct SnapshotSlot {
+    int32_t key;
+    int32_t value;
+    int64_t softUnixMs;
+    int64_t hardUnixMs;
+};
+static_assert(sizeof(SnapshotHeader) == 48 && sizeof(SnapshotSlot) == 24, "on-disk layout");
+
+class CacheSnapshot {
+    using Clock = CacheEntry::Clock;
+
+    const char* base = nullptr;
+    size_t bytes = 0;
+    bool mapped = false;
+    vector<char> owned;         // mmap이 없는 플랫폼: 파일을 통째로 읽어 둠
+    const SnapshotHeader* header = nullptr;
+    const uint8_t* ctrl = nullptr;
+    const SnapshotSlot* slots = nullptr;
+    // unix ms ↔ steady_clock 변환 기준 (open 시점에 한 번 잡음)
+    Clock::time_point steadyBase;
+    int64_t unixBase = 0;
+
+    CacheSnapshot() = default;
+
+    static uint64_t hashKey(int32_t key) {
+        uint64_t h = static_cast<uint32_t>(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+    static uint8_t tagOf(uint64_t h) { return static_cast<uint8_t>(0x80 | (h >> 57)); }
+    static size_t slotsOffset(uint64_t slotCount) { return (sizeof(SnapshotHeader) + slotCount + 7) & ~size_t{7}; }
+    static size_t fileBytes(uint64_t slotCount) { return slotsOffset(slotCount) + slotCount * sizeof(SnapshotSlot); }
+
+    static uint64_t checksumOf(const SnapshotHeader& h) {
+        const auto* p = reinterpret_cast<const uint8_t*>(&h);
+        uint64_t sum = 0xcbf29ce484222325ULL;
+        for (size_t i = 0; i < offsetof(SnapshotHeader, checksum); ++i) sum = (sum ^ p[i]) * 0x100000001b3ULL;
+        return sum;
+    }
+
+    static int64_t unixNowMs() {
+        return chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
+    }
+    static int64_t toUnixMs(Clock::time_point t, Clock::time_point steadyNow, int64_t unixNow) {
+        if (t == Clock::time_point::max()) return 0;
+        return unixNow + chrono::duration_cast<chrono::milliseconds>(t - steadyNow).count();
+    }
+    Clock::time_point toSteady(int64_t unixMs) const {
+        return unixMs == 0 ? Clock::time_point::max() : steadyBase + chrono::milliseconds(unixMs - unixBase);
+    }
+
+    static bool fail(string* error, string why) {
+        if (error) *error = move(why);
+        return false;
+    }
+
+    // 열린 바이트 열이 이 버전의 레이아웃인지 확인하고 포인터를 잡음
+    bool bind(string* error) {
+        if (bytes < sizeof(SnapshotHeader)) return fail(error, "file smaller than header");
+        header = reinterpret_cast<const SnapshotHeader*>(base);
+        if (header->magic != SnapshotHeader::MAGIC) return fail(error, "bad magic");
+        if (header->version != SnapshotHeader::VERSION) return fail(error, "version mismatch");
+        if (header->checksum != checksumOf(*header)) return fail(error, "header checksum mismatch");
+        // 곱셈 넘침 방지: entryCount * 2 대신 slotCount / 2, slotCount는 파일 크기로 먼저 묶음
+        if (!has_single_bit(header->slotCount) || header->slotCount > bytes || header->entryCount > header->slotCount / 2)
+            return fail(error, "bad slot count");
+        if (bytes != fileBytes(header->slotCount)) return fail(error, "size mismatch");
+        ctrl = reinterpret_cast<const uint8_t*>(base + sizeof(SnapshotHeader));
+        slots = reinterpret_cast<const SnapshotSlot*>(base + slotsOffset(header->slotCount));
+        steadyBase = Clock::now();
+        unixBase = unixNowMs();
+        return true;
+    }
+
+    const SnapshotSlot* findSlot(int key) const {
+        uint64_t h = hashKey(key);
+        uint8_t tag = tagOf(h);
+        size_t mask = header->slotCount - 1;
+        size_t pos = h & mask;
+        // 빈 ctrl 바이트가 없는 손상된 파일에서도 끝나도록 slotCount번까지만 탐색
+        for (uint64_t probe = 0; probe < header->slotCount && ctrl[pos]; ++probe, pos = (pos + 1) & mask)
+            if (ctrl[pos] == tag && slots[pos].key == key) return slots + pos;
+        return nullptr;
+    }
+
+public:
+    ~CacheSnapshot() {
+#ifdef __unix__
+        if (mapped) munmap(const_cast<char*>(base), bytes);
+#endif
+    }
+    CacheSnapshot(const CacheSnapshot&) = delete;
+    CacheSnapshot& operator=(const CacheSnapshot&) = delete;
+
+    // 파일을 읽기 전용으로 매핑 (페이지는 처음 조회될 때 들어옴)
+    static shared_ptr<const CacheSnapshot> open(const string& path, string* error = nullptr) {
+        shared_ptr<CacheSnapshot> snapshot(new CacheSnapshot());
+#ifdef __unix__
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) { fail(error, "open: " + string(strerror(errno))); return nullptr; }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close(fd);
+            fail(error, "empty or unreadable file");
+            return nullptr;
+        }
+        snapshot->bytes = static_cast<size_t>(st.st_size);
+        void* addr = mmap(nullptr, snapshot->bytes, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED) { fail(error, "mmap: " + string(strerror(errno))); return nullptr; }
+        madvise(addr, snapshot->bytes, MADV_WILLNEED);      // 읽어 오기는 커널이 백그라운드로
+        snapshot->base = static_cast<const char*>(addr);
+        snapshot->mapped = true;
+#else
+        ifstream in(path, ios::binary);
+        if (!in) { fail(error, "open failed"); return nullptr; }
+        snapshot->owned.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+        snapshot->base = snapshot->owned.data();
+        snapshot->bytes = snapshot->owned.size();
+#endif
+        if (!snapshot->bind(error)) return nullptr;
+        return snapshot;
+    }
+
+    // entries(키 중복 없음)로 새 스냅샷 파일을 만들어 path를 원자적으로 교체
+    static bool write(const string& path, const vector<pair<int, CacheEntry>>& entries, uint64_t generation,
+                      string* error = nullptr) {
+        uint64_t slotCount = bit_ceil(max<uint64_t>(16, entries.size() * 2));
+        vector<char> image(fileBytes(slotCount), 0);
+        auto* h = reinterpret_cast<SnapshotHeader*>(image.data());
+        auto* ctrlOut = reinterpret_cast<uint8_t*>(image.data() + sizeof(SnapshotHeader));
+        auto* slotsOut = reinterpret_cast<SnapshotSlot*>(image.data() + slotsOffset(slotCount));
+        auto steadyNow = Clock::now();
+        int64_t unixNow = unixNowMs();
+        for (const auto& [key, entry] : entries) {
+            uint64_t hash = hashKey(key);
+            size_t pos = hash & (slotCount - 1);
+            while (ctrlOut[pos]) pos = (pos + 1) & (slotCount - 1);
+            ctrlOut[pos] = tagOf(hash);
+            slotsOut[pos] = {key, entry.value, toUnixMs(entry.softExpiry, steadyNow, unixNow),
+                             toUnixMs(entry.hardExpiry, steadyNow, unixNow)};
+        }
+        *h = {SnapshotHeader::MAGIC, SnapshotHeader::VERSION, slotCount, entries.size(), generation, unixNow, 0};
+        h->checksum = checksumOf(*h);
+
+        string temp = path + ".tmp";
+        FILE* out = fopen(temp.c_str(), "wb");
+        if (!out) return fail(error, "fopen: " + string(strerror(errno)));
+        bool ok = fwrite(image.data(), 1, image.size(), out) == image.size() && fflush(out) == 0;
+#ifdef __unix__
+        ok = ok && fsync(fileno(out)) == 0;
+#endif
+        ok = fclose(out) == 0 && ok;
+        error_code ec;
+        if (ok) filesystem::rename(temp, path, ec);
+        if (!ok || ec) {
+            filesystem::remove(temp, ec);
+            return fail(error, "write failed");
+        }
+        return true;
+    }
+
+    bool find(int key, CacheEntry& entry) const {
+        const SnapshotSlot* slot = findSlot(key);
+        if (!slot) return false;
+        entry.value = slot->value;
+        entry.softExpiry = toSteady(slot->softUnixMs);
+        entry.hardExpiry = toSteady(slot->hardUnixMs);
+        return true;
+    }
+    bool contains(int key) const { return findSlot(key) != nullptr; }
+
+    // fn(key, entry) - 슬롯 순서대로
+    template<typename Fn>
+    void forEach(Fn&& fn) const {
+        for (size_t pos = 0; pos < header->slotCount; ++pos) {
+            if (!ctrl[pos]) continue;
+            CacheEntry entry;
+            entry.value = slots[pos].value;
+            entry.softExpiry = toSteady(slots[pos].softUnixMs);
+            entry.hardExpiry = toSteady(slots[pos].hardUnixMs);
+            fn(static_cast<int>(slots[pos].key), entry);
+        }
+    }
+
+    size_t size() const { return header->entryCount; }
+    uint64_t generation() const { return header->generation; }
+    size_t fileSize() const { return bytes; }
+};
+
+/*
+ * BasicCache - 스레드 안전 int→int 캐시
+ *  - get_or_load(key, loader): 같은 키의 동시 miss는 in-flight load 하나를 공유 (stampede 방지)
+ *  - loader 예외는 기다리던 모두에게 전달, 엔트리는 저장하지 않음 → 다음 호출이 다시 load
+ *  - 저장소(Storage)는 int→CacheEntry 맵이면 교체 가능 (unordered_map / FlatHashMap)
+ *  - attachSnapshot: 저장소 miss 시 스냅샷(warm tier)을 조회, 찾은 키만 저장소로 올림
+ *  - trackChanges/takeChanges: 바뀐 키만 모아 두었다가 SnapshotWriter에 넘김 (증분 스냅샷)
+ */
+template<typename Storage = unordered_map<int, CacheEntry>>
+class BasicCache {
+    using Clock = CacheEntry::Clock;
+    using Loader = function<int()>;
+
+    mutable mutex lock;
+    Storage cache;
+    unordered_map<int, shared_future<int>> inFlight;
+    vector<future<void>> refreshes;         // 소멸자에서 모두 기다림
+    shared_ptr<const CacheSnapshot> warm;   // 재시작 후 읽기 전용 tier
+    unordered_set<int> shadowed;            // warm에 있지만 저장소에서 만료된 키 → 옛 값으로 되살리지 않음
+    bool tracking = false;
+    unordered_map<int, optional<CacheEntry>> dirty;     // 마지막 takeChanges 이후 바뀐 키 (nullopt = 삭제)
+    struct {
+        atomic<uint64_t> hits{0}, misses{0}, warmHits{0}, coalescedWaits{0}, staleHits{0};
+        atomic<uint64_t> expirations{0}, loads{0}, loadFailures{0}, loadNanos{0};
+    } stats;
+
+    static CacheEntry makeEntry(int value, Ttl ttl) {
+        CacheEntry entry;
+        entry.value = value;
+        auto now = Clock::now();
+        if (ttl.soft.count() > 0) entry.softExpiry = now + ttl.soft;
+        if (ttl.hard.count() > 0) entry.hardExpiry = now + ttl.hard;
+        return entry;
+    }
+
+    // lock 보유 상태
+    void store(int key, const CacheEntry& entry) {
+        cache[key] = entry;
+        if (tracking) dirty[key] = entry;
+    }
+
+    // lock 보유 상태, 스냅샷에서 찾으면 저장소로 올림 (스냅샷에 이미 있으므로 dirty 아님)
+    CacheEntry* promoteWarm(int key, Clock::time_point now) {
+        CacheEntry entry;
+        if (!shadowed.empty() && shadowed.count(key)) return nullptr;
+        if (!warm->find(key, entry) || entry.hardExpiry <= now) return nullptr;
+        stats.warmHits.fetch_add(1, memory_order_relaxed);
+        CacheEntry& slot = cache[key];
+        slot = entry;
+        return &slot;
+    }
+
+    // lock 보유 상태, hard TTL이 지난 엔트리는 여기서 지움
+    CacheEntry* findLive(int key, Clock::time_point now) {
         auto it = cache.find(key);
-        if (it != cache.end()) {
-            value = it->second;
-            cout << "[Cache] Hit: " << key << endl;
+        if (it == cache.end()) return warm ? promoteWarm(key, now) : nullptr;
+        if (it->second.hardExpiry <= now) {
+            cache.erase(key);
+            stats.expirations.fetch_add(1, memory_order_relaxed);
+            if (tracking) dirty[key] = nullopt;
+            if (warm && warm->contains(key)) shadowed.insert(key);
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    // lock 없이 호출, 결과를 저장하고 in-flight 표시를 지움
+    int runLoad(int key, const Loader& loader, Ttl ttl, promise<int>& result) {
+        auto start = Clock::now();
+        try {
+            int value = loader();
+            stats.loads.fetch_add(1, memory_order_relaxed);
+            stats.loadNanos.fetch_add(chrono::duration_cast<chrono::nanoseconds>(Clock::now() - start).count(),
+                                      memory_order_relaxed);
+            {
+                lock_guard<mutex> guard(lock);
+                store(key, makeEntry(value, ttl));
+                inFlight.erase(key);
+            }
+            result.set_value(value);
+            return value;
+        } catch (...) {
+            stats.loadFailures.fetch_add(1, memory_order_relaxed);
+            {
+                lock_guard<mutex> guard(lock);
+                inFlight.erase(key);
+            }
+            result.set_exception(current_exception());
+            throw;
+        }
+    }
+
+public:
+    BasicCache() = default;
+    ~BasicCache() {
+        for (auto& r : refreshes) r.wait();
+    }
+    BasicCache(const BasicCache&) = delete;
+    BasicCache& operator=(const BasicCache&) = delete;
+
+    bool get(int key, int& value) {
+        lock_guard<mutex> guard(lock);
+        if (CacheEntry* entry = findLive(key, Clock::now())) {
+            value = entry->value;
+            stats.hits.fetch_add(1, memory_order_relaxed);
             return true;
         }
-        cout << "[Cache] Miss: " << key << endl;
+        stats.misses.fetch_add(1, memory_order_relaxed);
         return false;
     }
     
-    void put(int key, int value) {
-        cache[key] = value;
+    void put(int key, int value, Ttl ttl = {}) {
+        lock_guard<mutex> guard(lock);
+        store(key, makeEntry(value, ttl));
+    }
+
+    int get_or_load(int key, Loader loader, Ttl ttl = {}) {
+        unique_lock<mutex> guard(lock);
+        auto now = Clock::now();
+        if (CacheEntry* entry = findLive(key, now)) {
+            stats.hits.fetch_add(1, memory_order_relaxed);
+            if (entry->softExpiry <= now) {
+                stats.staleHits.fetch_add(1, memory_order_relaxed);
+                // 이미 refresh 중이 아니면 백그라운드 load 시작, 호출자는 stale 값으로 즉시 반환
+                if (!inFlight.count(key)) {
+                    erase_if(refreshes, [](const future<void>& r) {
+                        return r.wait_for(chrono::seconds(0)) == future_status::ready;
+                    });
+                    auto result = make_shared<promise<int>>();
+                    inFlight.emplace(key, result->get_future().share());
+                    refreshes.push_back(async(launch::async, [this, key, loader, ttl, result]() {
+                        try { runLoad(key, loader, ttl, *result); } catch (...) {}
+                    }));
+                }
+            }
+            return entry->value;
+        }
+
+        auto pending = inFlight.find(key);
+        if (pending != inFlight.end()) {
+            stats.coalescedWaits.fetch_add(1, memory_order_relaxed);
+            shared_future<int> shared = pending->second;
+            guard.unlock();
+            return shared.get();        // loader 예외도 여기서 다시 던져짐
+        }
+
+        stats.misses.fetch_add(1, memory_order_relaxed);
+        promise<int> result;
+        inFlight.emplace(key, result.get_future().share());
+        guard.unlock();
+        return runLoad(key, loader, ttl, result);
+    }
+
+    // null이면 warm tier 해제, 새 스냅샷으로 바꾸면 거기 없는 shadowed 키는 더 기억할 필요 없음
+    void attachSnapshot(shared_ptr<const CacheSnapshot> snapshot) {
+        lock_guard<mutex> guard(lock);
+        warm = move(snapshot);
+        if (!warm) shadowed.clear();
+        else erase_if(shadowed, [this](int key) { return !warm->contains(key); });
+    }
+
+    // 변경 추적 시작, 이미 저장소에 있는 엔트리도 한 번은 스냅샷에 들어가도록 dirty 표시
+    void trackChanges() {
+        lock_guard<mutex> guard(lock);
+        if (tracking) return;
+        tracking = true;
+        for (auto it = cache.begin(); it != cache.end(); ++it) dirty[it->first] = it->second;
+    }
+
+    // 바뀐 키를 넘겨받음, lock은 swap하는 동안만
+    unordered_map<int, optional<CacheEntry>> takeChanges() {
+        unordered_map<int, optional<CacheEntry>> changes;
+        lock_guard<mutex> guard(lock);
+        changes.swap(dirty);
+        return changes;
+    }
+
+    CacheCounters counters() const {
+        CacheCounters c;
+        c.hits = stats.hits.load(memory_order_relaxed);
+        c.misses = stats.misses.load(memory_order_relaxed);
+        c.warmHits = stats.warmHits.load(memory_order_relaxed);
+        c.coalescedWaits = stats.coalescedWaits.load(memory_order_relaxed);
+        c.staleHits = stats.staleHits.load(memory_order_relaxed);
+        c.expirations = stats.expirations.load(memory_order_relaxed);
+        c.loads = stats.loads.load(memory_order_relaxed);
+        c.loadFailures = stats.loadFailures.load(memory_order_relaxed);
+        c.loadNanos = stats.loadNanos.load(memory_order_relaxed);
+        return c;
     }
 };
 
-int main() {
+using Cache = BasicCache<>;
+using FlatCache = BasicCache<FlatHashMap<int, CacheEntry>>;
+
+struct SnapshotStats {
+    uint64_t snapshots = 0;     // 이 writer가 쓴 파일 수
+    uint64_t generation = 0;
+    size_t entries = 0;         // 마지막 스냅샷의 엔트리 수
+    size_t changed = 0;         // 마지막 스냅샷에 합친 바뀐 키 수
+    size_t bytes = 0;
+    double lastWriteMs = 0.0;
+    string lastError;
+};
+
+/*
+ * SnapshotWriter - 백그라운드 증분 스냅샷
+ *  - interval마다 cache.takeChanges()로 바뀐 키만 받아 옴 → 캐시 lock은 swap 순간만, 읽기는 계속됨
+ *  - 이전 스냅샷(mmap) + 바뀐 키를 합쳐 새 파일을 쓰고 rename (캐시 전체를 lock 잡고 훑지 않음)
+ *  - 새 파일을 다시 매핑해 캐시의 warm tier로 교체, 만료/삭제된 키는 새 파일에서 빠짐
+ *  - 쓰기가 실패하면 바뀐 키를 들고 있다가 다음 주기에 다시 시도, 소멸자에서 마지막 flush
+ */
+template<typename CacheType>
+class SnapshotWriter {
+    CacheType& cache;
+    string path;
+    chrono::milliseconds interval;
+    shared_ptr<const CacheSnapshot> base;                   // 마지막으로 쓴 (또는 시작 시 연) 스냅샷
+    unordered_map<int, optional<CacheEntry>> pending;       // 아직 파일에 못 쓴 변경
+    mutable mutex writeLock;                                // flush 직렬화 (worker ↔ 직접 호출)
+    SnapshotStats current;
+    mutex stopLock;
+    condition_variable stopSignal;
+    bool stopping = false;
+    thread worker;
+
+    void run() {
+        unique_lock<mutex> guard(stopLock);
+        while (!stopSignal.wait_for(guard, interval, [this]() { return stopping; })) {
+            guard.unlock();
+            string error;
+            if (!flush(&error) && !error.empty()) {
+                lock_guard<mutex> w(writeLock);
+                current.lastError = error;
+            }
+            guard.lock();
+        }
+    }
+
+public:
+    SnapshotWriter(CacheType& cache, string path, chrono::milliseconds interval,
+                   shared_ptr<const CacheSnapshot> restored = nullptr)
+        : cache(cache), path(move(path)), interval(interval), base(move(restored)) {
+        if (base) current.generation = base->generation();
+        cache.trackChanges();
+        worker = thread([this]() { run(); });
+    }
+    ~SnapshotWriter() {
+        {
+            lock_guard<mutex> guard(stopLock);
+            stopping = true;
+        }
+        stopSignal.notify_one();
+        worker.join();
+        flush();
+    }
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    // 바뀐 키가 있으면 새 스냅샷을 씀 (안 썼으면 false, 실패 사유는 error)
+    bool flush(string* error = nullptr) {
+        lock_guard<mutex> guard(writeLock);
+        for (auto& [key, entry] : cache.takeChanges()) pending[key] = move(entry);
+        if (pending.empty()) return false;
+
+        auto start = chrono::steady_clock::now();
+        auto now = CacheEntry::Clock::now();
+        vector<pair<int, CacheEntry>> entries;
+        entries.reserve((base ? base->size() : 0) + pending.size());
+        if (base) {
+            base->forEach([&](int key, const CacheEntry& entry) {
+                if (entry.hardExpiry > now && !pending.count(key)) entries.emplace_back(key, entry);
+            });
+        }
+        for (const auto& [key, entry] : pending)
+            if (entry && entry->hardExpiry > now) entries.emplace_back(key, *entry);
+
+        uint64_t generation = current.generation + 1;
+        if (!CacheSnapshot::write(path, entries, generation, error)) return false;
+        auto fresh = CacheSnapshot::open(path, error);
+        if (!fresh) return false;
+        base = fresh;
+        cache.attachSnapshot(fresh);
+        current.snapshots++;
+        current.generation = generation;
+        current.entries = entries.size();
+        current.changed = pending.size();
+        current.bytes = fresh->fileSize();
+        current.lastWriteMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        current.lastError.clear();
+        pending.clear();
+        return true;
+    }
+
+    SnapshotStats stats() const {
+        lock_guard<mutex> guard(writeLock);
+        return current;
+    }
+};
+
+static void printCounters(const char* label, const CacheCounters& c) {
+    cout << label << ": hits " << c.hits << " (warm " << c.warmHits << "), misses " << c.misses << ", coalesced " << c.coalescedWaits
+         << ", stale " << c.staleHits << ", expired " << c.expirations << ", loads " << c.loads
+         << " (failed " << c.loadFailures << ", avg " << c.averageLoadMs() << " ms)" << endl;
+}
+
+/*
+ * 용량 단위 정책
+ *  - EntryCost: 엔트리 1개 = 1
+ *  - ByteCost : 키 + 값이 차지하는 바이트 (string은 heap 버퍼 포함)
+ */
+template<typename T>
+size_t payloadBytes(const T&) { return sizeof(T); }
+inline size_t payloadBytes(const string& s) { return sizeof(string) + s.capacity(); }
+
+struct EntryCost {
+    template<typename K, typename V>
+    static size_t of(const K&, const V&) { return 1; }
+};
+
+struct ByteCost {
+    template<typename K, typename V>
+    static size_t of(const K& key, const V& value) { return payloadBytes(key) + payloadBytes(value); }
+};
+
+struct CacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    double hitRatio() const { return hits + misses ? static_cast<double>(hits) / (hits + misses) : 0.0; }
+};
+
+/*
+ * LruCache - 정확한 LRU
+ *  - 리스트 링크(prev/next)를 unordered_map 노드 안에 둠 → 엔트리당 할당 1번
+ *  - unordered_map 노드는 rehash에도 주소가 바뀌지 않음 → 포인터 링크가 안정적
+ *  - hit: 노드를 리스트 머리로 relink, 용량 초과 시 꼬리부터 축출
+ */
+template<typename K, typename V, typename Cost = EntryCost>
+class LruCache {
+    struct Entry {
+        V value;
+        size_t cost = 0;
+        Entry* prev = nullptr;
+        Entry* next = nullptr;
+        const K* key = nullptr;     // 축출 시 map.erase용 (노드 안의 키를 가리킴)
+    };
+
+    unordered_map<K, Entry> map;
+    Entry* head = nullptr;          // 최근 사용
+    Entry* tail = nullptr;          // 축출 후보
+    size_t capacity;
+    size_t used = 0;
+    CacheStats counters;
+
+    void unlink(Entry* e) {
+        (e->prev ? e->prev->next : head) = e->next;
+        (e->next ? e->next->prev : tail) = e->prev;
+        e->prev = e->next = nullptr;
+    }
+
+    void pushFront(Entry* e) {
+        e->next = head;
+        if (head) head->prev = e;
+        head = e;
+        if (!tail) tail = e;
+    }
+
+    void evictUntilFits(size_t incoming) {
+        while (tail && used + incoming > capacity) {
+            Entry* victim = tail;
+            unlink(victim);
+            used -= victim->cost;
+            counters.evictions++;
+            map.erase(*victim->key);
+        }
+    }
+
+public:
+    explicit LruCache(size_t capacity) : capacity(capacity) { map.reserve(min<size_t>(capacity, 1 << 20)); }
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
+    V* get(const K& key) {
+        auto it = map.find(key);
+        if (it == map.end()) { counters.misses++; return nullptr; }
+        counters.hits++;
+        Entry* e = &it->second;
+        if (e != head) { unlink(e); pushFront(e); }
+        return &e->value;
+    }
+
+    void put(const K& key, V value) {
+        size_t cost = Cost::of(key, value);
+        auto it = map.find(key);
+        if (it != map.end()) {
+            Entry* e = &it->second;
+            unlink(e);
+            used -= e->cost;
+            map.erase(it);
+        }
+        if (cost > capacity) return;    // 한 엔트리가 용량보다 크면 캐시하지 않음 (옛 값도 이미 지움)
+        evictUntilFits(cost);
+        auto [pos, inserted] = map.try_emplace(key);
+        Entry* e = &pos->second;
+        e->value = std::move(value);
+        e->cost = cost;
+        e->key = &pos->first;
+        pushFront(e);
+        used += cost;
+    }
+
+    size_t size() const { return map.size(); }
+    size_t usedCapacity() const { return used; }
+    const CacheStats& stats() const { return counters; }
+};
+
+/*
+ * ClockCache - CLOCK(second-chance) 근사 LRU
+ *  - hit: referenced 비트 하나만 세팅, 노드 relink 없음
+ *  - 축출: hand가 슬롯을 돌며 referenced면 비트만 지우고 통과, 아니면 축출
+ *  - 슬롯은 vector에 두고 빈 슬롯은 free list로 재사용 (바이트 용량이면 엔트리 수가 가변)
+ */
+template<typename K, typename V, typename Cost = EntryCost>
+class ClockCache {
+    struct Slot {
+        K key{};
+        V value{};
+        size_t cost = 0;
+        bool referenced = false;
+        bool occupied = false;
+    };
+
+    unordered_map<K, size_t> index;     // key → 슬롯 번호
+    vector<Slot> slots;
+    vector<size_t> freeSlots;
+    size_t hand = 0;
+    size_t capacity;
+    size_t used = 0;
+    CacheStats counters;
+
+    void evictOne() {
+        for (;;) {
+            if (hand >= slots.size()) hand = 0;
+            Slot& s = slots[hand];
+            if (s.occupied) {
+                if (!s.referenced) break;
+                s.referenced = false;   // second chance
+            }
+            ++hand;
+        }
+        release(hand);
+        counters.evictions++;
+        ++hand;
+    }
+
+    void release(size_t slot) {
+        Slot& s = slots[slot];
+        index.erase(s.key);
+        used -= s.cost;
+        s.occupied = false;
+        s.value = V{};
+        freeSlots.push_back(slot);
+    }
+
+public:
+    explicit ClockCache(size_t capacity) : capacity(capacity) { index.reserve(min<size_t>(capacity, 1 << 20)); }
+    ClockCache(const ClockCache&) = delete;
+    ClockCache& operator=(const ClockCache&) = delete;
+
+    V* get(const K& key) {
+        auto it = index.find(key);
+        if (it == index.end()) { counters.misses++; return nullptr; }
+        counters.hits++;
+        Slot& s = slots[it->second];
+        s.referenced = true;
+        return &s.value;
+    }
+
+    void put(const K& key, V value) {
+        size_t cost = Cost::of(key, value);
+        auto it = index.find(key);
+        if (cost > capacity) {          // 캐시하지 않음, 같은 키의 옛 값이 계속 보이지 않게 지움
+            if (it != index.end()) release(it->second);
+            return;
+        }
+        if (it != index.end()) {
+            Slot& s = slots[it->second];
+            used -= s.cost;
+            s.value = std::move(value);
+            s.cost = cost;
+            s.referenced = true;
+            used += cost;
+            while (used > capacity) evictOne();     // 값이 커졌으면 다른 엔트리를 밀어냄
+            return;
+        }
+        while (used > 0 && used + cost > capacity) evictOne();
+        size_t slot;
+        if (!freeSlots.empty()) {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            slot = slots.size();
+            slots.emplace_back();
+        }
+        Slot& s = slots[slot];
+        s.key = key;
+        s.value = std::move(value);
+        s.cost = cost;
+        s.referenced = false;   // 새 엔트리는 한 번 더 쓰여야 보호됨
+        s.occupied = true;
+        index.emplace(key, slot);
+        used += cost;
+    }
+
+    size_t size() const { return index.size(); }
+    size_t usedCapacity() const { return used; }
+    const CacheStats& stats() const { return counters; }
+};
+
+// 비교 기준: 무제한 unordered_map (축출 없음)
+template<typename K, typename V>
+class UnboundedCache {
+    unordered_map<K, V> map;
+    CacheStats counters;
+public:
+    explicit UnboundedCache(size_t) {}
+    V* get(const K& key) {
+        auto it = map.find(key);
+        if (it == map.end()) { counters.misses++; return nullptr; }
+        counters.hits++;
+        return &it->second;
+    }
+    void put(const K& key, V value) { map[key] = std::move(value); }
+    size_t size() const { return map.size(); }
+    const CacheStats& stats() const { return counters; }
+};
+
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+/*
+ * ShardedCache - 여러 스레드가 공유하는 캐시
+ *  - 키 해시 상위 비트로 샤드 선택, 샤드마다 자기 mutex + 축출 상태 (cache line 정렬)
+ *  - 샤드 안은 set-associative: 버킷 하나 = WAYS개 슬롯 + seqlock 버전
+ *  - 읽기(hit): lock 없이 버전 확인 → 슬롯 읽기 → 버전 재확인 (바뀌었으면 재시도)
+ *  - 쓰기: 샤드 lock 안에서 버전을 홀수로 올리고 수정 후 짝수로
+ *  - 축출: 버킷 안 CLOCK, hit은 referenced 비트 fetch_or만 (relink 없음)
+ *  - 슬롯은 atomic<K>/atomic<V> → K, V는 lock-free atomic 가능한 trivially copyable 타입
+ *  - 샤드당 버킷 수는 2의 거듭제곱으로 내림 → 실제 용량(capacity())은 요청 이하, 최소 샤드 × WAYS
+ */
+template<typename K, typename V, size_t Shards = 16>
+class ShardedCache {
+    static_assert(is_trivially_copyable_v<K> && is_trivially_copyable_v<V>, "slots are read optimistically");
+    static_assert(has_single_bit(Shards), "shard count must be a power of two");
+    static constexpr int WAYS = 8;
+    static constexpr int SHARD_BITS = countr_zero(Shards);
+
+    struct alignas(CACHE_LINE_SIZE) Bucket {
+        atomic<uint32_t> version{0};
+        atomic<uint8_t> occupied{0};        // 슬롯별 비트
+        atomic<uint8_t> referenced{0};      // CLOCK 비트
+        uint8_t hand = 0;                   // lock 안에서만 접근
+        atomic<K> keys[WAYS];
+        atomic<V> values[WAYS];
+    };
+
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        mutex lock;
+        vector<Bucket> buckets;
+        size_t mask = 0;
+        size_t evictions = 0;
+    };
+
+    Shard shards[Shards];
+
+    static uint64_t mix(const K& key) {
+        uint64_t h = hash<K>{}(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    Shard& shardOf(uint64_t h) { return shards[SHARD_BITS ? h >> (64 - SHARD_BITS) : 0]; }
+    Bucket& bucketOf(Shard& shard, uint64_t h) { return shard.buckets[h & shard.mask]; }
+
+    // 낙관적 읽기, ok=false면 hit 없음
+    static bool readBucket(Bucket& b, const K& key, V& out) {
+        for (;;) {
+            uint32_t before = b.version.load(memory_order_acquire);
+            if (before & 1) { this_thread::yield(); continue; }     // 쓰기 중
+            uint8_t occupied = b.occupied.load(memory_order_relaxed);
+            int found = -1;
+            V value{};
+            for (int w = 0; w < WAYS; ++w) {
+                if ((occupied >> w & 1) && b.keys[w].load(memory_order_relaxed) == key) {
+                    value = b.values[w].load(memory_order_relaxed);
+                    found = w;
+                    break;
+                }
+            }
+            atomic_thread_fence(memory_order_acquire);
+            if (b.version.load(memory_order_relaxed) != before) continue;
+            if (found < 0) return false;
+            // 이미 세팅돼 있으면 쓰기 생략 → hot 키 hit이 cache line을 더럽히지 않음
+            uint8_t bit = static_cast<uint8_t>(1u << found);
+            if (!(b.referenced.load(memory_order_relaxed) & bit)) b.referenced.fetch_or(bit, memory_order_relaxed);
+            out = value;
+            return true;
+        }
+    }
+
+    static size_t bucketsPerShard(size_t capacity) { return bit_floor(max<size_t>(1, capacity / (Shards * WAYS))); }
+
+public:
+    // 요청 용량으로 만들었을 때의 실제 슬롯 수 (비교 대상을 같은 크기로 맞출 때)
+    static size_t capacityFor(size_t capacity) { return bucketsPerShard(capacity) * Shards * WAYS; }
+
+    explicit ShardedCache(size_t capacity) {
+        size_t buckets = bucketsPerShard(capacity);
+        for (auto& shard : shards) {
+            shard.buckets = vector<Bucket>(buckets);
+            shard.mask = buckets - 1;
+        }
+    }
+    ShardedCache(const ShardedCache&) = delete;
+    ShardedCache& operator=(const ShardedCache&) = delete;
+
+    size_t capacity() const { return shards[0].buckets.size() * Shards * WAYS; }
+
+    bool get(const K& key, V& out) {
+        uint64_t h = mix(key);
+        return readBucket(bucketOf(shardOf(h), h), key, out);
+    }
+
+    // 해시/버킷 주소를 먼저 모두 계산하고 prefetch → 메모리 지연을 겹침
+    size_t get_many(const K* keys, size_t count, V* out, bool* found) {
+        constexpr size_t BATCH = 16;
+        Bucket* targets[BATCH];
+        size_t hits = 0;
+        for (size_t base = 0; base < count; base += BATCH) {
+            size_t n = min(BATCH, count - base);
+            for (size_t i = 0; i < n; ++i) {
+                uint64_t h = mix(keys[base + i]);
+                targets[i] = &bucketOf(shardOf(h), h);
+                __builtin_prefetch(targets[i]);
+            }
+            for (size_t i = 0; i < n; ++i) {
+                found[base + i] = readBucket(*targets[i], keys[base + i], out[base + i]);
+                hits += found[base + i];
+            }
+        }
+        return hits;
+    }
+
+    void put(const K& key, const V& value) {
+        uint64_t h = mix(key);
+        Shard& shard = shardOf(h);
+        lock_guard<mutex> guard(shard.lock);
+        Bucket& b = bucketOf(shard, h);
+        uint8_t occupied = b.occupied.load(memory_order_relaxed);
+        int way = -1;
+        for (int w = 0; w < WAYS && way < 0; ++w)
+            if ((occupied >> w & 1) && b.keys[w].load(memory_order_relaxed) == key) way = w;
+        for (int w = 0; w < WAYS && way < 0; ++w)
+            if (!(occupied >> w & 1)) way = w;
+        if (way < 0) {
+            // 버킷 안 CLOCK: referenced면 비트 지우고 다음 슬롯
+            for (;;) {
+                uint8_t bit = static_cast<uint8_t>(1u << b.hand);
+                if (!(b.referenced.fetch_and(static_cast<uint8_t>(~bit), memory_order_relaxed) & bit)) break;
+                b.hand = (b.hand + 1) % WAYS;
+            }
+            way = b.hand;
+            b.hand = (b.hand + 1) % WAYS;
+            shard.evictions++;
+        }
+        uint32_t v = b.version.load(memory_order_relaxed);
+        b.version.store(v + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+        b.keys[way].store(key, memory_order_relaxed);
+        b.values[way].store(value, memory_order_relaxed);
+        b.occupied.store(static_cast<uint8_t>(occupied | 1u << way), memory_order_relaxed);
+        b.version.store(v + 2, memory_order_release);
+    }
+
+    size_t evictions() {
+        size_t total = 0;
+        for (auto& shard : shards) {
+            lock_guard<mutex> guard(shard.lock);
+            total += shard.evictions;
+        }
+        return total;
+    }
+};
+
+// 비교 기준: 전역 mutex 하나로 감싼 LRU (hit도 relink하므로 배타 lock 필요)
+template<typename K, typename V>
+class GlobalLockCache {
+    mutex lock;
+    LruCache<K, V> lru;
+public:
+    explicit GlobalLockCache(size_t capacity) : lru(capacity) {}
+    bool get(const K& key, V& out) {
+        lock_guard<mutex> guard(lock);
+        if (V* v = lru.get(key)) { out = *v; return true; }
+        return false;
+    }
+    void put(const K& key, const V& value) {
+        lock_guard<mutex> guard(lock);
+        lru.put(key, value);
+    }
+};
+
+// unordered_map 메모리 측정용 할당자 (노드 + 버킷 배열)
+inline size_t g_trackedBytes = 0;
+template<typename T>
+struct TrackingAllocator {
+    using value_type = T;
+    TrackingAllocator() = default;
+    template<typename U> TrackingAllocator(const TrackingAllocator<U>&) {}
+    T* allocate(size_t n) { g_trackedBytes += n * sizeof(T); return static_cast<T*>(::operator new(n * sizeof(T))); }
+    void deallocate(T* p, size_t n) { g_trackedBytes -= n * sizeof(T); ::operator delete(p); }
+    template<typename U> bool operator==(const TrackingAllocator<U>&) const { return true; }
+};
+using TrackedUnorderedMap = unordered_map<int, int, hash<int>, equal_to<int>, TrackingAllocator<pair<const int, int>>>;
+
+template<typename Map>
+static size_t mapBytes(const Map& map) {
+    if constexpr (is_same_v<Map, TrackedUnorderedMap>) return g_trackedBytes;
+    else return map.memoryBytes();
+}
+
+// n개 삽입 후 무작위 hit 조회 (LOOKUPS회), 순서 섞기 위해 키는 곱셈 해시로 흩뿌림
+template<typename Map>
+static void benchmarkMap(const char* name, size_t n) {
+    constexpr size_t LOOKUPS = 200000;
+    auto keyOf = [](size_t i) { return static_cast<int>(static_cast<uint32_t>(i * 2654435761u)); };
+    mt19937_64 rng(7);
+    vector<int> probes(LOOKUPS);
+    for (auto& p : probes) p = keyOf(rng() % n);
+
+    auto map = make_unique<Map>();
+    auto start = chrono::steady_clock::now();
+    for (size_t i = 0; i < n; ++i) (*map)[keyOf(i)] = static_cast<int>(i);
+    double insertNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / n;
+
+    long long sum = 0;
+    start = chrono::steady_clock::now();
+    for (int key : probes) sum += map->find(key)->second;
+    double lookupNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / LOOKUPS;
+    cout << "  " << name << ": insert " << insertNs << " ns, lookup " << lookupNs << " ns, "
+         << static_cast<double>(mapBytes(*map)) / n << " bytes/entry (sum " << sum << ")" << endl;
+}
+
+// Zipf(s) 분포 키 trace (CDF + 이진 탐색)
+static vector<int> zipfTrace(int keys, double skew, size_t length, uint32_t seed) {
+    vector<double> cdf(keys);
+    double sum = 0;
+    for (int k = 0; k < keys; ++k) {
+        sum += 1.0 / pow(k + 1, skew);
+        cdf[k] = sum;
+    }
+    mt19937 rng(seed);
+    uniform_real_distribution<double> uniform(0.0, sum);
+    vector<int> trace(length);
+    for (auto& key : trace) key = static_cast<int>(lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+    return trace;
+}
+
+// read-through: miss면 put
+template<typename CacheType>
+static void benchmarkCache(const char* name, const vector<int>& trace, size_t capacity) {
+    CacheType cache(capacity);
+    long long sum = 0;
+    auto start = chrono::steady_clock::now();
+    for (int key : trace) {
+        if (int* v = cache.get(key)) sum += *v;
+        else cache.put(key, key);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << ": hit " << cache.stats().hitRatio() * 100 << "%, "
+         << trace.size() / seconds / 1e6 << " Mops/s, entries " << cache.size() << " (sum " << sum << ")" << endl;
+}
+
+// 공유 캐시 처리량: 스레드들이 같은 trace의 다른 구간을 read-through로 처리
+template<typename CacheType>
+static void benchmarkShared(const char* name, const vector<int>& trace, int threads, size_t capacity) {
+    CacheType cache(capacity);
+    vector<thread> workers;
+    size_t perThread = trace.size() / threads;
+    atomic<size_t> hits{0};
+    auto start = chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            size_t localHits = 0;
+            int value;
+            for (size_t i = t * perThread; i < (t + 1) * perThread; ++i) {
+                if (cache.get(trace[i], value)) localHits++;
+                else cache.put(trace[i], trace[i]);
+            }
+            hits += localHits;
+        });
+    }
+    for (auto& w : workers) w.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << " x" << threads << ": " << perThread * threads / seconds / 1e6 << " Mops/s, hit "
+         << 100.0 * hits / (perThread * threads) << "% (capacity " << capacity << ")" << endl;
+}
+
+// 재시작 시나리오: 백엔드 load 1회 = ~1us busy wait, 같은 키 집합을 다시 읽을 때 backend 호출 수/시간 비교
+static void demoSnapshotRestart() {
+    constexpr int KEYS = 100000;
+    string path = (filesystem::temp_directory_path() /
+                   ("cache_snapshot_" + to_string(chrono::steady_clock::now().time_since_epoch().count()) + ".bin"))
+                      .string();
+    atomic<long long> backendCalls{0};
+    auto backend = [&backendCalls](int key) {
+        return [&backendCalls, key]() {
+            backendCalls++;
+            auto until = chrono::steady_clock::now() + chrono::microseconds(1);
+            while (chrono::steady_clock::now() < until) {}
+            return key * 3;
+        };
+    };
+    Ttl ttl{chrono::milliseconds(0), chrono::minutes(10)};
+    auto fill = [&](FlatCache& target) {
+        auto start = chrono::steady_clock::now();
+        for (int k = 0; k < KEYS; ++k) target.get_or_load(k, backend(k), ttl);
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    };
+
+    {
+        FlatCache before;
+        SnapshotWriter<FlatCache> writer(before, path, chrono::milliseconds(50));
+        double coldMs = fill(before);
+        writer.flush();
+        SnapshotStats s = writer.stats();
+        cout << "cold fill: " << backendCalls << " backend calls, " << coldMs << " ms → snapshot gen "
+             << s.generation << ", " << s.entries << " entries, " << s.bytes / 1024 << " KB in " << s.lastWriteMs
+             << " ms" << endl;
+
+        // 읽기를 계속 돌리는 동안 키 1000개만 바꿈 → 백그라운드 writer가 그 1000개만 합쳐서 씀
+        atomic<bool> done{false};
+        atomic<long long> reads{0};
+        thread reader([&]() {
+            int value;
+            for (int k = 0; !done.load(memory_order_relaxed); k = (k + 7919) % KEYS) {
+                before.get(k, value);
+                reads.fetch_add(1, memory_order_relaxed);
+            }
+        });
+        for (int k = 0; k < 1000; ++k) before.put(k, -k, ttl);
+        this_thread::sleep_for(chrono::milliseconds(120));
+        done = true;
+        reader.join();
+        s = writer.stats();
+        cout << "incremental: gen " << s.generation << ", " << s.changed << " changed keys merged in "
+             << s.lastWriteMs << " ms, reader did " << reads << " gets meanwhile" << endl;
+    }   // writer 소멸자: 마지막 flush
+
+    backendCalls = 0;
+    auto start = chrono::steady_clock::now();
+    string error;
+    auto snapshot = CacheSnapshot::open(path, &error);
+    double openUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    if (!snapshot) {
+        cout << "snapshot open failed: " << error << endl;
+        return;
+    }
+    FlatCache after;
+    after.attachSnapshot(snapshot);
+    double warmMs = fill(after);
+    int value = 0;
+    after.get(5, value);
+    cout << "restart: mmap open " << openUs << " us (" << snapshot->size() << " entries), refill " << warmMs
+         << " ms, backend calls " << backendCalls << ", key 5 = " << value << endl;
+    printCounters("[FlatCache warm]", after.counters());
+
+    error_code ec;
+    filesystem::resize_file(path, 100, ec);
+    cout << "truncated file: open " << (CacheSnapshot::open(path, &error) ? "ok" : "rejected (" + error + ")") << endl;
+    filesystem::remove(path, ec);
+}
+
+int main(int argc, char** argv) {
     cout << "=== C++ Cache ===" << endl;
     Cache cache;
     cache.put(1, 100);
@@ -30,6 +1363,121 @@ int main() {
     int val;
     cache.get(1, val);
     cache.get(2, val);
+    printCounters("[Cache]", cache.counters());
+
+    cout << "\n=== Cache::get_or_load (coalescing + TTL) ===" << endl;
+    {
+        Cache loading;
+        atomic<int> backendCalls{0};
+        auto slowLoad = [&backendCalls]() {
+            backendCalls++;
+            this_thread::sleep_for(chrono::milliseconds(20));
+            return 42;
+        };
+        vector<thread> callers;
+        for (int t = 0; t < 8; ++t) callers.emplace_back([&]() { loading.get_or_load(7, slowLoad); });
+        for (auto& c : callers) c.join();
+        cout << "8 concurrent misses → backend calls " << backendCalls << endl;
+
+        loading.put(1, 100, {chrono::milliseconds(0), chrono::milliseconds(10)});
+        this_thread::sleep_for(chrono::milliseconds(15));
+        cout << "hard TTL 10ms, after 15ms: get(1) " << (loading.get(1, val) ? "hit" : "miss (expired)") << endl;
+
+        int version = 1;
+        auto versioned = [&version]() { return version * 100; };
+        Ttl soft{chrono::milliseconds(10), chrono::milliseconds(1000)};
+        loading.get_or_load(2, versioned, soft);
+        version = 2;
+        this_thread::sleep_for(chrono::milliseconds(15));
+        int stale = loading.get_or_load(2, versioned, soft);     // stale 반환 + refresh 시작
+        this_thread::sleep_for(chrono::milliseconds(5));
+        int fresh = loading.get_or_load(2, versioned, soft);
+        cout << "soft TTL: stale served " << stale << ", after refresh " << fresh << endl;
+
+        try {
+            loading.get_or_load(3, []() -> int { throw runtime_error("backend down"); });
+        } catch (const exception& e) {
+            cout << "failed load: " << e.what() << " (not cached)" << endl;
+        }
+        printCounters("[Cache]", loading.counters());
+    }
+
+    cout << "\n=== FlatHashMap as Cache storage ===" << endl;
+    FlatCache flat;
+    flat.put(1, 100);
+    flat.get(1, val);
+    flat.get(2, val);
+    printCounters("[FlatCache]", flat.counters());
+    FlatHashMap<int, int> table;
+    for (int i = 0; i < 1000; ++i) table[i] = i;
+    for (int i = 0; i < 1000; i += 2) table.erase(i);
+    size_t iterated = 0;
+    for (auto it = table.begin(); it != table.end(); ++it) iterated++;
+    cout << "1000 inserted, 500 erased: size " << table.size() << ", iterated " << iterated
+         << ", find(7)=" << table.find(7)->second << ", find(8) found=" << (table.find(8) != table.end()) << endl;
+
+    cout << "\n=== Cache snapshot: mmap warm restart ===" << endl;
+    demoSnapshotRestart();
+
+    cout << "\n=== Bounded caches: LRU / CLOCK ===" << endl;
+    LruCache<int, int> lru(2);
+    lru.put(1, 10); lru.put(2, 20);
+    lru.get(1);                     // 1이 최근 → 2가 축출 후보
+    lru.put(3, 30);
+    cout << "LRU   (cap 2): has 1=" << (lru.get(1) != nullptr) << " has 2=" << (lru.get(2) != nullptr)
+         << " has 3=" << (lru.get(3) != nullptr) << endl;
+
+    ClockCache<int, int> clockCache(2);
+    clockCache.put(1, 10); clockCache.put(2, 20);
+    clockCache.get(1);              // 1의 referenced 비트 → second chance
+    clockCache.put(3, 30);
+    cout << "CLOCK (cap 2): has 1=" << (clockCache.get(1) != nullptr) << " has 2=" << (clockCache.get(2) != nullptr)
+         << " has 3=" << (clockCache.get(3) != nullptr) << endl;
+
+    cout << "\n=== Byte-capacity cache (4KB) ===" << endl;
+    LruCache<int, string, ByteCost> pages(4096);
+    for (int i = 0; i < 64; ++i) pages.put(i, string(200 + i * 10, 'x'));
+    cout << "entries " << pages.size() << ", bytes " << pages.usedCapacity() << "/4096, evictions "
+         << pages.stats().evictions << endl;
+
+    cout << "\n=== Benchmark: Zipf(0.99) over 100k keys, 300k ops ===" << endl;
+    auto trace = zipfTrace(100000, 0.99, 300000, 42);
+    for (size_t capacity : {1000, 10000}) {
+        cout << "capacity " << capacity << " entries" << endl;
+        benchmarkCache<UnboundedCache<int, int>>("unbounded map", trace, capacity);
+        benchmarkCache<LruCache<int, int>>("LRU          ", trace, capacity);
+        benchmarkCache<ClockCache<int, int>>("CLOCK        ", trace, capacity);
+    }
+
+    cout << "\n=== ShardedCache (16 shards, optimistic reads) ===" << endl;
+    ShardedCache<int, int> sharded(1024);
+    for (int k = 0; k < 64; ++k) sharded.put(k, k * 10);
+    vector<int> wanted = {3, 7, 63, 64, 1000};
+    vector<int> values(wanted.size());
+    unique_ptr<bool[]> found(new bool[wanted.size()]);
+    size_t batchHits = sharded.get_many(wanted.data(), wanted.size(), values.data(), found.get());
+    cout << "get_many(3,7,63,64,1000): " << batchHits << " hits →";
+    for (size_t i = 0; i < wanted.size(); ++i) cout << " " << (found[i] ? to_string(values[i]) : "miss");
+    cout << endl;
+
+    // 샤드 용량은 2의 거듭제곱 단위 → 두 캐시 모두 그 실제 용량으로 맞춰 hit 차이가 크기 차이가 되지 않게
+    const size_t sharedCapacity = ShardedCache<int, int>::capacityFor(10000);
+    cout << "\n=== Benchmark: shared cache scaling (Zipf, capacity " << sharedCapacity << ") ===" << endl;
+    for (int threads : {1, 4, 16, 64}) {
+        benchmarkShared<GlobalLockCache<int, int>>("global mutex LRU", trace, threads, sharedCapacity);
+        benchmarkShared<ShardedCache<int, int>>("sharded         ", trace, threads, sharedCapacity);
+    }
+
+    // 1M 이상은 오래 걸리고 100M은 수 GB 메모리가 필요 → --large 일 때만
+    bool large = argc > 1 && string(argv[1]) == "--large";
+    cout << "\n=== Benchmark: FlatHashMap vs unordered_map (int→int) ===" << endl;
+    vector<size_t> sizes = {1000, 100000};
+    if (large) sizes.insert(sizes.end(), {1000000, 10000000, 100000000});
+    for (size_t n : sizes) {
+        cout << n << " entries" << endl;
+        benchmarkMap<TrackedUnorderedMap>("unordered_map", n);
+        benchmarkMap<FlatHashMap<int, int>>("FlatHashMap  ", n);
+    }
     
     return 0;
 }
@@ -1,29 +1,456 @@
 /* C++ Zero-Copy - move semantics */
 #include <iostream>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <new>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
 #include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#define HAVE_POSIX_IO 1
+#endif
 using namespace std;
 
+#ifdef HAVE_POSIX_IO
+[[noreturn]] static void throwErrno(const char* what) {
+    throw system_error(errno, generic_category(), what);
+}
+
+/*
+ * mmap 옵션
+ *  - populate: MAP_POPULATE로 페이지를 미리 매핑 (첫 접근 page fault 제거, 생성은 느려짐)
+ *  - advice  : madvise 힌트 (MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED, MADV_HUGEPAGE ...)
+ *  - writable: 파일 매핑을 MAP_SHARED로 (쓰면 파일에 반영)
+ *              기본은 MAP_PRIVATE copy-on-write: operator[]로 써도 되지만 그 페이지만 복사되고 파일은 그대로
+ */
+struct MapOptions {
+    bool populate = false;
+    int advice = MADV_NORMAL;
+    bool writable = false;
+};
+#endif
+
+/*
+ * Buffer - 생성 방식별 int 버퍼
+ *  - Buffer(size)     : 0으로 초기화 (기존 동작)
+ *  - forOverwrite(n)  : 초기화 생략, 곧 덮어쓸 버퍼용 (make_unique_for_overwrite)
+ *  - mapAnonymous(n)  : 익명 mmap, 만질 때 페이지 할당 (커널이 0 페이지 제공)
+ *  - mapFile(path)    : 파일을 그대로 매핑, read()로 복사하지 않음
+ */
 class Buffer {
-    vector<int> data;
+    unique_ptr<int[]> data;
+    int* mapped = nullptr;          // mmap 모드일 때만
+    size_t mappedBytes = 0;
+    size_t count = 0;
+
+    struct ForOverwrite {};
+    Buffer(ForOverwrite, size_t size) : data(make_unique_for_overwrite<int[]>(size)), count(size) {}
+    Buffer(int* mapped, size_t bytes) : mapped(mapped), mappedBytes(bytes), count(bytes / sizeof(int)) {}
+
 public:
-    Buffer(size_t size) : data(size) {
+    Buffer(size_t size) : data(make_unique<int[]>(size)), count(size) {
         cout << "[Buffer] 생성 (size: " << size << ")" << endl;
     }
     
-    Buffer(Buffer&& other) noexcept : data(move(other.data)) {
+    Buffer(Buffer&& other) noexcept
+        : data(move(other.data)), mapped(exchange(other.mapped, nullptr)),
+          mappedBytes(exchange(other.mappedBytes, 0)), count(exchange(other.count, 0)) {
         cout << "[Buffer] 이동 (복사 없음!)" << endl;
     }
-    
-    size_t size() const { return data.size(); }
+
+    ~Buffer() {
+#ifdef HAVE_POSIX_IO
+        if (mapped) ::munmap(mapped, mappedBytes);
+#endif
+    }
+
+    static Buffer forOverwrite(size_t size) { return Buffer(ForOverwrite{}, size); }
+
+#ifdef HAVE_POSIX_IO
+    static Buffer mapAnonymous(size_t size, MapOptions options = {}) {
+        size_t bytes = size * sizeof(int);
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_POPULATE
+        if (options.populate) flags |= MAP_POPULATE;
+#endif
+        void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (p == MAP_FAILED) throwErrno("mmap");
+        Buffer buffer(static_cast<int*>(p), bytes);
+        buffer.advise(options.advice);
+        return buffer;
+    }
+
+    static Buffer mapFile(const char* path, MapOptions options = {}) {
+        int fd = ::open(path, options.writable ? O_RDWR : O_RDONLY);
+        if (fd < 0) throwErrno("open");
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            int saved = errno;
+            ::close(fd);
+            errno = saved;
+            throwErrno("fstat");
+        }
+        size_t bytes = static_cast<size_t>(st.st_size);
+        if (bytes == 0) {
+            ::close(fd);
+            return Buffer(nullptr, 0);
+        }
+        int flags = options.writable ? MAP_SHARED : MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        if (options.populate) flags |= MAP_POPULATE;
+#endif
+        void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, fd, 0);     // O_RDONLY여도 MAP_PRIVATE면 쓰기 가능
+        int saved = errno;
+        ::close(fd);                // 매핑은 fd를 닫아도 유지됨
+        if (p == MAP_FAILED) {
+            errno = saved;
+            throwErrno("mmap");
+        }
+        Buffer buffer(static_cast<int*>(p), bytes);
+        buffer.advise(options.advice);
+        return buffer;
+    }
+
+    // 힌트는 실패해도 동작에는 영향 없음 → 결과만 반환
+    bool advise(int advice) {
+        if (!mapped || advice == MADV_NORMAL) return true;
+        return ::madvise(mapped, mappedBytes, advice) == 0;
+    }
+#endif
+
+    int* begin() { return mapped ? mapped : data.get(); }
+    const int* begin() const { return mapped ? mapped : data.get(); }
+    int& operator[](size_t i) { return begin()[i]; }
+    size_t size() const { return count; }
+    size_t bytes() const { return count * sizeof(int); }
+    bool isMapped() const { return mapped != nullptr; }
 };
 
 Buffer createBuffer(size_t size) {
     return Buffer(size);  // RVO/이동
 }
 
+#ifdef HAVE_POSIX_IO
+// 생성 시간 vs 첫 전체 쓰기 시간 (page fault 포함)
+template<typename Make>
+static void benchmarkBufferCreation(const char* name, size_t ints, Make make) {
+    auto start = chrono::steady_clock::now();
+    Buffer buffer = make(ints);
+    double createMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    memset(buffer.begin(), 0xAB, buffer.bytes());
+    double fillMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << ": create " << createMs << " ms, first fill " << fillMs << " ms, total "
+         << createMs + fillMs << " ms" << endl;
+}
+
+/*
+ * BufferChain - scatter-gather 버퍼 체인
+ *  - 세그먼트 = (포인터, 길이, owner)
+ *    owner가 없으면 빌린 메모리 (호출자가 전송 완료까지 수명 보장)
+ *    owner가 있으면 shared_ptr 참조 카운트로 수명 유지
+ *  - prepend/append: 세그먼트 기술자만 추가, 데이터 복사 없음
+ *  - writeTo/sendTo: 세그먼트를 iovec으로 모아 writev/sendmsg (IOV_BATCH개씩)
+ *    부분 쓰기는 consume()으로 앞에서 잘라내고 이어서 전송
+ *  - readFrom: 블록들을 할당해 readv로 한 번에 받고 채워진 만큼 세그먼트로 추가
+ *    반환은 read()처럼 받은 바이트 수 / 0 = EOF / -1 = non-blocking fd에 아직 데이터 없음 (EAGAIN)
+ */
+class BufferChain {
+public:
+    struct Segment {
+        const char* data;
+        size_t size;
+        shared_ptr<const void> owner;
+    };
+
+private:
+    static constexpr int IOV_BATCH = 64 < IOV_MAX ? 64 : IOV_MAX;
+    deque<Segment> segments;
+    size_t totalBytes = 0;
+
+    int fillIovecs(iovec* iov) const {
+        int n = 0;
+        for (auto it = segments.begin(); it != segments.end() && n < IOV_BATCH; ++it, ++n)
+            iov[n] = {const_cast<char*>(it->data), it->size};
+        return n;
+    }
+
+public:
+    // 빌린 메모리 (literal, 호출자 소유 버퍼)
+    void append(const void* data, size_t size) {
+        if (size == 0) return;
+        segments.push_back({static_cast<const char*>(data), size, nullptr});
+        totalBytes += size;
+    }
+    void prepend(const void* data, size_t size) {
+        if (size == 0) return;
+        segments.push_front({static_cast<const char*>(data), size, nullptr});
+        totalBytes += size;
+    }
+
+    // 소유권 공유 (다른 체인/캐시와 같은 블록을 가리켜도 됨)
+    void append(shared_ptr<const void> owner, const void* data, size_t size) {
+        if (size == 0) return;
+        segments.push_back({static_cast<const char*>(data), size, std::move(owner)});
+        totalBytes += size;
+    }
+    void prepend(shared_ptr<const void> owner, const void* data, size_t size) {
+        if (size == 0) return;
+        segments.push_front({static_cast<const char*>(data), size, std::move(owner)});
+        totalBytes += size;
+    }
+
+    // string을 넘겨받아 heap 버퍼를 그대로 세그먼트로 사용
+    void append(string&& text) {
+        auto owned = make_shared<const string>(std::move(text));
+        append(owned, owned->data(), owned->size());
+    }
+    void prepend(string&& text) {
+        auto owned = make_shared<const string>(std::move(text));
+        prepend(owned, owned->data(), owned->size());
+    }
+
+    // 다른 체인의 세그먼트를 참조로 이어붙임 (데이터 복사 없음)
+    void append(const BufferChain& other) {
+        for (const auto& seg : other.segments) segments.push_back(seg);
+        totalBytes += other.totalBytes;
+    }
+
+    // 앞에서 n바이트 제거 (전송 완료된 부분)
+    void consume(size_t n) {
+        totalBytes -= min(n, totalBytes);
+        while (n > 0 && !segments.empty()) {
+            Segment& front = segments.front();
+            if (n < front.size) {
+                front.data += n;
+                front.size -= n;
+                return;
+            }
+            n -= front.size;
+            segments.pop_front();
+        }
+    }
+
+    // blocking fd: 전부 쓸 때까지, non-blocking: EAGAIN에서 멈추고 쓴 만큼 반환
+    size_t writeTo(int fd) {
+        size_t written = 0;
+        iovec iov[IOV_BATCH];
+        while (!segments.empty()) {
+            int n = fillIovecs(iov);
+            ssize_t w = ::writev(fd, iov, n);
+            if (w < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+                throwErrno("writev");
+            }
+            consume(static_cast<size_t>(w));
+            written += static_cast<size_t>(w);
+        }
+        return written;
+    }
+
+    // 소켓: sendmsg + MSG_NOSIGNAL (끊긴 연결에서 SIGPIPE 대신 EPIPE)
+    size_t sendTo(int socket) {
+        size_t sent = 0;
+        iovec iov[IOV_BATCH];
+        while (!segments.empty()) {
+            msghdr msg{};
+            msg.msg_iov = iov;
+            msg.msg_iovlen = fillIovecs(iov);
+#ifdef MSG_NOSIGNAL
+            ssize_t w = ::sendmsg(socket, &msg, MSG_NOSIGNAL);
+#else
+            ssize_t w = ::sendmsg(socket, &msg, 0);
+#endif
+            if (w < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+                throwErrno("sendmsg");
+            }
+            consume(static_cast<size_t>(w));
+            sent += static_cast<size_t>(w);
+        }
+        return sent;
+    }
+
+    // blockSize 블록 blocks개로 readv 한 번, 받은 바이트 수 반환 (0 = EOF, -1 = EAGAIN)
+    ssize_t readFrom(int fd, size_t blockSize = 16384, int blocks = 4) {
+        blocks = min(blocks, IOV_BATCH);
+        vector<shared_ptr<char[]>> storage;
+        iovec iov[IOV_BATCH];
+        for (int i = 0; i < blocks; ++i) {
+            storage.push_back(shared_ptr<char[]>(new char[blockSize]));
+            iov[i] = {storage.back().get(), blockSize};
+        }
+        ssize_t r;
+        do {
+            r = ::readv(fd, iov, blocks);
+        } while (r < 0 && errno == EINTR);
+        if (r < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) return -1;
+            throwErrno("readv");
+        }
+        size_t remaining = static_cast<size_t>(r);
+        for (int i = 0; i < blocks && remaining > 0; ++i) {
+            size_t part = min(remaining, blockSize);
+            append(shared_ptr<const void>(storage[i], storage[i].get()), storage[i].get(), part);
+            remaining -= part;
+        }
+        return r;
+    }
+
+    void clear() {
+        segments.clear();
+        totalBytes = 0;
+    }
+
+    size_t size() const { return totalBytes; }
+    size_t segmentCount() const { return segments.size(); }
+    bool empty() const { return totalBytes == 0; }
+
+    // 검증/디버깅용 평탄화 (여기서만 복사)
+    string flatten() const {
+        string out;
+        out.reserve(totalBytes);
+        for (const auto& seg : segments) out.append(seg.data, seg.size);
+        return out;
+    }
+};
+
+static void writeAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t w = ::write(fd, data, size);
+        if (w < 0) {
+            if (errno == EINTR) continue;
+            throwErrno("write");
+        }
+        data += w;
+        size -= static_cast<size_t>(w);
+    }
+}
+
+// socketpair 한쪽으로 응답(header + body + trailer)을 보내고 다른 쪽 스레드가 비움
+static void benchmarkResponses(size_t bodySize) {
+    const string header = "HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\nContent-Length: " +
+                          to_string(bodySize) + "\r\n\r\n";
+    static const char trailer[] = "\r\n0\r\n\r\n";
+    auto body = make_shared<string>(bodySize, 'b');     // 캐시된 본문을 여러 응답이 공유
+    size_t messageBytes = header.size() + bodySize + sizeof(trailer) - 1;
+    size_t messages = max<size_t>(200, (16u << 20) / messageBytes);
+
+    auto run = [&](bool chained) {
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) throwErrno("socketpair");
+        thread drain([fd = fds[1]]() {
+            vector<char> sink(1 << 16);
+            while (::read(fd, sink.data(), sink.size()) > 0) {}
+        });
+        BufferChain response;       // 연결마다 하나를 재사용 (세그먼트 기술자 메모리 재활용)
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < messages; ++i) {
+            if (chained) {
+                response.clear();
+                response.append(body, body->data(), body->size());
+                response.prepend(header.data(), header.size());
+                response.append(trailer, sizeof(trailer) - 1);
+                response.sendTo(fds[0]);
+            } else {
+                string response;
+                response.reserve(messageBytes);
+                response += header;
+                response += *body;
+                response.append(trailer, sizeof(trailer) - 1);
+                writeAll(fds[0], response.data(), response.size());
+            }
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        ::close(fds[0]);
+        drain.join();
+        ::close(fds[1]);
+        return seconds;
+    };
+
+    double concat = run(false);
+    double chain = run(true);
+    cout << "  body " << bodySize << " B: concat+write " << messages / concat / 1e3 << "k msg/s, chain+sendmsg "
+         << messages / chain / 1e3 << "k msg/s (x" << concat / chain << ")" << endl;
+}
+#endif
+
 int main() {
     cout << "=== C++ Zero-Copy (move) ===" << endl;
     Buffer buf = createBuffer(1000);
     cout << "Size: " << buf.size() << endl;
+
+
+    cout << "\n=== Buffer construction modes ===" << endl;
+    Buffer scratch = Buffer::forOverwrite(1000);
+    for (size_t i = 0; i < scratch.size(); ++i) scratch[i] = static_cast<int>(i);
+    cout << "forOverwrite(1000): last " << scratch[999] << endl;
+
+#ifdef HAVE_POSIX_IO
+    {
+        const char* path = "zero_copy_map.bin";
+        {
+            FILE* f = fopen(path, "wb");
+            if (!f) throwErrno("fopen");
+            for (int i = 0; i < 4096; ++i) fwrite(&i, sizeof(i), 1, f);
+            fclose(f);
+        }
+        Buffer fromFile = Buffer::mapFile(path, {false, MADV_SEQUENTIAL, false});
+        long long sum = 0;
+        for (size_t i = 0; i < fromFile.size(); ++i) sum += fromFile[i];
+        cout << "mapFile: " << fromFile.size() << " ints mapped, sum " << sum << endl;
+        remove(path);
+    }
+
+    cout << "\n=== Benchmark: 128MB buffer create + first fill ===" << endl;
+    constexpr size_t INTS = (128u << 20) / sizeof(int);
+    benchmarkBufferCreation("zeroed (default)", INTS, [](size_t n) { return Buffer(n); });
+    benchmarkBufferCreation("forOverwrite    ", INTS, [](size_t n) { return Buffer::forOverwrite(n); });
+    benchmarkBufferCreation("mmap anonymous  ", INTS, [](size_t n) { return Buffer::mapAnonymous(n); });
+#ifdef MAP_POPULATE
+    benchmarkBufferCreation("mmap + POPULATE ", INTS, [](size_t n) { return Buffer::mapAnonymous(n, {true}); });
+#endif
+#ifdef MADV_HUGEPAGE
+    benchmarkBufferCreation("mmap + HUGEPAGE ", INTS,
+                            [](size_t n) { return Buffer::mapAnonymous(n, {false, MADV_HUGEPAGE}); });
+#endif
+
+    cout << "\n=== BufferChain (scatter-gather) ===" << endl;
+    BufferChain response;
+    static const char headerText[] = "HEADER|";
+    response.append(string("body-owned-by-chain"));
+    response.prepend(headerText, sizeof(headerText) - 1);
+    response.append("|TRAILER", 8);
+    cout << "segments " << response.segmentCount() << ", bytes " << response.size() << endl;
+
+    int pipeFds[2];
+    if (::pipe(pipeFds) != 0) throwErrno("pipe");
+    size_t written = response.writeTo(pipeFds[1]);
+    ::close(pipeFds[1]);
+    BufferChain received;
+    while (received.readFrom(pipeFds[0], 8, 4) > 0) {}     // 작은 블록으로 readv 여러 번
+    ::close(pipeFds[0]);
+    cout << "writev " << written << " bytes → readv into " << received.segmentCount() << " segments: "
+         << received.flatten() << endl;
+
+    cout << "\n=== Benchmark: concat+write vs BufferChain+sendmsg (AF_UNIX) ===" << endl;
+    for (size_t bodySize : {256, 4096, 65536}) benchmarkResponses(bodySize);
+#endif
     return 0;
 }
@@ -1,24 +1,501 @@
 /* C++ Watchdog - chrono */
 #include <iostream>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#ifdef __linux__
+#include <time.h>
+#endif
 using namespace std;
 using namespace chrono;
 
-class Watchdog {
-    time_point<steady_clock> lastKick;
+/*
+ * 시계 소스 (모두 chrono Clock 요구사항: rep/period/duration/time_point/now())
+ *  - PreciseClock: steady_clock 그대로 (vDSO clock_gettime)
+ *  - CoarseClock : 백그라운드 ticker가 갱신하는 캐시 값, now() = relaxed load 한 번
+ *                  CoarseClockTicker가 살아 있는 동안만 전진 (해상도 = tick 주기)
+ *  - TscClock    : invariant TSC(x86) / 가상 카운터(aarch64)를 steady_clock에 대해 보정
+ *                  사용할 수 없으면 steady_clock으로 대체
+ *  - 셋 다 steady_clock과 같은 epoch → time_point끼리 비교 가능
+ */
+using PreciseClock = steady_clock;
+
+struct CoarseClock {
+    using rep = steady_clock::rep;
+    using period = steady_clock::period;
+    using duration = steady_clock::duration;
+    using time_point = chrono::time_point<CoarseClock, duration>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept { return time_point(duration(cached.load(memory_order_relaxed))); }
+
+private:
+    friend class CoarseClockTicker;
+    static inline atomic<rep> cached{steady_clock::now().time_since_epoch().count()};
+};
+
+class CoarseClockTicker {
+    atomic<bool> running{true};
+    thread ticker;
+public:
+    explicit CoarseClockTicker(microseconds resolution = milliseconds(1))
+        : ticker([this, resolution]() {
+              while (running.load(memory_order_relaxed)) {
+                  CoarseClock::cached.store(steady_clock::now().time_since_epoch().count(), memory_order_relaxed);
+                  this_thread::sleep_for(resolution);
+              }
+          }) {}
+    ~CoarseClockTicker() {
+        running.store(false, memory_order_relaxed);
+        ticker.join();
+    }
+    CoarseClockTicker(const CoarseClockTicker&) = delete;
+    CoarseClockTicker& operator=(const CoarseClockTicker&) = delete;
+};
+
+struct TscClock {
+    using rep = steady_clock::rep;
+    using period = steady_clock::period;
+    using duration = steady_clock::duration;
+    using time_point = chrono::time_point<TscClock, duration>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept {
+        const Calibration& c = calibration();
+        if (!c.usable) [[unlikely]] return time_point(steady_clock::now().time_since_epoch());
+        double ticks = static_cast<double>(readCounter() - c.baseCounter);
+        return time_point(duration(c.baseNanos + static_cast<rep>(ticks * c.nanosPerTick)));
+    }
+
+    static bool usable() { return calibration().usable; }
+    static double ticksPerMicrosecond() {
+        const Calibration& c = calibration();
+        return c.usable ? 1e3 / c.nanosPerTick : 0.0;
+    }
+
+private:
+    struct Calibration {
+        bool usable = false;
+        uint64_t baseCounter = 0;
+        rep baseNanos = 0;
+        double nanosPerTick = 1.0;
+    };
+
+    static uint64_t readCounter() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t value;
+        asm volatile("isb; mrs %0, cntvct_el0" : "=r"(value));
+        return value;
+#else
+        return 0;
+#endif
+    }
+
+    static bool counterIsInvariant() {
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned eax, ebx, ecx, edx;
+        if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007) return false;
+        __cpuid(0x80000007, eax, ebx, ecx, edx);
+        return edx & (1u << 8);     // invariant TSC: 코어/전력 상태와 무관하게 일정 속도
+#elif defined(__aarch64__)
+        return true;                // 아키텍처상 고정 주파수 카운터
+#else
+        return false;
+#endif
+    }
+
+    // 처음 쓸 때 한 번: 10ms 간격 두 점으로 tick → ns 비율 계산
+    static Calibration calibrate() {
+        Calibration c;
+        if (!counterIsInvariant()) return c;
+        auto t0 = steady_clock::now();
+        uint64_t c0 = readCounter();
+        this_thread::sleep_for(milliseconds(10));
+        auto t1 = steady_clock::now();
+        uint64_t c1 = readCounter();
+        if (c1 <= c0) return c;
+        c.usable = true;
+        c.baseCounter = c1;
+        c.baseNanos = t1.time_since_epoch().count();
+        c.nanosPerTick = static_cast<double>(duration_cast<nanoseconds>(t1 - t0).count()) / (c1 - c0);
+        return c;
+    }
+
+    // 지역 static → 첫 호출에서만 10ms 보정, 이후 now()는 초기화 guard load 하나
+    // (정적 초기화에서 보정하면 TscClock을 안 쓰는 프로그램도 시작마다 10ms를 잃음)
+    static const Calibration& calibration() noexcept {
+        static const Calibration c = calibrate();
+        return c;
+    }
+};
+
+template<typename Clock = steady_clock>
+class BasicWatchdog {
+    typename Clock::time_point lastKick;
     int timeoutSec;
 public:
-    Watchdog(int timeout) : timeoutSec(timeout) { kick(); }
-    void kick() { lastKick = steady_clock::now(); }
+    BasicWatchdog(int timeout) : timeoutSec(timeout) { kick(); }
+    void kick() { lastKick = Clock::now(); }
     bool check() {
-        auto elapsed = duration_cast<seconds>(steady_clock::now() - lastKick).count();
+        auto elapsed = duration_cast<seconds>(Clock::now() - lastKick).count();
         return elapsed < timeoutSec;
     }
 };
 
+using Watchdog = BasicWatchdog<>;
+using CoarseWatchdog = BasicWatchdog<CoarseClock>;
+
+template<typename Clock>
+static void benchmarkClock(const char* name) {
+    constexpr int READS = 2000000;
+    typename Clock::rep sink = 0;
+    auto start = steady_clock::now();
+    for (int i = 0; i < READS; ++i) sink += Clock::now().time_since_epoch().count() & 1;
+    double ns = duration<double, nano>(steady_clock::now() - start).count() / READS;
+    cout << "  " << name << ": " << ns << " ns/read (sink " << sink << ")" << endl;
+}
+
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+// 비교용: 커널 coarse 시계 (jiffy 해상도, vDSO)
+struct KernelCoarseClock {
+    using rep = steady_clock::rep;
+    using period = nano;
+    using duration = nanoseconds;
+    using time_point = chrono::time_point<KernelCoarseClock, duration>;
+    static time_point now() noexcept {
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+        return time_point(duration(ts.tv_sec * 1000000000LL + ts.tv_nsec));
+    }
+};
+#endif
+
+/*
+ * WatchdogManager - 수천 개 작업을 감시하는 타이밍 휠 watchdog
+ *  - watch(name, timeout, onExpire) → Handle, Handle 소멸 시 감시 해제
+ *  - kick(): 감독 스레드가 1ms마다 갱신하는 coarse 시각을 relaxed store 한 번
+ *    (kick은 휠을 건드리지 않음)
+ *  - 감독 스레드 하나가 계층 타이밍 휠(4단계 x 64슬롯, 1ms 틱)을 돌림
+ *    → 틱마다 해당 슬롯만 처리 = O(만료 후보)
+ *  - 슬롯이 터지면 lastKick + timeout을 확인: 그 사이 kick됐으면 새 마감 시각으로 재배치,
+ *    아니면 onExpire 호출 후 timeout 뒤에 다시 검사 (조용한 동안 timeout마다 반복 통지)
+ *  - 등록/해제는 mutex로 감독 스레드에 넘기고, 휠 자체는 감독 스레드만 만짐
+ *  - Handle::reset()은 실행 중인 onExpire가 끝날 때까지 기다림 → 반환 뒤에는 콜백이 다시 불리지 않음
+ *    (콜백 안에서 자기 Handle을 reset하면 기다리지 않고 취소만 표시)
+ *  - Handle은 manager보다 먼저 소멸해야 함
+ */
+class WatchdogManager {
+public:
+    using Callback = function<void(const string& name, uint64_t silentMs)>;
+
+private:
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOTS = size_t{1} << SLOT_BITS;
+    static constexpr size_t LEVELS = 4;
+    static constexpr uint64_t MAX_DELTA = (uint64_t{1} << (SLOT_BITS * LEVELS)) - 1;
+
+    struct Task {
+        string name;
+        uint64_t timeoutMs;
+        Callback onExpire;
+        atomic<uint64_t> lastKick;
+        bool cancelled = false;         // callbackLock 아래에서만 읽고 씀
+        // 이하 감독 스레드 전용
+        size_t ownerIndex = 0;
+        Task* prev = nullptr;
+        Task* next = nullptr;
+        uint64_t deadline = 0;
+        uint8_t level = 0;
+        uint8_t slot = 0;
+        bool linked = false;
+    };
+
+    atomic<uint64_t> coarseNowMs{0};
+    steady_clock::time_point epoch = steady_clock::now();
+    atomic<bool> running{true};
+    atomic<uint64_t> expiredCount{0};
+    atomic<size_t> watchedCount{0};
+
+    mutex pendingLock;
+    mutex callbackLock;             // onExpire 실행 ↔ 해제 직렬화
+    vector<unique_ptr<Task>> pendingAdds;
+    vector<Task*> pendingRemoves;
+
+    // 감독 스레드 전용
+    vector<unique_ptr<Task>> tasks;
+    array<array<Task*, SLOTS>, LEVELS> heads{};
+    uint64_t current = 0;
+    thread supervisor;
+
+    static size_t slotOf(uint64_t tick, size_t level) { return (tick >> (SLOT_BITS * level)) & (SLOTS - 1); }
+
+    void link(Task* t, uint64_t deadline) {
+        t->deadline = max(deadline, current + 1);
+        uint64_t delta = t->deadline - current;
+        uint64_t placed = delta > MAX_DELTA ? current + MAX_DELTA : t->deadline;
+        size_t level = 0;
+        while (level + 1 < LEVELS && delta >= (uint64_t{1} << (SLOT_BITS * (level + 1)))) ++level;
+        size_t slot = slotOf(placed, level);
+        t->level = static_cast<uint8_t>(level);
+        t->slot = static_cast<uint8_t>(slot);
+        t->prev = nullptr;
+        t->next = heads[level][slot];
+        if (t->next) t->next->prev = t;
+        heads[level][slot] = t;
+        t->linked = true;
+    }
+
+    void unlink(Task* t) {
+        if (!t->linked) return;
+        if (t->prev) t->prev->next = t->next;
+        else heads[t->level][t->slot] = t->next;
+        if (t->next) t->next->prev = t->prev;
+        t->linked = false;
+    }
+
+    void cascade(size_t level, size_t slot) {
+        Task* t = heads[level][slot];
+        heads[level][slot] = nullptr;
+        while (t) {
+            Task* next = t->next;
+            t->linked = false;
+            link(t, t->deadline);
+            t = next;
+        }
+    }
+
+    void fire(Task* t) {
+        uint64_t kicked = t->lastKick.load(memory_order_relaxed);
+        uint64_t deadline = kicked + t->timeoutMs;
+        if (deadline > current) {       // 그 사이 kick됨 → 새 마감으로 재배치
+            link(t, deadline);
+            return;
+        }
+        {
+            lock_guard<mutex> guard(callbackLock);
+            if (t->cancelled) return;   // 해제됨 → 재배치 없이 applyPending이 정리
+            expiredCount.fetch_add(1, memory_order_relaxed);
+            t->onExpire(t->name, current - kicked);
+            if (t->cancelled) return;   // 콜백이 스스로 reset
+        }
+        link(t, current + t->timeoutMs);
+    }
+
+    void advance(uint64_t nowTick) {
+        if (tasks.empty()) {
+            current = nowTick;
+            return;
+        }
+        while (current < nowTick) {
+            ++current;
+            for (size_t level = 1; level < LEVELS && slotOf(current, level - 1) == 0; ++level)
+                cascade(level, slotOf(current, level));
+            Task* t = heads[0][slotOf(current, 0)];
+            heads[0][slotOf(current, 0)] = nullptr;
+            while (t) {
+                Task* next = t->next;
+                t->linked = false;
+                fire(t);
+                t = next;
+            }
+        }
+    }
+
+    void applyPending() {
+        vector<unique_ptr<Task>> adds;
+        vector<Task*> removes;
+        {
+            lock_guard<mutex> guard(pendingLock);
+            adds.swap(pendingAdds);
+            removes.swap(pendingRemoves);
+        }
+        for (auto& t : adds) {
+            t->ownerIndex = tasks.size();
+            link(t.get(), t->lastKick.load(memory_order_relaxed) + t->timeoutMs);
+            tasks.push_back(std::move(t));
+        }
+        for (Task* t : removes) {       // 같은 배치의 등록이 먼저 처리되므로 항상 tasks 안에 있음
+            unlink(t);
+            size_t index = t->ownerIndex;
+            swap(tasks[index], tasks.back());
+            tasks[index]->ownerIndex = index;
+            tasks.pop_back();
+        }
+    }
+
+    void supervise() {
+        while (running.load(memory_order_relaxed)) {
+            this_thread::sleep_for(milliseconds(1));
+            uint64_t now = duration_cast<milliseconds>(steady_clock::now() - epoch).count();
+            coarseNowMs.store(now, memory_order_relaxed);
+            applyPending();
+            advance(now);
+        }
+    }
+
+public:
+    class Handle {
+        friend class WatchdogManager;
+        WatchdogManager* manager = nullptr;
+        Task* task = nullptr;
+        Handle(WatchdogManager* manager, Task* task) : manager(manager), task(task) {}
+    public:
+        Handle() = default;
+        Handle(Handle&& other) noexcept : manager(exchange(other.manager, nullptr)), task(exchange(other.task, nullptr)) {}
+        Handle& operator=(Handle&& other) noexcept {
+            if (this != &other) {
+                reset();
+                manager = exchange(other.manager, nullptr);
+                task = exchange(other.task, nullptr);
+            }
+            return *this;
+        }
+        ~Handle() { reset(); }
+
+        void kick() { task->lastKick.store(manager->coarseNowMs.load(memory_order_relaxed), memory_order_relaxed); }
+
+        void reset() {
+            if (!task) return;
+            manager->unwatch(task);
+            manager = nullptr;
+            task = nullptr;
+        }
+        explicit operator bool() const { return task != nullptr; }
+    };
+
+    WatchdogManager() : supervisor([this]() { supervise(); }) {}
+    ~WatchdogManager() {
+        running.store(false, memory_order_relaxed);
+        supervisor.join();
+    }
+    WatchdogManager(const WatchdogManager&) = delete;
+    WatchdogManager& operator=(const WatchdogManager&) = delete;
+
+    Handle watch(string name, milliseconds timeout, Callback onExpire) {
+        auto task = make_unique<Task>();
+        task->name = std::move(name);
+        task->timeoutMs = max<uint64_t>(1, timeout.count());
+        task->onExpire = std::move(onExpire);
+        task->lastKick.store(coarseNowMs.load(memory_order_relaxed), memory_order_relaxed);
+        Task* raw = task.get();
+        {
+            lock_guard<mutex> guard(pendingLock);
+            pendingAdds.push_back(std::move(task));
+        }
+        watchedCount.fetch_add(1, memory_order_relaxed);
+        return Handle(this, raw);
+    }
+
+    size_t watched() const { return watchedCount.load(memory_order_relaxed); }
+    uint64_t expirations() const { return expiredCount.load(memory_order_relaxed); }
+
+private:
+    void unwatch(Task* task) {
+        if (this_thread::get_id() == supervisor.get_id()) {
+            task->cancelled = true;     // 콜백 안: callbackLock은 이미 이 스레드가 잡고 있음
+        } else {
+            lock_guard<mutex> guard(callbackLock);
+            task->cancelled = true;
+        }
+        lock_guard<mutex> guard(pendingLock);
+        pendingRemoves.push_back(task);
+        watchedCount.fetch_sub(1, memory_order_relaxed);
+    }
+};
+
 int main() {
     cout << "=== C++ Watchdog ===" << endl;
     Watchdog wd(3);
     cout << "Status: " << (wd.check() ? "OK" : "Timeout") << endl;
+
+    cout << "\n=== Clock sources ===" << endl;
+    {
+        CoarseClockTicker ticker;
+        CoarseWatchdog coarse(3);
+        TscClock::time_point tscStart = TscClock::now();
+        this_thread::sleep_for(milliseconds(5));
+        auto tscElapsed = duration_cast<microseconds>(TscClock::now() - tscStart).count();
+        cout << "CoarseWatchdog status: " << (coarse.check() ? "OK" : "Timeout") << endl;
+        cout << "TSC usable: " << TscClock::usable() << " (" << TscClock::ticksPerMicrosecond()
+             << " ticks/us), sleep 5ms measured " << tscElapsed << " us" << endl;
+        auto drift = duration_cast<microseconds>(steady_clock::now().time_since_epoch() -
+                                                 TscClock::now().time_since_epoch()).count();
+        cout << "steady - tsc: " << drift << " us" << endl;
+
+        cout << "\n=== Benchmark: cost per read ===" << endl;
+        benchmarkClock<steady_clock>("steady_clock        ");
+        benchmarkClock<high_resolution_clock>("high_resolution     ");
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+        benchmarkClock<KernelCoarseClock>("MONOTONIC_COARSE    ");
+#endif
+        benchmarkClock<TscClock>("TscClock            ");
+        benchmarkClock<CoarseClock>("CoarseClock (cached)");
+    }
+
+    cout << "\n=== WatchdogManager (timing wheel, 1ms) ===" << endl;
+    {
+        constexpr int TASKS = 3000;
+        constexpr int STALLED = 5;          // 앞의 5개는 kick하지 않음
+        vector<atomic<int>> fired(TASKS);   // 콜백이 참조 → manager(감독 스레드)보다 오래 살아야 함
+        WatchdogManager manager;
+        vector<WatchdogManager::Handle> handles;
+        for (int i = 0; i < TASKS; ++i) {
+            handles.push_back(manager.watch("worker-" + to_string(i), milliseconds(20 + i % 30),
+                                            [&fired, i](const string&, uint64_t) { fired[i]++; }));
+        }
+        handles.push_back(manager.watch("stuck-job", milliseconds(30), [](const string& name, uint64_t silentMs) {
+            cout << "  [watchdog] " << name << " silent for " << silentMs << " ms" << endl;
+        }));
+        cout << "watching " << manager.watched() << " tasks" << endl;
+
+        auto start = steady_clock::now();
+        while (steady_clock::now() - start < milliseconds(100)) {
+            for (int i = STALLED; i < TASKS; ++i) handles[i].kick();
+            this_thread::sleep_for(milliseconds(5));
+        }
+        int stalledFired = 0, healthyFired = 0;
+        for (int i = 0; i < TASKS; ++i) (i < STALLED ? stalledFired : healthyFired) += fired[i] > 0;
+        cout << "stalled tasks expired: " << stalledFired << "/" << STALLED
+             << ", healthy tasks expired: " << healthyFired << ", total expirations " << manager.expirations() << endl;
+
+        constexpr int KICKS = 1000000;
+        auto kickStart = steady_clock::now();
+        for (int i = 0; i < KICKS; ++i) handles[STALLED + i % (TASKS - STALLED)].kick();
+        cout << "kick(): " << duration<double, nano>(steady_clock::now() - kickStart).count() / KICKS << " ns" << endl;
+        handles.clear();                    // manager보다 먼저 해제
+    }
+
+    cout << "\n=== Handle::reset() waits for in-flight onExpire ===" << endl;
+    {
+        atomic<int> calls{0};
+        atomic<bool> inside{false};
+        WatchdogManager manager;
+        auto handle = manager.watch("slow-callback", milliseconds(1), [&](const string&, uint64_t) {
+            inside.store(true);
+            this_thread::sleep_for(milliseconds(10));
+            calls++;
+            inside.store(false);
+        });
+        while (!inside.load()) this_thread::sleep_for(microseconds(100));
+        handle.reset();                     // 콜백이 도는 중 → 끝날 때까지 대기
+        bool stillInside = inside.load();
+        int atReset = calls.load();
+        this_thread::sleep_for(milliseconds(30));
+        cout << "inside after reset: " << stillInside << ", calls after reset: " << calls.load() - atReset << endl;
+    }
     return 0;
 }
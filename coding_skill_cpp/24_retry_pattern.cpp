@@ -1,6 +1,22 @@
 /* C++ Retry - 템플릿 함수 */
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
 using namespace std;
 
 template<typename Func>
@@ -16,6 +32,216 @@ bool retry(Func func, int maxRetries) {
     return false;
 }
 
+/*
+ * 재시도 정책
+ *  - 시도 횟수 제한 + 전체 시간 한도(deadline)
+ *  - 지연: base * 2^n 을 maxDelay로 자르고 jitter 적용
+ *    Full        : uniform(0, 지연)                 → 동시 실패한 호출들이 흩어짐
+ *    Decorrelated: min(maxDelay, uniform(base, 직전 지연 * 3))
+ *  - retryable: error_code 분류 (기본은 모두 재시도)
+ */
+enum class Jitter { None, Full, Decorrelated };
+
+struct RetryPolicy {
+    int maxAttempts = 5;
+    chrono::milliseconds baseDelay{10};
+    chrono::milliseconds maxDelay{1000};
+    chrono::milliseconds deadline{10000};
+    Jitter jitter = Jitter::Full;
+    function<bool(const error_code&)> retryable = [](const error_code&) { return true; };
+};
+
+static chrono::milliseconds nextDelay(const RetryPolicy& policy, int failedAttempts, chrono::milliseconds previous,
+                                      mt19937_64& rng) {
+    using ms = chrono::milliseconds;
+    int shift = min(failedAttempts - 1, 30);
+    ms exponential = min(policy.maxDelay, ms(policy.baseDelay.count() << shift));
+    switch (policy.jitter) {
+    case Jitter::None:
+        return exponential;
+    case Jitter::Full:
+        return ms(uniform_int_distribution<ms::rep>(0, exponential.count())(rng));
+    case Jitter::Decorrelated: {
+        ms::rep low = policy.baseDelay.count();
+        ms::rep high = max(low, max(previous, policy.baseDelay).count() * 3);
+        return min(policy.maxDelay, ms(uniform_int_distribution<ms::rep>(low, high)(rng)));
+    }
+    }
+    return exponential;
+}
+
+/*
+ * RetryBudget - 작업 종류별 재시도 토큰 버킷
+ *  - 첫 시도마다 ratio만큼 적립, 재시도는 1개 소비 (최대 maxTokens)
+ *  - 의존 서비스가 죽으면 토큰이 바닥나 재시도가 원래 요청 대비 ratio 비율로 제한됨
+ */
+class RetryBudget {
+    mutex lock;
+    double tokens;
+    double ratio;
+    double maxTokens;
+public:
+    RetryBudget(double ratio, double maxTokens) : tokens(maxTokens), ratio(ratio), maxTokens(maxTokens) {}
+    void recordRequest() {
+        lock_guard<mutex> guard(lock);
+        tokens = min(maxTokens, tokens + ratio);
+    }
+    bool tryWithdraw() {
+        lock_guard<mutex> guard(lock);
+        if (tokens < 1.0) return false;
+        tokens -= 1.0;
+        return true;
+    }
+};
+
+struct RetryOutcome {
+    bool succeeded = false;
+    int attempts = 0;
+    error_code lastError;
+    exception_ptr lastException;
+    const char* stopReason = "";            // success / attempts / deadline / budget / not-retryable
+    chrono::milliseconds elapsed{0};
+};
+
+/*
+ * RetryScheduler - 모든 재시도를 스레드 하나의 타이머 큐에서 실행
+ *  - 호출자는 submit() 후 바로 반환 (future 또는 완료 콜백)
+ *  - 실패하면 다음 시도를 지연 후 큐에 다시 넣음 → 대기 중에 잠자는 스레드 없음
+ *  - 작업 형태: error_code를 반환 (0 = 성공) 또는 void 반환 + 예외로 실패
+ *  - 시도는 타이머 스레드에서 실행되므로 짧은 비차단 작업이어야 함
+ */
+class RetryScheduler {
+    using Clock = chrono::steady_clock;
+    struct Timer {
+        Clock::time_point due;
+        uint64_t sequence;
+        function<void()> fn;
+        bool operator>(const Timer& other) const {
+            return due != other.due ? due > other.due : sequence > other.sequence;
+        }
+    };
+
+    mutex lock;
+    condition_variable changed;
+    priority_queue<Timer, vector<Timer>, greater<Timer>> timers;
+    uint64_t sequence = 0;
+    bool stopping = false;
+    mt19937_64 rng{random_device{}()};      // 타이머 스레드에서만 사용
+    thread worker;
+
+    void runLoop() {
+        unique_lock<mutex> guard(lock);
+        for (;;) {
+            if (timers.empty()) {
+                if (stopping) return;
+                changed.wait(guard);
+                continue;
+            }
+            if (timers.top().due > Clock::now()) {
+                changed.wait_until(guard, timers.top().due);
+                continue;
+            }
+            auto fn = std::move(const_cast<Timer&>(timers.top()).fn);
+            timers.pop();
+            guard.unlock();
+            fn();
+            guard.lock();
+        }
+    }
+
+    void scheduleAt(Clock::time_point due, function<void()> fn) {
+        {
+            lock_guard<mutex> guard(lock);
+            timers.push({due, sequence++, std::move(fn)});
+        }
+        changed.notify_one();
+    }
+
+    template<typename Op>
+    struct Operation {
+        Op op;
+        RetryPolicy policy;
+        RetryBudget* budget;
+        function<void(RetryOutcome)> done;
+        Operation(Op op, RetryPolicy policy, RetryBudget* budget, function<void(RetryOutcome)> done)
+            : op(std::move(op)), policy(std::move(policy)), budget(budget), done(std::move(done)) {}
+        RetryOutcome outcome;
+        Clock::time_point start = Clock::now();
+        chrono::milliseconds previousDelay{0};
+    };
+
+    template<typename Op>
+    void attempt(shared_ptr<Operation<Op>> state) {
+        RetryOutcome& out = state->outcome;
+        out.attempts++;
+        bool failed = false;
+        bool retryable = true;
+        if constexpr (is_same_v<invoke_result_t<Op&>, error_code>) {
+            out.lastError = state->op();
+            failed = static_cast<bool>(out.lastError);
+            if (failed) retryable = state->policy.retryable(out.lastError);
+        } else {
+            try {
+                state->op();
+            } catch (const system_error& e) {
+                failed = true;
+                out.lastError = e.code();
+                out.lastException = current_exception();
+                retryable = state->policy.retryable(e.code());
+            } catch (...) {
+                failed = true;
+                out.lastException = current_exception();
+            }
+        }
+
+        auto finish = [&](bool ok, const char* reason) {
+            out.succeeded = ok;
+            out.stopReason = reason;
+            out.elapsed = chrono::duration_cast<chrono::milliseconds>(Clock::now() - state->start);
+            if (state->done) state->done(std::move(out));
+        };
+
+        if (!failed) return finish(true, "success");
+        if (!retryable) return finish(false, "not-retryable");
+        if (out.attempts >= state->policy.maxAttempts) return finish(false, "attempts");
+        auto delay = nextDelay(state->policy, out.attempts, state->previousDelay, rng);
+        if (Clock::now() + delay > state->start + state->policy.deadline) return finish(false, "deadline");
+        if (state->budget && !state->budget->tryWithdraw()) return finish(false, "budget");
+        state->previousDelay = delay;
+        scheduleAt(Clock::now() + delay, [this, state]() { attempt(state); });
+    }
+
+public:
+    RetryScheduler() : worker([this]() { runLoop(); }) {}
+    // 남은 재시도까지 모두 끝난 뒤 종료
+    ~RetryScheduler() {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+        }
+        changed.notify_one();
+        worker.join();
+    }
+    RetryScheduler(const RetryScheduler&) = delete;
+    RetryScheduler& operator=(const RetryScheduler&) = delete;
+
+    template<typename Op>
+    void submit(Op op, RetryPolicy policy, function<void(RetryOutcome)> done, RetryBudget* budget = nullptr) {
+        auto state = make_shared<Operation<Op>>(std::move(op), std::move(policy), budget, std::move(done));
+        if (budget) budget->recordRequest();
+        scheduleAt(Clock::now(), [this, state]() { attempt(state); });
+    }
+
+    template<typename Op>
+    future<RetryOutcome> submit(Op op, RetryPolicy policy, RetryBudget* budget = nullptr) {
+        auto result = make_shared<promise<RetryOutcome>>();
+        auto f = result->get_future();
+        submit(std::move(op), std::move(policy), [result](RetryOutcome outcome) { result->set_value(std::move(outcome)); },
+               budget);
+        return f;
+    }
+};
+
 int main() {
     cout << "=== C++ Retry ===" << endl;
     int attempt = 0;
@@ -25,6 +251,85 @@ int main() {
         if (attempt < 3) throw runtime_error("Fail");
         cout << "[Success] Attempt " << attempt << endl;
     }, 5);
+
+    cout << "\n=== Backoff jitter (first 5 delays, base 10ms, cap 200ms) ===" << endl;
+    {
+        mt19937_64 rng(1);
+        for (Jitter jitter : {Jitter::None, Jitter::Full, Jitter::Decorrelated}) {
+            RetryPolicy policy;
+            policy.maxDelay = chrono::milliseconds(200);
+            policy.jitter = jitter;
+            cout << (jitter == Jitter::None ? "none        " : jitter == Jitter::Full ? "full        " : "decorrelated")
+                 << ":";
+            chrono::milliseconds previous{0};
+            for (int failed = 1; failed <= 5; ++failed) {
+                previous = nextDelay(policy, failed, previous, rng);
+                cout << " " << previous.count();
+            }
+            cout << " ms" << endl;
+        }
+    }
+
+    cout << "\n=== RetryScheduler (one timer thread, no sleeping callers) ===" << endl;
+    {
+        RetryScheduler scheduler;
+        RetryPolicy policy;
+        policy.baseDelay = chrono::milliseconds(2);
+        policy.maxDelay = chrono::milliseconds(20);
+
+        // 예외 방식: 처음 2번 실패
+        auto flakyCount = make_shared<atomic<int>>(0);
+        auto viaException = scheduler.submit([flakyCount]() {
+            if (++*flakyCount < 3) throw runtime_error("connection reset");
+        }, policy);
+
+        // error_code 방식: 재시도 불가 오류는 바로 중단
+        RetryPolicy strict = policy;
+        strict.retryable = [](const error_code& ec) { return ec != errc::permission_denied; };
+        auto denied = scheduler.submit([]() { return make_error_code(errc::permission_denied); }, strict);
+
+        // 동시 호출 200개가 절반 확률로 실패하는 의존 서비스에 접근
+        constexpr int CALLS = 200;
+        vector<future<RetryOutcome>> calls;
+        auto rng = make_shared<mt19937>(7);
+        for (int i = 0; i < CALLS; ++i) {
+            calls.push_back(scheduler.submit([rng]() {
+                return (*rng)() % 2 ? make_error_code(errc::resource_unavailable_try_again) : error_code{};
+            }, policy));
+        }
+
+        RetryOutcome e = viaException.get();
+        cout << "exception style: " << (e.succeeded ? "ok" : "failed") << " after " << e.attempts << " attempts, "
+             << e.elapsed.count() << " ms" << endl;
+        RetryOutcome d = denied.get();
+        cout << "error_code style: stopped (" << d.stopReason << ") after " << d.attempts << " attempt: "
+             << d.lastError.message() << endl;
+        map<int, int> histogram;
+        int succeeded = 0;
+        for (auto& f : calls) {
+            RetryOutcome o = f.get();
+            histogram[o.attempts]++;
+            succeeded += o.succeeded;
+        }
+        cout << CALLS << " flaky calls: " << succeeded << " succeeded, attempts histogram:";
+        for (auto [attempts, count] : histogram) cout << " " << attempts << "x" << count;
+        cout << endl;
+
+        // dead 의존 서비스: 예산 10% → 재시도가 원래 요청 수의 일부로 제한
+        RetryBudget budget(0.1, 10);
+        atomic<int> deadAttempts{0};
+        vector<future<RetryOutcome>> dead;
+        for (int i = 0; i < 100; ++i) {
+            dead.push_back(scheduler.submit([&deadAttempts]() {
+                deadAttempts++;
+                return make_error_code(errc::connection_refused);
+            }, policy, &budget));
+        }
+        int budgetStops = 0;
+        for (auto& f : dead) budgetStops += string(f.get().stopReason) == "budget";
+        cout << "dead dependency: 100 calls → " << deadAttempts << " attempts (" << budgetStops
+             << " stopped by budget, unbudgeted would be 500)" << endl;
+    }
     
     return 0;
 }
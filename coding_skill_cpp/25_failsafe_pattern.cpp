@@ -1,30 +1,300 @@
 /* C++ Failsafe - enum class */
 #include <iostream>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 using namespace std;
 
 enum class Mode { NORMAL, DEGRADED, SAFE };
 
-class System {
-    Mode mode = Mode::NORMAL;
-    int errors = 0;
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+/*
+ * CircuitBreaker - 슬라이딩 윈도우 실패율 기반 차단기
+ *  - CLOSED   : 모두 통과, 윈도우 실패율이 임계값을 넘으면 OPEN
+ *  - OPEN     : 모두 거부, openDuration 지나면 첫 allow()가 HALF_OPEN으로 전환
+ *  - HALF_OPEN: probe 몇 개만 통과, 모두 성공하면 CLOSED / 하나라도 실패하면 다시 OPEN
+ *  - 상태 + OPEN 해제 시각을 atomic 64비트 하나에 묶어 CAS로만 전이
+ *    → CLOSED에서 allow()는 relaxed load 한 번
+ *    HALF_OPEN에서는 같은 자리에 probe 발급 / 성공 수를 담음 → 전환 CAS가 곧 카운터 리셋 (따로 리셋하면 초과 발급)
+ *  - 윈도우 = BUCKETS개 시간 버킷 x STRIPES개 스트라이프 (스레드별로 다른 cache line에 기록)
+ *    버킷은 epoch(버킷 번호)가 바뀌면 처음 쓰는 스레드가 0으로 리셋 (리셋 경계의 몇 건은 근사치)
+ */
+struct BreakerConfig {
+    chrono::milliseconds window{10000};
+    double failureRateThreshold = 0.5;
+    uint32_t minimumRequests = 20;      // 표본이 적을 때 한두 건 실패로 열리지 않도록
+    chrono::milliseconds openDuration{5000};
+    uint32_t halfOpenProbes = 3;        // 1 ~ 65535로 맞춤 (0이면 HALF_OPEN에서 영영 닫히지 않음)
+};
+
+class CircuitBreaker {
 public:
-    void reportError() {
-        errors++;
-        if (errors >= 3 && mode == Mode::NORMAL) {
-            mode = Mode::DEGRADED;
-            cout << "[Failsafe] → DEGRADED" << endl;
+    enum class State : uint8_t { Closed, Open, HalfOpen };
+    using Config = BreakerConfig;
+
+private:
+    static constexpr size_t BUCKETS = 10;
+    static constexpr size_t STRIPES = 8;
+
+    struct alignas(CACHE_LINE_SIZE) Bucket {
+        atomic<uint64_t> epoch{0};
+        atomic<uint32_t> successes{0};
+        atomic<uint32_t> failures{0};
+    };
+
+    Config config;
+    uint64_t bucketMs;
+    chrono::steady_clock::time_point origin = chrono::steady_clock::now();
+    alignas(CACHE_LINE_SIZE) atomic<uint64_t> word{pack(State::Closed, 0)};    // (openUntilMs << 2) | state
+    array<array<Bucket, BUCKETS>, STRIPES> buckets;
+    function<void(State)> onTransition;
+
+    static uint64_t pack(State state, uint64_t openUntil) { return openUntil << 2 | static_cast<uint64_t>(state); }
+    static State stateOf(uint64_t w) { return static_cast<State>(w & 3); }
+    static uint64_t openUntilOf(uint64_t w) { return w >> 2; }
+
+    // HALF_OPEN 전용: word = (성공 수 << 18) | (발급 수 << 2) | state, 각 16비트
+    static constexpr uint64_t PROBE_MASK = 0xFFFF;
+    static constexpr uint64_t PROBE_ISSUED_ONE = uint64_t{1} << 2;
+    static constexpr uint64_t PROBE_OK_ONE = uint64_t{1} << 18;
+    static uint64_t probesIssuedOf(uint64_t w) { return w >> 2 & PROBE_MASK; }
+    static uint64_t probeSuccessesOf(uint64_t w) { return w >> 18 & PROBE_MASK; }
+    uint64_t probeLimit() const { return config.halfOpenProbes; }     // 생성자에서 [1, PROBE_MASK]로 맞춤
+
+    // 0 epoch은 "미사용"으로 쓰므로 +1
+    uint64_t nowMs() const {
+        return static_cast<uint64_t>(
+            chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - origin).count()) + 1;
+    }
+
+    static size_t stripeIndex() {
+        static atomic<size_t> nextStripe{0};
+        thread_local size_t stripe = nextStripe.fetch_add(1, memory_order_relaxed) % STRIPES;
+        return stripe;
+    }
+
+    bool transition(uint64_t expected, State to, uint64_t openUntil) {
+        if (!word.compare_exchange_strong(expected, pack(to, openUntil), memory_order_acq_rel)) return false;
+        if (to == State::Closed) resetWindow();
+        if (onTransition) onTransition(to);
+        return true;
+    }
+
+    void resetWindow() {
+        for (auto& stripe : buckets)
+            for (auto& b : stripe) b.epoch.store(0, memory_order_relaxed);
+    }
+
+    void count(bool success, uint64_t now) {
+        uint64_t epoch = now / bucketMs + 1;
+        Bucket& b = buckets[stripeIndex()][epoch % BUCKETS];
+        uint64_t seen = b.epoch.load(memory_order_relaxed);
+        if (seen != epoch && b.epoch.compare_exchange_strong(seen, epoch, memory_order_relaxed)) {
+            b.successes.store(0, memory_order_relaxed);
+            b.failures.store(0, memory_order_relaxed);
+        }
+        (success ? b.successes : b.failures).fetch_add(1, memory_order_relaxed);
+    }
+
+    // 윈도우 안(현재 epoch 기준 BUCKETS개) 버킷만 합산
+    void windowTotals(uint64_t now, uint64_t& successes, uint64_t& failures) const {
+        uint64_t current = now / bucketMs + 1;
+        successes = failures = 0;
+        for (const auto& stripe : buckets) {
+            for (const auto& b : stripe) {
+                uint64_t epoch = b.epoch.load(memory_order_relaxed);
+                if (epoch == 0 || epoch + BUCKETS <= current) continue;
+                successes += b.successes.load(memory_order_relaxed);
+                failures += b.failures.load(memory_order_relaxed);
+            }
+        }
+    }
+
+public:
+    explicit CircuitBreaker(Config config = Config{}, function<void(State)> onTransition = nullptr)
+        : config(config), bucketMs(max<uint64_t>(1, config.window.count() / BUCKETS)),
+          onTransition(std::move(onTransition)) {
+        this->config.halfOpenProbes = clamp<uint32_t>(config.halfOpenProbes, 1, PROBE_MASK);
+    }
+    CircuitBreaker(const CircuitBreaker&) = delete;
+    CircuitBreaker& operator=(const CircuitBreaker&) = delete;
+
+    bool allow() {
+        uint64_t w = word.load(memory_order_relaxed);
+        if (stateOf(w) == State::Closed) [[likely]] return true;
+        return allowSlow(w);
+    }
+
+    void record(bool success) {
+        uint64_t w = word.load(memory_order_relaxed);
+        uint64_t now = nowMs();
+        switch (stateOf(w)) {
+        case State::Closed: {
+            count(success, now);
+            if (success) return;
+            uint64_t ok, failed;
+            windowTotals(now, ok, failed);
+            uint64_t total = ok + failed;
+            if (total >= config.minimumRequests && failed >= config.failureRateThreshold * total)
+                transition(w, State::Open, now + config.openDuration.count());
+            return;
+        }
+        case State::HalfOpen:
+            if (!success) {
+                transition(w, State::Open, now + config.openDuration.count());
+                return;
+            }
+            while (stateOf(w) == State::HalfOpen) {
+                if (probeSuccessesOf(w) + 1 >= probeLimit()) {
+                    if (transition(w, State::Closed, 0)) return;
+                    w = word.load(memory_order_relaxed);
+                } else if (word.compare_exchange_weak(w, w + PROBE_OK_ONE, memory_order_acq_rel, memory_order_relaxed)) {
+                    return;
+                }
+            }
+            return;
+        case State::Open:
+            return;     // OPEN 직전에 통과했던 호출의 늦은 결과는 무시
+        }
+    }
+
+    State state() const { return stateOf(word.load(memory_order_relaxed)); }
+
+private:
+    bool allowSlow(uint64_t w) {
+        if (stateOf(w) == State::Open) {
+            if (nowMs() < openUntilOf(w)) return false;
+            transition(w, State::HalfOpen, 0);      // 실패해도 다른 스레드가 이미 전환
+            w = word.load(memory_order_relaxed);
+        }
+        // 발급 수는 상태와 같은 word에서 CAS로 올림 → 다른 전환과 겹쳐도 한 HALF_OPEN 구간에 probeLimit개까지만
+        for (;;) {
+            if (stateOf(w) != State::HalfOpen) return stateOf(w) == State::Closed;
+            if (probesIssuedOf(w) >= probeLimit()) return false;
+            if (word.compare_exchange_weak(w, w + PROBE_ISSUED_ONE, memory_order_acq_rel, memory_order_relaxed)) return true;
         }
     }
+};
+
+// 차단기 상태를 운영 모드로 노출: OPEN/HALF_OPEN 동안 DEGRADED, 닫히면 NORMAL로 복귀
+class System {
+    atomic<Mode> mode{Mode::NORMAL};
+    CircuitBreaker breaker;
+
+    static CircuitBreaker::Config demoConfig() {
+        CircuitBreaker::Config config;
+        config.window = chrono::milliseconds(1000);
+        config.minimumRequests = 3;
+        config.openDuration = chrono::milliseconds(20);
+        config.halfOpenProbes = 2;
+        return config;
+    }
+
+public:
+    System() : breaker(demoConfig(), [this](CircuitBreaker::State s) {
+        Mode next = s == CircuitBreaker::State::Closed ? Mode::NORMAL : Mode::DEGRADED;
+        if (mode.exchange(next) != next) cout << "[Failsafe] → " << (next == Mode::NORMAL ? "NORMAL" : "DEGRADED") << endl;
+    }) {}
+
+    void reportError() { breaker.record(false); }
+    void reportSuccess() { breaker.record(true); }
+    bool allow() { return breaker.allow(); }
     
     void operate() {
-        cout << "[System] Mode: " << static_cast<int>(mode) << endl;
+        cout << "[System] Mode: " << static_cast<int>(mode.load()) << endl;
     }
 };
 
+// 24_retry_pattern.cpp의 retry()와 같은 구조 + 차단기: 열려 있으면 시도하지 않고 즉시 포기
+template<typename Func>
+bool retry(Func func, int maxRetries, CircuitBreaker& breaker) {
+    for (int i = 1; i <= maxRetries; ++i) {
+        if (!breaker.allow()) {
+            cout << "[Retry] circuit open, giving up after " << i - 1 << " attempts" << endl;
+            return false;
+        }
+        try {
+            func();
+            breaker.record(true);
+            return true;
+        } catch (...) {
+            breaker.record(false);
+            cout << "[Retry] Attempt " << i << " failed" << endl;
+        }
+    }
+    return false;
+}
+
+// 비교용: mutex 하나로 보호하는 단순 차단기 (allow/record 모두 lock)
+class LockedBreaker {
+    mutex lock;
+    bool open = false;
+    uint64_t failures = 0, total = 0;
+public:
+    bool allow() {
+        lock_guard<mutex> guard(lock);
+        return !open;
+    }
+    void record(bool success) {
+        lock_guard<mutex> guard(lock);
+        total++;
+        if (!success && ++failures * 2 > total && total > 1000000) open = true;
+    }
+};
+
+template<typename Breaker>
+static void benchmarkBreaker(const char* name, int threads) {
+    constexpr int OPS = 200000;
+    Breaker breaker;
+    atomic<long long> allowed{0};
+    vector<thread> workers;
+    auto start = chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            long long local = 0;
+            for (int i = 0; i < OPS; ++i) {
+                if (breaker.allow()) local++;
+                if ((i & 15) == 0) breaker.record(true);    // 결과 기록은 호출 16번에 1번
+            }
+            allowed += local;
+        });
+    }
+    for (auto& w : workers) w.join();
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / (OPS * threads);
+    cout << "  " << name << " x" << threads << ": " << ns << " ns/call (allowed " << allowed << ")" << endl;
+}
+
 int main() {
     cout << "=== C++ Failsafe ===" << endl;
     System sys;
     for (int i = 0; i < 5; ++i) sys.reportError();
     sys.operate();
+
+    cout << "\n=== Circuit breaker recovery ===" << endl;
+    cout << "allow while open: " << sys.allow() << endl;
+    this_thread::sleep_for(chrono::milliseconds(25));       // openDuration 경과 → HALF_OPEN probe
+    for (int i = 0; i < 2; ++i) {
+        if (sys.allow()) sys.reportSuccess();
+    }
+    sys.operate();
+
+    cout << "\n=== retry() gated by breaker ===" << endl;
+    CircuitBreaker::Config config;
+    config.minimumRequests = 3;
+    CircuitBreaker breaker(config);
+    retry([]() { throw runtime_error("dependency down"); }, 10, breaker);
+
+    cout << "\n=== Benchmark: allow()+record() hot path ===" << endl;
+    for (int threads : {1, 4}) {
+        benchmarkBreaker<CircuitBreaker>("CircuitBreaker", threads);
+        benchmarkBreaker<LockedBreaker>("mutex breaker ", threads);
+    }
     return 0;
 }
@@ -1,31 +1,240 @@
 /* C++ HAL - 추상 클래스 */
 #include <iostream>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 using namespace std;
 
 class IGPIO {
 public:
     virtual ~IGPIO() = default;
     virtual void write(int pin, bool value) = 0;
+    virtual uint32_t readPort() const = 0;
+
+    // mask의 핀들을 value의 같은 비트로 한 번에 (기본 구현은 핀별 write)
+    virtual void writeMasked(uint32_t mask, uint32_t value) {
+        for (int pin = 0; pin < 32; ++pin)
+            if (mask >> pin & 1) write(pin, value >> pin & 1);
+    }
 };
 
 class STM32_GPIO : public IGPIO {
+    uint32_t state = 0;
 public:
     void write(int pin, bool value) override {
         cout << "[STM32] GPIO " << pin << " = " << value << endl;
+        state = value ? state | 1u << pin : state & ~(1u << pin);
     }
+    uint32_t readPort() const override { return state; }
 };
 
 class Nordic_GPIO : public IGPIO {
+    uint32_t state = 0;
 public:
     void write(int pin, bool value) override {
         cout << "[Nordic] GPIO " << pin << " = " << value << endl;
+        state = value ? state | 1u << pin : state & ~(1u << pin);
     }
+    uint32_t readPort() const override { return state; }
 };
 
 void app_toggle_led(IGPIO& hal) {
     hal.write(5, true);
 }
 
+/*
+ * 정적 디스패치 HAL
+ *  - 레지스터 블록 주소를 템플릿 인자로 고정 → write()가 레지스터 store 한 번으로 inline
+ *  - 보드 선택은 빌드 시 HAL_BOARD로 (가상 호출/런타임 분기 없음)
+ *  - 실제 보드에서는 Regs가 고정 주소(예: 0x48000000)의 MMIO, 여기서는 메모리로 흉내
+ *  - 테스트/모킹용 가상 경로는 VirtualGpio<Port> 어댑터로 유지
+ */
+#define HAL_INLINE [[gnu::always_inline]] inline
+
+struct Stm32GpioRegisters {
+    volatile uint32_t ODR;      // 출력 데이터
+    volatile uint32_t BSRR;     // 하위 16비트 set, 상위 16비트 reset (원자적 비트 조작)
+};
+
+struct NordicGpioRegisters {
+    volatile uint32_t OUT;
+    volatile uint32_t OUTSET;   // 1인 비트만 set
+    volatile uint32_t OUTCLR;   // 1인 비트만 clear
+};
+
+inline Stm32GpioRegisters stm32GpioA{};
+inline NordicGpioRegisters nordicP0{};
+
+template<typename T>
+concept GpioPort = requires(T port, int pin, bool value, uint32_t mask) {
+    { port.write(pin, value) } -> same_as<void>;
+    { port.toggle(pin) } -> same_as<void>;
+    { port.writeMasked(mask, mask) } -> same_as<void>;
+    { port.readPort() } -> same_as<uint32_t>;
+};
+
+template<Stm32GpioRegisters& Regs>
+struct Stm32Gpio {
+    HAL_INLINE void write(int pin, bool value) {
+        Regs.BSRR = value ? 1u << pin : 1u << (pin + 16);
+        Regs.ODR = value ? Regs.ODR | 1u << pin : Regs.ODR & ~(1u << pin);   // 시뮬레이션: 하드웨어가 하는 반영
+    }
+    HAL_INLINE void toggle(int pin) { write(pin, !(Regs.ODR >> pin & 1)); }
+
+    // BSRR 한 번: set 비트와 reset 비트를 같은 store에 (핀 0~15)
+    HAL_INLINE void writeMasked(uint32_t mask, uint32_t value) {
+        Regs.BSRR = (mask & value) | (mask & ~value) << 16;
+        Regs.ODR = (Regs.ODR & ~mask) | (mask & value);     // 시뮬레이션
+    }
+    HAL_INLINE uint32_t readPort() const { return Regs.ODR; }
+};
+
+template<NordicGpioRegisters& Regs>
+struct NordicGpio {
+    HAL_INLINE void write(int pin, bool value) {
+        if (value) Regs.OUTSET = 1u << pin;
+        else Regs.OUTCLR = 1u << pin;
+        Regs.OUT = value ? Regs.OUT | 1u << pin : Regs.OUT & ~(1u << pin);   // 시뮬레이션
+    }
+    HAL_INLINE void toggle(int pin) { write(pin, !(Regs.OUT >> pin & 1)); }
+
+    // nRF는 set/clear 레지스터가 따로 → store 두 번 (OUT 직접 쓰기는 read-modify-write라 다른 핀과 경합)
+    HAL_INLINE void writeMasked(uint32_t mask, uint32_t value) {
+        Regs.OUTSET = mask & value;
+        Regs.OUTCLR = mask & ~value;
+        Regs.OUT = (Regs.OUT & ~mask) | (mask & value);     // 시뮬레이션
+    }
+    HAL_INLINE uint32_t readPort() const { return Regs.OUT; }
+};
+
+/*
+ * PinBus<Pins...> - 컴파일 타임 핀 목록으로 만든 병렬 버스
+ *  - MASK: 핀 목록에서 계산한 constexpr 마스크
+ *  - spread(): 값의 비트 i를 Pins[i] 위치로 (인접 핀이면 shift 하나로 접힘)
+ *  - write(): writeMasked 한 번 / read(): readPort 한 번
+ */
+template<int... Pins>
+struct PinBus {
+    static_assert(sizeof...(Pins) > 0 && sizeof...(Pins) <= 16, "bus width 1..16");
+    static_assert(((Pins >= 0 && Pins < 16) && ...), "BSRR-style ports have 16 pins");
+    static constexpr uint32_t MASK = ((1u << Pins) | ...);
+    static_assert(__builtin_popcount(MASK) == sizeof...(Pins), "duplicate pin in bus");
+    static constexpr int PIN_LIST[] = {Pins...};
+
+    static constexpr bool contiguous() {
+        for (size_t i = 1; i < sizeof...(Pins); ++i)
+            if (PIN_LIST[i] != PIN_LIST[0] + static_cast<int>(i)) return false;
+        return true;
+    }
+
+    static constexpr uint32_t spread(uint32_t value) {
+        if constexpr (contiguous()) {
+            return (value << PIN_LIST[0]) & MASK;
+        } else {
+            uint32_t out = 0;
+            for (size_t i = 0; i < sizeof...(Pins); ++i) out |= (value >> i & 1) << PIN_LIST[i];
+            return out;
+        }
+    }
+
+    static constexpr uint32_t gather(uint32_t port) {
+        uint32_t out = 0;
+        for (size_t i = 0; i < sizeof...(Pins); ++i) out |= (port >> PIN_LIST[i] & 1) << i;
+        return out;
+    }
+
+    template<GpioPort Gpio>
+    HAL_INLINE static void write(Gpio& hal, uint32_t value) { hal.writeMasked(MASK, spread(value)); }
+    static void write(IGPIO& hal, uint32_t value) { hal.writeMasked(MASK, spread(value)); }
+
+    template<GpioPort Gpio>
+    HAL_INLINE static uint32_t read(Gpio& hal) { return gather(hal.readPort()); }
+};
+
+using DataBus = PinBus<8, 9, 10, 11, 12, 13, 14, 15>;      // 8비트 병렬 버스 (인접)
+using LedRow = PinBus<0, 2, 4, 6>;                          // 흩어진 핀
+static_assert(DataBus::MASK == 0xFF00 && DataBus::spread(0xA5) == 0xA500);
+static_assert(LedRow::MASK == 0x55 && LedRow::spread(0b1011) == 0b01000101);
+
+// 빌드 시 보드 선택: -DHAL_BOARD=1 (STM32) / 2 (Nordic)
+#ifndef HAL_BOARD
+#define HAL_BOARD 1
+#endif
+#if HAL_BOARD == 1
+using BoardGpio = Stm32Gpio<stm32GpioA>;
+static const char* const BOARD_NAME = "STM32";
+#elif HAL_BOARD == 2
+using BoardGpio = NordicGpio<nordicP0>;
+static const char* const BOARD_NAME = "Nordic";
+#else
+#error "HAL_BOARD must be 1 (STM32) or 2 (Nordic)"
+#endif
+
+static_assert(GpioPort<BoardGpio>);
+
+// 가상 경로: 정적 포트를 IGPIO로 감싸 테스트 더블과 같은 인터페이스 제공
+template<GpioPort Port>
+class VirtualGpio : public IGPIO {
+    Port port;
+public:
+    void write(int pin, bool value) override { port.write(pin, value); }
+    void writeMasked(uint32_t mask, uint32_t value) override { port.writeMasked(mask, value); }
+    uint32_t readPort() const override { return const_cast<Port&>(port).readPort(); }
+};
+
+template<GpioPort Gpio>
+void app_toggle_led_static(Gpio& hal) {
+    hal.write(5, true);
+}
+
+// bit-bang: MSB부터 데이터 핀에 쓰고 클럭 핀 토글 (SPI 흉내)
+template<GpioPort Gpio>
+void bitbang_byte(Gpio& hal, uint8_t byte, int dataPin, int clockPin) {
+    for (int bit = 7; bit >= 0; --bit) {
+        hal.write(dataPin, byte >> bit & 1);
+        hal.write(clockPin, true);
+        hal.write(clockPin, false);
+    }
+}
+
+static uint64_t readCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(chrono::steady_clock::now().time_since_epoch().count());   // ns 단위
+#endif
+}
+
+// 8비트 버스 갱신: 핀별 8번 쓰기 vs 마스크 쓰기 1번
+template<typename Update>
+static void benchmarkBus(const char* name, Update update) {
+    constexpr int UPDATES = 1000000;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < UPDATES; ++i) update(static_cast<uint32_t>(i & 0xFF));
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << ": " << UPDATES / seconds / 1e6 << " M bus updates/s" << endl;
+}
+
+static void benchmarkToggle(IGPIO& virtualHal, BoardGpio& staticHal) {
+    constexpr int TOGGLES = 2000000;
+    uint64_t start = readCycles();
+    for (int i = 0; i < TOGGLES; ++i) virtualHal.write(3, i & 1);
+    double virtualCycles = static_cast<double>(readCycles() - start) / TOGGLES;
+    start = readCycles();
+    for (int i = 0; i < TOGGLES; ++i) staticHal.write(3, i & 1);
+    double staticCycles = static_cast<double>(readCycles() - start) / TOGGLES;
+#if defined(__x86_64__) || defined(__i386__)
+    const char* unit = "cycles";
+#else
+    const char* unit = "ns";
+#endif
+    cout << "  virtual IGPIO::write : " << virtualCycles << " " << unit << "/toggle" << endl;
+    cout << "  static  BoardGpio    : " << staticCycles << " " << unit << "/toggle" << endl;
+}
+
 int main() {
     cout << "=== C++ HAL ===" << endl;
     STM32_GPIO stm32;
@@ -33,6 +242,36 @@ int main() {
     
     app_toggle_led(stm32);
     app_toggle_led(nordic);
+
+    cout << "\n=== Static-dispatch HAL (board: " << BOARD_NAME << ") ===" << endl;
+    BoardGpio board;
+    app_toggle_led_static(board);
+    bitbang_byte(board, 0xA5, 1, 2);
+    cout << "STM32 ODR=0x" << hex << stm32GpioA.ODR << ", Nordic OUT=0x" << nordicP0.OUT << dec << endl;
+
+    VirtualGpio<BoardGpio> forTests;          // 같은 포트를 가상 경로로
+    IGPIO* volatile indirect = &forTests;     // 컴파일러가 devirtualize하지 못하게
+    app_toggle_led(*indirect);
+
+    cout << "\n=== Port-wide GPIO ===" << endl;
+    DataBus::write(board, 0x3C);
+    LedRow::write(board, 0b1001);
+    cout << "DataBus=0x" << hex << DataBus::read(board) << " LedRow=0x" << LedRow::read(board) << " port=0x"
+         << board.readPort() << dec << endl;
+
+    cout << "\n=== Benchmark: cost per pin write ===" << endl;
+    benchmarkToggle(*indirect, board);
+
+    cout << "\n=== Benchmark: 8-bit bus update ===" << endl;
+    IGPIO& virtualHal = *indirect;
+    benchmarkBus("virtual, per pin  ", [&](uint32_t v) {
+        for (int bit = 0; bit < 8; ++bit) virtualHal.write(8 + bit, v >> bit & 1);
+    });
+    benchmarkBus("static,  per pin  ", [&](uint32_t v) {
+        for (int bit = 0; bit < 8; ++bit) board.write(8 + bit, v >> bit & 1);
+    });
+    benchmarkBus("virtual, masked   ", [&](uint32_t v) { DataBus::write(virtualHal, v); });
+    benchmarkBus("static,  masked   ", [&](uint32_t v) { DataBus::write(board, v); });
     
     return 0;
 }
@@ -1,5 +1,27 @@
 /* C++ Driver Interface */
 #include <iostream>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <ctime>
+#if defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#define HAVE_POSIX_IO 1
+#endif
 using namespace std;
 
 class IDriver {
@@ -9,6 +31,29 @@ public:
     virtual int close() = 0;
     virtual int read(uint8_t* buf, size_t len) = 0;
     virtual int write(const uint8_t* buf, size_t len) = 0;
+
+    // vectored I/O: 기본 구현은 버퍼마다 read/write (드라이버가 gather DMA를 지원하면 override)
+    // 반환: 전체 바이트 수, 첫 오류(음수)에서 중단
+    virtual int writev(span<const span<const uint8_t>> buffers) {
+        int total = 0;
+        for (auto b : buffers) {
+            int rc = write(b.data(), b.size());
+            if (rc < 0) return rc;
+            total += rc;
+            if (static_cast<size_t>(rc) < b.size()) break;     // 짧은 쓰기
+        }
+        return total;
+    }
+    virtual int readv(span<const span<uint8_t>> buffers) {
+        int total = 0;
+        for (auto b : buffers) {
+            int rc = read(b.data(), b.size());
+            if (rc < 0) return rc;
+            total += rc;
+            if (static_cast<size_t>(rc) < b.size()) break;
+        }
+        return total;
+    }
 };
 
 class UARTDriver : public IDriver {
@@ -19,10 +64,513 @@ public:
     int write(const uint8_t* buf, size_t len) override { return len; }
 };
 
+/*
+ * IAsyncDriver - 완료 콜백 방식 드라이버
+ *  - submit_read/submit_write: 요청을 큐에 넣고 바로 반환 (0 = 접수, -EBUSY = 큐 가득 참)
+ *  - 완료 콜백은 인터럽트/DMA 완료 문맥(여기서는 하드웨어 시뮬레이션 스레드)에서 호출 → 짧게 유지
+ *  - future 버전과, future를 기다리는 동기 read/write도 제공 (busy-wait 없음)
+ *  - 버퍼는 완료 콜백이 불릴 때까지 호출자가 유지
+ */
+class IAsyncDriver : public IDriver {
+public:
+    using Completion = function<void(int result)>;     // result: 전송 바이트 수 또는 -errno
+
+    virtual int submit_read(uint8_t* buf, size_t len, Completion done) = 0;
+    virtual int submit_write(const uint8_t* buf, size_t len, Completion done) = 0;
+
+    future<int> submit_read(uint8_t* buf, size_t len) {
+        return submitWithFuture([&](Completion done) { return submit_read(buf, len, std::move(done)); });
+    }
+    future<int> submit_write(const uint8_t* buf, size_t len) {
+        return submitWithFuture([&](Completion done) { return submit_write(buf, len, std::move(done)); });
+    }
+
+    int read(uint8_t* buf, size_t len) override { return submit_read(buf, len).get(); }
+    int write(const uint8_t* buf, size_t len) override { return submit_write(buf, len).get(); }
+
+private:
+    template<typename Submit>
+    static future<int> submitWithFuture(Submit submit) {
+        auto result = make_shared<promise<int>>();
+        future<int> f = result->get_future();
+        int rc = submit([result](int r) { result->set_value(r); });
+        if (rc != 0) result->set_value(rc);     // 접수 실패는 즉시 완료
+        return f;
+    }
+};
+
+// SPSC 바이트 링 (14_ring_buffer.cpp의 SPSC 큐와 같은 head/tail 구조를 바이트 단위 bulk 복사로)
+template<size_t Capacity>
+class ByteRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+    array<uint8_t, Capacity> data;
+    atomic<size_t> head{0};     // 소비 위치
+    atomic<size_t> tail{0};     // 생산 위치
+public:
+    size_t push(const uint8_t* src, size_t len) {
+        size_t t = tail.load(memory_order_relaxed);
+        size_t n = min(len, Capacity - (t - head.load(memory_order_acquire)));
+        size_t first = min(n, Capacity - (t & (Capacity - 1)));
+        memcpy(&data[t & (Capacity - 1)], src, first);
+        memcpy(&data[0], src + first, n - first);
+        tail.store(t + n, memory_order_release);
+        return n;
+    }
+    size_t pop(uint8_t* dst, size_t len) {
+        size_t h = head.load(memory_order_relaxed);
+        size_t n = min(len, tail.load(memory_order_acquire) - h);
+        size_t first = min(n, Capacity - (h & (Capacity - 1)));
+        memcpy(dst, &data[h & (Capacity - 1)], first);
+        memcpy(dst + first, &data[0], n - first);
+        head.store(h + n, memory_order_release);
+        return n;
+    }
+    size_t size() const { return tail.load(memory_order_acquire) - head.load(memory_order_acquire); }
+};
+
+/*
+ * AsyncUartDriver - 링 버퍼 기반 UART (하드웨어는 스레드로 시뮬레이션, TX→RX loopback)
+ *  - TX: 요청 버퍼를 DMA burst 단위로 TX 링에 채우고, 선로 속도(bytesPerSecond)로 내보냄
+ *  - RX: 선로에서 들어온 바이트는 RX 링(circular DMA)에 쌓이고, 읽기 요청이 여기서 채워짐
+ *  - 요청 큐는 방향별 QUEUE_DEPTH개 고정 (초과 submit은 -EBUSY)
+ */
+class AsyncUartDriver : public IAsyncDriver {
+public:
+    static constexpr size_t QUEUE_DEPTH = 8;
+    static constexpr size_t BURST = 4096;
+
+private:
+    struct Request {
+        uint8_t* rxBuf = nullptr;
+        const uint8_t* txBuf = nullptr;
+        size_t len = 0;
+        size_t done = 0;
+        Completion completion;
+    };
+
+    // 고정 크기 요청 링 (mutex 보호)
+    struct RequestQueue {
+        array<Request, QUEUE_DEPTH> slots;
+        size_t head = 0, count = 0;
+        bool full() const { return count == QUEUE_DEPTH; }
+        Request& front() { return slots[head]; }
+        void push(Request r) { slots[(head + count++) % QUEUE_DEPTH] = std::move(r); }
+        Request pop() {
+            Request r = std::move(slots[head]);
+            head = (head + 1) % QUEUE_DEPTH;
+            --count;
+            return r;
+        }
+    };
+
+    ByteRing<16384> txRing;
+    ByteRing<16384> rxRing;
+    mutex lock;
+    condition_variable work;
+    RequestQueue txQueue, rxQueue;
+    bool opened = false;
+    bool stopping = false;
+    double bytesPerSecond;
+    atomic<uint64_t> overruns{0};
+    thread hardware;
+
+    // 하드웨어 + DMA + ISR 역할
+    void hardwareLoop() {
+        auto wireClock = chrono::steady_clock::now();
+        vector<uint8_t> shift(BURST);
+        unique_lock<mutex> guard(lock);
+        while (!stopping) {
+            bool txPending = txQueue.count > 0 || txRing.size() > 0;
+            bool rxReady = rxQueue.count > 0 && rxRing.size() > 0;
+            if (!txPending && !rxReady) {
+                work.wait(guard);
+                wireClock = max(wireClock, chrono::steady_clock::now());
+                continue;
+            }
+            vector<Completion> finished;
+            vector<int> results;
+            if (txQueue.count > 0) {        // DMA: 요청 버퍼 → TX 링
+                Request& r = txQueue.front();
+                r.done += txRing.push(r.txBuf + r.done, min(BURST, r.len - r.done));
+                if (r.done == r.len) {
+                    Request completed = txQueue.pop();
+                    finished.push_back(std::move(completed.completion));
+                    results.push_back(static_cast<int>(completed.len));
+                }
+            }
+            if (rxQueue.count > 0) {        // RX 링 → 읽기 요청 버퍼
+                Request& r = rxQueue.front();
+                r.done += rxRing.pop(r.rxBuf + r.done, r.len - r.done);
+                if (r.done == r.len) {
+                    Request completed = rxQueue.pop();
+                    finished.push_back(std::move(completed.completion));
+                    results.push_back(static_cast<int>(completed.len));
+                }
+            }
+            guard.unlock();
+            // 선로 전송: burst 하나를 내보내는 시간만큼 대기 (CPU는 쓰지 않음)
+            size_t n = txRing.pop(shift.data(), BURST);
+            if (n > 0) {
+                wireClock += chrono::nanoseconds(static_cast<long long>(n * 1e9 / bytesPerSecond));
+                this_thread::sleep_until(wireClock);
+                if (rxRing.push(shift.data(), n) < n) overruns.fetch_add(1, memory_order_relaxed);   // loopback
+            }
+            for (size_t i = 0; i < finished.size(); ++i)
+                if (finished[i]) finished[i](results[i]);      // "ISR"에서 완료 통지
+            guard.lock();
+        }
+        // 종료: 남은 요청은 취소로 완료
+        for (auto* q : {&txQueue, &rxQueue}) {
+            while (q->count > 0) {
+                Request r = q->pop();
+                if (r.completion) r.completion(-ECANCELED);
+            }
+        }
+    }
+
+    int enqueue(RequestQueue& queue, Request request) {
+        {
+            lock_guard<mutex> guard(lock);
+            if (!opened) return -ENODEV;
+            if (queue.full()) return -EBUSY;
+            queue.push(std::move(request));
+        }
+        work.notify_one();
+        return 0;
+    }
+
+public:
+    explicit AsyncUartDriver(double bytesPerSecond = 1e6) : bytesPerSecond(bytesPerSecond) {}
+    ~AsyncUartDriver() { close(); }
+
+    int open() override {
+        lock_guard<mutex> guard(lock);
+        if (opened) return 0;
+        opened = true;
+        stopping = false;
+        hardware = thread([this]() { hardwareLoop(); });
+        return 0;
+    }
+
+    int close() override {
+        {
+            lock_guard<mutex> guard(lock);
+            if (!opened) return 0;
+            opened = false;
+            stopping = true;
+        }
+        work.notify_one();
+        hardware.join();
+        return 0;
+    }
+
+    using IAsyncDriver::submit_read;
+    using IAsyncDriver::submit_write;
+
+    int submit_read(uint8_t* buf, size_t len, Completion done) override {
+        Request r;
+        r.rxBuf = buf;
+        r.len = len;
+        r.completion = std::move(done);
+        return enqueue(rxQueue, std::move(r));
+    }
+
+    int submit_write(const uint8_t* buf, size_t len, Completion done) override {
+        Request r;
+        r.txBuf = buf;
+        r.len = len;
+        r.completion = std::move(done);
+        return enqueue(txQueue, std::move(r));
+    }
+
+    uint64_t rxOverruns() const { return overruns.load(memory_order_relaxed); }
+};
+
+// 비교용: 상태 레지스터를 polling하는 동기 전송 (호출 스레드가 선로 시간 내내 spin)
+static int blockingUartWrite(const uint8_t* buf, size_t len, double bytesPerSecond) {
+    volatile uint8_t dataRegister = 0;
+    auto wireClock = chrono::steady_clock::now();
+    for (size_t sent = 0; sent < len; sent += AsyncUartDriver::BURST) {
+        size_t n = min(AsyncUartDriver::BURST, len - sent);
+        for (size_t i = 0; i < n; ++i) dataRegister = buf[sent + i];
+        wireClock += chrono::nanoseconds(static_cast<long long>(n * 1e9 / bytesPerSecond));
+        while (chrono::steady_clock::now() < wireClock) {}     // TXE 플래그 polling
+    }
+    (void)dataRegister;
+    return static_cast<int>(len);
+}
+
+/*
+ * BatchingDriver - 작은 쓰기를 모아 하위 드라이버에 한 번에 전달하는 데코레이터
+ *  - maxBytes가 차거나, 첫 바이트가 들어온 뒤 maxDelay가 지나면 flush
+ *  - maxBytes 이상인 큰 쓰기는 모아둔 것을 먼저 flush하고 그대로 통과
+ *  - read 전에도 flush (요청/응답 순서 보장)
+ *  - 지연 flush는 백그라운드 스레드가 deadline까지 기다렸다가 수행
+ */
+class BatchingDriver : public IDriver {
+    IDriver& inner;
+    size_t maxBytes;
+    chrono::microseconds maxDelay;
+    mutex lock;
+    condition_variable pendingChanged;
+    vector<uint8_t> pending;
+    chrono::steady_clock::time_point deadline;
+    bool stopping = false;
+    int lastError = 0;
+    uint64_t flushCount = 0;
+    thread flusher;
+
+    // lock 보유 상태, 부분 쓰기면 남은 바이트를 이어서 보냄 (오류가 나면 나머지는 버리고 오류 보고)
+    int flushLocked() {
+        int rc = 0;
+        for (size_t sent = 0; sent < pending.size();) {
+            rc = inner.write(pending.data() + sent, pending.size() - sent);
+            flushCount++;
+            if (rc == 0) rc = -EIO;         // 진행이 없으면 무한 반복 대신 오류
+            if (rc < 0) break;
+            sent += static_cast<size_t>(rc);
+        }
+        pending.clear();
+        if (rc < 0) lastError = rc;
+        return rc < 0 ? rc : 0;
+    }
+
+    void appendLocked(const uint8_t* buf, size_t len) {
+        if (pending.empty()) {
+            deadline = chrono::steady_clock::now() + maxDelay;
+            pendingChanged.notify_one();
+        }
+        pending.insert(pending.end(), buf, buf + len);
+    }
+
+    void flushLoop() {
+        unique_lock<mutex> guard(lock);
+        while (!stopping) {
+            if (pending.empty()) {
+                pendingChanged.wait(guard);
+            } else if (chrono::steady_clock::now() >= deadline) {
+                flushLocked();
+            } else {
+                pendingChanged.wait_until(guard, deadline);
+            }
+        }
+    }
+
+public:
+    BatchingDriver(IDriver& inner, size_t maxBytes = 1024, chrono::microseconds maxDelay = chrono::microseconds(500))
+        : inner(inner), maxBytes(maxBytes), maxDelay(maxDelay) {
+        pending.reserve(maxBytes);
+        flusher = thread([this]() { flushLoop(); });   // pending 준비가 끝난 뒤 시작 → reserve와 경합 없음
+    }
+    ~BatchingDriver() {
+        {
+            lock_guard<mutex> guard(lock);
+            flushLocked();
+            stopping = true;
+        }
+        pendingChanged.notify_one();
+        flusher.join();
+    }
+
+    int open() override { return inner.open(); }
+    int close() override {
+        flush();
+        return inner.close();
+    }
+
+    int write(const uint8_t* buf, size_t len) override {
+        lock_guard<mutex> guard(lock);
+        if (lastError < 0) return exchange(lastError, 0);     // 지연 flush 실패는 다음 호출에 보고
+        if (len >= maxBytes) {
+            int rc = flushLocked();
+            if (rc < 0) return rc;
+            return inner.write(buf, len);
+        }
+        if (pending.size() + len > maxBytes) {
+            int rc = flushLocked();
+            if (rc < 0) return rc;
+        }
+        appendLocked(buf, len);
+        if (pending.size() >= maxBytes) flushLocked();
+        return static_cast<int>(len);
+    }
+
+    // 여러 조각을 한 번에 모음 → 패킷 하나가 배치 경계에서 쪼개지지 않음 (maxBytes 이하일 때)
+    int writev(span<const span<const uint8_t>> buffers) override {
+        size_t total = 0;
+        for (auto b : buffers) total += b.size();
+        lock_guard<mutex> guard(lock);
+        if (lastError < 0) return exchange(lastError, 0);
+        if (pending.size() + total > maxBytes) {
+            int rc = flushLocked();
+            if (rc < 0) return rc;
+        }
+        if (total >= maxBytes) return inner.writev(buffers);
+        for (auto b : buffers) appendLocked(b.data(), b.size());
+        if (pending.size() >= maxBytes) flushLocked();
+        return static_cast<int>(total);
+    }
+
+    int read(uint8_t* buf, size_t len) override {
+        flush();
+        return inner.read(buf, len);
+    }
+
+    int flush() {
+        lock_guard<mutex> guard(lock);
+        return flushLocked();
+    }
+
+    uint64_t flushes() {
+        lock_guard<mutex> guard(lock);
+        return flushCount;
+    }
+};
+
+// 측정용 드라이버: 호출마다 doorbell 비용(레지스터 쓰기 + 인터럽트 왕복)을 흉내, gather를 지원하면 writev 한 번
+class DoorbellDriver : public IDriver {
+    bool gather;
+    static void doorbell() {
+        auto until = chrono::steady_clock::now() + chrono::microseconds(1);
+        while (chrono::steady_clock::now() < until) {}
+    }
+public:
+    uint64_t calls = 0;
+    uint64_t bytes = 0;
+    explicit DoorbellDriver(bool gather) : gather(gather) {}
+    int open() override { return 0; }
+    int close() override { return 0; }
+    int read(uint8_t*, size_t len) override { return static_cast<int>(len); }
+    int write(const uint8_t*, size_t len) override {
+        doorbell();
+        calls++;
+        bytes += len;
+        return static_cast<int>(len);
+    }
+    int writev(span<const span<const uint8_t>> buffers) override {
+        if (!gather) return IDriver::writev(buffers);
+        doorbell();
+        calls++;
+        size_t total = 0;
+        for (auto b : buffers) total += b.size();
+        bytes += total;
+        return static_cast<int>(total);
+    }
+};
+
+// 패킷 = header(8) + payload(64) + CRC(4)
+template<typename Send>
+static void benchmarkFraming(const char* name, DoorbellDriver& driver, Send send) {
+    constexpr int PACKETS = 10000;
+    array<uint8_t, 8> header{};
+    array<uint8_t, 64> payload{};
+    array<uint8_t, 4> crc{};
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < PACKETS; ++i) send(span<const uint8_t>(header), span<const uint8_t>(payload), span<const uint8_t>(crc));
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << ": " << ms << " ms, driver calls " << driver.calls << " (" << driver.bytes << " bytes)" << endl;
+}
+
+// POSIX가 아니면 프로세스 CPU 시간으로 대체 (하드웨어 스레드 몫까지 포함되어 async 쪽이 크게 나옴)
+static double threadCpuMs() {
+#ifdef HAVE_POSIX_IO
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+#else
+    return std::clock() * 1e3 / CLOCKS_PER_SEC;
+#endif
+}
+
 int main() {
     cout << "=== C++ Driver Interface ===" << endl;
     UARTDriver uart;
     uart.open();
     uart.close();
+
+    cout << "\n=== AsyncUartDriver (loopback) ===" << endl;
+    {
+        AsyncUartDriver async(1e6);
+        async.open();
+        const char message[] = "hello, dma";
+        uint8_t received[sizeof(message) - 1] = {};
+        auto rx = async.submit_read(received, sizeof(received));
+        atomic<bool> txDone{false};
+        async.submit_write(reinterpret_cast<const uint8_t*>(message), sizeof(message) - 1,
+                           [&txDone](int result) { txDone = result > 0; });
+        cout << "read completed: " << rx.get() << " bytes \"" << string(received, received + sizeof(received))
+             << "\", write callback " << (txDone ? "fired" : "pending") << endl;
+
+        // 큐 한도: 큰 쓰기를 QUEUE_DEPTH개 넘게 넣으면 -EBUSY
+        vector<uint8_t> big(64 * 1024);
+        int accepted = 0, busy = 0;
+        for (size_t i = 0; i < AsyncUartDriver::QUEUE_DEPTH + 2; ++i) {
+            int rc = async.submit_write(big.data(), big.size(), [](int) {});
+            (rc == 0 ? accepted : busy)++;
+        }
+        cout << "submitted " << AsyncUartDriver::QUEUE_DEPTH + 2 << " writes: " << accepted << " queued, " << busy
+             << " -EBUSY" << endl;
+        async.close();      // 남은 요청은 -ECANCELED로 완료
+    }
+
+    cout << "\n=== Benchmark: packet framing (header + payload + CRC, 10k packets) ===" << endl;
+    {
+        DoorbellDriver plain(false);
+        benchmarkFraming("3x write()            ", plain, [&](auto h, auto p, auto c) {
+            plain.write(h.data(), h.size());
+            plain.write(p.data(), p.size());
+            plain.write(c.data(), c.size());
+        });
+        DoorbellDriver looped(false);
+        benchmarkFraming("writev (default loop) ", looped, [&](auto h, auto p, auto c) {
+            span<const uint8_t> parts[] = {h, p, c};
+            looped.writev(parts);
+        });
+        DoorbellDriver gathered(true);
+        benchmarkFraming("writev (gather DMA)   ", gathered, [&](auto h, auto p, auto c) {
+            span<const uint8_t> parts[] = {h, p, c};
+            gathered.writev(parts);
+        });
+        DoorbellDriver batchedTarget(false);
+        {
+            BatchingDriver batched(batchedTarget, 4096, chrono::microseconds(200));
+            benchmarkFraming("BatchingDriver (4KB)  ", batchedTarget, [&](auto h, auto p, auto c) {
+                span<const uint8_t> parts[] = {h, p, c};
+                batched.writev(parts);
+            });
+            batched.flush();
+            cout << "  BatchingDriver flushes " << batched.flushes() << ", total bytes " << batchedTarget.bytes << endl;
+        }
+    }
+
+    cout << "\n=== Benchmark: app-thread CPU per MB (simulated 50 MB/s wire) ===" << endl;
+    {
+        constexpr double WIRE = 50e6;
+        vector<uint8_t> payload(1 << 20, 0x5A);
+
+        double cpu0 = threadCpuMs();
+        auto t0 = chrono::steady_clock::now();
+        blockingUartWrite(payload.data(), payload.size(), WIRE);
+        double wallSync = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        double cpuSync = threadCpuMs() - cpu0;
+
+        AsyncUartDriver async(WIRE);
+        async.open();
+        vector<uint8_t> sink(payload.size());
+        cpu0 = threadCpuMs();
+        t0 = chrono::steady_clock::now();
+        auto rx = async.submit_read(sink.data(), sink.size());      // loopback으로 되돌아온 데이터 수신
+        auto tx = async.submit_write(payload.data(), payload.size());
+        tx.get();
+        rx.get();
+        double wallAsync = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        double cpuAsync = threadCpuMs() - cpu0;
+        async.close();
+
+        cout << "  polling write : wall " << wallSync << " ms, app CPU " << cpuSync << " ms/MB" << endl;
+        cout << "  async + future: wall " << wallAsync << " ms, app CPU " << cpuAsync << " ms/MB, loopback "
+             << (sink == payload ? "intact" : "corrupt") << endl;
+        cout << "  CPU freed: " << cpuSync - cpuAsync << " ms per MB" << endl;
+    }
     return 0;
 }
@@ -1,24 +1,303 @@
 /* C++ Interrupt Handler - atomic */
 #include <iostream>
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 using namespace std;
 
+// 빌드 플래그: -DISR_INSTRUMENTATION=0 이면 계측 hook이 빈 inline으로 사라짐
+#ifndef ISR_INSTRUMENTATION
+#define ISR_INSTRUMENTATION 1
+#endif
+
+static inline uint64_t cycleCounter() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value;
+    asm volatile("isb; mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return static_cast<uint64_t>(chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// cycle → ns 환산 (시작 시 2ms 구간으로 보정, 보고용으로만 사용)
+static double cyclesPerNs() {
+    static const double ratio = []() {
+        auto t0 = chrono::steady_clock::now();
+        uint64_t c0 = cycleCounter();
+        this_thread::sleep_for(chrono::milliseconds(2));
+        uint64_t c1 = cycleCounter();
+        double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count();
+        return ns > 0 && c1 > c0 ? (c1 - c0) / ns : 1.0;
+    }();
+    return ratio;
+}
+
+struct HistogramSnapshot {
+    array<uint64_t, 65> buckets{};      // bucket b: bit_width(value) == b → [2^(b-1), 2^b)
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+
+    // 해당 백분위가 속한 bucket의 상한 (log2 해상도 = 최대 2배 과대 추정)
+    uint64_t percentile(double p) const {
+        if (count == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(p / 100.0 * (count - 1)) + 1;
+        uint64_t seen = 0;
+        for (size_t b = 0; b < buckets.size(); ++b) {
+            seen += buckets[b];
+            if (seen >= rank) return b == 0 ? 0 : min(max, b >= 64 ? UINT64_MAX : (uint64_t{1} << b) - 1);
+        }
+        return max;
+    }
+
+    void print(const char* name) const {
+        double k = cyclesPerNs();
+        cout << "  " << name << ": n=" << count << " mean " << (count ? sum / count : 0) << " cyc, p50 <= "
+             << percentile(50) << ", p99 <= " << percentile(99) << ", max " << max << " cyc (~" << max / k << " ns)"
+             << endl;
+    }
+};
+
+/*
+ * Log2Histogram - ISR에서 기록해도 안전한 고정 크기 히스토그램
+ *  - bucket = bit_width(cycles), 65개 atomic 카운터 (할당 없음)
+ *  - record: relaxed fetch_add 두 번 + max CAS (대부분 비교 한 번으로 끝남)
+ *  - snapshot()은 main 문맥에서 읽기만, snapshotAndReset()은 exchange(0)로 구간별 수치 export
+ */
+class Log2Histogram {
+    array<atomic<uint32_t>, 65> buckets{};
+    atomic<uint64_t> count{0};
+    atomic<uint64_t> sum{0};
+    atomic<uint64_t> maxValue{0};
+public:
+    void record(uint64_t cycles) {
+        buckets[bit_width(cycles)].fetch_add(1, memory_order_relaxed);
+        count.fetch_add(1, memory_order_relaxed);
+        sum.fetch_add(cycles, memory_order_relaxed);
+        uint64_t seen = maxValue.load(memory_order_relaxed);
+        while (cycles > seen && !maxValue.compare_exchange_weak(seen, cycles, memory_order_relaxed)) {}
+    }
+
+    HistogramSnapshot snapshot() const {
+        HistogramSnapshot s;
+        for (size_t b = 0; b < buckets.size(); ++b) s.buckets[b] = buckets[b].load(memory_order_relaxed);
+        s.count = count.load(memory_order_relaxed);
+        s.sum = sum.load(memory_order_relaxed);
+        s.max = maxValue.load(memory_order_relaxed);
+        return s;
+    }
+
+    HistogramSnapshot snapshotAndReset() {
+        HistogramSnapshot s;
+        for (size_t b = 0; b < buckets.size(); ++b) s.buckets[b] = buckets[b].exchange(0, memory_order_relaxed);
+        s.count = count.exchange(0, memory_order_relaxed);
+        s.sum = sum.exchange(0, memory_order_relaxed);
+        s.max = maxValue.exchange(0, memory_order_relaxed);
+        return s;
+    }
+};
+
+/*
+ * IsrProbe - ISR 실행 시간 + 이벤트 전달 지연 계측
+ *  - IsrScope: 생성 시 진입 시각, 소멸 시 (exit - entry)를 handlerCycles에 기록
+ *  - stamp(): ISR이 이벤트에 붙이는 발생 시각 / consumed(stamp): main loop 소비 시 지연 기록
+ */
+struct IsrProbe {
+    Log2Histogram handlerCycles;
+    Log2Histogram latencyCycles;
+
+#if ISR_INSTRUMENTATION
+    class IsrScope {
+        Log2Histogram& target;
+        uint64_t entry = cycleCounter();
+    public:
+        explicit IsrScope(IsrProbe& probe) : target(probe.handlerCycles) {}
+        ~IsrScope() { target.record(cycleCounter() - entry); }
+    };
+    static uint64_t stamp() { return cycleCounter(); }
+    void consumed(uint64_t stamp) { latencyCycles.record(cycleCounter() - stamp); }
+#else
+    struct IsrScope {
+        explicit IsrScope(IsrProbe&) {}
+    };
+    static uint64_t stamp() { return 0; }
+    void consumed(uint64_t) {}
+#endif
+};
+
+IsrProbe gpioProbe;
 atomic<bool> buttonPressed{false};
+atomic<uint64_t> buttonStamp{0};
 
 void GPIO_ISR() {
+    IsrProbe::IsrScope scope(gpioProbe);
+    buttonStamp.store(IsrProbe::stamp(), memory_order_relaxed);
     buttonPressed = true;  // atomic operation
     cout << "[ISR] Flag set" << endl;
 }
 
 void MainLoop() {
     if (buttonPressed.exchange(false)) {
+        gpioProbe.consumed(buttonStamp.load(memory_order_relaxed));
         cout << "[MainLoop] Processing event" << endl;
     }
 }
 
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+/*
+ * IsrEventChannel - ISR → main loop 이벤트 채널 (lock 없음, 인터럽트 유실 없음)
+ *  - pending: 소스별 비트, ISR은 fetch_or로 세팅 / main loop는 exchange(0)로 한 번에 수거
+ *  - 소스마다 wait-free SPSC payload 링 (ISR = 생산자, main loop = 소비자)
+ *    링이 가득 차면 새 payload는 버리고 overflow 카운터 증가 (ISR은 절대 기다리지 않음)
+ *  - drain(): 수거한 소스들의 링을 모두 비우고, 버려진 개수도 onOverflow로 보고
+ *  - ISR이 payload를 넣은 뒤 비트를 세팅 → main이 비트를 본 시점엔 payload가 보임 (release/acquire)
+ *    drain 도중 들어온 이벤트는 이번 pass에 처리되거나 다음 pass의 비트로 남음
+ */
+template<typename Payload, size_t Sources, size_t Depth = 16>
+class IsrEventChannel {
+    static_assert(Sources <= 32, "one pending bit per source");
+    static_assert(has_single_bit(Depth), "ring depth must be a power of two");
+    static_assert(atomic<uint32_t>::is_always_lock_free, "ISR needs lock-free atomics");
+
+    struct alignas(CACHE_LINE_SIZE) Ring {
+        array<Payload, Depth> slots;
+        atomic<uint32_t> head{0};       // main loop만 씀
+        atomic<uint32_t> tail{0};       // ISR만 씀
+        atomic<uint32_t> overflows{0};
+    };
+
+    alignas(CACHE_LINE_SIZE) atomic<uint32_t> pending{0};
+    array<Ring, Sources> rings;
+
+public:
+    // ISR 문맥: 상수 시간, 실패(overflow)해도 비트는 세팅해 main이 보고하게 함
+    bool raise(size_t source, const Payload& payload) {
+        Ring& r = rings[source];
+        uint32_t t = r.tail.load(memory_order_relaxed);
+        bool stored = t - r.head.load(memory_order_acquire) < Depth;
+        if (stored) {
+            r.slots[t & (Depth - 1)] = payload;
+            r.tail.store(t + 1, memory_order_release);
+        } else {
+            r.overflows.fetch_add(1, memory_order_relaxed);
+        }
+        pending.fetch_or(1u << source, memory_order_release);
+        return stored;
+    }
+
+    // main loop: onEvent(source, payload), onOverflow(source, droppedCount)
+    template<typename OnEvent, typename OnOverflow>
+    size_t drain(OnEvent&& onEvent, OnOverflow&& onOverflow) {
+        size_t handled = 0;
+        for (uint32_t mask = pending.exchange(0, memory_order_acquire); mask; mask &= mask - 1) {
+            size_t source = static_cast<size_t>(countr_zero(mask));
+            Ring& r = rings[source];
+            uint32_t h = r.head.load(memory_order_relaxed);
+            uint32_t t = r.tail.load(memory_order_acquire);
+            for (; h != t; ++h, ++handled) onEvent(source, r.slots[h & (Depth - 1)]);
+            r.head.store(h, memory_order_release);
+            if (uint32_t dropped = r.overflows.exchange(0, memory_order_relaxed)) onOverflow(source, dropped);
+        }
+        return handled;
+    }
+
+    uint32_t pendingMask() const { return pending.load(memory_order_relaxed); }
+};
+
+enum IrqSource : size_t { IRQ_BUTTON, IRQ_UART_RX, IRQ_TIMER, IRQ_COUNT };
+
+struct IrqEvent {
+    uint32_t sequence;
+    uint32_t data;      // 버튼 번호 / 수신 바이트 / 타이머 틱
+    uint64_t stamp;     // IsrProbe::stamp() (발생 시각)
+};
+
 int main() {
     cout << "=== C++ Interrupt Handler ===" << endl;
     GPIO_ISR();
     MainLoop();
+    cout << "GPIO_ISR instrumentation:" << endl;
+    gpioProbe.handlerCycles.snapshot().print("handler ");
+    gpioProbe.latencyCycles.snapshot().print("latency ");
+
+    cout << "\n=== Bursts between MainLoop passes ===" << endl;
+    {
+        // 기존 플래그: main loop가 돌기 전에 인터럽트 5번 → 처리 1번
+        int flagHandled = 0;
+        for (int i = 0; i < 5; ++i) buttonPressed = true;
+        if (buttonPressed.exchange(false)) flagHandled++;
+        cout << "atomic<bool> flag: 5 interrupts → " << flagHandled << " handled" << endl;
+
+        IsrEventChannel<IrqEvent, IRQ_COUNT, 8> channel;
+        for (uint32_t i = 0; i < 5; ++i) channel.raise(IRQ_BUTTON, {i, 1, 0});
+        for (uint32_t i = 0; i < 10; ++i) channel.raise(IRQ_UART_RX, {i, 'a' + i, 0});    // 깊이 8 → 2개 overflow
+        channel.raise(IRQ_TIMER, {0, 1000, 0});
+        cout << "pending mask 0x" << hex << channel.pendingMask() << dec << endl;
+        size_t handled = channel.drain(
+            [](size_t source, const IrqEvent& e) {
+                if (source == IRQ_UART_RX) cout << static_cast<char>(e.data);
+            },
+            [](size_t source, uint32_t dropped) { cout << " [overflow src " << source << ": " << dropped << "]"; });
+        cout << endl << "channel: one pass handled " << handled << " events" << endl;
+    }
+
+    cout << "\n=== Simulated ISR thread vs main loop ===" << endl;
+    {
+        IsrEventChannel<IrqEvent, IRQ_COUNT, 64> channel;
+        IsrProbe probe;
+        constexpr uint32_t PER_SOURCE = 100000;
+        atomic<bool> isrDone{false};
+        array<uint64_t, IRQ_COUNT> handled{}, dropped{};
+        array<bool, IRQ_COUNT> inOrder{true, true, true};
+        array<uint32_t, IRQ_COUNT> nextExpected{};
+
+        thread isr([&]() {
+            for (uint32_t i = 0; i < PER_SOURCE; ++i) {
+                {
+                    IsrProbe::IsrScope scope(probe);    // 인터럽트 한 번 = 세 소스 raise
+                    for (size_t src = 0; src < IRQ_COUNT; ++src)
+                        channel.raise(src, {i, static_cast<uint32_t>(src), IsrProbe::stamp()});
+                }
+                if (i % 32 == 31) this_thread::yield();     // 인터럽트 사이 간격 (버스트 최대 32개)
+            }
+            isrDone = true;
+        });
+        auto onEvent = [&](size_t src, const IrqEvent& e) {
+            if (e.sequence < nextExpected[src]) inOrder[src] = false;
+            nextExpected[src] = e.sequence + 1;
+            handled[src]++;
+            probe.consumed(e.stamp);
+        };
+        auto onOverflow = [&](size_t src, uint32_t n) { dropped[src] += n; };
+        size_t passes = 0;
+        while (!isrDone) {
+            channel.drain(onEvent, onOverflow);
+            passes++;
+            this_thread::yield();
+        }
+        isr.join();
+        channel.drain(onEvent, onOverflow);
+        for (size_t src = 0; src < IRQ_COUNT; ++src) {
+            cout << "source " << src << ": raised " << PER_SOURCE << " = handled " << handled[src] << " + dropped "
+                 << dropped[src] << (handled[src] + dropped[src] == PER_SOURCE ? " ✓" : " ✗")
+                 << (inOrder[src] ? ", in order" : ", OUT OF ORDER") << endl;
+        }
+        cout << "main loop passes: " << passes << endl;
+        HistogramSnapshot latency = probe.latencyCycles.snapshotAndReset();
+        probe.handlerCycles.snapshotAndReset().print("ISR handler    ");
+        latency.print("ISR → main loop");
+        cout << "  after reset: n=" << probe.latencyCycles.snapshot().count << endl;
+    }
     return 0;
 }
@@ -1,18 +1,52 @@
 /* C++ Mock Object */
 #include <iostream>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HAVE_POSIX_IO 1
+#endif
 using namespace std;
 
+[[noreturn]] static void throwErrno(const char* what) {
+    throw system_error(errno, generic_category(), what);
+}
+
 class ISensor {
 public:
     virtual ~ISensor() = default;
     virtual float read() = 0;
+    // batch read: 기본은 read() 반복, 읽은 개수 반환
+    virtual size_t read(span<float> out) {
+        for (float& v : out) v = read();
+        return out.size();
+    }
 };
 
 class RealSensor : public ISensor {
+    bool logReads;
+    uint32_t reads = 0;
 public:
+    explicit RealSensor(bool logReads = true) : logReads(logReads) {}
     float read() override {
-        cout << "[Real] Hardware read" << endl;
-        return 25.5f;
+        if (logReads) cout << "[Real] Hardware read" << endl;
+        // 하드웨어 흉내: 25.5°C 주변의 느린 변화
+        return 25.5f + 0.5f * static_cast<float>(sin(reads++ * 0.01));
     }
 };
 
@@ -24,11 +58,222 @@ public:
     }
 };
 
+/*
+ * 센서 trace 파일 형식 (little-endian, SoA)
+ *  - TraceHeader
+ *  - int64_t timestampNs[count]   : 첫 샘플 기준 상대 시각
+ *  - float   value[count]         : 연속 배열 → batch read는 memcpy 한 번
+ */
+struct TraceHeader {
+    static constexpr uint32_t MAGIC = 0x524E5353;  // "SSNR"
+    uint32_t magic = MAGIC;
+    uint32_t version = 1;
+    uint64_t count = 0;
+    int64_t durationNs = 0;     // 한 바퀴 길이 (마지막 샘플 + 평균 주기), loop playback용
+};
+
+// RealSensor(또는 임의의 ISensor) 출력을 trace로 기록
+class SensorRecorder {
+    ISensor& source;
+    vector<int64_t> timestamps;
+    vector<float> values;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+public:
+    explicit SensorRecorder(ISensor& source) : source(source) {}
+
+    float read() {
+        int64_t ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+        float value = source.read();
+        timestamps.push_back(ns);
+        values.push_back(value);
+        return value;
+    }
+
+    // 일정 주기로 n개 수집
+    void capture(size_t n, chrono::microseconds period) {
+        timestamps.reserve(timestamps.size() + n);
+        values.reserve(values.size() + n);
+        auto next = chrono::steady_clock::now();
+        for (size_t i = 0; i < n; ++i) {
+            read();
+            next += period;
+            this_thread::sleep_until(next);
+        }
+    }
+
+    void save(const string& path) const {
+        TraceHeader header;
+        header.count = values.size();
+        if (header.count > 0) {
+            int64_t last = timestamps.back() - timestamps.front();
+            header.durationNs = last + (header.count > 1 ? last / static_cast<int64_t>(header.count - 1) : 0);
+        }
+        unique_ptr<FILE, int (*)(FILE*)> file(fopen(path.c_str(), "wb"), fclose);
+        if (!file) throwErrno("fopen");
+        vector<int64_t> relative(timestamps.size());
+        for (size_t i = 0; i < timestamps.size(); ++i) relative[i] = timestamps[i] - timestamps.front();
+        if (fwrite(&header, sizeof header, 1, file.get()) != 1 ||
+            fwrite(relative.data(), sizeof(int64_t), relative.size(), file.get()) != relative.size() ||
+            fwrite(values.data(), sizeof(float), values.size(), file.get()) != values.size())
+            throwErrno("fwrite");
+    }
+};
+
+/*
+ * 재생 속도
+ *  - RealTime       : 기록된 시각 그대로 (scale 1)
+ *  - Scaled         : scale배 빠르게 (scale 2 → 절반 간격)
+ *  - AsFastAsPossible : 대기 없음, 처리 체인의 최대 처리량 측정용
+ */
+struct Playback {
+    enum Mode { RealTime, Scaled, AsFastAsPossible };
+    Mode mode = AsFastAsPossible;
+    double scale = 1.0;
+
+    static Playback realTime() { return {RealTime, 1.0}; }
+    static Playback scaled(double factor) { return {Scaled, factor}; }
+    static Playback asFastAsPossible() { return {AsFastAsPossible, 1.0}; }
+};
+
+/*
+ * ReplaySensor - 기록된 trace를 mmap해서 재생하는 ISensor
+ *  - 열 때 한 번 map + 검증, 이후 read()는 배열 인덱싱만 (할당/I/O/로그 없음)
+ *  - 끝에 도달하면 처음으로 돌아감 (lap마다 durationNs만큼 시각 이동)
+ *  - POSIX가 아니면 파일 전체를 한 번 읽어 메모리에 둠
+ */
+class ReplaySensor : public ISensor {
+    const TraceHeader* header = nullptr;
+    const int64_t* timestamps = nullptr;
+    const float* values = nullptr;
+#ifdef HAVE_POSIX_IO
+    void* mapped = nullptr;
+    size_t mappedBytes = 0;
+#else
+    vector<char> contents;
+#endif
+    Playback playback;
+    size_t cursor = 0;
+    uint64_t laps = 0;
+    chrono::steady_clock::time_point start;
+
+    void bind(const char* base, size_t bytes) {
+        if (bytes < sizeof(TraceHeader)) throw runtime_error("trace too short");
+        header = reinterpret_cast<const TraceHeader*>(base);
+        if (header->magic != TraceHeader::MAGIC || header->version != 1) throw runtime_error("not a sensor trace");
+        // count * 12가 넘칠 수 있으므로 곱하지 않고 나눠서 비교
+        if (header->count == 0 || header->count > (bytes - sizeof(TraceHeader)) / (sizeof(int64_t) + sizeof(float)))
+            throw runtime_error("truncated sensor trace");
+        timestamps = reinterpret_cast<const int64_t*>(base + sizeof(TraceHeader));
+        values = reinterpret_cast<const float*>(timestamps + header->count);
+    }
+
+    // 다음 샘플의 재생 시각까지 대기
+    void pace(size_t index) {
+        if (playback.mode == Playback::AsFastAsPossible) return;
+        double ns = (static_cast<double>(laps) * header->durationNs + timestamps[index]) / playback.scale;
+        this_thread::sleep_until(start + chrono::nanoseconds(static_cast<int64_t>(ns)));
+    }
+
+    void advance(size_t n) {
+        cursor += n;
+        if (cursor == header->count) { cursor = 0; ++laps; }
+    }
+
+public:
+    explicit ReplaySensor(const string& path, Playback playback = {}) : playback(playback) {
+#ifdef HAVE_POSIX_IO
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throwErrno("open");
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            int saved = errno;          // close가 errno를 덮어쓰지 않게
+            ::close(fd);
+            errno = saved;
+            throwErrno("fstat");
+        }
+        mappedBytes = static_cast<size_t>(st.st_size);
+        if (mappedBytes < sizeof(TraceHeader)) {
+            ::close(fd);
+            throw runtime_error("trace too short");
+        }
+        void* p = ::mmap(nullptr, mappedBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        int saved = errno;
+        ::close(fd);                    // 매핑은 fd를 닫아도 유지됨
+        if (p == MAP_FAILED) {
+            errno = saved;
+            throwErrno("mmap");
+        }
+        ::madvise(p, mappedBytes, MADV_SEQUENTIAL);
+        mapped = p;
+        try {
+            bind(static_cast<const char*>(p), mappedBytes);
+        } catch (...) {
+            ::munmap(p, mappedBytes);
+            throw;
+        }
+#else
+        unique_ptr<FILE, int (*)(FILE*)> file(fopen(path.c_str(), "rb"), fclose);
+        if (!file) throwErrno("fopen");
+        char chunk[4096];
+        for (size_t got; (got = fread(chunk, 1, sizeof chunk, file.get())) > 0;) contents.insert(contents.end(), chunk, chunk + got);
+        bind(contents.data(), contents.size());
+#endif
+        rewind();
+    }
+
+    ~ReplaySensor() override {
+#ifdef HAVE_POSIX_IO
+        if (mapped) ::munmap(mapped, mappedBytes);
+#endif
+    }
+
+    ReplaySensor(const ReplaySensor&) = delete;
+    ReplaySensor& operator=(const ReplaySensor&) = delete;
+
+    void rewind() {
+        cursor = 0;
+        laps = 0;
+        start = chrono::steady_clock::now();
+    }
+
+    size_t size() const { return header->count; }
+
+    float read() override {
+        pace(cursor);
+        float value = values[cursor];
+        advance(1);
+        return value;
+    }
+
+    // 연속 구간을 memcpy로 복사, paced 모드에서는 각 구간 마지막 샘플 시각까지 대기
+    size_t read(span<float> out) override {
+        size_t done = 0;
+        while (done < out.size()) {
+            size_t n = min(out.size() - done, static_cast<size_t>(header->count) - cursor);
+            pace(cursor + n - 1);
+            memcpy(out.data() + done, values + cursor, n * sizeof(float));
+            advance(n);
+            done += n;
+        }
+        return done;
+    }
+};
+
 void processTemperature(ISensor& sensor) {
     float temp = sensor.read();
     cout << "[App] Temperature: " << temp << "°C" << endl;
 }
 
+// 처리 체인 흉내: 이동 평균 + 임계값 초과 카운트
+struct TemperatureFilter {
+    float average = 0;
+    uint64_t alarms = 0;
+    void feed(float t) {
+        average += (t - average) * 0.05f;
+        if (average > 25.9f) ++alarms;
+    }
+};
+
 int main() {
     cout << "=== C++ Mock Object ===" << endl;
     
@@ -38,5 +283,50 @@ int main() {
     processTemperature(real);
     processTemperature(mock);
     
+    cout << "\n=== Record RealSensor → trace ===" << endl;
+    string path = "/tmp/sensor_trace_" + to_string(chrono::steady_clock::now().time_since_epoch().count()) + ".bin";
+    {
+        RealSensor quiet(false);
+        SensorRecorder recorder(quiet);
+        recorder.capture(200, chrono::microseconds(100));    // 10kHz 센서, 20ms
+        recorder.save(path);
+        cout << "recorded 200 samples @ 10kHz → " << path << endl;
+    }
+    
+    cout << "\n=== Replay (paced) ===" << endl;
+    for (Playback speed : {Playback::realTime(), Playback::scaled(4.0), Playback::asFastAsPossible()}) {
+        ReplaySensor replay(path, speed);
+        float samples[50];
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < 4; ++i) replay.read(span<float>(samples));
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        const char* name = speed.mode == Playback::RealTime ? "real-time   " :
+                           speed.mode == Playback::Scaled ? "scaled x4   " : "as fast     ";
+        cout << "  " << name << ": 200 samples in " << ms << " ms" << endl;
+    }
+    
+    cout << "\n=== Benchmark: processing chain at full rate ===" << endl;
+    {
+        ReplaySensor replay(path);
+        ISensor& sensor = replay;
+        constexpr size_t SAMPLES = 2000000;
+        TemperatureFilter filter;
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < SAMPLES; ++i) filter.feed(sensor.read());
+        double single = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    
+        TemperatureFilter batched;
+        float block[256];
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < SAMPLES; i += size(block)) {
+            size_t n = sensor.read(span<float>(block));
+            for (size_t j = 0; j < n; ++j) batched.feed(block[j]);
+        }
+        double batch = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "  read()           : " << SAMPLES / single / 1e6 << " M samples/s (alarms " << filter.alarms << ")" << endl;
+        cout << "  read(span<float>): " << SAMPLES / batch / 1e6 << " M samples/s (alarms " << batched.alarms << ")" << endl;
+    }
+    remove(path.c_str());
+    
     return 0;
 }
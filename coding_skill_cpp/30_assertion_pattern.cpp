@@ -1,8 +1,62 @@
 /* C++ Assertion - assert, static_assert */
 #include <iostream>
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
 using namespace std;
 
+/*
+ * 단계별 assertion (컴파일 타임에 수준 선택)
+ *  - ASSERT_ALWAYS : release 포함 항상 (싼 체크: 범위, null)
+ *  - ASSERT_DEBUG  : 개발 빌드 (NDEBUG 없을 때 기본)
+ *  - ASSERT_AUDIT  : O(n) 이상 비싼 불변식, -DASSERT_LEVEL=3 일 때만
+ *  - 꺼진 수준의 체크는 조건식까지 평가되지 않음 (sizeof 안에서만 type-check)
+ */
+#define ASSERT_LEVEL_ALWAYS 1
+#define ASSERT_LEVEL_DEBUG 2
+#define ASSERT_LEVEL_AUDIT 3
+
+#ifndef ASSERT_LEVEL
+#ifdef NDEBUG
+#define ASSERT_LEVEL ASSERT_LEVEL_ALWAYS
+#else
+#define ASSERT_LEVEL ASSERT_LEVEL_DEBUG
+#endif
+#endif
+
+// 실패 경로: noinline + cold → 메시지 포맷/호출 코드가 hot 함수 밖(.text.unlikely)으로 빠짐
+// constexpr가 아니므로 상수 평가 중 실패하면 컴파일 에러가 됨 (static_assert와 같은 효과)
+[[noreturn, gnu::noinline, gnu::cold]] void assertionFailed(const char* expr, const char* message, const char* file,
+                                                           int line) {
+    fprintf(stderr, "%s:%d: assertion failed: %s (%s)\n", file, line, expr, message);
+    abort();
+}
+
+#define CHECK_IMPL(cond, message) \
+    do { \
+        if (!(cond)) [[unlikely]] \
+            assertionFailed(#cond, message, __FILE__, __LINE__); \
+    } while (0)
+#define CHECK_DISABLED(cond, message) \
+    do { \
+        (void)sizeof(!(cond)); \
+    } while (0)
+
+#define ASSERT_ALWAYS(cond, message) CHECK_IMPL(cond, message)
+#if ASSERT_LEVEL >= ASSERT_LEVEL_DEBUG
+#define ASSERT_DEBUG(cond, message) CHECK_IMPL(cond, message)
+#else
+#define ASSERT_DEBUG(cond, message) CHECK_DISABLED(cond, message)
+#endif
+#if ASSERT_LEVEL >= ASSERT_LEVEL_AUDIT
+#define ASSERT_AUDIT(cond, message) CHECK_IMPL(cond, message)
+#else
+#define ASSERT_AUDIT(cond, message) CHECK_DISABLED(cond, message)
+#endif
+
 // 컴파일 타임 체크
 static_assert(sizeof(int) == 4, "int must be 4 bytes");
 
@@ -11,11 +65,72 @@ int divide(int a, int b) {
     return a / b;
 }
 
+// constexpr 함수 안의 ASSERT_*: 상수 평가에서 실패하면 컴파일 에러, 런타임 호출에서는 일반 체크
+constexpr int checkedDivide(int a, int b) {
+    ASSERT_ALWAYS(b != 0, "Divisor cannot be zero");
+    return a / b;
+}
+static_assert(checkedDivide(10, 2) == 5);
+// static_assert(checkedDivide(10, 0) == 0);   // 컴파일 에러: assertionFailed는 상수식이 아님
+
+// hot path 예: 항상 켜진 범위 체크 + audit 수준 정렬 체크
+int lowerBoundIndex(const vector<int>& sorted, int key) {
+    ASSERT_AUDIT(is_sorted(sorted.begin(), sorted.end()), "input must be sorted");
+    return static_cast<int>(lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+}
+
+inline int checkedAt(const int* data, size_t size, size_t i) {
+    ASSERT_ALWAYS(i < size, "index out of range");
+    return data[i];
+}
+
+inline int uncheckedAt(const int* data, size_t, size_t i) {
+    return data[i];
+}
+
+// 같은 gather 루프를 체크 유무만 바꿔 측정
+template<typename Access>
+static double benchmarkGather(const vector<int>& data, const vector<uint32_t>& indices, Access access, long long& sum) {
+    auto start = chrono::steady_clock::now();
+    long long s = 0;
+    for (int round = 0; round < 8; ++round)
+        for (uint32_t i : indices) s += access(data.data(), data.size(), i);
+    sum = s;
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
 int main() {
     cout << "=== C++ Assertion ===" << endl;
     
     cout << "10 / 2 = " << divide(10, 2) << endl;
     // divide(10, 0);  // Assert 실패 (주석 처리)
     
+    cout << "\n=== Tiered assertions (ASSERT_LEVEL=" << ASSERT_LEVEL << ") ===" << endl;
+    cout << "checkedDivide(9, 3) = " << checkedDivide(9, 3) << endl;
+    vector<int> sorted{1, 3, 5, 7, 9};
+    cout << "lowerBoundIndex(6) = " << lowerBoundIndex(sorted, 6)
+         << (ASSERT_LEVEL >= ASSERT_LEVEL_AUDIT ? " (audit: sortedness checked)" : " (audit check compiled out)") << endl;
+    // checkedAt(sorted.data(), sorted.size(), 5);  // 실패 → stderr 메시지 + abort
+    
+    cout << "\n=== Benchmark: always-on range check ===" << endl;
+    vector<int> data(1 << 16);
+    for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<int>(i * 7);
+    vector<uint32_t> indices(1 << 17);
+    uint32_t x = 12345;
+    for (auto& i : indices) {
+        x = x * 1664525 + 1013904223;
+        i = x % data.size();
+    }
+    long long sumChecked = 0, sumUnchecked = 0;
+    benchmarkGather(data, indices, checkedAt, sumChecked);      // warm-up
+    double unchecked = 1e9, checked = 1e9;
+    for (int trial = 0; trial < 5; ++trial) {       // 최솟값 비교로 잡음 제거
+        unchecked = min(unchecked, benchmarkGather(data, indices, uncheckedAt, sumUnchecked));
+        checked = min(checked, benchmarkGather(data, indices, checkedAt, sumChecked));
+    }
+    cout << "  unchecked    : " << unchecked << " ms" << endl;
+    cout << "  ASSERT_ALWAYS: " << checked << " ms (" << (checked / unchecked - 1) * 100 << "% overhead)"
+         << (sumChecked == sumUnchecked ? "" : " MISMATCH") << endl;
+    
     return 0;
 }
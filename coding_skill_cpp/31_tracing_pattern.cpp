@@ -1,24 +1,459 @@
 /* C++ Tracing - RAII 기반 */
 #include <iostream>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "bench/perf_counters.h"
 using namespace std;
 
+// 빌드 플래그: -DTRACING_ENABLED=0 이면 TRACE()가 아무 코드도 만들지 않음
+#ifndef TRACING_ENABLED
+#define TRACING_ENABLED 1
+#endif
+
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+[[noreturn]] static void throwErrno(const char* what) {
+    throw system_error(errno, generic_category(), what);
+}
+
+// 비교용 기존 방식: 매 진입/종료마다 string 생성 + cout (depth는 스레드별로 분리)
+//  - 종료 시 구간의 하드웨어 카운터 요약 (카운터가 없으면 시간만)
 class FunctionTracer {
     string name;
-    static int depth;
+    static thread_local int depth;
+    perf::Reading start;
 public:
     FunctionTracer(const string& fname) : name(fname) {
         cout << string(depth++, ' ') << "→ " << name << "()" << endl;
+        start = perf::threadCounters().read();
     }
     
     ~FunctionTracer() {
-        cout << string(--depth, ' ') << "← " << name << "()" << endl;
+        perf::Delta d = perf::threadCounters().since(start);
+        cout << string(--depth, ' ') << "← " << name << "() [" << perf::describe(d, 1, "call") << "]" << endl;
+    }
+};
+
+thread_local int FunctionTracer::depth = 0;
+
+enum class TraceEventType : uint8_t { Begin, End };
+
+// 16바이트 고정 레코드: 문자열 없음, 이름은 intern된 ID
+struct TraceRecord {
+    uint64_t timestampNs;
+    uint32_t nameId;
+    uint16_t threadId;
+    TraceEventType type;
+    uint8_t reserved = 0;
+};
+static_assert(sizeof(TraceRecord) == 16);
+
+/*
+ * TraceNames - 정적 이름(__func__ 등) → ID
+ *  - 호출 지점마다 function-local static으로 한 번만 등록 → hot path는 ID만 씀
+ *  - 포인터만 보관 (이름은 정적 수명 문자열이어야 함)
+ */
+class TraceNames {
+    mutex lock;
+    vector<const char*> names;
+public:
+    static TraceNames& instance() {
+        static TraceNames registry;
+        return registry;
+    }
+    uint32_t intern(const char* name) {
+        lock_guard<mutex> guard(lock);
+        for (uint32_t i = 0; i < names.size(); ++i)
+            if (names[i] == name) return i;
+        names.push_back(name);
+        return static_cast<uint32_t>(names.size() - 1);
+    }
+    const char* name(uint32_t id) {
+        lock_guard<mutex> guard(lock);
+        return id < names.size() ? names[id] : "?";
+    }
+};
+
+/*
+ * ThreadTraceBuffer - 스레드 하나가 쓰고 flusher 하나가 읽는 SPSC ring
+ *  - push: relaxed load + store 두 번, 가득 차면 버리고 dropped 증가 (생산자는 절대 대기 안 함)
+ *  - head/tail은 다른 cache line → 생산자/소비자 false sharing 없음
+ */
+class ThreadTraceBuffer {
+    static constexpr uint32_t CAPACITY = 8192;
+    array<TraceRecord, CAPACITY> records;
+    alignas(CACHE_LINE_SIZE) atomic<uint32_t> head{0};    // 생산자
+    alignas(CACHE_LINE_SIZE) atomic<uint32_t> tail{0};    // 소비자
+    atomic<uint64_t> droppedCount{0};
+public:
+    const uint16_t threadId;
+
+    explicit ThreadTraceBuffer(uint16_t threadId) : threadId(threadId) {}
+
+    void push(uint32_t nameId, TraceEventType type, uint64_t ns) {
+        uint32_t h = head.load(memory_order_relaxed);
+        if (h - tail.load(memory_order_acquire) == CAPACITY) {
+            droppedCount.fetch_add(1, memory_order_relaxed);
+            return;
+        }
+        records[h % CAPACITY] = {ns, nameId, threadId, type};
+        head.store(h + 1, memory_order_release);
+    }
+
+    // 쌓인 레코드를 out에 붙이고 개수 반환
+    size_t drainTo(vector<TraceRecord>& out) {
+        uint32_t t = tail.load(memory_order_relaxed);
+        uint32_t h = head.load(memory_order_acquire);
+        // wrap 지점 기준 최대 두 구간을 통째로 복사
+        uint32_t first = min(h - t, CAPACITY - t % CAPACITY);
+        out.insert(out.end(), records.begin() + t % CAPACITY, records.begin() + t % CAPACITY + first);
+        out.insert(out.end(), records.begin(), records.begin() + (h - t - first));
+        tail.store(h, memory_order_release);
+        return h - t;
     }
+
+    uint64_t dropped() const { return droppedCount.load(memory_order_relaxed); }
 };
 
-int FunctionTracer::depth = 0;
+/*
+ * Tracer - 스레드별 버퍼 등록 + 백그라운드 flusher
+ *  - 스레드는 첫 TRACE() 때 버퍼를 받음 (thread_local 포인터, 등록 시 한 번만 lock)
+ *  - 버퍼는 Tracer가 소유 → 스레드가 끝나도 남은 레코드를 flusher가 읽을 수 있음
+ *  - flusher: 주기적으로 모든 버퍼를 비워 바이너리 파일에 fwrite
+ */
+class Tracer {
+    mutex buffersLock;
+    vector<unique_ptr<ThreadTraceBuffer>> buffers;
+    FILE* output = nullptr;
+    atomic<bool> running{false};
+    thread flusher;
+    uint64_t written = 0;
+
+    void flushOnce(vector<TraceRecord>& scratch) {
+        scratch.clear();
+        {
+            lock_guard<mutex> guard(buffersLock);
+            for (auto& buffer : buffers) buffer->drainTo(scratch);
+        }
+        if (!scratch.empty() && output) {
+            fwrite(scratch.data(), sizeof(TraceRecord), scratch.size(), output);
+            written += scratch.size();
+        }
+    }
+
+public:
+    static Tracer& instance() {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    ~Tracer() { stop(); }
+
+    ThreadTraceBuffer& threadBuffer() {
+        thread_local ThreadTraceBuffer* mine = nullptr;
+        if (!mine) [[unlikely]] {
+            lock_guard<mutex> guard(buffersLock);
+            buffers.push_back(make_unique<ThreadTraceBuffer>(static_cast<uint16_t>(buffers.size() + 1)));
+            mine = buffers.back().get();
+        }
+        return *mine;
+    }
+
+    void start(const string& binaryPath, chrono::milliseconds period = chrono::milliseconds(2)) {
+        output = fopen(binaryPath.c_str(), "wb");
+        if (!output) throwErrno("fopen");
+        written = 0;
+        running = true;
+        flusher = thread([this, period]() {
+            vector<TraceRecord> scratch;
+            scratch.reserve(4096);
+            while (running.load(memory_order_acquire)) {
+                flushOnce(scratch);
+                this_thread::sleep_for(period);
+            }
+            flushOnce(scratch);     // 마지막 잔여분
+        });
+    }
 
-#define TRACE() FunctionTracer __tracer__(__func__)
+    void stop() {
+        if (!running.exchange(false)) return;
+        flusher.join();
+        fclose(output);
+        output = nullptr;
+    }
+
+    uint64_t recordsWritten() const { return written; }
+
+    uint64_t dropped() {
+        lock_guard<mutex> guard(buffersLock);
+        uint64_t total = 0;
+        for (auto& buffer : buffers) total += buffer->dropped();
+        return total;
+    }
+};
+
+static inline uint64_t traceNowNs() {
+    return static_cast<uint64_t>(
+        chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/*
+ * 함수별 집계 프로파일 (raw trace와 같은 TRACE() 지점에서 수집)
+ *  - SiteStats: 호출 수, 샘플 수, total/self 시간, log2(ns) latency 히스토그램
+ *  - 스레드별 고정 크기 테이블 (이름 ID로 인덱싱), 주인 스레드만 쓰므로 RMW 없이 load+store
+ *  - report 시 모든 스레드 테이블을 relaxed load로 합산
+ */
+constexpr uint32_t MAX_TRACE_SITES = 256;
+
+struct SiteStats {
+    atomic<uint64_t> calls{0};
+    atomic<uint64_t> sampled{0};
+    atomic<uint64_t> totalNs{0};
+    atomic<uint64_t> selfNs{0};
+    array<atomic<uint32_t>, 64> histogram{};
+    atomic<uint64_t> counted{0};                                // 카운터를 읽은 샘플 수
+    array<atomic<uint64_t>, perf::EVENT_COUNT> events{};
+
+    static void bump(atomic<uint64_t>& counter, uint64_t delta) {
+        counter.store(counter.load(memory_order_relaxed) + delta, memory_order_relaxed);
+    }
+    void addSample(uint64_t total, uint64_t self) {
+        bump(sampled, 1);
+        bump(totalNs, total);
+        bump(selfNs, self);
+        auto& bucket = histogram[min<size_t>(bit_width(total), 63)];
+        bucket.store(bucket.load(memory_order_relaxed) + 1, memory_order_relaxed);
+    }
+    void addCounters(const perf::Delta& d) {
+        if (!d.has(perf::CYCLES)) return;
+        bump(counted, 1);
+        for (uint32_t e = 0; e < perf::EVENT_COUNT; ++e) bump(events[e], d.counts[e]);
+    }
+};
+
+struct ThreadProfile {
+    array<SiteStats, MAX_TRACE_SITES> sites;
+};
+
+struct FunctionProfile {
+    const char* name = "";
+    uint64_t calls = 0;
+    uint64_t sampled = 0;
+    uint64_t totalNs = 0;
+    uint64_t selfNs = 0;
+    array<uint64_t, 64> histogram{};
+    uint64_t counted = 0;
+    array<uint64_t, perf::EVENT_COUNT> events{};
+
+    double ipc() const { return events[perf::CYCLES] ? double(events[perf::INSTRUCTIONS]) / events[perf::CYCLES] : 0; }
+    double cacheMissesPerCall() const { return counted ? double(events[perf::CACHE_MISSES]) / counted : 0; }
+
+    // 샘플링된 호출만 시간을 쟀으므로 calls/sampled 배로 환산
+    double estimatedTotalMs() const { return sampled ? totalNs * (double(calls) / sampled) / 1e6 : 0; }
+    double estimatedSelfMs() const { return sampled ? selfNs * (double(calls) / sampled) / 1e6 : 0; }
+    uint64_t percentileNs(double p) const {
+        uint64_t rank = static_cast<uint64_t>(p / 100.0 * (sampled ? sampled - 1 : 0)) + 1, seen = 0;
+        for (size_t b = 0; b < histogram.size(); ++b)
+            if ((seen += histogram[b]) >= rank) return b == 0 ? 0 : (uint64_t{1} << b) - 1;
+        return 0;
+    }
+};
+
+class Profiler {
+    mutex tablesLock;
+    vector<unique_ptr<ThreadProfile>> tables;
+public:
+    static Profiler& instance() {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    ThreadProfile& threadProfile() {
+        thread_local ThreadProfile* mine = nullptr;
+        if (!mine) [[unlikely]] {
+            lock_guard<mutex> guard(tablesLock);
+            tables.push_back(make_unique<ThreadProfile>());
+            mine = tables.back().get();
+        }
+        return *mine;
+    }
+
+    // 스레드별 테이블 합산, 추정 total 시간 내림차순
+    vector<FunctionProfile> merge() {
+        vector<FunctionProfile> merged(MAX_TRACE_SITES);
+        {
+            lock_guard<mutex> guard(tablesLock);
+            for (auto& table : tables) {
+                for (uint32_t id = 0; id < MAX_TRACE_SITES; ++id) {
+                    const SiteStats& s = table->sites[id];
+                    FunctionProfile& f = merged[id];
+                    f.calls += s.calls.load(memory_order_relaxed);
+                    f.sampled += s.sampled.load(memory_order_relaxed);
+                    f.totalNs += s.totalNs.load(memory_order_relaxed);
+                    f.selfNs += s.selfNs.load(memory_order_relaxed);
+                    for (size_t b = 0; b < 64; ++b) f.histogram[b] += s.histogram[b].load(memory_order_relaxed);
+                    f.counted += s.counted.load(memory_order_relaxed);
+                    for (uint32_t e = 0; e < perf::EVENT_COUNT; ++e) f.events[e] += s.events[e].load(memory_order_relaxed);
+                }
+            }
+        }
+        for (uint32_t id = 0; id < MAX_TRACE_SITES; ++id) merged[id].name = TraceNames::instance().name(id);
+        erase_if(merged, [](const FunctionProfile& f) { return f.calls == 0; });
+        sort(merged.begin(), merged.end(),
+             [](const FunctionProfile& a, const FunctionProfile& b) { return a.estimatedTotalMs() > b.estimatedTotalMs(); });
+        return merged;
+    }
+
+    void report() {
+        cout << "  " << left << setw(12) << "function" << right << setw(10) << "calls" << setw(10) << "sampled"
+             << setw(12) << "total ms" << setw(12) << "self ms" << setw(10) << "p50 ns" << setw(10) << "p99 ns"
+             << setw(8) << "IPC" << setw(12) << "miss/call" << endl;
+        for (const auto& f : merge()) {
+            cout << "  " << left << setw(12) << f.name << right << setw(10) << f.calls << setw(10) << f.sampled
+                 << setw(12) << fixed << setprecision(3) << f.estimatedTotalMs() << setw(12) << f.estimatedSelfMs()
+                 << setw(10) << f.percentileNs(50) << setw(10) << f.percentileNs(99);
+            if (f.counted)      // TRACE_COUNTERS() 지점만
+                cout << setw(8) << setprecision(2) << f.ipc() << setw(12) << setprecision(1) << f.cacheMissesPerCall();
+            else
+                cout << setw(8) << "-" << setw(12) << "-";
+            cout << defaultfloat << endl;
+        }
+    }
+};
+
+/*
+ * TraceScope - RAII 범위: raw 이벤트(Begin/End) + 프로파일 집계
+ *  - sampleEvery = N: 스레드별로 N번째 호출만 시각을 재고 기록, 나머지는 호출 수만 증가
+ *  - self 시간 = 내 시간 - 샘플링된 자식 scope 시간 (샘플링 안 된 자식은 부모 self에 포함)
+ *  - 이름 ID가 MAX_TRACE_SITES 이상이면 raw 이벤트만 기록
+ */
+class TraceScope {
+    static inline thread_local TraceScope* current = nullptr;
+    ThreadTraceBuffer* buffer = nullptr;        // nullptr = 이번 호출은 샘플링 안 됨
+    SiteStats* stats = nullptr;
+    TraceScope* parent = nullptr;
+    uint32_t nameId;
+    uint64_t startNs = 0;
+    uint64_t childNs = 0;
+    bool withCounters;
+    perf::Reading counterStart;
+public:
+    TraceScope(uint32_t nameId, uint32_t sampleEvery, bool withCounters = false)
+        : nameId(nameId), withCounters(withCounters) {
+        if (nameId < MAX_TRACE_SITES) {
+            stats = &Profiler::instance().threadProfile().sites[nameId];
+            uint64_t n = stats->calls.load(memory_order_relaxed);
+            stats->calls.store(n + 1, memory_order_relaxed);
+            if (n % sampleEvery != 0) return;
+        }
+        buffer = &Tracer::instance().threadBuffer();
+        parent = current;
+        current = this;
+        startNs = traceNowNs();
+        buffer->push(nameId, TraceEventType::Begin, startNs);
+        if (withCounters) counterStart = perf::threadCounters().read();    // 마지막에 읽어 push 비용 제외
+    }
+    ~TraceScope() {
+        if (!buffer) return;
+        if (withCounters && stats) stats->addCounters(perf::threadCounters().since(counterStart));
+        uint64_t endNs = traceNowNs();
+        buffer->push(nameId, TraceEventType::End, endNs);
+        uint64_t elapsed = endNs - startNs;
+        if (stats) stats->addSample(elapsed, elapsed > childNs ? elapsed - childNs : 0);
+        if (parent) parent->childNs += elapsed;
+        current = parent;
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+// TRACE(): 모든 호출 기록, TRACE_EVERY(n): n번째 호출마다 기록 (hot path 상시 계측용)
+// TRACE_COUNTERS_EVERY(n): 샘플마다 하드웨어 카운터도 읽음 (read syscall 2번 → 느린 함수에만)
+#if TRACING_ENABLED
+#define TRACE_SCOPE_(n, counters) \
+    static const uint32_t traceNameId_ = TraceNames::instance().intern(__func__); \
+    TraceScope traceScope_(traceNameId_, (n), (counters))
+#else
+#define TRACE_SCOPE_(n, counters) do {} while (0)
+#endif
+#define TRACE_EVERY(n) TRACE_SCOPE_(n, false)
+#define TRACE() TRACE_EVERY(1)
+#define TRACE_COUNTERS_EVERY(n) TRACE_SCOPE_(n, true)
+#define TRACE_COUNTERS() TRACE_COUNTERS_EVERY(1)
+
+/*
+ * Chrome trace JSON 내보내기 (chrome://tracing, ui.perfetto.dev에서 열림)
+ *  - flusher가 쓴 바이너리 레코드를 읽어 {"ph":"B"/"E","ts":us,...}로 변환
+ *  - ts는 첫 레코드 기준 마이크로초
+ *  - 파일 전체를 스레드별·시각순으로 모아 B/E 짝을 맞춤 (flush 묶음·버퍼 경계와 무관)
+ *    ring이 가득 차 짝이 버려진 경우: 짝 없는 E는 버리고, 안쪽 E가 빠졌으면 바깥 E 시각에 닫고,
+ *    끝까지 안 닫힌 B는 그 스레드의 마지막 시각에 닫음 → 뷰어에서 범위가 어긋나지 않음
+ */
+size_t exportChromeTrace(const string& binaryPath, const string& jsonPath) {
+    unique_ptr<FILE, int (*)(FILE*)> in(fopen(binaryPath.c_str(), "rb"), fclose);
+    if (!in) throwErrno("fopen");
+    vector<TraceRecord> records;
+    TraceRecord chunk[1024];
+    for (size_t got; (got = fread(chunk, sizeof(TraceRecord), 1024, in.get())) > 0;)
+        records.insert(records.end(), chunk, chunk + got);
+
+    stable_sort(records.begin(), records.end(), [](const TraceRecord& a, const TraceRecord& b) {
+        return a.threadId != b.threadId ? a.threadId < b.threadId : a.timestampNs < b.timestampNs;
+    });
+
+    vector<TraceRecord> matched;
+    matched.reserve(records.size());
+    vector<TraceRecord> open;       // 현재 스레드의 열린 B
+    auto closeTo = [&](size_t depth, uint64_t ns) {
+        while (open.size() > depth) {
+            TraceRecord end = open.back();
+            end.type = TraceEventType::End;
+            end.timestampNs = ns;
+            matched.push_back(end);
+            open.pop_back();
+        }
+    };
+    for (size_t i = 0; i < records.size(); ++i) {
+        const auto& r = records[i];
+        if (r.type == TraceEventType::Begin) {
+            open.push_back(r);
+            matched.push_back(r);
+        } else {
+            auto it = find_if(open.rbegin(), open.rend(), [&](const TraceRecord& b) { return b.nameId == r.nameId; });
+            if (it != open.rend()) closeTo(static_cast<size_t>(open.rend() - it) - 1, r.timestampNs);
+        }
+        if (i + 1 == records.size() || records[i + 1].threadId != r.threadId) closeTo(0, r.timestampNs);
+    }
+
+    unique_ptr<FILE, int (*)(FILE*)> out(fopen(jsonPath.c_str(), "w"), fclose);
+    if (!out) throwErrno("fopen");
+    uint64_t base = UINT64_MAX;
+    for (const auto& r : matched) base = min(base, r.timestampNs);
+    fputs("{\"traceEvents\":[\n", out.get());
+    for (size_t i = 0; i < matched.size(); ++i) {
+        const auto& r = matched[i];
+        fprintf(out.get(), "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}%s\n",
+                TraceNames::instance().name(r.nameId), r.type == TraceEventType::Begin ? 'B' : 'E',
+                (r.timestampNs - base) / 1000.0, r.threadId, i + 1 < matched.size() ? "," : "");
+    }
+    fputs("],\"displayTimeUnit\":\"ns\"}\n", out.get());
+    return matched.size();
+}
 
 void functionC() {
     TRACE();
@@ -37,8 +472,77 @@ void functionA() {
     functionB();
 }
 
+// 캐시 미스가 많은 함수: 4 MB 표를 cache line 간격으로 훑음
+static vector<uint8_t> scanTableData(4 << 20, 1);
+
+uint64_t scanTable() {
+    TRACE_COUNTERS();
+    uint64_t sum = 0;
+    for (size_t i = 0; i < scanTableData.size(); i += CACHE_LINE_SIZE) sum += scanTableData[i];
+    return sum;
+}
+
+// benchmark용: 출력 없는 빈 함수
+void tracedLeaf() { TRACE(); }
+void sampledLeaf() { TRACE_EVERY(64); }
+void legacyLeaf() { FunctionTracer tracer(__func__); }
+void plainLeaf() {}
+
+template<typename Func>
+static double nsPerCall(Func func, int calls) {
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < calls; ++i) func();
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / calls;
+}
+
 int main() {
     cout << "=== C++ Tracing ===" << endl;
+    string base = "/tmp/trace_" + to_string(chrono::steady_clock::now().time_since_epoch().count());
+    Tracer::instance().start(base + ".bin");
     functionA();
+    
+    cout << "\n=== Multi-threaded TRACE() ===" << endl;
+    vector<thread> workers;
+    for (int t = 0; t < 3; ++t) {
+        workers.emplace_back([]() {
+            for (int i = 0; i < 1000; ++i) tracedLeaf();
+        });
+    }
+    for (auto& w : workers) w.join();
+    
+    cout << "\n=== Hardware counters ===" << endl;
+    cout << "  " << (perf::threadCounters().hardware() ? string("perf_event_open counters available")
+                                                      : "time only: " + perf::threadCounters().unavailableReason())
+         << endl;
+    uint64_t scanned = 0;
+    {
+        FunctionTracer tracer("scanTable x20");
+        for (int i = 0; i < 20; ++i) scanned += scanTable();
+    }
+    cout << "  scanned " << scanned << " lines" << endl;
+    
+    cout << "\n=== Benchmark: per-call cost ===" << endl;
+    constexpr int CALLS = 200000;
+    double plain = nsPerCall(plainLeaf, CALLS);
+    double traced = nsPerCall(tracedLeaf, CALLS);
+    double sampled = nsPerCall(sampledLeaf, CALLS);
+    ostringstream sink;
+    streambuf* saved = cout.rdbuf(sink.rdbuf());        // 기존 방식 출력은 메모리로 (터미널 비용 제외)
+    double legacy = nsPerCall(legacyLeaf, 20000);
+    cout.rdbuf(saved);
+    cout << "  no tracing          : " << plain << " ns/call" << endl;
+    cout << "  TRACE() ring buffer : " << traced << " ns/call" << endl;
+    cout << "  TRACE_EVERY(64)     : " << sampled << " ns/call" << endl;
+    cout << "  string + cout       : " << legacy << " ns/call (even without a terminal)" << endl;
+    
+    Tracer::instance().stop();
+    
+    cout << "\n=== Aggregated profile (all threads merged) ===" << endl;
+    Profiler::instance().report();
+    size_t events = exportChromeTrace(base + ".bin", base + ".json");
+    cout << "\nflushed " << Tracer::instance().recordsWritten() << " records, dropped " << Tracer::instance().dropped()
+         << " (ring full), exported " << events << " events → " << base << ".json" << endl;
+    remove((base + ".bin").c_str());
+    remove((base + ".json").c_str());
     return 0;
 }
@@ -0,0 +1,164 @@
+/* C++ Allocation Profiler - 전역 operator new 교체 + 호출 지점별 집계 */
+#include <iostream>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 이 실행 파일에서만 전역 operator new/delete를 프로파일러로 교체
+#define ALLOC_PROFILER_REPLACE_NEW
+#include "profiling/alloc_profiler.h"
+using namespace std;
+
+/*
+ * 숨은 할당이 있는 경로들 (각 데모 파일의 모양을 축약)
+ *  - 리포트에 함수 이름이 보이도록 static 없이 두고 inline을 막음 (CMake에서 이 타깃만 ENABLE_EXPORTS)
+ */
+
+// 10_event_queue.cpp의 BasicEventQueue::push(function<void()>): 캡처가 내부 버퍼(16B)보다 크면 힙
+struct SensorSample {
+    int id;
+    double values[4];
+};
+
+ALLOCPROF_NOINLINE void pushEvents(vector<function<void()>>& queue, int count) {
+    for (int i = 0; i < count; ++i) {
+        SensorSample sample{i, {1.0, 2.0, 3.0, 4.0}};
+        queue.push_back([sample]() { (void)sample; });
+    }
+}
+
+// 31_tracing_pattern.cpp의 FunctionTracer: 진입마다 const string& 인자로 string 생성 (SSO 15자 초과)
+class NamedTracer {
+    string name;
+public:
+    explicit NamedTracer(const string& fname) : name(fname) {}
+    size_t length() const { return name.size(); }
+};
+
+ALLOCPROF_NOINLINE size_t traceCalls(int count) {
+    size_t total = 0;
+    for (int i = 0; i < count; ++i) {
+        NamedTracer tracer("SensorPipeline::processFrame");
+        total += tracer.length();
+    }
+    return total;
+}
+
+// 05_state_machine.cpp의 StateMachine::transition: onEnter[current]가 없는 상태면 노드를 끼워 넣음
+enum class MachineState { IDLE, RUNNING, STOPPED };
+
+ALLOCPROF_NOINLINE int runTransitions(int count) {
+    map<MachineState, function<void()>> onEnter;        // 인스턴스마다 새 map (핸들러 등록도 할당)
+    int entered = 0;
+    onEnter[MachineState::RUNNING] = [&entered]() { entered++; };
+    MachineState current = MachineState::IDLE;
+    for (int i = 0; i < count; ++i) {
+        current = current == MachineState::RUNNING ? MachineState::STOPPED : MachineState::RUNNING;
+        if (onEnter[current]) onEnter[current]();
+    }
+    return entered;
+}
+
+// 06_factory_pattern.cpp의 Factory::create: 제품마다 make_unique
+struct Product {
+    virtual ~Product() = default;
+    virtual int value() const = 0;
+};
+struct ProductA : Product {
+    int value() const override { return 1; }
+};
+
+ALLOCPROF_NOINLINE int createProducts(int count) {
+    int sum = 0;
+    for (int i = 0; i < count; ++i) {
+        unique_ptr<Product> product = make_unique<ProductA>();
+        sum += product->value();
+    }
+    return sum;
+}
+
+// 할당 없는 경로: 고정 크기 배열 링 버퍼
+ALLOCPROF_NOINLINE int fixedRing(int count) {
+    array<int, 64> ring{};
+    int sum = 0;
+    for (int i = 0; i < count; ++i) {
+        ring[i & 63] = i;
+        sum += ring[(i + 1) & 63];
+    }
+    return sum;
+}
+
+ALLOCPROF_NOINLINE void runWorkload(int rounds) {
+    vector<function<void()>> queue;
+    queue.reserve(static_cast<size_t>(rounds));
+    pushEvents(queue, rounds);
+    traceCalls(rounds);
+    for (int i = 0; i < rounds / 100; ++i) runTransitions(100);
+    createProducts(rounds);
+}
+
+// 할당 1회 비용: 교체 안의 경로만 (꺼짐 / 표본 간격 64 / 전부 표본)
+static void* volatile allocationSink = nullptr;
+
+static double nsPerAllocation(int count) {
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        void* p = ::operator new(48);
+        allocationSink = p;
+        ::operator delete(p);
+    }
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / count;
+}
+
+static uint64_t failedLine = 0;
+static uint64_t failedCount = 0;
+
+int main() {
+    cout << "=== C++ Allocation Profiler ===" << endl;
+    allocprof::start(1);
+    runWorkload(10000);
+    allocprof::stop();
+    allocprof::report(cout, 6, 3);
+
+    cout << "\n=== Sampling (interval 64) ===" << endl;
+    allocprof::reset();
+    allocprof::start(64);
+    runWorkload(10000);
+    allocprof::stop();
+    for (const auto& site : allocprof::topSites(4)) {
+        cout << "  ~" << site.estimatedCount << " allocs (" << site.samples << " samples) at "
+             << site.callSite() << endl;
+    }
+
+    cout << "\n=== ASSERT_NO_ALLOC ===" << endl;
+    allocprof::setNoAllocHandler([](const char*, int line, uint64_t count) {
+        failedLine = static_cast<uint64_t>(line);
+        failedCount = count;
+    });
+    int sum = 0;
+    ASSERT_NO_ALLOC {
+        sum += fixedRing(1000);
+    }
+    cout << "fixedRing: passed (sum " << sum << ")" << endl;
+    ASSERT_NO_ALLOC {
+        sum += createProducts(3);
+    }
+    cout << "createProducts(3): failed at line " << failedLine << " with " << failedCount << " allocation(s)" << endl;
+    allocprof::setNoAllocHandler(nullptr);      // 기본 동작(abort)으로 복구
+
+    cout << "\n=== Overhead per allocation ===" << endl;
+    constexpr int COUNT = 200000;
+    cout << "  profiler off : " << nsPerAllocation(COUNT) << " ns" << endl;
+    allocprof::start(64);
+    cout << "  interval 64  : " << nsPerAllocation(COUNT) << " ns" << endl;
+    allocprof::start(1);
+    cout << "  every alloc  : " << nsPerAllocation(COUNT) << " ns" << endl;
+    allocprof::stop();
+
+    return 0;
+}
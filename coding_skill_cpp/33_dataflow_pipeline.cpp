@@ -0,0 +1,353 @@
+/* C++ Dataflow Pipeline - 센서 → 어댑터 변환 → 필터 → 캐시 / 옵저버 fan-out */
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+#include "dataflow/pipeline.h"
+using namespace std;
+
+// 10_event_queue.cpp의 WorkStealingExecutor와 같은 구조 (통계 / process_until_idle 생략)
+class WorkStealingExecutor {
+    struct alignas(64) Worker {
+        mutex mtx;
+        deque<function<void()>> tasks;
+    };
+
+    vector<unique_ptr<Worker>> workers;
+    vector<thread> threads;
+    atomic<size_t> queued{0};
+    atomic<size_t> sleepers{0};
+    atomic<size_t> nextWorker{0};
+    atomic<bool> stopping{false};
+    mutex sleepMtx;
+    condition_variable wakeCv;
+
+    static inline thread_local WorkStealingExecutor* currentExecutor = nullptr;
+    static inline thread_local size_t currentIndex = 0;
+
+public:
+    explicit WorkStealingExecutor(size_t workerCount) {
+        for (size_t i = 0; i < workerCount; ++i) workers.push_back(make_unique<Worker>());
+        for (size_t i = 0; i < workerCount; ++i) threads.emplace_back([this, i]() { workerLoop(i); });
+    }
+
+    ~WorkStealingExecutor() {
+        stopping = true;
+        { lock_guard<mutex> lock(sleepMtx); }
+        wakeCv.notify_all();
+        for (auto& t : threads) t.join();
+    }
+
+    void push(function<void()> task) {
+        size_t index = (currentExecutor == this) ? currentIndex
+                                                 : nextWorker.fetch_add(1, memory_order_relaxed) % workers.size();
+        {
+            lock_guard<mutex> lock(workers[index]->mtx);
+            workers[index]->tasks.push_back(std::move(task));
+        }
+        queued.fetch_add(1);
+        if (sleepers.load() > 0) {
+            { lock_guard<mutex> lock(sleepMtx); }
+            wakeCv.notify_one();
+        }
+    }
+
+private:
+    bool take(size_t index, function<void()>& task) {
+        for (size_t k = 0; k < workers.size(); ++k) {
+            Worker& w = *workers[(index + k) % workers.size()];
+            lock_guard<mutex> lock(w.mtx);
+            if (w.tasks.empty()) continue;
+            if (k == 0) {
+                task = std::move(w.tasks.back());       // 자기 deque: LIFO
+                w.tasks.pop_back();
+            } else {
+                task = std::move(w.tasks.front());      // 훔치기: FIFO
+                w.tasks.pop_front();
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void workerLoop(size_t index) {
+        currentExecutor = this;
+        currentIndex = index;
+        function<void()> task;
+        for (;;) {
+            if (take(index, task)) {
+                queued.fetch_sub(1);
+                task();
+                task = nullptr;
+                continue;
+            }
+            if (stopping.load() && queued.load() == 0) return;
+            unique_lock<mutex> lock(sleepMtx);
+            sleepers.fetch_add(1);
+            wakeCv.wait(lock, [this]() { return stopping.load() || queued.load() > 0; });
+            sleepers.fetch_sub(1);
+        }
+    }
+};
+
+/*
+ * 단계 함수들 (각 데모의 역할을 축약)
+ *  - 모두 순서와 무관한 결과를 내도록 함 → 복제본이 항목 순서를 섞어도 checksum이 같아야 함
+ */
+constexpr uint32_t SENSOR_COUNT = 64;
+constexpr uint64_t SAMPLE_COUNT = 400000;
+
+struct RawSample {
+    uint32_t sensorId;
+    uint32_t seq;
+    float kelvin;
+};
+
+struct Reading {
+    uint32_t sensorId;
+    uint32_t seq;
+    float celsius;
+};
+
+// 센서: seq 순서로 샘플 생성, 97번째마다 고장 값(0 K)
+class SensorSource {
+    uint64_t next = 0;
+    uint64_t total;
+public:
+    explicit SensorSource(uint64_t total) : total(total) {}
+
+    size_t operator()(span<RawSample> out) {
+        size_t n = 0;
+        for (; n < out.size() && next < total; ++n, ++next) {
+            uint32_t noise = static_cast<uint32_t>(next * 2654435761u) >> 24;      // 0..255
+            float kelvin = next % 97 == 0 ? 0.0f : 283.15f + static_cast<float>(noise) * 0.25f;
+            out[n] = {static_cast<uint32_t>(next % SENSOR_COUNT), static_cast<uint32_t>(next), kelvin};
+        }
+        return n;
+    }
+};
+
+// 02_adapter_pattern.cpp의 Kelvin → Celsius 변환 + 센서 보정 다항식 (가장 무거운 단계)
+static size_t convertToCelsius(span<const RawSample> in, span<Reading> out) {
+    for (size_t i = 0; i < in.size(); ++i) {
+        float x = (in[i].kelvin - 273.15f) / 100.0f;
+        float y = 0.0f;
+        for (int k = 0; k < 48; ++k) y = y * x + 1.0f / static_cast<float>(k + 1);    // Horner
+        out[i] = {in[i].sensorId, in[i].seq, in[i].kelvin - 273.15f + (y - 1.0f) * 0.001f};
+    }
+    return in.size();
+}
+
+// 25_failsafe_pattern.cpp의 범위 검사: 물리적으로 불가능한 값은 버림
+static size_t dropOutOfRange(span<const Reading> in, span<Reading> out) {
+    size_t n = 0;
+    for (const Reading& r : in)
+        if (r.celsius >= -40.0f && r.celsius <= 125.0f) out[n++] = r;
+    return n;
+}
+
+// 21_cache_pattern.cpp의 캐시 역할: 센서별 최신(seq가 가장 큰) 값
+struct LatestCache {
+    struct Entry {
+        uint32_t seq = 0;
+        float celsius = 0.0f;
+    };
+    vector<Entry> entries = vector<Entry>(SENSOR_COUNT);
+    uint64_t updates = 0;
+
+    void operator()(span<const Reading> in) {
+        for (const Reading& r : in) {
+            Entry& e = entries[r.sensorId];
+            if (r.seq >= e.seq) e = {r.seq, r.celsius};
+            updates++;
+        }
+    }
+
+    uint64_t checksum() const {
+        uint64_t sum = 0;
+        for (const Entry& e : entries) sum = sum * 31 + e.seq;
+        return sum;
+    }
+};
+
+// 07_observer_pattern.cpp의 Subject 역할: 등록된 옵저버에 배치 단위로 통지
+struct ObserverFanout {
+    vector<function<void(const Reading&)>> observers;
+    uint64_t delivered = 0;
+
+    void operator()(span<const Reading> in) {
+        for (const Reading& r : in)
+            for (auto& observer : observers) observer(r);
+        delivered += in.size();
+    }
+};
+
+struct Result {
+    uint64_t cacheUpdates;
+    uint64_t cacheChecksum;
+    uint64_t delivered;
+    uint64_t alarms;
+    double seconds;
+};
+
+static void printResult(const char* name, const Result& r, const Result& baseline) {
+    bool same = r.cacheUpdates == baseline.cacheUpdates && r.cacheChecksum == baseline.cacheChecksum &&
+                r.delivered == baseline.delivered && r.alarms == baseline.alarms;
+    cout << name << ": " << SAMPLE_COUNT / r.seconds / 1e6 << " M samples/s (" << r.seconds * 1e3 << " ms, x"
+         << baseline.seconds / r.seconds << ")" << (same ? "" : " (MISMATCH)") << endl;
+}
+
+// 파이프라인 없이 단일 스레드에서 같은 단계 함수를 배치 단위로 차례 호출
+static Result runSequential() {
+    SensorSource source(SAMPLE_COUNT);
+    LatestCache cache;
+    ObserverFanout fanout;
+    uint64_t alarms = 0;
+    fanout.observers.push_back([&alarms](const Reading& r) { if (r.celsius > 70.0f) alarms++; });
+
+    RawSample raw[64];
+    Reading converted[64], filtered[64];
+    auto start = chrono::steady_clock::now();
+    while (size_t n = source(span<RawSample>(raw))) {
+        convertToCelsius(span<const RawSample>(raw, n), span<Reading>(converted, n));
+        size_t kept = dropOutOfRange(span<const Reading>(converted, n), span<Reading>(filtered, n));
+        cache(span<const Reading>(filtered, kept));
+        fanout(span<const Reading>(filtered, kept));
+    }
+    double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return {cache.updates, cache.checksum(), fanout.delivered, alarms, sec};
+}
+
+struct PipelineConfig {
+    dataflow::Placement sensor, adapter, filter, cache, observers;
+    size_t adapterReplicas = 1;
+    size_t capacity = 1024;
+    size_t observerSpinNs = 0;      // 느린 옵저버 흉내 (backpressure 확인용)
+    WorkStealingExecutor* executor = nullptr;
+    bool report = true;
+};
+
+static Result runPipeline(const PipelineConfig& config) {
+    SensorSource source(SAMPLE_COUNT);
+    LatestCache cache;
+    ObserverFanout fanout;
+    atomic<uint64_t> alarms{0};
+    fanout.observers.push_back([&alarms](const Reading& r) {
+        if (r.celsius > 70.0f) alarms.fetch_add(1, memory_order_relaxed);
+    });
+    if (config.observerSpinNs) {
+        fanout.observers.push_back([ns = config.observerSpinNs](const Reading&) {
+            auto until = chrono::steady_clock::now() + chrono::nanoseconds(ns);
+            while (chrono::steady_clock::now() < until) {}
+        });
+    }
+
+    dataflow::Pipeline pipe;
+    auto& sensor = pipe.source<RawSample>("sensor", ref(source), {.placement = config.sensor});
+    auto& adapter = pipe.stage<RawSample, Reading>("adapter", convertToCelsius,
+                                                   {.replicas = config.adapterReplicas, .placement = config.adapter});
+    auto& filter = pipe.stage<Reading, Reading>("filter", dropOutOfRange, {.placement = config.filter});
+    auto& cacheSink = pipe.sink<Reading>("cache", ref(cache), {.placement = config.cache});
+    auto& observerSink = pipe.sink<Reading>("observers", ref(fanout), {.placement = config.observers});
+    pipe.connect(sensor, adapter, config.capacity);
+    pipe.connect(adapter, filter, config.capacity);
+    pipe.connect(filter, cacheSink, config.capacity);       // fan-out: 같은 항목이 두 싱크로
+    pipe.connect(filter, observerSink, config.capacity);
+    if (config.executor) pipe.useExecutor(*config.executor);
+
+    pipe.run();
+    if (config.report) pipe.report(cout);
+    return {cache.updates, cache.checksum(), fanout.delivered, alarms.load(), pipe.elapsedSec()};
+}
+
+// 끝 전파 경쟁 반복: 작은 입력을 복제본 4개 실행기 단계에 흘려 보내고 매번 새 Pipeline을 만들어 바로 파괴
+//  - 입력이 닫힐 때 쉬거나 막혀 있던 형제 복제본도 모두 깨어나 끝나야 run()이 돌아옴
+//  - run()이 돌아온 직후 파괴해도 실행 중인 작업이 없어야 함
+static bool runCloseRace(WorkStealingExecutor& executor, int rounds) {
+    for (int round = 0; round < rounds; ++round) {
+        uint32_t next = 0;
+        const uint32_t total = 1 + round % 300;
+        atomic<uint64_t> sum{0};
+        {
+            dataflow::Pipeline pipe;
+            auto& src = pipe.source<uint32_t>("numbers", [&](span<uint32_t> out) {
+                size_t n = 0;
+                while (n < out.size() && next < total) out[n++] = ++next;
+                return n;
+            }, {.batch = 8, .placement = dataflow::onExecutor()});
+            auto& twice = pipe.stage<uint32_t, uint32_t>("twice", [](span<const uint32_t> in, span<uint32_t> out) {
+                for (size_t i = 0; i < in.size(); ++i) out[i] = in[i] * 2;
+                return in.size();
+            }, {.batch = 4, .replicas = 4, .placement = dataflow::onExecutor()});
+            auto& total2 = pipe.sink<uint32_t>("sum", [&](span<const uint32_t> in) {
+                for (uint32_t v : in) sum.fetch_add(v, memory_order_relaxed);
+            }, {.batch = 4, .placement = dataflow::onExecutor()});
+            pipe.connect(src, twice, 8);
+            pipe.connect(twice, total2, 4);
+            pipe.useExecutor(executor);
+            pipe.run();
+        }
+        if (sum.load() != uint64_t{total} * (total + 1)) {
+            cout << "round " << round << ": sum " << sum.load() << " != " << uint64_t{total} * (total + 1) << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    cout << "=== C++ Dataflow Pipeline ===" << endl;
+    cout << "sensor → adapter(K→°C) → filter(range) → cache + observers, " << SAMPLE_COUNT << " samples, "
+         << thread::hardware_concurrency() << " core(s)" << endl;
+
+    Result baseline = runSequential();
+    cout << "cache updates " << baseline.cacheUpdates << ", observer deliveries " << baseline.delivered
+         << ", alarms " << baseline.alarms << " (고장 샘플 " << SAMPLE_COUNT - baseline.cacheUpdates << "개 제거)"
+         << endl;
+    printResult("sequential (1 thread)     ", baseline, baseline);
+
+    cout << "\n=== 단계마다 전용 스레드 (코어 고정) ===" << endl;
+    PipelineConfig pinned{dataflow::pinnedTo(0), dataflow::pinnedTo(1), dataflow::pinnedTo(2),
+                          dataflow::pinnedTo(3), dataflow::pinnedTo(4)};
+    printResult("pinned threads            ", runPipeline(pinned), baseline);
+
+    cout << "\n=== 무거운 단계 복제 (adapter x2 → MPMC 큐) ===" << endl;
+    PipelineConfig replicated = pinned;
+    replicated.adapterReplicas = 2;
+    replicated.filter = dataflow::pinnedTo(3);         // 복제본 r은 코어 1 + r
+    replicated.cache = dataflow::pinnedTo(4);
+    replicated.observers = dataflow::pinnedTo(5);
+    printResult("pinned, adapter x2        ", runPipeline(replicated), baseline);
+
+    cout << "\n=== Work-stealing executor (워커 4개) ===" << endl;
+    {
+        WorkStealingExecutor executor(4);
+        PipelineConfig onExecutor{dataflow::onExecutor(), dataflow::onExecutor(), dataflow::onExecutor(),
+                                  dataflow::onExecutor(), dataflow::onExecutor()};
+        onExecutor.adapterReplicas = 2;
+        onExecutor.executor = &executor;
+        printResult("executor, adapter x2      ", runPipeline(onExecutor), baseline);
+
+        const int rounds = 2000;
+        cout << "close race (replicas x4, " << rounds << " runs): "
+             << (runCloseRace(executor, rounds) ? "all finished, sums match" : "FAILED") << endl;
+    }
+
+    cout << "\n=== Backpressure (느린 옵저버, 큐 용량 64) ===" << endl;
+    PipelineConfig slow = pinned;
+    slow.capacity = 64;
+    slow.observerSpinNs = 500;
+    printResult("slow observer             ", runPipeline(slow), baseline);
+    cout << "큐 깊이는 용량을 넘지 않고, 막힘(stalls)이 filter → adapter → sensor로 전파됨" << endl;
+
+    return 0;
+}
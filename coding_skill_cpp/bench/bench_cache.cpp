@@ -0,0 +1,75 @@
+/* 벤치마크: 21_cache_pattern.cpp (FlatHashMap / LruCache / ClockCache, Zipf 접근, 스냅샷 warm restart) */
+#define main cachePatternDemoMain
+#include "../21_cache_pattern.cpp"
+#undef main
+
+#include "harness.h"
+
+template<typename CacheType>
+static void readThrough(bench::Runner& runner, const string& name, const vector<int>& trace, size_t capacity) {
+    runner.run(name, trace.size(), [&]() {
+        CacheType cache(capacity);
+        long long sum = 0;
+        for (int key : trace) {
+            if (int* v = cache.get(key)) sum += *v;
+            else cache.put(key, key);
+        }
+        bench::doNotOptimize(sum);
+    });
+}
+
+int main(int argc, char** argv) {
+    bench::Runner runner("cache", argc, argv);
+    const vector<int> trace = zipfTrace(100000, 0.99, 1 << 19, 7);
+    
+    constexpr size_t KEYS = 1 << 16;
+    runner.run("unordered_map insert+find", KEYS, [&]() {
+        unordered_map<int, int> map;
+        long long sum = 0;
+        for (size_t i = 0; i < KEYS; ++i) map[static_cast<int>(i * 2654435761u)] = static_cast<int>(i);
+        for (size_t i = 0; i < KEYS; ++i) sum += map.find(static_cast<int>(i * 2654435761u))->second;
+        bench::doNotOptimize(sum);
+    });
+    runner.run("FlatHashMap insert+find", KEYS, [&]() {
+        FlatHashMap<int, int> map;
+        long long sum = 0;
+        for (size_t i = 0; i < KEYS; ++i) map[static_cast<int>(i * 2654435761u)] = static_cast<int>(i);
+        for (size_t i = 0; i < KEYS; ++i) sum += map.find(static_cast<int>(i * 2654435761u))->second;
+        bench::doNotOptimize(sum);
+    });
+    
+    readThrough<LruCache<int, int>>(runner, "LruCache zipf read-through", trace, 10000);
+    readThrough<ClockCache<int, int>>(runner, "ClockCache zipf read-through", trace, 10000);
+    runner.run("ShardedCache zipf read-through", trace.size(), [&]() {
+        ShardedCache<int, int> cache(10000);
+        long long sum = 0;
+        int value = 0;
+        for (int key : trace) {
+            if (cache.get(key, value)) sum += value;
+            else cache.put(key, key);
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    // 재시작 경로: 스냅샷 mmap + warm tier에서 키 전부 읽기 (파일은 한 번만 씀)
+    string snapshotPath = (filesystem::temp_directory_path() /
+                           ("bench_cache_snapshot_" + to_string(chrono::steady_clock::now().time_since_epoch().count()) +
+                            ".bin")).string();
+    vector<pair<int, CacheEntry>> snapshotEntries;
+    for (size_t i = 0; i < KEYS; ++i) snapshotEntries.emplace_back(static_cast<int>(i), CacheEntry{static_cast<int>(i)});
+    if (CacheSnapshot::write(snapshotPath, snapshotEntries, 1)) {
+        runner.run("CacheSnapshot open + warm get", KEYS, [&]() {
+            FlatCache cache;
+            cache.attachSnapshot(CacheSnapshot::open(snapshotPath));
+            long long sum = 0;
+            int value = 0;
+            for (size_t i = 0; i < KEYS; ++i)
+                if (cache.get(static_cast<int>(i), value)) sum += value;
+            bench::doNotOptimize(sum);
+        });
+        error_code ec;
+        filesystem::remove(snapshotPath, ec);
+    }
+    
+    return runner.finish();
+}
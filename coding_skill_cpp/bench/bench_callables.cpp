@@ -0,0 +1,46 @@
+/* 벤치마크: 04_callback_pattern.cpp (std::function / InplaceFunction / function_ref) */
+#define main callbackPatternDemoMain
+#include "../04_callback_pattern.cpp"
+#undef main
+
+#include "harness.h"
+
+template<typename Fn>
+static void construct(bench::Runner& runner, const string& name) {
+    constexpr size_t OPS = 1 << 18;
+    double scale = 1.5, offset = 2.0, bias = 0.25;
+    double sum = 0;
+    auto lambda = [&sum, scale, offset, bias](int x) { sum += x * scale + offset + bias; };     // 32바이트 캡처
+    runner.run(name + " construct+call", OPS, [&]() {
+        for (size_t i = 0; i < OPS; ++i) {
+            Fn fn(lambda);
+            fn(static_cast<int>(i));
+        }
+        bench::doNotOptimize(sum);
+    });
+}
+
+template<typename Fn>
+static void dispatch(bench::Runner& runner, const string& name) {
+    constexpr size_t OPS = 1 << 20;
+    double scale = 1.5, offset = 2.0, bias = 0.25;
+    double sum = 0;
+    auto lambda = [&sum, scale, offset, bias](int x) { sum += x * scale + offset + bias; };
+    Fn fn(lambda);
+    bench::doNotOptimize(fn);
+    runner.run(name + " call", OPS, [&]() {
+        for (size_t i = 0; i < OPS; ++i) fn(static_cast<int>(i));
+        bench::doNotOptimize(sum);
+    });
+}
+
+int main(int argc, char** argv) {
+    bench::Runner runner("callables", argc, argv);
+    dispatch<Callback>(runner, "std::function");
+    dispatch<InplaceCallback>(runner, "InplaceFunction");
+    dispatch<CallbackRef>(runner, "function_ref");
+    construct<Callback>(runner, "std::function");
+    construct<InplaceCallback>(runner, "InplaceFunction");
+    construct<CallbackRef>(runner, "function_ref");
+    return runner.finish();
+}
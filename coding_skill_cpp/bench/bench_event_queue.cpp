@@ -0,0 +1,42 @@
+/* 벤치마크: 10_event_queue.cpp (EventQueue / InplaceEventQueue / TimerWheel) */
+#define main eventQueueDemoMain
+#include "../10_event_queue.cpp"
+#undef main
+
+#include "harness.h"
+
+int main(int argc, char** argv) {
+    bench::Runner runner("event_queue", argc, argv);
+    constexpr size_t ROUNDS = 4096;
+    constexpr size_t EVENTS = ROUNDS * 64;
+    long long sum = 0;
+    array<long long, 4> capture{};      // 40바이트 캡처 (데모 벤치마크와 같은 크기)
+    
+    EventQueue queue;
+    runner.run("EventQueue push+process", EVENTS, [&]() {
+        for (size_t r = 0; r < ROUNDS; ++r) {
+            for (int i = 0; i < 64; ++i) queue.push([&sum, capture, i]() { sum += capture[0] + i; });
+            queue.process();
+        }
+        bench::doNotOptimize(sum);
+    });
+    
+    InplaceEventQueue<> inplace;
+    runner.run("InplaceEventQueue push+process", EVENTS, [&]() {
+        for (size_t r = 0; r < ROUNDS; ++r) {
+            for (int i = 0; i < 64; ++i) inplace.push([&sum, capture, i]() { sum += capture[0] + i; });
+            inplace.process();
+        }
+        bench::doNotOptimize(sum);
+    });
+    
+    constexpr size_t TIMERS = 50000;
+    vector<TimerId> ids(TIMERS);
+    runner.run("TimerWheel schedule+cancel", TIMERS, [&]() {
+        TimerWheel wheel;
+        for (size_t i = 0; i < TIMERS; ++i) ids[i] = wheel.schedule(1 + i % 5000, 0, Priority::Normal, []() {});
+        for (auto id : ids) wheel.cancel(id);
+    });
+    
+    return runner.finish();
+}
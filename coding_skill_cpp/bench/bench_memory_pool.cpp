@@ -0,0 +1,63 @@
+/* 벤치마크: 11_memory_pool.cpp (MemoryPool / ConcurrentMemoryPool / ScratchArena) */
+#include <array>
+
+#define main memoryPoolDemoMain
+#include "../11_memory_pool.cpp"
+#undef main
+
+#include "harness.h"
+
+int main(int argc, char** argv) {
+    bench::Runner runner("memory_pool", argc, argv);
+    constexpr size_t BATCH = 256;
+    constexpr size_t ROUNDS = 1024;
+    constexpr size_t OPS = BATCH * ROUNDS;      // 할당+해제 쌍
+    array<Message*, BATCH> live{};
+    
+    runner.run("new/delete Message", OPS, [&]() {
+        for (size_t r = 0; r < ROUNDS; ++r) {
+            for (auto& p : live) p = new Message{};
+            bench::clobberMemory();
+            for (auto* p : live) delete p;
+        }
+    });
+    
+    MemoryPool<Message> pool;
+    runner.run("MemoryPool allocate/deallocate", OPS, [&]() {
+        for (size_t r = 0; r < ROUNDS; ++r) {
+            for (auto& p : live) p = pool.allocate();
+            bench::clobberMemory();
+            for (auto* p : live) pool.deallocate(p);
+        }
+    });
+    
+    ConcurrentMemoryPool<Message> shared;
+    runner.run("ConcurrentMemoryPool LocalCache", OPS, [&]() {
+        ConcurrentMemoryPool<Message>::LocalCache cache(shared);
+        for (size_t r = 0; r < ROUNDS; ++r) {
+            for (auto& p : live) p = cache.allocate();
+            bench::clobberMemory();
+            for (auto* p : live) cache.deallocate(p);
+        }
+    });
+    
+    constexpr size_t REQUESTS = 2000;
+    const char* request = "get user profile get user settings put cart item";
+    runner.run("handleRequest (global heap)", REQUESTS, [&]() {
+        size_t distinct = 0;
+        for (size_t i = 0; i < REQUESTS; ++i) distinct += handleRequest(request, pmr::new_delete_resource());
+        bench::doNotOptimize(distinct);
+    });
+    
+    ScratchArena<> arena;
+    runner.run("handleRequest (ScratchArena)", REQUESTS, [&]() {
+        size_t distinct = 0;
+        for (size_t i = 0; i < REQUESTS; ++i) {
+            distinct += handleRequest(request, &arena);
+            arena.release();
+        }
+        bench::doNotOptimize(distinct);
+    });
+    
+    return runner.finish();
+}
@@ -0,0 +1,96 @@
+/* 벤치마크: topology/topology.h - 같은 node(local) vs 다른 node(remote) 메모리 배치, 11_memory_pool.cpp의 NodeLocal 청크 포함 */
+#include <array>
+#include <random>
+
+#define main memoryPoolDemoMain
+#include "../11_memory_pool.cpp"
+#undef main
+
+#include "harness.h"
+
+// 캐시 라인 하나 = 추적 노드 하나 (다음 노드 인덱스만 사용)
+struct alignas(64) ChaseNode {
+    uint64_t next;
+};
+
+// 무작위 순환 하나로 연결 → 하드웨어 prefetch가 못 따라옴 (라인마다 DRAM 왕복)
+// Sattolo 알고리즘: 제자리 셔플로 길이 count인 순환 하나 생성 (보조 배열 없음)
+static void linkRandomCycle(ChaseNode* nodes, size_t count) {
+    for (size_t i = 0; i < count; ++i) nodes[i].next = i;
+    mt19937_64 rng(42);
+    for (size_t i = count - 1; i > 0; --i) {
+        size_t j = uniform_int_distribution<size_t>(0, i - 1)(rng);
+        swap(nodes[i].next, nodes[j].next);
+    }
+}
+
+// 가장 큰 캐시의 2배 (최소 128MB, 최대 1GB) → 대부분의 접근이 DRAM까지 감
+static size_t bufferBytes() {
+    size_t largest = 0;
+    for (const topology::CacheInfo& cache : topology::system().caches()) largest = max(largest, cache.bytes);
+    return min<size_t>(max<size_t>(2 * largest, 128u << 20), 1u << 30);
+}
+
+// 실행 스레드는 runNode에 고정, 메모리만 memoryNode에 배치
+static void placementCases(bench::Runner& runner, unsigned runNode, unsigned memoryNode) {
+    const string where = (runNode == memoryNode ? "local" : "remote") + string(" (mem node ") +
+                         to_string(memoryNode) + ", cpu node " + to_string(runNode) + ")";
+    const size_t BYTES = bufferBytes();
+    const size_t LINES = BYTES / 64;
+
+    topology::NodeMemory buffer(BYTES, memoryNode);
+    cout << "  " << where << ": " << (BYTES >> 20) << " MB, binding " << topology::bindingName(buffer.binding()) << ", pages on node "
+         << topology::addressNode(buffer.data()) << endl;
+
+    const uint64_t* words = static_cast<const uint64_t*>(buffer.data());
+    runner.run("sequential read " + where, LINES, [&]() {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < BYTES / sizeof(uint64_t); i += 8) sum += words[i];     // 라인당 한 번
+        bench::doNotOptimize(sum);
+    });
+
+    ChaseNode* chase = static_cast<ChaseNode*>(buffer.data());
+    linkRandomCycle(chase, LINES);
+    constexpr size_t HOPS = 1 << 20;
+    runner.run("pointer chase " + where, HOPS, [&]() {
+        uint64_t at = 0;
+        for (size_t i = 0; i < HOPS; ++i) at = chase[at].next;
+        bench::doNotOptimize(at);
+    });
+
+    // 풀 청크를 node에 배치 → 블록 순회 (id 쓰기 + payload 읽기)
+    constexpr size_t BLOCKS = 1 << 18;
+    MemoryPool<Message, 2 * 1024 * 1024> pool(ChunkBacking::NodeLocal, memoryNode);
+    vector<Message*> blocks(BLOCKS);
+    for (auto& b : blocks) b = pool.allocate();
+    shuffle(blocks.begin(), blocks.end(), mt19937_64(7));
+    runner.run("MemoryPool<NodeLocal> touch " + where, BLOCKS, [&]() {
+        double sum = 0;
+        for (Message* m : blocks) {
+            m->id++;
+            sum += m->payload[0];
+        }
+        bench::doNotOptimize(sum);
+    });
+    for (auto* b : blocks) pool.deallocate(b);
+}
+
+int main(int argc, char** argv) {
+    bench::Runner runner("numa", argc, argv);
+    const topology::Topology& topo = topology::system();
+    cout << "topology: " << topo.cpus().size() << " cpu(s), " << topo.packageCount() << " package(s), "
+         << topo.nodeCount() << " NUMA node(s)";
+    for (const topology::CacheInfo* cache : topo.cachesOf(topo.cpus().front().cpu))
+        cout << ", L" << cache->level << (cache->type == "Instruction" ? "i " : " ") << cache->bytes / 1024 << "K";
+    cout << endl;
+
+    const unsigned local = topo.nodes().front().id;
+    topology::pinCurrentThreadToNode(local);
+    placementCases(runner, local, local);
+    if (topo.nodeCount() > 1) {
+        placementCases(runner, local, topo.nodes()[1].id);
+    } else {
+        cout << "  remote: skipped (NUMA node 하나뿐 → local과 같은 메모리)" << endl;
+    }
+    return runner.finish();
+}
@@ -0,0 +1,50 @@
+/* 벤치마크: 12_object_pool.cpp (ObjectPool / ConcurrentObjectPool / SlabObjectPool) */
+#define main objectPoolDemoMain
+#include "../12_object_pool.cpp"
+#undef main
+
+#include "harness.h"
+
+int main(int argc, char** argv) {
+    bench::Runner runner("object_pool", argc, argv);
+    constexpr size_t OPS = 1 << 20;
+    
+    runner.run("make_unique<Packet>", OPS, [&]() {
+        for (size_t i = 0; i < OPS; ++i) {
+            auto p = make_unique<Packet>();
+            p->id = static_cast<int>(i);
+            bench::doNotOptimize(p->id);
+        }
+    });
+    
+    ObjectPool<Packet> basic(64);
+    runner.run("ObjectPool acquire/release", OPS, [&]() {
+        for (size_t i = 0; i < OPS; ++i) {
+            Packet* p = basic.acquire();
+            p->id = static_cast<int>(i);
+            bench::doNotOptimize(p->id);
+            basic.release(p);
+        }
+    });
+    
+    ConcurrentObjectPool<Packet> lockFree(64);
+    runner.run("ConcurrentObjectPool Handle", OPS, [&]() {
+        for (size_t i = 0; i < OPS; ++i) {
+            auto handle = lockFree.acquire();
+            handle->id = static_cast<int>(i);
+            bench::doNotOptimize(handle->id);
+        }
+    });
+    
+    SlabObjectPool<Packet> slab(1);
+    runner.run("SlabObjectPool acquire/release", OPS, [&]() {
+        for (size_t i = 0; i < OPS; ++i) {
+            Packet* p = slab.acquire();
+            p->id = static_cast<int>(i);
+            bench::doNotOptimize(p->id);
+            slab.release(p);
+        }
+    });
+    
+    return runner.finish();
+}
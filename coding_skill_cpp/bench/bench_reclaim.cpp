@@ -0,0 +1,135 @@
+/* 벤치마크: reclaim/reclaim.h (EpochDomain / HazardDomain) - 07_observer_pattern.cpp의 CowObserverList 포함 */
+#define main observerPatternDemoMain
+#include "../07_observer_pattern.cpp"
+#undef main
+
+#include "harness.h"
+
+struct ReclaimNode {
+    uint64_t value;
+};
+
+// 읽기 구역마다 노드 하나 (reader 쪽 고정 비용: Guard 진입/퇴장 + protect)
+template<typename Domain>
+static void readSide(bench::Runner& runner, const string& name, atomic<ReclaimNode*>& shared, size_t reads) {
+    Domain domain;
+    runner.run(name, reads, [&]() {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < reads; ++i) {
+            typename Domain::Guard guard(domain);
+            sum += guard.protect(shared)->value;
+        }
+        bench::doNotOptimize(sum);
+    });
+}
+
+// reader 2개 + writer 1개 (writer는 교체할 때마다 retire) → reader 기준 ns/read
+template<typename Domain>
+static void readWithWriter(bench::Runner& runner, const string& name, size_t reads) {
+    Domain domain;
+    atomic<ReclaimNode*> shared{new ReclaimNode{0}};
+    runner.run(name, reads, [&]() {
+        atomic<bool> done{false};
+        thread writer([&]() {
+            for (uint64_t i = 1; !done.load(memory_order_relaxed); ++i) {
+                domain.retire(shared.exchange(new ReclaimNode{i}, memory_order_seq_cst));
+                this_thread::yield();
+            }
+        });
+        thread other([&]() {
+            uint64_t sum = 0;
+            for (size_t i = 0; i < reads / 2; ++i) {
+                typename Domain::Guard guard(domain);
+                sum += guard.protect(shared)->value;
+            }
+            bench::doNotOptimize(sum);
+        });
+        uint64_t sum = 0;
+        for (size_t i = 0; i < reads / 2; ++i) {
+            typename Domain::Guard guard(domain);
+            sum += guard.protect(shared)->value;
+        }
+        bench::doNotOptimize(sum);
+        other.join();
+        done = true;
+        writer.join();
+    });
+    domain.collect();
+    delete shared.load();
+}
+
+// Guard 안에서 멈춘 reader가 있는 동안 writer가 노드를 계속 교체 → 미회수 노드 최대치
+template<typename Domain>
+static size_t pendingUnderStall(size_t replacements) {
+    Domain domain;
+    atomic<ReclaimNode*> shared{new ReclaimNode{0}};
+    atomic<bool> entered{false}, resume{false};
+    thread stalled([&]() {
+        typename Domain::Guard guard(domain);
+        bench::doNotOptimize(guard.protect(shared)->value);
+        entered = true;
+        while (!resume.load()) this_thread::sleep_for(chrono::milliseconds(1));
+    });
+    while (!entered.load()) this_thread::yield();
+    size_t peak = 0;
+    for (uint64_t i = 1; i <= replacements; ++i) {
+        domain.retire(shared.exchange(new ReclaimNode{i}, memory_order_seq_cst));
+        peak = max(peak, domain.pending());
+    }
+    resume = true;
+    stalled.join();
+    domain.collect();
+    delete shared.load();
+    return peak;
+}
+
+int main(int argc, char** argv) {
+    bench::Runner runner("reclaim", argc, argv);
+    constexpr size_t READS = 1 << 20;
+    atomic<ReclaimNode*> shared{new ReclaimNode{42}};
+    
+    runner.run("raw atomic load (unsafe)", READS, [&]() {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < READS; ++i) sum += shared.load(memory_order_acquire)->value;
+        bench::doNotOptimize(sum);
+    });
+    readSide<reclaim::EpochDomain>(runner, "EpochDomain guard+protect", shared, READS);
+    readSide<reclaim::HazardDomain>(runner, "HazardDomain guard+protect", shared, READS);
+    
+    atomic<shared_ptr<ReclaimNode>> sharedOwner{make_shared<ReclaimNode>(ReclaimNode{42})};
+    runner.run("atomic<shared_ptr> load", READS, [&]() {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < READS; ++i) sum += sharedOwner.load()->value;
+        bench::doNotOptimize(sum);
+    });
+    delete shared.load();
+    
+    readWithWriter<reclaim::EpochDomain>(runner, "EpochDomain 2 readers + writer", READS / 4);
+    readWithWriter<reclaim::HazardDomain>(runner, "HazardDomain 2 readers + writer", READS / 4);
+    
+    constexpr size_t EVENTS = 1 << 16;
+    CowObserverList<function<void(int)>, reclaim::EpochDomain> epochList;
+    CowObserverList<function<void(int)>, reclaim::HazardDomain> hazardList;
+    long long acc = 0;
+    auto a = epochList.subscribe([&acc](int v) { acc += v; });
+    auto b = hazardList.subscribe([&acc](int v) { acc += v; });
+    runner.run("CowObserverList notify (epoch)", EVENTS, [&]() {
+        for (size_t i = 0; i < EVENTS; ++i) epochList.notify(static_cast<int>(i));
+    });
+    runner.run("CowObserverList notify (hazard)", EVENTS, [&]() {
+        for (size_t i = 0; i < EVENTS; ++i) hazardList.notify(static_cast<int>(i));
+    });
+    bench::doNotOptimize(acc);
+    
+    int rc = runner.finish();
+    
+    // 메모리 상한: 시간 측정이 아니므로 결과 파일에는 넣지 않음
+    if (!runner.settings().quiet) {
+        constexpr size_t REPLACEMENTS = 100000;
+        cout << "\nstalled reader, " << REPLACEMENTS << " replacements -> peak unreclaimed nodes" << endl;
+        cout << "  EpochDomain : " << pendingUnderStall<reclaim::EpochDomain>(REPLACEMENTS) << endl;
+        cout << "  HazardDomain: " << pendingUnderStall<reclaim::HazardDomain>(REPLACEMENTS)
+             << " (bound: max(RETIRE_BATCH, 2 x slots x threads))" << endl;
+    }
+    return rc;
+}
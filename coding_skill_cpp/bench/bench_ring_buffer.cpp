@@ -0,0 +1,59 @@
+/* 벤치마크: 14_ring_buffer.cpp (RingBuffer / SpscRingBuffer / MpmcQueue) */
+#define main ringBufferDemoMain
+#include "../14_ring_buffer.cpp"
+#undef main
+
+#include "harness.h"
+
+int main(int argc, char** argv) {
+    bench::Runner runner("ring_buffer", argc, argv);
+    constexpr size_t OPS = 1 << 20;
+    
+    RingBuffer<int, 1024> ring;
+    runner.run("RingBuffer push+pop", OPS, [&]() {
+        int v = 0;
+        for (size_t i = 0; i < OPS; ++i) {
+            ring.push(static_cast<int>(i));
+            ring.pop(v);
+            bench::doNotOptimize(v);
+        }
+    });
+    
+    SpscRingBuffer<int, 1024> spsc;
+    runner.run("SpscRingBuffer push+pop (1 thread)", OPS, [&]() {
+        int v = 0;
+        for (size_t i = 0; i < OPS; ++i) {
+            spsc.push(static_cast<int>(i));
+            spsc.pop(v);
+            bench::doNotOptimize(v);
+        }
+    });
+    
+    MpmcQueue<int, 1024> mpmc;
+    runner.run("MpmcQueue push+pop (1 thread)", OPS, [&]() {
+        int v = 0;
+        for (size_t i = 0; i < OPS; ++i) {
+            mpmc.push(static_cast<int>(i));
+            mpmc.pop(v);
+            bench::doNotOptimize(v);
+        }
+    });
+    
+    constexpr size_t TRANSFER = 1 << 18;
+    runner.run("SpscRingBuffer 2-thread transfer", TRANSFER, [&]() {
+        thread consumer([&]() {
+            int v = 0;
+            for (size_t received = 0; received < TRANSFER;) {
+                if (spsc.pop(v)) ++received;
+                else this_thread::yield();
+            }
+            bench::doNotOptimize(v);
+        });
+        for (size_t i = 0; i < TRANSFER; ++i) {
+            while (!spsc.push(static_cast<int>(i))) this_thread::yield();
+        }
+        consumer.join();
+    });
+    
+    return runner.finish();
+}
@@ -0,0 +1,33 @@
+/* 벤치마크: 31_tracing_pattern.cpp (TRACE / TRACE_EVERY 호출당 비용) */
+#define main tracingDemoMain
+#include "../31_tracing_pattern.cpp"
+#undef main
+
+#include "harness.h"
+
+int main(int argc, char** argv) {
+    bench::Runner runner("tracing", argc, argv);
+    constexpr size_t CALLS = 1 << 16;      // ring(8192)을 넘겨 flusher가 비우는 경로까지 포함
+    string path = "/tmp/bench_trace_" + to_string(chrono::steady_clock::now().time_since_epoch().count()) + ".bin";
+    Tracer::instance().start(path, chrono::milliseconds(1));
+    
+    runner.run("no tracing", CALLS, [&]() {
+        for (size_t i = 0; i < CALLS; ++i) {
+            plainLeaf();
+            bench::clobberMemory();     // 빈 루프가 통째로 제거되지 않게 (기준선)
+        }
+    });
+    runner.run("TRACE()", CALLS, [&]() {
+        for (size_t i = 0; i < CALLS; ++i) tracedLeaf();
+    });
+    runner.run("TRACE_EVERY(64)", CALLS, [&]() {
+        for (size_t i = 0; i < CALLS; ++i) sampledLeaf();
+    });
+    
+    Tracer::instance().stop();
+    remove(path.c_str());
+    if (!runner.settings().quiet)
+        cout << "  (records written " << Tracer::instance().recordsWritten() << ", dropped " << Tracer::instance().dropped()
+             << ")" << endl;
+    return runner.finish();
+}
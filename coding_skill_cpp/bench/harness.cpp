@@ -0,0 +1,158 @@
+/* 벤치마크 harness - 통계 요약, 옵션 파싱, JSON/CSV 출력 */
+#include "harness.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+
+namespace bench {
+
+namespace {
+
+// 정렬된 샘플의 q 분위 (선형 보간)
+double quantile(const std::vector<double>& sorted, double q) {
+    double position = q * static_cast<double>(sorted.size() - 1);
+    size_t lower = static_cast<size_t>(position);
+    size_t upper = std::min(lower + 1, sorted.size() - 1);
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * (position - static_cast<double>(lower));
+}
+
+bool startsWith(const char* arg, const char* prefix, const char*& value) {
+    size_t n = std::strlen(prefix);
+    if (std::strncmp(arg, prefix, n) != 0) return false;
+    value = arg + n;
+    return true;
+}
+
+std::string jsonEscape(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+}  // namespace
+
+Summary summarize(std::vector<double> samples) {
+    Summary s;
+    if (samples.empty()) return s;
+    std::sort(samples.begin(), samples.end());
+    s.min = samples.front();
+    s.max = samples.back();
+    s.median = quantile(samples, 0.5);
+    s.p90 = quantile(samples, 0.9);
+    s.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+    double sq = 0;
+    for (double v : samples) sq += (v - s.mean) * (v - s.mean);
+    s.stddev = samples.size() > 1 ? std::sqrt(sq / static_cast<double>(samples.size() - 1)) : 0.0;
+    return s;
+}
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const char* value = nullptr;
+        if (startsWith(argv[i], "--reps=", value)) options.repetitions = std::max(1, std::atoi(value));
+        else if (startsWith(argv[i], "--warmup=", value)) options.warmup = std::max(0, std::atoi(value));
+        else if (startsWith(argv[i], "--filter=", value)) options.filter = value;
+        else if (startsWith(argv[i], "--json=", value)) options.jsonPath = value;
+        else if (startsWith(argv[i], "--csv=", value)) options.csvPath = value;
+        else if (std::strcmp(argv[i], "--quiet") == 0) options.quiet = true;
+        else if (std::strcmp(argv[i], "--no-counters") == 0) options.counters = false;
+        else std::cerr << "unknown option ignored: " << argv[i] << std::endl;
+    }
+    return options;
+}
+
+Runner::Runner(std::string suite, int argc, char** argv) : suite(std::move(suite)), options(parseOptions(argc, argv)) {
+    if (!options.quiet) {
+        std::cout << "[" << this->suite << "] warmup " << options.warmup << ", reps " << options.repetitions;
+        if (!options.counters) std::cout << ", counters off";
+        else if (perf::threadCounters().hardware()) std::cout << ", hardware counters on";
+        else std::cout << ", time only (" << perf::threadCounters().unavailableReason() << ")";
+        std::cout << std::endl;
+        std::cout << std::left << std::setw(40) << "  benchmark" << std::right << std::setw(12) << "median ns" << std::setw(12)
+                  << "min ns" << std::setw(12) << "p90 ns" << std::setw(9) << "cv %" << std::setw(12) << "Mitems/s"
+                  << std::endl;
+    }
+}
+
+void Runner::record(const std::string& name, size_t items, std::vector<double> samples, const perf::Delta& counters) {
+    Result result{name, items, std::move(samples), {}, counters};
+    result.summary = summarize(result.nsPerItem);
+    if (!options.quiet) {
+        const Summary& s = result.summary;
+        double cv = s.mean > 0 ? 100.0 * s.stddev / s.mean : 0.0;
+        std::cout << std::left << std::setw(40) << ("  " + name) << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << s.median << std::setw(12) << s.min << std::setw(12) << s.p90 << std::setprecision(1)
+                  << std::setw(9) << cv << std::setprecision(1) << std::setw(12) << (s.median > 0 ? 1e3 / s.median : 0.0)
+                  << std::defaultfloat << std::endl;
+        if (counters.has(perf::CYCLES))
+            std::cout << "      " << perf::describe(counters, static_cast<double>(items * counters.regions)) << std::endl;
+    }
+    results.push_back(std::move(result));
+}
+
+int Runner::finish() {
+    int status = 0;
+    if (!options.jsonPath.empty()) {
+        std::ofstream out(options.jsonPath);
+        out << "{\"suite\":\"" << jsonEscape(suite) << "\",\"results\":[";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            const Summary& s = r.summary;
+            out << (i ? "," : "") << "\n  {\"name\":\"" << jsonEscape(r.name) << "\",\"items\":" << r.items
+                << ",\"reps\":" << r.nsPerItem.size() << ",\"ns_per_item\":{\"min\":" << s.min << ",\"median\":" << s.median
+                << ",\"mean\":" << s.mean << ",\"p90\":" << s.p90 << ",\"max\":" << s.max << ",\"stddev\":" << s.stddev
+                << "},\"counters\":";
+            if (r.counters.mask == 0) {
+                out << "null}";
+                continue;
+            }
+            double measured = static_cast<double>(r.items * r.counters.regions);
+            out << "{\"ipc\":" << r.counters.ipc();
+            for (uint32_t e = 0; e < perf::EVENT_COUNT; ++e)
+                if (r.counters.has(static_cast<perf::Event>(e)))
+                    out << ",\"" << perf::EVENT_NAMES[e] << "_per_item\":" << r.counters.per(static_cast<perf::Event>(e), measured);
+            out << "}}";
+        }
+        out << "\n]}\n";
+        if (!out) {
+            std::cerr << "cannot write " << options.jsonPath << std::endl;
+            status = 1;
+        }
+    }
+    if (!options.csvPath.empty()) {
+        std::ofstream out(options.csvPath);
+        out << "suite,name,items,reps,min_ns,median_ns,mean_ns,p90_ns,max_ns,stddev_ns,ipc";
+        for (const char* event : perf::EVENT_NAMES) out << ',' << event << "_per_item";
+        out << '\n';
+        for (const Result& r : results) {
+            const Summary& s = r.summary;
+            out << suite << ",\"" << r.name << "\"," << r.items << ',' << r.nsPerItem.size() << ',' << s.min << ','
+                << s.median << ',' << s.mean << ',' << s.p90 << ',' << s.max << ',' << s.stddev << ',';
+            double measured = static_cast<double>(r.items * r.counters.regions);
+            if (r.counters.has(perf::CYCLES)) out << r.counters.ipc();
+            for (uint32_t e = 0; e < perf::EVENT_COUNT; ++e) {
+                out << ',';
+                if (r.counters.has(static_cast<perf::Event>(e))) out << r.counters.per(static_cast<perf::Event>(e), measured);
+            }
+            out << '\n';
+        }
+        if (!out) {
+            std::cerr << "cannot write " << options.csvPath << std::endl;
+            status = 1;
+        }
+    }
+    return status;
+}
+
+}  // namespace bench
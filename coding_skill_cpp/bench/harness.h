@@ -0,0 +1,127 @@
+/*
+ * 벤치마크 공용 harness
+ *  - Runner::run(name, items, body): warmup 후 반복 측정, 반복마다 ns/item 샘플 하나
+ *  - 요약: min / median / mean / p90 / max / 표준편차
+ *  - 출력: 터미널 표 + --json=FILE / --csv=FILE (회귀 추적용)
+ *  - 하드웨어 카운터(perf_counters.h): 측정 반복 전체의 IPC, item당 cycles / cache-miss / branch-miss
+ *  - 옵션: --reps=N --warmup=N --filter=부분문자열 --no-counters --quiet
+ *
+ * 각 bench_*.cpp는 패턴 데모 파일을 main 이름만 바꿔 그대로 include
+ * → 데모와 같은 코드를 -O2로 측정 (복사본이 어긋날 일이 없음)
+ */
+#ifndef CODING_SKILL_BENCH_HARNESS_H
+#define CODING_SKILL_BENCH_HARNESS_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "perf_counters.h"
+
+namespace bench {
+
+// 값을 "사용된 것"으로 만들어 계산이 제거되지 않게 함
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+template<typename T>
+inline void doNotOptimize(T& value) {
+#if defined(__GNUC__)
+    asm volatile("" : "+r,m"(value) : : "memory");
+#else
+    static volatile void* sink;
+    sink = &value;
+#endif
+}
+
+// 메모리 쓰기를 컴파일러가 재배치/제거하지 못하게
+inline void clobberMemory() {
+#if defined(__GNUC__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+struct Summary {
+    double min = 0;
+    double median = 0;
+    double mean = 0;
+    double p90 = 0;
+    double max = 0;
+    double stddev = 0;
+};
+
+Summary summarize(std::vector<double> samples);
+
+struct Result {
+    std::string name;
+    size_t items = 0;                   // body 한 번에 처리한 연산 수
+    std::vector<double> nsPerItem;      // 반복마다 하나
+    Summary summary;
+    perf::Delta counters;               // 측정 반복 전체 합계 (mask == 0이면 시간만)
+};
+
+struct Options {
+    int warmup = 2;
+    int repetitions = 10;
+    std::string filter;
+    std::string jsonPath;
+    std::string csvPath;
+    bool quiet = false;
+    bool counters = true;
+};
+
+Options parseOptions(int argc, char** argv);
+
+class Runner {
+    std::string suite;
+    Options options;
+    std::vector<Result> results;
+    
+    void record(const std::string& name, size_t items, std::vector<double> samples, const perf::Delta& counters);
+    
+public:
+    Runner(std::string suite, int argc, char** argv);
+    
+    const Options& settings() const { return options; }
+    
+    template<typename Body>
+    void run(const std::string& name, size_t items, Body&& body) {
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos) return;
+        for (int i = 0; i < options.warmup; ++i) body();
+        std::vector<double> samples;
+        samples.reserve(options.repetitions);
+        perf::Delta total;
+        for (int i = 0; i < options.repetitions; ++i) {
+            if (options.counters) {
+                perf::CounterSet& counters = perf::threadCounters();
+                perf::Reading start = counters.read();
+                body();
+                perf::Delta d = counters.since(start);
+                samples.push_back(static_cast<double>(d.wallNs) / static_cast<double>(items));
+                total += d;
+            } else {
+                auto start = std::chrono::steady_clock::now();
+                body();
+                auto elapsed = std::chrono::steady_clock::now() - start;
+                samples.push_back(std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(items));
+            }
+        }
+        record(name, items, std::move(samples), total);
+    }
+    
+    // 결과 파일 기록, main의 반환값 (파일을 못 쓰면 1)
+    int finish();
+};
+
+}  // namespace bench
+
+#endif
@@ -0,0 +1,192 @@
+/*
+ * 하드웨어 성능 카운터 계측 (header-only)
+ *  - Linux: perf_event_open으로 cycles / instructions / cache-misses / branch-misses를 한 그룹으로 열고
+ *    read() 한 번에 모두 읽음 (user 공간만 계수, 멀티플렉싱되면 time_enabled/time_running으로 환산)
+ *  - 카운터를 못 열면(권한, VM, 비 Linux) 시간만 측정하는 fallback, 이유는 unavailableReason()
+ *  - 스레드마다 CounterSet 하나 (perf 이벤트는 열린 스레드만 계수)
+ *  - 구간 측정: ScopedCounters(주어진 Delta에 누적) / Reading 두 개의 차
+ *
+ * 빌드 플래그: -DPERF_COUNTERS=0 이면 항상 시간만 측정
+ */
+#ifndef CODING_SKILL_PERF_COUNTERS_H
+#define CODING_SKILL_PERF_COUNTERS_H
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#ifndef PERF_COUNTERS
+#define PERF_COUNTERS 1
+#endif
+
+#if PERF_COUNTERS && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define HAVE_PERF_EVENTS 1
+#endif
+
+namespace perf {
+
+enum Event : uint32_t { CYCLES, INSTRUCTIONS, CACHE_MISSES, BRANCH_MISSES, EVENT_COUNT };
+
+inline constexpr std::array<const char*, EVENT_COUNT> EVENT_NAMES = {"cycles", "instructions", "cache_misses",
+                                                                     "branch_misses"};
+
+inline uint64_t wallNowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+struct Reading {
+    uint64_t wallNs = 0;
+    std::array<uint64_t, EVENT_COUNT> counts{};
+};
+
+// 두 Reading의 차 (또는 그 합계)
+struct Delta {
+    uint64_t wallNs = 0;
+    std::array<uint64_t, EVENT_COUNT> counts{};
+    uint32_t mask = 0;          // 측정된 이벤트 비트
+    uint64_t regions = 0;       // 합산된 구간 수
+    
+    bool has(Event e) const { return mask & (1u << e); }
+    double ipc() const {
+        return has(CYCLES) && has(INSTRUCTIONS) && counts[CYCLES] ? double(counts[INSTRUCTIONS]) / counts[CYCLES] : 0.0;
+    }
+    double per(Event e, double items) const { return has(e) && items > 0 ? counts[e] / items : 0.0; }
+    
+    Delta& operator+=(const Delta& other) {
+        wallNs += other.wallNs;
+        for (uint32_t e = 0; e < EVENT_COUNT; ++e) counts[e] += other.counts[e];
+        mask = regions ? (mask & other.mask) : other.mask;
+        regions += other.regions;
+        return *this;
+    }
+};
+
+class CounterSet {
+#if defined(HAVE_PERF_EVENTS)
+    int leader = -1;
+    std::array<int, EVENT_COUNT> fds{-1, -1, -1, -1};
+    std::array<uint32_t, EVENT_COUNT> slot{};       // 그룹 read 결과에서의 위치
+    uint32_t opened = 0;
+    
+    static int open(uint64_t config, int groupFd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = groupFd == -1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+    }
+#endif
+    uint32_t available = 0;
+    std::string reason;
+    
+public:
+    CounterSet() {
+#if defined(HAVE_PERF_EVENTS)
+        constexpr std::array<uint64_t, EVENT_COUNT> CONFIGS = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                               PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+        for (uint32_t e = 0; e < EVENT_COUNT; ++e) {
+            int fd = open(CONFIGS[e], leader);
+            if (fd < 0) {
+                if (reason.empty()) reason = std::string("perf_event_open(") + EVENT_NAMES[e] + "): " + std::strerror(errno);
+                if (leader < 0) return;     // 리더(cycles)가 없으면 그룹 전체 불가
+                continue;
+            }
+            if (leader < 0) leader = fd;
+            fds[e] = fd;
+            slot[e] = opened++;
+            available |= 1u << e;
+        }
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#else
+        reason = "hardware counters not supported in this build";
+#endif
+    }
+    ~CounterSet() {
+#if defined(HAVE_PERF_EVENTS)
+        for (int fd : fds)
+            if (fd >= 0) close(fd);
+#endif
+    }
+    CounterSet(const CounterSet&) = delete;
+    CounterSet& operator=(const CounterSet&) = delete;
+    
+    bool hardware() const { return available != 0; }
+    uint32_t mask() const { return available; }
+    const std::string& unavailableReason() const { return reason; }
+    
+    Reading read() const {
+        Reading r;
+#if defined(HAVE_PERF_EVENTS)
+        if (available) {
+            // {nr, time_enabled, time_running, value[nr]}
+            std::array<uint64_t, 3 + EVENT_COUNT> buffer{};
+            if (::read(leader, buffer.data(), sizeof(buffer)) > 0) {
+                double scale = buffer[2] ? double(buffer[1]) / buffer[2] : 1.0;
+                for (uint32_t e = 0; e < EVENT_COUNT; ++e)
+                    if (available & (1u << e)) r.counts[e] = static_cast<uint64_t>(buffer[3 + slot[e]] * scale);
+            }
+        }
+#endif
+        r.wallNs = wallNowNs();
+        return r;
+    }
+    
+    Delta since(const Reading& start) const {
+        Reading now = read();
+        Delta d;
+        d.wallNs = now.wallNs - start.wallNs;
+        for (uint32_t e = 0; e < EVENT_COUNT; ++e) d.counts[e] = now.counts[e] - start.counts[e];
+        d.mask = available;
+        d.regions = 1;
+        return d;
+    }
+};
+
+inline CounterSet& threadCounters() {
+    thread_local CounterSet counters;
+    return counters;
+}
+
+// 범위를 벗어날 때 target에 누적
+class ScopedCounters {
+    CounterSet& counters;
+    Reading start;
+    Delta& target;
+public:
+    explicit ScopedCounters(Delta& target) : counters(threadCounters()), start(counters.read()), target(target) {}
+    ~ScopedCounters() { target += counters.since(start); }
+    ScopedCounters(const ScopedCounters&) = delete;
+    ScopedCounters& operator=(const ScopedCounters&) = delete;
+};
+
+// 한 줄 요약: "IPC 1.84, 12.3 cycles, 0.02 cache-miss, 0.001 branch-miss per item"
+inline std::string describe(const Delta& d, double items, const char* unit = "item") {
+    char text[192];
+    if (!d.has(CYCLES)) {
+        std::snprintf(text, sizeof(text), "%.2f ns per %s (time only)", items > 0 ? d.wallNs / items : 0.0, unit);
+    } else {
+        std::snprintf(text, sizeof(text), "IPC %.2f, %.1f cycles, %.3f cache-miss, %.4f branch-miss per %s", d.ipc(),
+                      d.per(CYCLES, items), d.per(CACHE_MISSES, items), d.per(BRANCH_MISSES, items), unit);
+    }
+    return text;
+}
+
+}  // namespace perf
+
+#endif
@@ -16,7 +16,7 @@ REM 각 .cpp 파일 컴파일
 for %%f in (*.cpp) do (
     set /A TOTAL+=1
     echo [!TOTAL!] 컴파일 중: %%f
-    g++ -std=c++17 -o "%%~nf.exe" "%%f" -Wall -Wextra 2>error.log
+    g++ -std=c++20 -o "%%~nf.exe" "%%f" -Wall -Wextra 2>error.log
     if !ERRORLEVEL! EQU 0 (
         echo    ✓ 성공: %%~nf.exe
         set /A SUCCESS+=1
@@ -0,0 +1,766 @@
+/*
+ * Dataflow pipeline - 단계(stage)를 선언하고 bounded 큐로 연결하는 header-only 프레임워크
+ *
+ *   dataflow::Pipeline pipe;
+ *   auto& src  = pipe.source<Raw>("sensor", produce);                       // size_t(span<Raw>)
+ *   auto& conv = pipe.stage<Raw, Reading>("adapter", convert, {.replicas = 2});
+ *   auto& sink = pipe.sink<Reading>("cache", store, {.placement = dataflow::onExecutor()});
+ *   pipe.connect(src, conv);  pipe.connect(conv, sink, 256);
+ *   pipe.useExecutor(executor);   // onExecutor() 단계가 있을 때만 필요
+ *   pipe.run();                   // 소스가 끝나고 모든 큐가 빌 때까지 대기
+ *   pipe.report(cout);
+ *
+ *  - 단계 함수는 배치 단위: 한 번 호출에 입력 최대 batch개 (std::function 호출 비용을 배치 전체에 분산)
+ *      source: size_t(span<Out> out)                        → 채운 개수, 0이면 끝
+ *      stage : size_t(span<const In> in, span<Out> out)     → out에 쓴 개수 (≤ in.size(), 필터링 가능)
+ *      sink  : void(span<const In> in)
+ *  - 연결 큐는 run() 때 양쪽 복제본 수를 보고 고름
+ *      생산자 1 / 소비자 1 → SPSC (14_ring_buffer.cpp의 SpscRingBuffer와 같은 프로토콜)
+ *      그 외             → MPMC (14_ring_buffer.cpp의 MpmcQueue와 같은 Vyukov 설계)
+ *    둘 다 용량만 런타임 (2의 거듭제곱으로 올림)
+ *    슬롯 저장소는 소비 단계가 고정된 node의 페이지에 둠 (topology::NodeMemory, 소비자의 읽기가 로컬)
+ *    소비 단계가 고정되지 않았으면 run()을 부른 스레드의 node
+ *  - 한 단계의 출력을 여러 단계에 연결하면 fan-out (항목을 출력마다 복사),
+ *    여러 단계를 한 단계에 연결하면 fan-in (입력 큐 하나를 공유 → MPMC)
+ *  - backpressure: 출력 큐가 가득 차면 남은 항목을 들고 있다가 공간이 생길 때 마저 보냄
+ *    그동안 입력을 더 읽지 않으므로 막힘이 상류로 전파되고 메모리는 큐 용량으로 묶임
+ *  - 배치: 배치 하나를 모두 보낼 때까지 다음 배치를 만들지 않음 (단계별 버퍼는 run() 때 한 번 할당)
+ *  - 실행 위치 (단계마다, 복제본마다 하나씩)
+ *      ownThread()   : 전용 스레드가 계속 폴링, 일이 없으면 yield
+ *      pinnedTo(c)   : 전용 스레드 + CPU 고정 (복제본 r은 CPU c + r)
+ *      onNode(n)     : 전용 스레드 + NUMA node n의 CPU 집합에 고정 (node 안에서는 스케줄러가 배치)
+ *      onExecutor()  : push(function<void()>)가 있는 실행기 (10_event_queue.cpp의 WorkStealingExecutor 등)
+ *                      복제본마다 scheduled 플래그 → 한 복제본이 동시에 두 번 돌지 않음 (SPSC 쪽 불변식 유지)
+ *                      입력이 오거나 출력 공간이 생기면 이웃 단계가 다시 예약, 할 일 없는 단계는 실행기를 점유하지 않음
+ *  - 복제본(replicas) > 1이면 단계 함수가 동시에 불림 (함수는 스레드 안전해야 함), 항목 순서는 보장하지 않음
+ *  - 지표 (단계별, 배치마다 relaxed 누적): 호출 수, 입출력 항목, 처리 시간, 큐 대기 시간, 입력 큐 최대 깊이, 출력 막힘
+ *    큐 대기 시간은 항목이 상류에서 push된 시각(배치마다 한 번 읽은 시각)부터 pop까지
+ *  - Pipeline은 한 번만 run()
+ */
+#ifndef CODING_SKILL_DATAFLOW_PIPELINE_H
+#define CODING_SKILL_DATAFLOW_PIPELINE_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../topology/topology.h"
+
+namespace dataflow {
+
+inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+// 소스의 입력 / 싱크의 출력 자리에 쓰는 빈 타입
+struct None {};
+
+struct Placement {
+    enum class Kind { Thread, Executor };
+    Kind kind = Kind::Thread;
+    int core = -1;          // Thread 전용, -1이면 CPU 고정 안 함
+    int node = -1;          // Thread 전용, -1이면 node 고정 안 함 (core가 있으면 core 우선)
+};
+
+inline Placement ownThread() { return {}; }
+inline Placement pinnedTo(int core) { return {Placement::Kind::Thread, core, -1}; }
+inline Placement onNode(int node) { return {Placement::Kind::Thread, -1, node}; }
+inline Placement onExecutor() { return {Placement::Kind::Executor, -1, -1}; }
+
+struct StageOptions {
+    size_t batch = 64;          // 호출 한 번에 넘기는 최대 항목 수
+    size_t replicas = 1;        // 같은 단계를 병렬로 돌릴 개수
+    Placement placement = ownThread();
+};
+
+struct StageStats {
+    std::string name;
+    size_t replicas;
+    Placement placement;
+    uint64_t invocations;
+    uint64_t itemsIn;
+    uint64_t itemsOut;
+    uint64_t busyNs;            // 단계 함수 안에서 보낸 시간 (복제본 합)
+    uint64_t waitNs;            // 입력 항목이 큐에서 기다린 시간 합
+    uint64_t stalls;            // 출력 큐가 가득 차서 돌아간 횟수
+    size_t maxDepth;            // 입력 큐 최대 깊이 (소스는 0)
+    size_t capacity;            // 입력 큐 용량 (소스는 0)
+};
+
+namespace detail {
+
+// 프로세스 시작 기준 ns (큐 대기 합계가 넘치지 않도록 작은 값 유지)
+inline uint64_t nowNs() {
+    static const auto base = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - base).count());
+}
+
+// 16_double_buffer.cpp의 pinToCore처럼 CPU 수로 나머지를 취함 (CPU가 하나뿐이면 고정하지 않음)
+inline void pinCurrentThread(const Placement& placement, size_t replica) {
+    const std::vector<topology::CpuInfo>& cpus = topology::system().cpus();
+    if (placement.core >= 0) {
+        if (cpus.size() > 1) topology::pinCurrentThread(cpus[(placement.core + replica) % cpus.size()].cpu);
+    } else if (placement.node >= 0) {
+        topology::pinCurrentThreadToNode(static_cast<unsigned>(placement.node));
+    }
+}
+
+// 슬롯 저장소가 놓일 node: 소비 단계의 고정 위치, 없으면 현재 스레드의 node
+inline unsigned homeNode(const Placement& consumer) {
+    const topology::Topology& topo = topology::system();
+    if (consumer.kind == Placement::Kind::Thread) {
+        if (consumer.core >= 0) return topo.nodeOf(topo.cpus()[consumer.core % topo.cpus().size()].cpu);
+        if (consumer.node >= 0) return static_cast<unsigned>(consumer.node);
+    }
+    return topology::currentNode();
+}
+
+// node 페이지 위의 고정 길이 배열 (placement new / 명시적 소멸)
+template<typename T>
+class NodeArray {
+    topology::NodeMemory memory;
+    T* items;
+    size_t count;
+
+public:
+    NodeArray(size_t count, unsigned node)
+        : memory(count * sizeof(T), node), items(static_cast<T*>(memory.data())), count(count) {
+        static_assert(alignof(T) <= 4096, "element alignment exceeds page alignment");
+        for (size_t i = 0; i < count; ++i) new (&items[i]) T();
+    }
+    ~NodeArray() {
+        for (size_t i = 0; i < count; ++i) items[i].~T();
+    }
+    NodeArray(const NodeArray&) = delete;
+    NodeArray& operator=(const NodeArray&) = delete;
+
+    T& operator[](size_t i) { return items[i]; }
+    const T& operator[](size_t i) const { return items[i]; }
+};
+
+inline void updateMax(std::atomic<size_t>& target, size_t value) {
+    size_t current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+// 14_ring_buffer.cpp의 SpscRingBuffer와 같은 구조 (용량 / 저장소 node만 런타임)
+template<typename T>
+class SpscQueue {
+    NodeArray<T> buffer;
+    size_t mask;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head{0};
+    size_t cachedTail = 0;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail{0};
+    size_t cachedHead = 0;
+
+public:
+    SpscQueue(size_t capacity, unsigned node) : buffer(capacity, node), mask(capacity - 1) {}
+
+    bool push(const T& item) {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cachedHead > mask) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t - cachedHead > mask) return false;
+        }
+        buffer[t & mask] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& item) {
+        const size_t h = head.load(std::memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h == cachedTail) return false;
+        }
+        item = buffer[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+};
+
+// 14_ring_buffer.cpp의 MpmcQueue와 같은 구조 (용량 / 저장소 node만 런타임)
+template<typename T>
+class MpmcQueue {
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    NodeArray<Slot> slots;
+    size_t mask;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos{0};
+
+public:
+    MpmcQueue(size_t capacity, unsigned node) : slots(capacity, node), mask(capacity - 1) {
+        for (size_t i = 0; i < capacity; ++i) slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    bool push(const T& item) {
+        Slot* slot;
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            slot = &slots[pos & mask];
+            const size_t seq = slot->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        slot->data = item;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& item) {
+        Slot* slot;
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            slot = &slots[pos & mask];
+            const size_t seq = slot->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        item = slot->data;
+        slot->sequence.store(pos + mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 근사값 (동시 push/pop 중이면 잠깐 용량을 넘거나 음수가 될 수 있어 잘라냄)
+    size_t size() const {
+        const size_t out = dequeuePos.load(std::memory_order_acquire);
+        const size_t in = enqueuePos.load(std::memory_order_acquire);
+        return in > out ? std::min(in - out, mask + 1) : 0;
+    }
+};
+
+} // namespace detail
+
+class NodeBase;
+
+// 단계 사이 연결: 소비 단계 하나 (복제본 여러 개 가능) + 생산 단계 여러 개
+class ChannelBase {
+    friend class NodeBase;
+    friend class Pipeline;
+protected:
+    size_t capacity = 0;
+    NodeBase* consumer = nullptr;
+    std::vector<NodeBase*> producers;
+    std::atomic<size_t> openProducers{0};   // 아직 끝나지 않은 생산 복제본 수
+    std::atomic<size_t> maxDepth{0};
+
+    virtual void open(bool multiProducer, bool multiConsumer, unsigned node) = 0;
+
+public:
+    virtual ~ChannelBase() = default;
+    virtual size_t size() const = 0;
+    bool closed() const { return openProducers.load(std::memory_order_acquire) == 0; }
+};
+
+template<typename T>
+class Channel : public ChannelBase {
+    // 항목 + 상류에서 push한 시각 (큐 대기 시간 측정용)
+    struct Envelope {
+        T value;
+        uint64_t stampNs;
+    };
+
+    std::unique_ptr<detail::SpscQueue<Envelope>> spsc;
+    std::unique_ptr<detail::MpmcQueue<Envelope>> mpmc;
+
+    void open(bool multiProducer, bool multiConsumer, unsigned node) override {
+        capacity = std::bit_ceil(std::max<size_t>(capacity, 2));
+        if (multiProducer || multiConsumer) mpmc = std::make_unique<detail::MpmcQueue<Envelope>>(capacity, node);
+        else spsc = std::make_unique<detail::SpscQueue<Envelope>>(capacity, node);
+    }
+
+public:
+    bool tryPush(const T& value, uint64_t stampNs) {
+        const Envelope e{value, stampNs};
+        return spsc ? spsc->push(e) : mpmc->push(e);
+    }
+
+    bool tryPop(T& value, uint64_t& stampNs) {
+        Envelope e;
+        if (!(spsc ? spsc->pop(e) : mpmc->pop(e))) return false;
+        value = std::move(e.value);
+        stampNs = e.stampNs;
+        return true;
+    }
+
+    size_t size() const override {
+        if (spsc) return spsc->size();
+        return mpmc ? mpmc->size() : 0;
+    }
+
+    bool isSpsc() const { return spsc != nullptr; }
+};
+
+/*
+ * NodeBase - 타입과 무관한 스케줄링 / 지표
+ *  - step(r): 복제본 r을 한 번 진행 (밀린 출력 보내기 → 입력 배치 하나 처리)
+ *  - 실행기 단계의 예약 규칙 (lost wakeup 방지)
+ *      깨우는 쪽: 큐 변경 → seq_cst fence → scheduled 확인 후 exchange
+ *      잠드는 쪽: scheduled = false → seq_cst fence → 큐 다시 확인, 일이 있으면 스스로 재예약
+ *    둘 중 하나는 반드시 상대의 store를 봄
+ */
+class NodeBase {
+    friend class Pipeline;
+public:
+    NodeBase(std::string name, StageOptions options) : stageName(std::move(name)), opts(options) {
+        if (opts.batch == 0) throw std::invalid_argument("stage batch must be positive: " + stageName);
+        if (opts.replicas == 0) throw std::invalid_argument("stage needs at least one replica: " + stageName);
+    }
+    virtual ~NodeBase() = default;
+    NodeBase(const NodeBase&) = delete;
+    NodeBase& operator=(const NodeBase&) = delete;
+
+    const std::string& name() const { return stageName; }
+    const StageOptions& options() const { return opts; }
+
+    StageStats stats() const {
+        return {stageName, opts.replicas, opts.placement,
+                metrics.invocations.load(std::memory_order_relaxed), metrics.itemsIn.load(std::memory_order_relaxed),
+                metrics.itemsOut.load(std::memory_order_relaxed), metrics.busyNs.load(std::memory_order_relaxed),
+                metrics.waitNs.load(std::memory_order_relaxed), metrics.stalls.load(std::memory_order_relaxed),
+                in ? in->maxDepth.load(std::memory_order_relaxed) : 0, in ? in->capacity : 0};
+    }
+
+protected:
+    enum class Step { Progress, Idle, Blocked, Finished };
+
+    struct alignas(CACHE_LINE_SIZE) Metrics {
+        std::atomic<uint64_t> invocations{0};
+        std::atomic<uint64_t> itemsIn{0};
+        std::atomic<uint64_t> itemsOut{0};
+        std::atomic<uint64_t> busyNs{0};
+        std::atomic<uint64_t> waitNs{0};
+        std::atomic<uint64_t> stalls{0};
+    };
+
+    std::string stageName;
+    StageOptions opts;
+    ChannelBase* in = nullptr;
+    std::vector<ChannelBase*> outs;
+    Metrics metrics;
+
+    virtual Step step(size_t replica) = 0;
+    virtual uint64_t pendingOutputs(size_t replica) const = 0;     // 아직 다 못 보낸 출력 큐 비트마스크
+    virtual void prepare() = 0;
+    virtual bool isSource() const = 0;
+    virtual bool isSink() const = 0;
+
+    // 이웃 단계에게 알릴 일
+    //  One: 내 입력에 항목이 생김 → 쉬는 복제본 하나면 충분
+    //  All: 내 출력 큐에 공간이 생김 / 입력이 닫힘 → 쉬는 복제본 전부
+    //       (어느 복제본이 Blocked인지 모르고, 닫힘은 복제본마다 직접 보고 끝나야 run()이 끝남)
+    enum class Wake { One, All };
+
+    void notify(Wake wake) {
+        if (opts.placement.kind != Placement::Kind::Executor) return;    // 전용 스레드는 계속 폴링
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (size_t r = 0; r < opts.replicas; ++r)
+            if (trySchedule(r) && wake == Wake::One) return;
+    }
+
+    void notifyProducers() {
+        for (NodeBase* producer : in->producers) producer->notify(Wake::All);
+    }
+
+    static void notifyConsumer(ChannelBase* channel) { channel->consumer->notify(Wake::One); }
+    static void recordDepth(ChannelBase* channel, size_t depth) { detail::updateMax(channel->maxDepth, depth); }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) ReplicaSlot {
+        std::atomic<bool> scheduled{false};
+    };
+
+    static constexpr int TASK_BUDGET = 16;      // 실행기 작업 한 번에 step 최대 횟수 (다른 단계에 양보)
+
+    std::unique_ptr<ReplicaSlot[]> slots;
+    std::function<void(std::function<void()>)>* submit = nullptr;
+    std::function<void()>* replicaDone = nullptr;
+    std::atomic<size_t>* tasksInFlight = nullptr;   // 실행기에 넘겼지만 아직 끝나지 않은 runTask 수
+    std::function<void()>* taskDone = nullptr;
+
+    bool trySchedule(size_t r) {
+        std::atomic<bool>& flag = slots[r].scheduled;
+        if (flag.load(std::memory_order_relaxed) || flag.exchange(true, std::memory_order_acq_rel)) return false;
+        submitTask(r);
+        return true;
+    }
+
+    void submitTask(size_t r) {
+        tasksInFlight->fetch_add(1, std::memory_order_relaxed);
+        (*submit)([this, r]() { runTask(r); });
+    }
+
+    // 막힌 이유가 풀렸는지 (잠들기 직전 재확인용, 틀리게 true여도 한 번 헛돌 뿐)
+    //  - blocked: scheduled를 내려놓기 전에 읽어 둔 pendingOutputs (그 뒤엔 다른 워커가 복제본 상태를 바꿀 수 있음)
+    bool hasWork(Step reason, uint64_t blocked) const {
+        if (reason == Step::Blocked) {
+            for (size_t o = 0; o < outs.size(); ++o)
+                if ((blocked >> o & 1) && outs[o]->size() < outs[o]->capacity) return true;
+            return false;
+        }
+        return in->size() > 0 || in->closed();
+    }
+
+    // taskDone은 반드시 마지막: 그 뒤로 run()이 돌아가 Pipeline이 사라질 수 있음
+    void runTask(size_t r) {
+        Step result = Step::Progress;
+        for (int i = 0; i < TASK_BUDGET && result == Step::Progress; ++i) result = step(r);
+        if (result == Step::Finished) {
+            finishReplica();                // scheduled는 true로 남겨 다시 예약되지 않게 함
+        } else if (result == Step::Progress) {
+            submitTask(r);
+        } else {
+            const uint64_t blocked = result == Step::Blocked ? pendingOutputs(r) : 0;
+            slots[r].scheduled.store(false, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (hasWork(result, blocked)) trySchedule(r);
+        }
+        (*taskDone)();
+    }
+
+    void runThread(size_t r) {
+        detail::pinCurrentThread(opts.placement, r);
+        for (;;) {
+            Step result = step(r);
+            if (result == Step::Finished) break;
+            if (result != Step::Progress) std::this_thread::yield();
+        }
+        finishReplica();
+    }
+
+    void finishReplica() {
+        for (ChannelBase* out : outs) {
+            out->openProducers.fetch_sub(1, std::memory_order_acq_rel);
+            out->consumer->notify(Wake::All);
+        }
+        (*replicaDone)();
+    }
+};
+
+template<typename In, typename Out>
+class Node : public NodeBase {
+public:
+    static constexpr bool IS_SOURCE = std::is_same_v<In, None>;
+    static constexpr bool IS_SINK = std::is_same_v<Out, None>;
+    static_assert(!(IS_SOURCE && IS_SINK), "a stage needs an input or an output");
+
+    using Function = std::conditional_t<IS_SOURCE, std::function<size_t(std::span<Out>)>,
+                     std::conditional_t<IS_SINK, std::function<void(std::span<const In>)>,
+                                        std::function<size_t(std::span<const In>, std::span<Out>)>>>;
+
+    Node(std::string name, Function fn, StageOptions options)
+        : NodeBase(std::move(name), options), fn(std::move(fn)) {}
+
+private:
+    // 복제본별 작업 버퍼 (run() 전에 한 번 할당)
+    struct Replica {
+        std::vector<In> input;
+        std::vector<Out> output;
+        std::vector<size_t> sent;       // 출력 큐별로 보낸 개수 (fan-out 중 일부만 막힐 수 있음)
+        size_t count = 0;               // output에 남은 배치 크기
+        uint64_t stampNs = 0;
+        bool pending = false;
+    };
+
+    Function fn;
+    std::vector<Replica> replicas;
+
+    bool isSource() const override { return IS_SOURCE; }
+    bool isSink() const override { return IS_SINK; }
+
+    uint64_t pendingOutputs(size_t r) const override {
+        const Replica& rep = replicas[r];
+        uint64_t mask = 0;
+        if (rep.pending)
+            for (size_t o = 0; o < outs.size(); ++o)
+                if (rep.sent[o] < rep.count) mask |= uint64_t{1} << o;
+        return mask;
+    }
+
+    void prepare() override {
+        replicas.resize(opts.replicas);
+        for (Replica& rep : replicas) {
+            if constexpr (!IS_SOURCE) rep.input.resize(opts.batch);
+            if constexpr (!IS_SINK) rep.output.resize(opts.batch);
+            rep.sent.assign(outs.size(), 0);
+        }
+    }
+
+    // 밀린 출력을 보낼 수 있는 만큼 보냄, 전부 보냈으면 true
+    bool flush(Replica& rep) {
+        bool done = true;
+        for (size_t o = 0; o < outs.size(); ++o) {
+            auto& channel = *static_cast<Channel<Out>*>(outs[o]);
+            size_t& sent = rep.sent[o];
+            const size_t before = sent;
+            while (sent < rep.count && channel.tryPush(rep.output[sent], rep.stampNs)) ++sent;
+            if (sent != before) notifyConsumer(outs[o]);
+            if (sent < rep.count) done = false;
+        }
+        rep.pending = !done;
+        return done;
+    }
+
+    Step step(size_t r) override {
+        Replica& rep = replicas[r];
+        if constexpr (!IS_SINK) {
+            if (rep.pending && !flush(rep)) {
+                metrics.stalls.fetch_add(1, std::memory_order_relaxed);
+                return Step::Blocked;
+            }
+        }
+
+        size_t produced = 0;
+        uint64_t start;
+        if constexpr (IS_SOURCE) {
+            start = detail::nowNs();
+            produced = std::min(fn(std::span<Out>(rep.output.data(), opts.batch)), opts.batch);
+            if (produced == 0) return Step::Finished;
+        } else {
+            auto& input = *static_cast<Channel<In>*>(in);
+            const bool closed = input.closed();     // pop 전에 확인 → 닫힌 뒤 비었으면 정말 끝
+            const size_t depth = input.size();
+            if (depth) recordDepth(in, depth);
+            size_t n = 0;
+            uint64_t stampSum = 0, stamp = 0;
+            while (n < opts.batch && input.tryPop(rep.input[n], stamp)) {
+                stampSum += stamp;
+                ++n;
+            }
+            if (n == 0) return closed ? Step::Finished : Step::Idle;
+            start = detail::nowNs();
+            metrics.itemsIn.fetch_add(n, std::memory_order_relaxed);
+            metrics.waitNs.fetch_add(start * n - stampSum, std::memory_order_relaxed);
+            notifyProducers();
+
+            const std::span<const In> batch(rep.input.data(), n);
+            if constexpr (IS_SINK) fn(batch);
+            else produced = std::min(fn(batch, std::span<Out>(rep.output.data(), n)), n);
+        }
+
+        const uint64_t end = detail::nowNs();
+        metrics.invocations.fetch_add(1, std::memory_order_relaxed);
+        metrics.busyNs.fetch_add(end - start, std::memory_order_relaxed);
+        if constexpr (!IS_SINK) {
+            if (produced) {
+                metrics.itemsOut.fetch_add(produced, std::memory_order_relaxed);
+                rep.count = produced;
+                rep.stampNs = end;
+                std::fill(rep.sent.begin(), rep.sent.end(), 0);
+                flush(rep);
+            }
+        }
+        return Step::Progress;
+    }
+};
+
+template<typename Out>
+using SourceNode = Node<None, Out>;
+template<typename In>
+using SinkNode = Node<In, None>;
+
+/*
+ * Pipeline - 단계 / 연결 소유, run()에서 큐 종류 결정 → 스레드 시작 / 실행기 예약 → 완료 대기
+ *  - 소스가 0을 돌려주면 그 복제본이 끝나고, 출력 큐의 생산자가 모두 끝나면 큐가 닫힘
+ *    소비자는 닫힌 큐를 비운 뒤 끝남 → 끝이 하류로 차례로 전파
+ */
+class Pipeline {
+    std::vector<std::unique_ptr<NodeBase>> nodes;
+    std::vector<std::unique_ptr<ChannelBase>> channels;
+    std::function<void(std::function<void()>)> submit;
+    std::function<void()> replicaDone;
+    std::function<void()> taskDone;
+    std::atomic<size_t> running{0};         // 아직 끝나지 않은 복제본 수
+    std::atomic<size_t> tasks{0};           // 실행 중이거나 대기 중인 실행기 작업 수
+    std::mutex doneMtx;
+    std::condition_variable doneCv;
+    uint64_t elapsedNs = 0;
+    bool started = false;
+
+    template<typename In, typename Out>
+    Node<In, Out>& add(std::string name, typename Node<In, Out>::Function fn, StageOptions options) {
+        auto node = std::make_unique<Node<In, Out>>(std::move(name), std::move(fn), options);
+        Node<In, Out>& ref = *node;
+        nodes.push_back(std::move(node));
+        return ref;
+    }
+
+    void validate() const {
+        bool needsExecutor = false;
+        for (const auto& node : nodes) {
+            if (!node->isSource() && !node->in) throw std::logic_error("stage has no input: " + node->name());
+            if (!node->isSink() && node->outs.empty()) throw std::logic_error("stage has no output: " + node->name());
+            needsExecutor |= node->opts.placement.kind == Placement::Kind::Executor;
+        }
+        if (needsExecutor && !submit) throw std::logic_error("onExecutor() stage needs Pipeline::useExecutor");
+    }
+
+public:
+    Pipeline() {
+        replicaDone = [this]() {
+            if (running.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                { std::lock_guard<std::mutex> lock(doneMtx); }
+                doneCv.notify_all();
+            }
+        };
+        // 0으로 만드는 감소는 doneMtx 안에서만 → run()은 마지막 작업이 잠금을 놓은 뒤에야 돌아감
+        taskDone = [this]() {
+            size_t n = tasks.load(std::memory_order_relaxed);
+            while (n > 1)
+                if (tasks.compare_exchange_weak(n, n - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) return;
+            std::lock_guard<std::mutex> lock(doneMtx);
+            if (tasks.fetch_sub(1, std::memory_order_acq_rel) == 1) doneCv.notify_all();
+        };
+    }
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    template<typename Out>
+    SourceNode<Out>& source(std::string name, typename SourceNode<Out>::Function fn, StageOptions options = {}) {
+        return add<None, Out>(std::move(name), std::move(fn), options);
+    }
+
+    template<typename In, typename Out>
+    Node<In, Out>& stage(std::string name, typename Node<In, Out>::Function fn, StageOptions options = {}) {
+        return add<In, Out>(std::move(name), std::move(fn), options);
+    }
+
+    template<typename In>
+    SinkNode<In>& sink(std::string name, typename SinkNode<In>::Function fn, StageOptions options = {}) {
+        return add<In, None>(std::move(name), std::move(fn), options);
+    }
+
+    // from의 출력 → to의 입력 (to에 이미 입력 큐가 있으면 공유: fan-in, 용량은 큰 쪽)
+    template<typename A, typename T, typename B>
+    void connect(Node<A, T>& from, Node<T, B>& to, size_t capacity = 1024) {
+        static_assert(!std::is_same_v<T, None>, "cannot connect a sink's output or a source's input");
+        if (started) throw std::logic_error("Pipeline::connect after run");
+        if (from.outs.size() == 64) throw std::length_error("stage has too many outputs: " + from.name());
+        if (!to.in) {
+            channels.push_back(std::make_unique<Channel<T>>());
+            to.in = channels.back().get();
+            to.in->consumer = &to;
+        }
+        to.in->capacity = std::max(to.in->capacity, capacity);
+        to.in->producers.push_back(&from);
+        from.outs.push_back(to.in);
+    }
+
+    // Executor는 push(function<void()>)를 제공, run()이 끝날 때까지 살아 있어야 함
+    template<typename Executor>
+    void useExecutor(Executor& executor) {
+        submit = [&executor](std::function<void()> task) { executor.push(std::move(task)); };
+    }
+
+    void run() {
+        if (started) throw std::logic_error("Pipeline::run called twice");
+        validate();
+        started = true;
+
+        size_t total = 0;
+        for (auto& node : nodes) total += node->opts.replicas;
+        for (auto& channel : channels) {
+            size_t producerReplicas = 0;
+            for (NodeBase* producer : channel->producers) producerReplicas += producer->opts.replicas;
+            channel->openProducers.store(producerReplicas, std::memory_order_relaxed);
+            channel->open(producerReplicas > 1, channel->consumer->opts.replicas > 1,
+                          detail::homeNode(channel->consumer->opts.placement));
+        }
+        for (auto& node : nodes) {
+            node->prepare();
+            node->slots = std::make_unique<NodeBase::ReplicaSlot[]>(node->opts.replicas);
+            node->submit = &submit;
+            node->replicaDone = &replicaDone;
+            node->tasksInFlight = &tasks;
+            node->taskDone = &taskDone;
+        }
+        running.store(total, std::memory_order_release);
+
+        const uint64_t start = detail::nowNs();
+        std::vector<std::thread> threads;
+        for (auto& node : nodes) {
+            for (size_t r = 0; r < node->opts.replicas; ++r) {
+                if (node->opts.placement.kind == Placement::Kind::Thread)
+                    threads.emplace_back([n = node.get(), r]() { n->runThread(r); });
+                else
+                    node->trySchedule(r);
+            }
+        }
+        // 복제본이 모두 끝나도 마지막 runTask가 아직 this를 쓰고 있을 수 있음 → 작업 수도 0이 될 때까지
+        {
+            std::unique_lock<std::mutex> lock(doneMtx);
+            doneCv.wait(lock, [this]() {
+                return running.load(std::memory_order_acquire) == 0 && tasks.load(std::memory_order_acquire) == 0;
+            });
+        }
+        for (auto& t : threads) t.join();
+        elapsedNs = detail::nowNs() - start;
+    }
+
+    double elapsedSec() const { return elapsedNs / 1e9; }
+
+    std::vector<StageStats> stats() const {
+        std::vector<StageStats> result;
+        for (const auto& node : nodes) result.push_back(node->stats());
+        return result;
+    }
+
+    // 단계별 한 줄: 처리량(벽시계 기준) / 처리 시간 비율 / 항목당 대기 / 큐 깊이 / 막힘
+    void report(std::ostream& out) const {
+        const double sec = std::max(elapsedSec(), 1e-9);
+        for (const StageStats& s : stats()) {
+            const uint64_t items = s.itemsIn ? s.itemsIn : s.itemsOut;
+            out << "  " << s.name;
+            for (size_t i = s.name.size(); i < 10; ++i) out << ' ';
+            out << (s.placement.kind == Placement::Kind::Executor ? " executor" : " thread  ") << " x" << s.replicas
+                << "  " << items / sec / 1e6 << " M items/s, busy " << 100.0 * s.busyNs / (elapsedNs * s.replicas + 1)
+                << "%, batch " << (s.invocations ? static_cast<double>(items) / s.invocations : 0.0);
+            if (s.capacity) {
+                out << ", wait " << (s.itemsIn ? s.waitNs / 1e3 / s.itemsIn : 0.0) << " us/item, depth "
+                    << s.maxDepth << "/" << s.capacity;
+            }
+            if (s.itemsIn && s.itemsOut != s.itemsIn && s.itemsOut) out << ", out " << s.itemsOut;
+            if (s.stalls) out << ", stalls " << s.stalls;
+            out << std::endl;
+        }
+    }
+};
+
+} // namespace dataflow
+
+#endif // CODING_SKILL_DATAFLOW_PIPELINE_H
@@ -0,0 +1,150 @@
+/*
+ * 스레드별 magazine 캐시 + lock-free depot 블록 풀 (11_memory_pool.cpp, 15_linked_list.cpp 공용)
+ *
+ *   mempool::ConcurrentMemoryPool<Node> pool;
+ *   thread_local mempool::ConcurrentMemoryPool<Node>::LocalCache cache(pool);
+ *   Node* n = new (cache.allocate()) Node(...);
+ *   n->~Node(); cache.deallocate(n);
+ */
+#ifndef CODING_SKILL_MEMPOOL_CONCURRENT_POOL_H
+#define CODING_SKILL_MEMPOOL_CONCURRENT_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace mempool {
+
+/*
+ * ConcurrentMemoryPool - 스레드별 magazine 캐시 + 공유 lock-free depot
+ *  - 각 스레드는 LocalCache(magazine 2개: loaded/previous)에서만 할당/해제 → 공유 상태 접근 없음
+ *  - magazine이 가득/비면 MagazineSize개 묶음 단위로 depot과 교환 (O(1), 드묾)
+ *  - 다른 스레드가 할당한 블록도 자기 magazine에 넣으면 끝 → cross-thread free O(1)
+ *  - depot은 Treiber 스택, 상위 16비트 태그로 ABA 방지 (64비트 주소 중 하위 48비트만 사용)
+ *  - 청크 할당만 mutex (depot도 비었을 때만)
+ *  - depot 링크(nextBatch)는 객체 저장 공간 밖에 둠: 낡은 top을 본 스레드는 이미 pop돼 재사용 중인 블록의
+ *    링크를 CAS 전에 읽을 수 있음 → 사용자 데이터와 겹치지 않는 relaxed atomic이어야 경합이 없음
+ *    (태그는 ABA만 막음, 블록당 포인터 하나 + 정렬만큼 커짐)
+ */
+template<typename T, size_t MagazineSize = 64, size_t BlockSize = 64 * 1024>
+class ConcurrentMemoryPool {
+    struct Block {
+        union {
+            alignas(T) uint8_t data[sizeof(T)];     // 첫 멤버 → T*와 Block* 주소가 같음
+            struct {
+                Block* next;        // magazine 내부 연결 (주인 스레드만 읽음)
+                size_t count;       // magazine 블록 수 (첫 블록만 사용, pop 성공 후에만 읽음)
+            } link;
+        };
+        std::atomic<Block*> nextBatch;  // depot 스택 연결 (magazine 첫 블록만 사용)
+    };
+    static constexpr size_t BLOCKS_PER_CHUNK = BlockSize / sizeof(Block);
+    static_assert(BLOCKS_PER_CHUNK >= MagazineSize, "BlockSize too small for one magazine");
+    static_assert(sizeof(void*) == 8, "tagged depot pointer assumes 64-bit addresses");
+
+    static constexpr uint64_t POINTER_MASK = (uint64_t{1} << 48) - 1;
+
+    alignas(64) std::atomic<uint64_t> depotTop{0};
+    alignas(64) std::mutex chunkLock;
+    std::vector<std::unique_ptr<uint8_t[]>> chunks;
+
+    static Block* pointerOf(uint64_t tagged) { return reinterpret_cast<Block*>(tagged & POINTER_MASK); }
+    static uint64_t tagged(Block* block, uint64_t previous) {
+        return reinterpret_cast<uint64_t>(block) | ((previous & ~POINTER_MASK) + (uint64_t{1} << 48));
+    }
+
+    // 블록 수가 몇 개든 magazine 하나를 depot에 push
+    void pushMagazine(Block* head, size_t count) {
+        head->link.count = count;
+        uint64_t top = depotTop.load(std::memory_order_relaxed);
+        do {
+            head->nextBatch.store(pointerOf(top), std::memory_order_relaxed);
+        } while (!depotTop.compare_exchange_weak(top, tagged(head, top),
+                                                 std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // depot에서 magazine 하나를 pop, 없으면 새 청크를 잘라서 공급
+    Block* popMagazine(size_t& count) {
+        uint64_t top = depotTop.load(std::memory_order_acquire);
+        while (Block* head = pointerOf(top)) {
+            // head가 다른 스레드에 재사용됐더라도 청크 메모리는 살아있고, 태그가 바뀌어 CAS가 실패함
+            if (depotTop.compare_exchange_weak(top, tagged(head->nextBatch.load(std::memory_order_relaxed), top),
+                                               std::memory_order_acquire, std::memory_order_acquire)) {
+                count = head->link.count;
+                return head;
+            }
+        }
+        return carveChunk(count);
+    }
+
+    Block* carveChunk(size_t& count) {
+        Block* blocks;
+        {
+            std::lock_guard<std::mutex> guard(chunkLock);
+            chunks.push_back(std::make_unique<uint8_t[]>(BLOCKS_PER_CHUNK * sizeof(Block)));
+            blocks = reinterpret_cast<Block*>(chunks.back().get());
+        }
+        for (size_t i = 0; i < BLOCKS_PER_CHUNK; ++i) {
+            blocks[i].link.next = (i + 1) % MagazineSize == 0 || i + 1 == BLOCKS_PER_CHUNK ? nullptr : &blocks[i + 1];
+        }
+        // 첫 magazine은 호출자에게, 나머지는 depot으로
+        for (size_t start = MagazineSize; start < BLOCKS_PER_CHUNK; start += MagazineSize) {
+            pushMagazine(&blocks[start], std::min(MagazineSize, BLOCKS_PER_CHUNK - start));
+        }
+        count = MagazineSize;
+        return blocks;
+    }
+
+public:
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned T not supported");
+
+    class LocalCache {
+        struct Magazine {
+            Block* head = nullptr;
+            size_t count = 0;
+        };
+        ConcurrentMemoryPool& pool;
+        Magazine loaded;
+        Magazine previous;      // 비어있거나 가득 찬 상태만 가짐
+    public:
+        explicit LocalCache(ConcurrentMemoryPool& pool) : pool(pool) {}
+        ~LocalCache() {
+            if (loaded.count) pool.pushMagazine(loaded.head, loaded.count);
+            if (previous.count) pool.pushMagazine(previous.head, previous.count);
+        }
+        LocalCache(const LocalCache&) = delete;
+        LocalCache& operator=(const LocalCache&) = delete;
+
+        T* allocate() {
+            if (loaded.count == 0) {
+                if (previous.count) std::swap(loaded, previous);
+                else loaded.head = pool.popMagazine(loaded.count);
+            }
+            Block* block = loaded.head;
+            loaded.head = block->link.next;
+            --loaded.count;
+            return reinterpret_cast<T*>(block);
+        }
+
+        void deallocate(T* ptr) {
+            if (loaded.count == MagazineSize) {
+                if (previous.count == 0) std::swap(loaded, previous);
+                else pool.pushMagazine(loaded.head, loaded.count);
+                loaded = {};
+            }
+            Block* block = reinterpret_cast<Block*>(ptr);
+            block->link.next = loaded.head;
+            loaded.head = block;
+            ++loaded.count;
+        }
+    };
+};
+
+}  // namespace mempool
+
+#endif  // CODING_SKILL_MEMPOOL_CONCURRENT_POOL_H
@@ -0,0 +1,432 @@
+/*
+ * Allocation profiler - 힙 할당을 호출 지점(call stack)별로 집계
+ *
+ * 실행 파일 하나(.cpp 하나)에서만 교체를 켬:
+ *
+ *   #define ALLOC_PROFILER_REPLACE_NEW      // 전역 operator new/delete 교체 (opt-in)
+ *   #include "profiling/alloc_profiler.h"
+ *
+ *   allocprof::start(64);                   // 스레드마다 64번째 할당마다 표본 1개
+ *   ...
+ *   allocprof::stop();
+ *   allocprof::report(std::cout, 10);       // 추정 바이트 기준 상위 10개 호출 지점
+ *
+ *   ASSERT_NO_ALLOC { hotPath(); }          // 블록 안에서 이 스레드가 할당하면 실패
+ *
+ *  - 표본 추출: 스레드별 countdown (thread_local 감소 한 번) → 꺼져 있거나 표본이 아니면 malloc + 헤더 기록만
+ *    다음 간격은 [1, 2 × interval - 1]에서 무작위 (평균 interval) → 루프 주기와 맞물려 한 지점만 뽑히는 일 방지
+ *  - 표본: backtrace로 호출 스택을 잡아 해시 → 고정 크기 site 테이블 (lock-free 삽입, 카운터는 atomic)
+ *  - 모든 블록 앞에 16바이트 헤더 (site 번호, 크기, 할당 시각) → delete에서 수명과 live 바이트 계산
+ *  - 표본 수 × 표본 간격 = 추정 할당 수 (간격 1이면 정확한 값)
+ *  - 리포트/스택 캡처 중의 할당은 스레드별 재진입 표시로 제외
+ *  - ASSERT_NO_ALLOC은 표본과 무관하게 모든 할당을 셈 (교체가 없는 실행 파일에서는 항상 통과)
+ *  - 스택은 glibc backtrace (함수 이름을 보려면 -rdynamic / ENABLE_EXPORTS), 그 외 플랫폼은 직전 호출자 1단계
+ */
+#ifndef CODING_SKILL_PROFILING_ALLOC_PROFILER_H
+#define CODING_SKILL_PROFILING_ALLOC_PROFILER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <execinfo.h>
+#endif
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+// 리포트에 이름으로 남길 함수용: 인라인/복제(.constprop 같은 로컬 심볼) 금지
+#if defined(__clang__)
+#define ALLOCPROF_NOINLINE __attribute__((noinline))
+#elif defined(__GNUC__)
+#define ALLOCPROF_NOINLINE __attribute__((noinline, noclone))
+#else
+#define ALLOCPROF_NOINLINE
+#endif
+
+namespace allocprof {
+
+inline constexpr size_t MAX_FRAMES = 8;
+inline constexpr size_t MAX_SITES = 4096;         // 2의 거듭제곱, 가득 차면 나머지 표본은 overflow로만 셈
+inline constexpr size_t HEADER_SIZE = 16;
+
+// 블록 바로 앞 헤더: site 0 = 표본 아님
+struct Header {
+    uint32_t site;
+    uint32_t size;          // 4GB 이상은 포화
+    uint64_t startNs;
+};
+static_assert(sizeof(Header) == HEADER_SIZE);
+
+struct Site {
+    std::atomic<uint64_t> hash{0};          // 0 = 빈 칸
+    std::atomic<bool> ready{false};         // frames 기록 완료
+    uint32_t depth = 0;
+    void* frames[MAX_FRAMES] = {};
+    std::atomic<uint64_t> samples{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> freed{0};
+    std::atomic<uint64_t> liveBytes{0};
+    std::atomic<uint64_t> lifetimeNs{0};    // 해제된 표본의 수명 합
+};
+
+// 스레드별 상태: 상수 초기화만 (operator new 안에서 동적 초기화나 할당이 일어나면 안 됨)
+struct ThreadState {
+    uint64_t allocations = 0;       // 모든 할당 (ASSERT_NO_ALLOC)
+    uint32_t countdown = 0;         // 0이 되면 표본
+    bool inside = false;            // 프로파일러 자신의 할당
+    uint64_t random = 0;            // 다음 간격용 xorshift (0이면 첫 표본 때 시드)
+};
+
+namespace detail {
+
+inline thread_local ThreadState threadState;
+
+struct State {
+    std::atomic<bool> active{false};
+    std::atomic<uint32_t> interval{1};
+    std::atomic<uint64_t> overflow{0};
+    std::atomic<uint64_t> resetNs{0};       // 이 시각 이전에 할당된 표본의 해제는 통계에 넣지 않음
+    Site sites[MAX_SITES];
+};
+
+inline State& state() {
+    static State s;
+    return s;
+}
+
+inline uint64_t nowNs() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+// 스택 캡처: 이 함수, recordSample, allocate 3단계를 건너뜀
+//  - operator new는 최적화 빌드에서 allocate로 꼬리 호출(jmp)되어 프레임이 없을 수 있으므로 리포트 쪽에서 거름
+ALLOCPROF_NOINLINE inline uint32_t captureStack(void** frames) {
+#if defined(__GLIBC__)
+    constexpr int SKIP = 3;
+    void* raw[MAX_FRAMES + SKIP];
+    int n = backtrace(raw, static_cast<int>(MAX_FRAMES + SKIP));
+    uint32_t depth = n > SKIP ? static_cast<uint32_t>(n - SKIP) : 0;
+    std::memcpy(frames, raw + SKIP, depth * sizeof(void*));
+    return depth;
+#elif defined(__GNUC__)
+    frames[0] = __builtin_return_address(2);
+    return 1;
+#else
+    (void)frames;
+    return 0;
+#endif
+}
+
+// 표본 하나를 site에 기록하고 site 번호(1부터)를 돌려줌, 테이블이 가득 차면 0
+ALLOCPROF_NOINLINE inline uint32_t recordSample(size_t size) {
+    void* frames[MAX_FRAMES];
+    uint32_t depth = captureStack(frames);
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (uint32_t i = 0; i < depth; ++i) hash = (hash ^ reinterpret_cast<uintptr_t>(frames[i])) * 0x100000001b3ULL;
+    hash |= 1;      // 0은 빈 칸 표시
+
+    State& s = state();
+    for (size_t probe = 0, i = hash & (MAX_SITES - 1); probe < MAX_SITES; ++probe, i = (i + 1) & (MAX_SITES - 1)) {
+        Site& site = s.sites[i];
+        uint64_t seen = site.hash.load(std::memory_order_acquire);
+        if (seen == 0) {
+            if (site.hash.compare_exchange_strong(seen, hash, std::memory_order_acq_rel)) {
+                site.depth = depth;
+                std::memcpy(site.frames, frames, depth * sizeof(void*));
+                site.ready.store(true, std::memory_order_release);
+                seen = hash;
+            }
+        }
+        if (seen != hash) continue;
+        site.samples.fetch_add(1, std::memory_order_relaxed);
+        site.bytes.fetch_add(size, std::memory_order_relaxed);
+        site.liveBytes.fetch_add(size, std::memory_order_relaxed);
+        return static_cast<uint32_t>(i + 1);
+    }
+    s.overflow.fetch_add(1, std::memory_order_relaxed);
+    return 0;
+}
+
+inline void* rawAllocate(size_t total, size_t alignment) {
+    if (alignment <= alignof(std::max_align_t)) return std::malloc(total);
+#if defined(_MSC_VER)
+    return _aligned_malloc(total, alignment);
+#else
+    return std::aligned_alloc(alignment, (total + alignment - 1) / alignment * alignment);
+#endif
+}
+
+inline void rawFree(void* p, size_t alignment) {
+#if defined(_MSC_VER)
+    if (alignment > alignof(std::max_align_t)) { _aligned_free(p); return; }
+#else
+    (void)alignment;
+#endif
+    std::free(p);
+}
+
+// 다음 표본까지 남은 할당 수 (interval 1이면 매번)
+inline uint32_t nextInterval(ThreadState& t, uint32_t interval) {
+    if (interval <= 1) return 0;
+    if (t.random == 0) t.random = reinterpret_cast<uintptr_t>(&t) * 0x9E3779B97F4A7C15ULL | 1;
+    t.random ^= t.random << 13;
+    t.random ^= t.random >> 7;
+    t.random ^= t.random << 17;
+    return static_cast<uint32_t>(t.random % (2 * uint64_t{interval} - 1));
+}
+
+// 헤더 자리는 정렬을 지키도록 max(16, alignment)
+inline size_t prefixFor(size_t alignment) { return std::max(HEADER_SIZE, alignment); }
+
+ALLOCPROF_NOINLINE inline void* allocate(size_t size, size_t alignment) {
+    ThreadState& t = threadState;
+    t.allocations++;
+    uint32_t site = 0;
+    uint64_t startNs = 0;
+    State& s = state();
+    if (s.active.load(std::memory_order_relaxed) && !t.inside && t.countdown-- == 0) {
+        t.countdown = nextInterval(t, s.interval.load(std::memory_order_relaxed));
+        t.inside = true;
+        startNs = nowNs();          // 집계 전에 찍음 → reset() 비교에서 "집계가 reset 뒤"를 보장
+        site = recordSample(size);
+        t.inside = false;
+    }
+    const size_t prefix = prefixFor(alignment);
+    char* raw = static_cast<char*>(rawAllocate(prefix + (size ? size : 1), alignment));
+    if (!raw) return nullptr;
+    char* user = raw + prefix;
+    Header* h = reinterpret_cast<Header*>(user - HEADER_SIZE);
+    h->site = site;
+    h->size = static_cast<uint32_t>(std::min<size_t>(size, UINT32_MAX));
+    h->startNs = site ? startNs : 0;
+    return user;
+}
+
+inline void deallocate(void* p, size_t alignment) {
+    if (!p) return;
+    char* user = static_cast<char*>(p);
+    const Header* h = reinterpret_cast<const Header*>(user - HEADER_SIZE);
+    if (h->site && h->startNs > state().resetNs.load(std::memory_order_acquire)) {
+        Site& site = state().sites[h->site - 1];
+        site.freed.fetch_add(1, std::memory_order_relaxed);
+        site.liveBytes.fetch_sub(h->size, std::memory_order_relaxed);
+        site.lifetimeNs.fetch_add(nowNs() - h->startNs, std::memory_order_relaxed);
+    }
+    rawFree(user - prefixFor(alignment), alignment);
+}
+
+inline void noAllocAbort(const char* file, int line, uint64_t count) {
+    std::fprintf(stderr, "%s:%d: ASSERT_NO_ALLOC failed: %llu allocation(s) in scope\n", file, line,
+                 static_cast<unsigned long long>(count));
+    std::abort();
+}
+
+inline std::atomic<void (*)(const char*, int, uint64_t)>& noAllocHandler() {
+    static std::atomic<void (*)(const char*, int, uint64_t)> handler{&noAllocAbort};
+    return handler;
+}
+
+// backtrace_symbols 한 줄 "binary(mangled+0x1f) [0x...]" → 가능하면 demangle한 함수 이름
+inline std::string describeFrame(const char* symbol) {
+    std::string line(symbol);
+#if defined(__GNUC__)
+    size_t open = line.find('('), plus = line.find('+', open);
+    if (open != std::string::npos && plus != std::string::npos && plus > open + 1) {
+        std::string mangled = line.substr(open + 1, plus - open - 1);
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(mangled.c_str(), nullptr, nullptr, &status);
+        if (status == 0 && demangled) {
+            std::string name(demangled);
+            std::free(demangled);
+            return name;
+        }
+        return mangled;
+    }
+#endif
+    return line;
+}
+
+}  // namespace detail
+
+// 표본 수집 시작 (interval번째 할당마다 1개), 이전 통계는 유지 → 새로 보려면 reset()
+inline void start(uint32_t interval = 1) {
+    detail::state().interval.store(std::max<uint32_t>(interval, 1), std::memory_order_relaxed);
+    detail::state().active.store(true, std::memory_order_release);
+}
+
+inline void stop() { detail::state().active.store(false, std::memory_order_release); }
+
+// 통계만 비움 (아직 살아 있는 표본 블록은 site 번호를 들고 있으므로 테이블 자체는 지우지 않음)
+//  - reset 이전에 할당된 블록은 나중에 해제돼도 freed/liveBytes에 반영하지 않음 → liveBytes underflow 없음
+//    (resetNs는 비운 뒤에 기록: 그보다 늦게 찍힌 표본은 집계도 비운 뒤에 들어감)
+inline void reset() {
+    for (Site& site : detail::state().sites) {
+        site.samples.store(0, std::memory_order_relaxed);
+        site.bytes.store(0, std::memory_order_relaxed);
+        site.freed.store(0, std::memory_order_relaxed);
+        site.liveBytes.store(0, std::memory_order_relaxed);
+        site.lifetimeNs.store(0, std::memory_order_relaxed);
+    }
+    detail::state().overflow.store(0, std::memory_order_relaxed);
+    detail::state().resetNs.store(detail::nowNs(), std::memory_order_release);
+}
+
+// 이 스레드의 누적 할당 수 (교체가 켜진 실행 파일에서만 증가)
+inline uint64_t threadAllocations() { return detail::threadState.allocations; }
+
+// ASSERT_NO_ALLOC 실패 시 호출 (기본: stderr 출력 후 abort)
+inline void setNoAllocHandler(void (*handler)(const char* file, int line, uint64_t count)) {
+    detail::noAllocHandler().store(handler ? handler : &detail::noAllocAbort, std::memory_order_release);
+}
+
+struct SiteReport {
+    uint64_t estimatedCount;
+    uint64_t estimatedBytes;
+    uint64_t samples;
+    uint64_t liveSamples;
+    double averageLifetimeUs;       // 해제된 표본 기준
+    std::vector<std::string> frames;
+
+    // 표준 라이브러리 안쪽 단계(allocator, basic_string, make_unique 등)를 건너뛴 첫 단계 = 호출 지점
+    //  - 함수 이름(인자 목록 앞)에 std:: / __gnu_cxx:: 가 있으면 라이브러리 단계로 봄
+    //  - 이름을 못 찾은 단계("binary(+0x..)": 람다 타입으로 찍힌 std::function 내부 등)도 건너뜀
+    size_t callSiteFrame() const {
+        auto isLibrary = [](const std::string& f) {
+            size_t args = f.find('(');
+            return std::min({f.find("std::"), f.find("__gnu_cxx::"), f.find("operator new")}) < args ||
+                   f.find("(+0x") != std::string::npos;
+        };
+        size_t i = 0;
+        while (i + 1 < frames.size() && isLibrary(frames[i])) ++i;
+        return i;
+    }
+    std::string callSite() const { return frames.empty() ? std::string("?") : frames[callSiteFrame()]; }
+};
+
+// 추정 바이트 많은 순서로 상위 top개
+inline std::vector<SiteReport> topSites(size_t top) {
+    ThreadState& t = detail::threadState;
+    bool wasInside = t.inside;
+    t.inside = true;
+    detail::State& s = detail::state();
+    const uint64_t interval = s.interval.load(std::memory_order_relaxed);
+    std::vector<const Site*> used;
+    for (const Site& site : s.sites)
+        if (site.ready.load(std::memory_order_acquire) && site.samples.load(std::memory_order_relaxed))
+            used.push_back(&site);
+    std::sort(used.begin(), used.end(), [](const Site* a, const Site* b) {
+        return a->bytes.load(std::memory_order_relaxed) > b->bytes.load(std::memory_order_relaxed);
+    });
+    if (used.size() > top) used.resize(top);
+
+    std::vector<SiteReport> result;
+    for (const Site* site : used) {
+        SiteReport r;
+        r.samples = site->samples.load(std::memory_order_relaxed);
+        uint64_t freed = site->freed.load(std::memory_order_relaxed);
+        r.estimatedCount = r.samples * interval;
+        r.estimatedBytes = site->bytes.load(std::memory_order_relaxed) * interval;
+        r.liveSamples = r.samples > freed ? r.samples - freed : 0;
+        r.averageLifetimeUs = freed ? site->lifetimeNs.load(std::memory_order_relaxed) / 1e3 / freed : 0.0;
+#if defined(__GLIBC__)
+        if (char** symbols = backtrace_symbols(const_cast<void* const*>(site->frames), static_cast<int>(site->depth))) {
+            for (uint32_t i = 0; i < site->depth; ++i) r.frames.push_back(detail::describeFrame(symbols[i]));
+            std::free(symbols);
+        }
+#else
+        for (uint32_t i = 0; i < site->depth; ++i) {
+            char buffer[32];
+            std::snprintf(buffer, sizeof buffer, "%p", site->frames[i]);
+            r.frames.emplace_back(buffer);
+        }
+#endif
+        result.push_back(std::move(r));
+    }
+    t.inside = wasInside;
+    return result;
+}
+
+// frames: site마다 보여 줄 스택 단계 수 (호출 지점부터 바깥쪽으로)
+inline void report(std::ostream& out, size_t top = 10, size_t frames = 4) {
+    std::vector<SiteReport> sites = topSites(top);
+    ThreadState& t = detail::threadState;
+    bool wasInside = t.inside;
+    t.inside = true;
+    out << "allocation sites (interval " << detail::state().interval.load(std::memory_order_relaxed)
+        << ", overflow " << detail::state().overflow.load(std::memory_order_relaxed) << ")" << std::endl;
+    for (size_t i = 0; i < sites.size(); ++i) {
+        const SiteReport& r = sites[i];
+        out << "  #" << i + 1 << " ~" << r.estimatedCount << " allocs, ~" << r.estimatedBytes << " B (avg "
+            << (r.samples ? r.estimatedBytes / r.estimatedCount : 0) << " B), live " << r.liveSamples << "/"
+            << r.samples << " samples, avg lifetime " << r.averageLifetimeUs << " us" << std::endl;
+        for (size_t f = r.callSiteFrame(); f < std::min(r.callSiteFrame() + frames, r.frames.size()); ++f)
+            out << "      " << r.frames[f] << std::endl;
+    }
+    t.inside = wasInside;
+}
+
+// ASSERT_NO_ALLOC 본체: 블록 시작/끝의 스레드 할당 수 비교
+class NoAllocScope {
+    const char* file;
+    int line;
+    uint64_t before;
+    bool entered = false;
+public:
+    NoAllocScope(const char* file, int line) : file(file), line(line), before(detail::threadState.allocations) {}
+    ~NoAllocScope() {
+        uint64_t count = detail::threadState.allocations - before;
+        if (count) detail::noAllocHandler().load(std::memory_order_acquire)(file, line, count);
+    }
+    NoAllocScope(const NoAllocScope&) = delete;
+    NoAllocScope& operator=(const NoAllocScope&) = delete;
+    bool enterOnce() { return !entered && (entered = true); }
+};
+
+}  // namespace allocprof
+
+// ASSERT_NO_ALLOC { ... } — for 한 번 도는 구문으로 블록에 scope를 붙임
+#define ALLOCPROF_CONCAT_INNER(a, b) a##b
+#define ALLOCPROF_CONCAT(a, b) ALLOCPROF_CONCAT_INNER(a, b)
+#define ASSERT_NO_ALLOC                                                                              \
+    for (::allocprof::NoAllocScope ALLOCPROF_CONCAT(allocprofScope_, __LINE__)(__FILE__, __LINE__); \
+         ALLOCPROF_CONCAT(allocprofScope_, __LINE__).enterOnce();)
+
+#ifdef ALLOC_PROFILER_REPLACE_NEW
+// 배열/nothrow 버전은 표준 기본 구현이 아래 함수들을 호출
+void* operator new(std::size_t size) {
+    if (void* p = allocprof::detail::allocate(size, alignof(std::max_align_t))) return p;
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* p = allocprof::detail::allocate(size, static_cast<std::size_t>(alignment))) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return ::operator new(size); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return ::operator new(size, alignment); }
+void operator delete(void* p) noexcept { allocprof::detail::deallocate(p, alignof(std::max_align_t)); }
+void operator delete(void* p, std::size_t) noexcept { allocprof::detail::deallocate(p, alignof(std::max_align_t)); }
+void operator delete(void* p, std::align_val_t alignment) noexcept {
+    allocprof::detail::deallocate(p, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* p, std::size_t, std::align_val_t alignment) noexcept {
+    allocprof::detail::deallocate(p, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* p) noexcept { ::operator delete(p); }
+void operator delete[](void* p, std::size_t) noexcept { ::operator delete(p); }
+void operator delete[](void* p, std::align_val_t alignment) noexcept { ::operator delete(p, alignment); }
+void operator delete[](void* p, std::size_t, std::align_val_t alignment) noexcept { ::operator delete(p, alignment); }
+#endif
+
+#endif  // CODING_SKILL_PROFILING_ALLOC_PROFILER_H
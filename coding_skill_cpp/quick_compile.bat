@@ -11,7 +11,7 @@ set FILES=00_function_pointer_basics 01_wrapper_pattern 02_adapter_pattern 03_si
 
 for %%F in (%FILES%) do (
     echo 컴파일 중: %%F.cpp
-    g++ -std=c++17 -o "%%F.exe" "%%F.cpp" 2>nul
+    g++ -std=c++20 -o "%%F.exe" "%%F.cpp" 2>nul
     if exist "%%F.exe" (
         echo   ✓ 성공
     ) else (
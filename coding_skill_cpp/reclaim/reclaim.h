@@ -0,0 +1,403 @@
+/*
+ * Safe memory reclamation - epoch 기반(EBR) + hazard pointer(HP) 공용 라이브러리
+ *
+ * 락-프리 구조에서 연결을 끊은 노드를 "어떤 스레드도 더 이상 읽고 있지 않을 때" 해제한다.
+ * 두 도메인은 같은 API를 가짐 (ReclamationDomain concept):
+ *
+ *   Domain::Guard guard(domain);       // 읽기 구역 시작 (RAII)
+ *   T* p = guard.protect(source);      // atomic<T*>에서 읽은 포인터를 guard 수명 동안 보호
+ *   domain.retire(old);                // 연결을 끊은 노드 해제 예약 (delete는 안전해진 뒤)
+ *   domain.collect();                  // 지금 검사 (스레드 종료로 남겨진 retire 목록도 회수)
+ *
+ *  - EpochDomain : Guard 진입 시 store 한 번, protect는 일반 load → 읽기 쪽 비용 최소
+ *                  대신 Guard 안에서 멈춘 스레드 하나가 모든 회수를 막음 (미회수 메모리 무한 증가)
+ *  - HazardDomain: protect마다 hazard 슬롯 공표 + 재확인 (store + load)
+ *                  미회수 노드 수 ≤ 스레드 수 × (retire 임계값) → 멈춘 스레드가 있어도 상한 유지
+ *  - retire 목록은 스레드별, 임계값만큼 모이면 한 번에 검사 (전역 스캔 비용을 노드 여러 개에 분산)
+ *  - 스레드가 끝나면 기록(record)은 재사용 대기 상태가 되고, 남은 retire 목록은
+ *    그 기록을 넘겨받는 스레드나 collect()가 회수
+ *  - 도메인은 그것을 쓰는 모든 스레드의 Guard / retire보다 오래 살아야 함
+ */
+#ifndef CODING_SKILL_RECLAIM_H
+#define CODING_SKILL_RECLAIM_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace reclaim {
+
+// retire된 노드 하나: 타입을 지운 포인터 + 해제 함수
+struct Retired {
+    void* ptr;
+    void (*deleter)(void*);
+    uint64_t epoch;     // EpochDomain 전용
+};
+
+template<typename T>
+void deleteAs(void* p) {
+    delete static_cast<T*>(p);
+}
+
+namespace detail {
+
+inline uint64_t nextDomainId() {
+    static std::atomic<uint64_t> next{1};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+/*
+ * RecordRegistry - 도메인별 스레드 기록
+ *  - 스레드는 도메인마다 기록 하나를 점유 (thread_local 캐시로 두 번째부터는 비교 한 번)
+ *  - 기록은 shared_ptr: 스레드 종료 시점에 도메인이 먼저 사라져도 inUse 해제가 안전
+ *  - 도메인 id는 재사용하지 않음 → 같은 주소에 새 도메인이 생겨도 옛 캐시와 섞이지 않음
+ */
+template<typename Record>
+class RecordRegistry {
+    struct ThreadCache {
+        struct Entry {
+            uint64_t domainId;
+            std::shared_ptr<Record> record;
+        };
+        std::vector<Entry> entries;
+        uint64_t lastId = 0;
+        Record* last = nullptr;
+
+        ~ThreadCache() {
+            for (auto& e : entries) e.record->inUse.store(false, std::memory_order_release);
+        }
+    };
+
+    const uint64_t id = nextDomainId();
+    std::mutex lock;
+    std::vector<std::shared_ptr<Record>> records;
+    std::atomic<size_t> recordCount{0};
+
+    std::shared_ptr<Record> acquire() {
+        std::lock_guard<std::mutex> guard(lock);
+        for (auto& r : records) {
+            bool expected = false;
+            if (r->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) return r;
+        }
+        auto r = std::make_shared<Record>();
+        r->inUse.store(true, std::memory_order_relaxed);
+        records.push_back(r);
+        recordCount.store(records.size(), std::memory_order_release);
+        return r;
+    }
+
+public:
+    Record& local() {
+        thread_local ThreadCache cache;
+        if (cache.lastId == id) [[likely]] return *cache.last;
+        auto it = std::find_if(cache.entries.begin(), cache.entries.end(),
+                               [this](const auto& e) { return e.domainId == id; });
+        if (it == cache.entries.end()) {
+            cache.entries.push_back({id, acquire()});
+            it = cache.entries.end() - 1;
+        }
+        cache.lastId = id;
+        cache.last = it->record.get();
+        return *cache.last;
+    }
+
+    template<typename Visit>
+    void forEach(Visit&& visit) {
+        std::lock_guard<std::mutex> guard(lock);
+        for (auto& r : records) visit(*r);
+    }
+
+    // 주인 없는 기록(스레드 종료)을 잠시 점유해 visit → 다시 반환
+    template<typename Visit>
+    void adoptOrphans(Visit&& visit) {
+        std::vector<std::shared_ptr<Record>> adopted;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            for (auto& r : records) {
+                bool expected = false;
+                if (r->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) adopted.push_back(r);
+            }
+        }
+        for (auto& r : adopted) {
+            visit(*r);
+            r->inUse.store(false, std::memory_order_release);
+        }
+    }
+
+    size_t size() const { return recordCount.load(std::memory_order_acquire); }
+};
+
+}  // namespace detail
+
+/*
+ * EpochDomain - epoch 기반 회수 (07_observer_pattern.cpp에 있던 EpochDomain을 일반화)
+ *  - Guard: 현재 전역 epoch를 자기 기록에 공표, 마지막 Guard가 끝나면 0(구역 밖)
+ *  - retire: 노드에 현재 전역 epoch e를 붙여 스레드 목록에 보관
+ *  - 회수: 전역 epoch를 올린 뒤, 활성 기록의 최소 epoch가 e보다 크면 (e 이전에 들어온 reader가 모두 나감) 해제
+ */
+class EpochDomain {
+    struct alignas(64) Record {
+        std::atomic<uint64_t> epoch{0};     // 0 = 읽기 구역 밖
+        std::atomic<bool> inUse{false};
+        int depth = 0;                      // 중첩 Guard
+        std::vector<Retired> retired;
+        size_t nextReclaim = 0;             // retired가 이 크기가 되면 검사
+    };
+
+    std::atomic<uint64_t> globalEpoch{1};
+    detail::RecordRegistry<Record> records;
+    std::atomic<size_t> pendingCount{0};
+    std::atomic<size_t> reclaimedCount{0};
+
+    uint64_t minActiveEpoch() {
+        uint64_t lowest = UINT64_MAX;
+        records.forEach([&](Record& r) {
+            uint64_t e = r.epoch.load(std::memory_order_seq_cst);
+            if (e != 0) lowest = std::min(lowest, e);
+        });
+        return lowest;
+    }
+
+    void reclaim(Record& r) {
+        if (r.retired.empty()) return;
+        globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+        const uint64_t lowest = minActiveEpoch();
+        size_t kept = 0;
+        for (Retired& item : r.retired) {
+            if (item.epoch < lowest) item.deleter(item.ptr);
+            else r.retired[kept++] = item;
+        }
+        const size_t freed = r.retired.size() - kept;
+        r.retired.resize(kept);
+        // 멈춘 reader 때문에 남은 노드가 많으면 다음 검사까지 간격을 늘림 → 검사 비용 상각 O(1)
+        r.nextReclaim = kept + std::max(RETIRE_BATCH, kept);
+        pendingCount.fetch_sub(freed, std::memory_order_relaxed);
+        reclaimedCount.fetch_add(freed, std::memory_order_relaxed);
+    }
+
+public:
+    static constexpr size_t RETIRE_BATCH = 64;
+
+    class Guard {
+        Record& record;
+    public:
+        explicit Guard(EpochDomain& domain) : record(domain.records.local()) {
+            if (record.depth++ == 0) {
+                record.epoch.store(domain.globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+            }
+        }
+        ~Guard() {
+            if (--record.depth == 0) record.epoch.store(0, std::memory_order_release);
+        }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        // 공표한 epoch가 Guard 수명 전체를 보호 → index는 쓰지 않음
+        template<typename T>
+        T* protect(const std::atomic<T*>& source, size_t = 0) const {
+            return source.load(std::memory_order_seq_cst);
+        }
+    };
+
+    EpochDomain() = default;
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    // 소멸 시점에는 Guard 안에 있는 스레드가 없어야 함
+    ~EpochDomain() {
+        records.forEach([](Record& r) {
+            for (Retired& item : r.retired) item.deleter(item.ptr);
+            r.retired.clear();
+        });
+    }
+
+    static EpochDomain& global() {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    template<typename T>
+    void retire(T* node) {
+        retire(const_cast<void*>(static_cast<const void*>(node)), &deleteAs<T>);
+    }
+
+    void retire(void* node, void (*deleter)(void*)) {
+        Record& r = records.local();
+        r.retired.push_back({node, deleter, globalEpoch.load(std::memory_order_seq_cst)});
+        pendingCount.fetch_add(1, std::memory_order_relaxed);
+        if (r.retired.size() >= std::max(RETIRE_BATCH, r.nextReclaim)) reclaim(r);
+    }
+
+    void collect() {
+        reclaim(records.local());
+        records.adoptOrphans([this](Record& r) { reclaim(r); });
+    }
+
+    size_t pending() const { return pendingCount.load(std::memory_order_relaxed); }
+    size_t reclaimed() const { return reclaimedCount.load(std::memory_order_relaxed); }
+};
+
+/*
+ * HazardDomain - hazard pointer 회수
+ *  - 스레드 기록마다 hazard 슬롯 SLOTS개, protect(source, index)가 슬롯에 포인터를 공표
+ *    공표 후 source를 다시 읽어 같을 때만 성공 (공표 전에 교체·retire된 노드는 거부)
+ *  - index는 Guard 안에서의 번호 (리스트 순회처럼 동시에 여러 노드를 잡을 때 0, 1, ...)
+ *    실제 슬롯은 처음 쓸 때 기록의 빈 슬롯을 배정 → 중첩 Guard(콜백 안에서 다시 notify)도 안전
+ *  - retire 목록이 max(RETIRE_BATCH, 2 × 전체 슬롯 수)에 닿으면 scan:
+ *    모든 슬롯을 모아 정렬 → 목록에서 어느 슬롯에도 없는 노드만 해제
+ *    → scan 한 번에 적어도 절반은 해제됨 (상각 O(1))
+ *  - 한 스레드가 동시에 보호할 수 있는 포인터는 SLOTS개 (넘으면 length_error)
+ */
+class HazardDomain {
+public:
+    static constexpr size_t SLOTS = 8;
+    static constexpr size_t RETIRE_BATCH = 64;
+
+private:
+    struct alignas(64) Record {
+        std::array<std::atomic<void*>, SLOTS> hazards{};
+        std::atomic<bool> inUse{false};
+        uint32_t busy = 0;                  // Guard에 배정된 슬롯 (주인 스레드만 접근)
+        std::vector<Retired> retired;
+        std::vector<void*> scratch;         // scan용 버퍼 재사용
+    };
+
+    detail::RecordRegistry<Record> records;
+    std::atomic<size_t> pendingCount{0};
+    std::atomic<size_t> reclaimedCount{0};
+
+    size_t threshold() const { return std::max(RETIRE_BATCH, 2 * SLOTS * records.size()); }
+
+    void scan(Record& r) {
+        if (r.retired.empty()) return;
+        r.scratch.clear();
+        records.forEach([&](Record& other) {
+            for (auto& h : other.hazards) {
+                if (void* p = h.load(std::memory_order_seq_cst)) r.scratch.push_back(p);
+            }
+        });
+        std::sort(r.scratch.begin(), r.scratch.end());
+        size_t kept = 0;
+        for (Retired& item : r.retired) {
+            if (std::binary_search(r.scratch.begin(), r.scratch.end(), item.ptr)) r.retired[kept++] = item;
+            else item.deleter(item.ptr);
+        }
+        const size_t freed = r.retired.size() - kept;
+        r.retired.resize(kept);
+        pendingCount.fetch_sub(freed, std::memory_order_relaxed);
+        reclaimedCount.fetch_add(freed, std::memory_order_relaxed);
+    }
+
+public:
+    class Guard {
+        static constexpr uint8_t UNASSIGNED = 0xFF;
+        Record& record;
+        std::array<uint8_t, SLOTS> slots;   // Guard 안 번호 → 기록의 슬롯
+
+        std::atomic<void*>& hazard(size_t index) {
+            if (index >= SLOTS) throw std::length_error("hazard index out of range");
+            if (slots[index] == UNASSIGNED) {
+                const uint32_t free = ~record.busy & ((1u << SLOTS) - 1);
+                if (free == 0) throw std::length_error("hazard slots exhausted");
+                const uint8_t slot = static_cast<uint8_t>(std::countr_zero(free));
+                record.busy |= 1u << slot;
+                slots[index] = slot;
+            }
+            return record.hazards[slots[index]];
+        }
+
+    public:
+        explicit Guard(HazardDomain& domain) : record(domain.records.local()) { slots.fill(UNASSIGNED); }
+        ~Guard() {
+            for (uint8_t slot : slots) {
+                if (slot == UNASSIGNED) continue;
+                record.hazards[slot].store(nullptr, std::memory_order_release);
+                record.busy &= ~(1u << slot);
+            }
+        }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        template<typename T>
+        T* protect(const std::atomic<T*>& source, size_t index = 0) {
+            std::atomic<void*>& h = hazard(index);
+            T* p = source.load(std::memory_order_relaxed);
+            for (;;) {
+                h.store(const_cast<void*>(static_cast<const void*>(p)), std::memory_order_seq_cst);
+                T* again = source.load(std::memory_order_seq_cst);
+                if (again == p) return p;
+                p = again;
+            }
+        }
+
+        // 보호를 Guard보다 일찍 해제 (리스트 순회에서 다음 노드로 넘어갈 때), 슬롯은 유지
+        void reset(size_t index = 0) {
+            if (index < SLOTS && slots[index] != UNASSIGNED) {
+                record.hazards[slots[index]].store(nullptr, std::memory_order_release);
+            }
+        }
+    };
+
+    HazardDomain() = default;
+    HazardDomain(const HazardDomain&) = delete;
+    HazardDomain& operator=(const HazardDomain&) = delete;
+
+    // 소멸 시점에는 Guard를 가진 스레드가 없어야 함
+    ~HazardDomain() {
+        records.forEach([](Record& r) {
+            for (Retired& item : r.retired) item.deleter(item.ptr);
+            r.retired.clear();
+        });
+    }
+
+    static HazardDomain& global() {
+        static HazardDomain domain;
+        return domain;
+    }
+
+    template<typename T>
+    void retire(T* node) {
+        retire(const_cast<void*>(static_cast<const void*>(node)), &deleteAs<T>);
+    }
+
+    void retire(void* node, void (*deleter)(void*)) {
+        Record& r = records.local();
+        r.retired.push_back({node, deleter, 0});
+        pendingCount.fetch_add(1, std::memory_order_relaxed);
+        if (r.retired.size() >= threshold()) scan(r);
+    }
+
+    void collect() {
+        scan(records.local());
+        records.adoptOrphans([this](Record& r) { scan(r); });
+    }
+
+    size_t pending() const { return pendingCount.load(std::memory_order_relaxed); }
+    size_t reclaimed() const { return reclaimedCount.load(std::memory_order_relaxed); }
+};
+
+// 두 도메인이 공유하는 API - 자료구조는 Domain 템플릿 인자로 회수 방식을 고를 수 있음
+template<typename D>
+concept ReclamationDomain = requires(D& domain, typename D::Guard& guard, const std::atomic<int*>& source, int* node) {
+    typename D::Guard;
+    requires std::constructible_from<typename D::Guard, D&>;
+    { guard.protect(source) } -> std::same_as<int*>;
+    domain.retire(node);
+    domain.collect();
+    { domain.pending() } -> std::convertible_to<size_t>;
+};
+
+static_assert(ReclamationDomain<EpochDomain>);
+static_assert(ReclamationDomain<HazardDomain>);
+
+}  // namespace reclaim
+
+#endif
@@ -2,7 +2,7 @@
 echo 단일 파일 컴파일 테스트...
 echo.
 
-g++ -std=c++17 -o test.exe 00_function_pointer_basics.cpp -Wall 2> error.txt
+g++ -std=c++20 -o test.exe 00_function_pointer_basics.cpp -Wall 2> error.txt
 
 if exist error.txt (
     echo === 컴파일 에러 ===
@@ -0,0 +1,443 @@
+/*
+ * CPU / 캐시 / NUMA 토폴로지 + 배치(affinity, node-local 메모리) header-only 모듈
+ *
+ *   const topology::Topology& topo = topology::system();    // 첫 호출 때 sysfs를 한 번 읽고 캐시
+ *   topo.nodeOf(cpu);  topo.cpusOf(node);  topo.cachesOf(cpu);
+ *   topology::pinCurrentThread(cpu);        // 또는 pinCurrentThreadToNode(node)
+ *   topology::NodeMemory mem(bytes, node);  // node에 묶인 anonymous 매핑 (RAII, 직접 관리는 mapOnNode / unmapNode)
+ *   auto ring = topology::makeOnNode<SpscRingBuffer<int, 1024>>(node);     // 객체 하나를 node 메모리에
+ *
+ *  - 발견: /sys/devices/system/cpu/cpuN/topology (core_id, physical_package_id)
+ *          /sys/devices/system/cpu/cpuN/cache/indexK (level, type, size, shared_cpu_list)
+ *          /sys/devices/system/node/nodeN/cpulist
+ *    읽을 수 없으면 (비 Linux, sysfs 없는 컨테이너) hardware_concurrency()개 CPU, node 하나로 간주
+ *  - node-local 할당 순서
+ *      1) mbind(MPOL_BIND) - libnuma 없이 syscall 직접 호출, 매핑 직후 페이지를 만지기 전에 정책 설정
+ *      2) 실패하면 (seccomp / EPERM / 커널 미지원) first-touch:
+ *         잠깐 그 node의 CPU로 스레드를 옮겨 페이지를 처음 씀 → 커널이 그 node에 페이지 배치, 원래 affinity 복구
+ *    어느 쪽이든 페이지를 미리 채움 (첫 사용 스레드가 어디서 돌든 위치가 바뀌지 않게)
+ *  - node가 하나뿐이면 정책 없이 일반 매핑 (Binding::None), 결과는 같고 비용만 없음
+ *  - addressNode(p): get_mempolicy(MPOL_F_NODE | MPOL_F_ADDR)로 페이지가 실제로 있는 node 확인 (벤치마크 검증용)
+ */
+#ifndef CODING_SKILL_TOPOLOGY_H
+#define CODING_SKILL_TOPOLOGY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace topology {
+
+struct CpuInfo {
+    unsigned cpu;
+    unsigned core;          // 패키지 안의 물리 코어 번호 (SMT 형제는 같은 값)
+    unsigned package;       // 소켓
+    unsigned node;          // NUMA node
+};
+
+struct CacheInfo {
+    unsigned level;
+    std::string type;       // Data / Instruction / Unified
+    size_t bytes;
+    std::vector<unsigned> cpus;     // 이 캐시를 공유하는 CPU
+};
+
+struct NodeInfo {
+    unsigned id;
+    std::vector<unsigned> cpus;
+};
+
+namespace detail {
+
+inline bool readLine(const std::string& path, std::string& out) {
+    std::ifstream in(path);
+    return static_cast<bool>(std::getline(in, out));
+}
+
+inline bool readUnsigned(const std::string& path, unsigned& out) {
+    std::string line;
+    if (!readLine(path, line) || line.empty()) return false;
+    out = static_cast<unsigned>(std::stoul(line));
+    return true;
+}
+
+// "0-3,8,10-11" → {0,1,2,3,8,10,11}
+inline std::vector<unsigned> parseCpuList(const std::string& list) {
+    std::vector<unsigned> cpus;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t end = list.find(',', pos);
+        if (end == std::string::npos) end = list.size();
+        const std::string part = list.substr(pos, end - pos);
+        if (!part.empty() && part[0] >= '0' && part[0] <= '9') {
+            const size_t dash = part.find('-');
+            const unsigned first = static_cast<unsigned>(std::stoul(part.substr(0, dash)));
+            const unsigned last = dash == std::string::npos ? first : static_cast<unsigned>(std::stoul(part.substr(dash + 1)));
+            for (unsigned c = first; c <= last; ++c) cpus.push_back(c);
+        }
+        pos = end + 1;
+    }
+    return cpus;
+}
+
+// "32K" / "1024K" / "36M" → 바이트
+inline size_t parseSize(const std::string& text) {
+    if (text.empty()) return 0;
+    size_t value = std::stoul(text);
+    switch (text.back()) {
+    case 'K': return value << 10;
+    case 'M': return value << 20;
+    case 'G': return value << 30;
+    default: return value;
+    }
+}
+
+#ifdef __linux__
+// <numaif.h>(libnuma-dev)의 상수와 같은 값
+inline constexpr int MPOL_BIND_MODE = 2;
+inline constexpr unsigned long MPOL_F_NODE_FLAG = 1ul << 0;
+inline constexpr unsigned long MPOL_F_ADDR_FLAG = 1ul << 1;
+inline constexpr unsigned long MAX_NODES = 1024;
+
+inline bool mbindToNode(void* addr, size_t bytes, unsigned node) {
+    if (node >= MAX_NODES) return false;        // nodemask 밖 → 호출자는 first-touch로 대체
+    unsigned long mask[MAX_NODES / (8 * sizeof(unsigned long))] = {};
+    mask[node / (8 * sizeof(unsigned long))] |= 1ul << (node % (8 * sizeof(unsigned long)));
+    return syscall(SYS_mbind, addr, bytes, MPOL_BIND_MODE, mask, MAX_NODES, 0u) == 0;
+}
+#endif
+
+} // namespace detail
+
+class Topology {
+    std::vector<CpuInfo> cpuList;
+    std::vector<CacheInfo> cacheList;
+    std::vector<NodeInfo> nodeList;
+    std::vector<unsigned> nodeByCpu;        // cpu 번호 → node (빈 번호는 0)
+
+public:
+    // root: sysfs 시스템 디렉터리 (다른 머신에서 떠 온 트리를 분석할 때 바꿈)
+    static Topology discover(const std::string& root = "/sys/devices/system") {
+        Topology topo;
+        std::string line;
+        std::vector<unsigned> online;
+        if (detail::readLine(root + "/cpu/online", line)) online = detail::parseCpuList(line);
+        if (online.empty()) {
+            for (unsigned c = 0; c < std::max(1u, std::thread::hardware_concurrency()); ++c) online.push_back(c);
+        }
+
+        // node별 CPU 목록 (node 디렉터리가 없으면 node 0 하나)
+        const unsigned maxCpu = *std::max_element(online.begin(), online.end());
+        topo.nodeByCpu.assign(maxCpu + 1, 0);
+        std::vector<unsigned> nodeIds;
+        if (detail::readLine(root + "/node/online", line)) nodeIds = detail::parseCpuList(line);
+        for (unsigned node : nodeIds) {
+            if (!detail::readLine(root + "/node/node" + std::to_string(node) + "/cpulist", line)) continue;
+            NodeInfo info{node, {}};
+            for (unsigned c : detail::parseCpuList(line)) {
+                if (c > maxCpu || std::find(online.begin(), online.end(), c) == online.end()) continue;
+                info.cpus.push_back(c);
+                topo.nodeByCpu[c] = node;
+            }
+            if (!info.cpus.empty()) topo.nodeList.push_back(std::move(info));
+        }
+        if (topo.nodeList.empty()) topo.nodeList.push_back({0, online});
+
+        for (unsigned c : online) {
+            const std::string base = root + "/cpu/cpu" + std::to_string(c);
+            CpuInfo info{c, c, 0, topo.nodeByCpu[c]};
+            detail::readUnsigned(base + "/topology/core_id", info.core);
+            detail::readUnsigned(base + "/topology/physical_package_id", info.package);
+            topo.cpuList.push_back(info);
+
+            // 캐시: 같은 (level, type, 공유 CPU 집합)은 한 번만
+            for (unsigned index = 0;; ++index) {
+                const std::string cacheBase = base + "/cache/index" + std::to_string(index);
+                CacheInfo cache{0, {}, 0, {}};
+                if (!detail::readUnsigned(cacheBase + "/level", cache.level)) break;
+                detail::readLine(cacheBase + "/type", cache.type);
+                if (detail::readLine(cacheBase + "/size", line)) cache.bytes = detail::parseSize(line);
+                if (detail::readLine(cacheBase + "/shared_cpu_list", line)) cache.cpus = detail::parseCpuList(line);
+                if (cache.cpus.empty()) cache.cpus.push_back(c);
+                auto same = [&cache](const CacheInfo& other) {
+                    return other.level == cache.level && other.type == cache.type && other.cpus == cache.cpus;
+                };
+                if (std::none_of(topo.cacheList.begin(), topo.cacheList.end(), same))
+                    topo.cacheList.push_back(std::move(cache));
+            }
+        }
+        return topo;
+    }
+
+    const std::vector<CpuInfo>& cpus() const { return cpuList; }
+    const std::vector<CacheInfo>& caches() const { return cacheList; }
+    const std::vector<NodeInfo>& nodes() const { return nodeList; }
+    size_t nodeCount() const { return nodeList.size(); }
+    size_t packageCount() const {
+        std::vector<unsigned> packages;
+        for (const CpuInfo& c : cpuList)
+            if (std::find(packages.begin(), packages.end(), c.package) == packages.end()) packages.push_back(c.package);
+        return packages.size();
+    }
+
+    unsigned nodeOf(unsigned cpu) const { return cpu < nodeByCpu.size() ? nodeByCpu[cpu] : 0; }
+
+    const std::vector<unsigned>& cpusOf(unsigned node) const {
+        for (const NodeInfo& n : nodeList)
+            if (n.id == node) return n.cpus;
+        return nodeList.front().cpus;
+    }
+
+    std::vector<const CacheInfo*> cachesOf(unsigned cpu) const {
+        std::vector<const CacheInfo*> result;
+        for (const CacheInfo& c : cacheList)
+            if (std::find(c.cpus.begin(), c.cpus.end(), cpu) != c.cpus.end()) result.push_back(&c);
+        return result;
+    }
+
+    // 워커 배치 순서: node별로 모으고, node 안에서는 물리 코어를 먼저 채운 뒤 SMT 형제
+    //  → 워커 i, i+1이 같은 node(가능하면 다른 물리 코어)에 놓임
+    std::vector<unsigned> compactOrder() const {
+        std::vector<unsigned> order;
+        for (const NodeInfo& node : nodeList) {
+            std::vector<const CpuInfo*> members;
+            for (const CpuInfo& c : cpuList)
+                if (c.node == node.id) members.push_back(&c);
+            std::vector<std::pair<unsigned, unsigned>> seenCores;      // (package, core)
+            std::vector<unsigned> siblings;
+            for (const CpuInfo* c : members) {
+                const std::pair<unsigned, unsigned> key{c->package, c->core};
+                if (std::find(seenCores.begin(), seenCores.end(), key) == seenCores.end()) {
+                    seenCores.push_back(key);
+                    order.push_back(c->cpu);
+                } else {
+                    siblings.push_back(c->cpu);
+                }
+            }
+            order.insert(order.end(), siblings.begin(), siblings.end());
+        }
+        return order;
+    }
+};
+
+inline const Topology& system() {
+    static const Topology topo = Topology::discover();
+    return topo;
+}
+
+// 지금 실행 중인 CPU / node (알 수 없으면 0)
+inline unsigned currentCpu() {
+#ifdef __linux__
+    int cpu = sched_getcpu();
+    return cpu < 0 ? 0 : static_cast<unsigned>(cpu);
+#else
+    return 0;
+#endif
+}
+
+inline unsigned currentNode() { return system().nodeOf(currentCpu()); }
+
+#ifdef __linux__
+// 할당 없음 (전역 operator new를 교체한 데모에서도 카운트에 안 잡힘)
+inline bool setAffinity(pthread_t thread, std::span<const unsigned> cpus) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (unsigned c : cpus) CPU_SET(c, &set);
+    return pthread_setaffinity_np(thread, sizeof(set), &set) == 0;
+}
+#endif
+
+// 성공하면 true (비 Linux는 항상 false → 호출자는 배치 없이 계속)
+inline bool pinThread(std::thread& t, unsigned cpu) {
+#ifdef __linux__
+    return setAffinity(t.native_handle(), std::span<const unsigned>(&cpu, 1));
+#else
+    (void)t; (void)cpu;
+    return false;
+#endif
+}
+
+inline bool pinCurrentThread(unsigned cpu) {
+#ifdef __linux__
+    return setAffinity(pthread_self(), std::span<const unsigned>(&cpu, 1));
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+// node 안에서는 스케줄러가 자유롭게 옮기도록 CPU 집합 전체에 고정
+inline bool pinCurrentThreadToNode(unsigned node) {
+#ifdef __linux__
+    return setAffinity(pthread_self(), system().cpusOf(node));
+#else
+    (void)node;
+    return false;
+#endif
+}
+
+// 페이지가 실제로 있는 node (확인할 수 없으면 -1)
+inline int addressNode(const void* p) {
+#ifdef __linux__
+    int node = -1;
+    if (syscall(SYS_get_mempolicy, &node, nullptr, 0ul, const_cast<void*>(p),
+                detail::MPOL_F_NODE_FLAG | detail::MPOL_F_ADDR_FLAG) != 0)
+        return -1;
+    return node;
+#else
+    (void)p;
+    return -1;
+#endif
+}
+
+enum class Binding {
+    None,           // node 하나뿐이거나 배치 불가 → 일반 할당
+    Mbind,          // MPOL_BIND 정책
+    FirstTouch      // node CPU에서 처음 써서 배치
+};
+
+inline const char* bindingName(Binding b) {
+    switch (b) {
+    case Binding::Mbind: return "mbind";
+    case Binding::FirstTouch: return "first-touch";
+    default: return "none";
+    }
+}
+
+namespace detail {
+
+inline size_t pageSize() {
+#ifdef __linux__
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 4096;
+#endif
+}
+
+#ifdef __linux__
+// 현재 스레드를 node CPU로 잠깐 옮겨서 페이지를 처음 씀
+inline bool touchFrom(unsigned node, void* p, size_t bytes) {
+    cpu_set_t previous;
+    if (pthread_getaffinity_np(pthread_self(), sizeof(previous), &previous) != 0) return false;
+    if (!pinCurrentThreadToNode(node)) return false;
+    std::memset(p, 0, bytes);
+    pthread_setaffinity_np(pthread_self(), sizeof(previous), &previous);
+    return true;
+}
+#endif
+
+} // namespace detail
+
+// node에 배치된 페이지 단위 매핑 (크기는 페이지 배수로 올림, 내용은 0)
+struct NodeMapping {
+    void* data;
+    size_t bytes;
+    Binding binding;
+};
+
+// 실패하면 bad_alloc, 해제는 unmapNode(data, bytes)
+//  - Linux가 아니면 aligned operator new (Binding::None)
+inline NodeMapping mapOnNode(size_t bytes, unsigned node) {
+    const size_t page = detail::pageSize();
+    NodeMapping m{nullptr, std::max(page, (bytes + page - 1) / page * page), Binding::None};
+#ifdef __linux__
+    m.data = mmap(nullptr, m.bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (m.data == MAP_FAILED) throw std::bad_alloc();
+    if (system().nodeCount() > 1) {
+        if (detail::mbindToNode(m.data, m.bytes, node)) m.binding = Binding::Mbind;
+        else if (detail::touchFrom(node, m.data, m.bytes)) m.binding = Binding::FirstTouch;
+    }
+    if (m.binding != Binding::FirstTouch) std::memset(m.data, 0, m.bytes);     // 정책대로 지금 배치
+#else
+    (void)node;
+    m.data = ::operator new(m.bytes, std::align_val_t{4096});
+    std::memset(m.data, 0, m.bytes);
+#endif
+    return m;
+}
+
+inline void unmapNode(void* p, size_t bytes) {
+    if (!p) return;
+#ifdef __linux__
+    munmap(p, bytes);
+#else
+    (void)bytes;
+    ::operator delete(p, std::align_val_t{4096});
+#endif
+}
+
+// NodeMapping의 move-only RAII 소유자
+class NodeMemory {
+    NodeMapping mapping{nullptr, 0, Binding::None};
+    unsigned homeNode = 0;
+
+public:
+    NodeMemory() = default;
+    NodeMemory(size_t bytes, unsigned node) : mapping(mapOnNode(bytes, node)), homeNode(node) {}
+    ~NodeMemory() { unmapNode(mapping.data, mapping.bytes); }
+
+    NodeMemory(NodeMemory&& other) noexcept
+        : mapping(std::exchange(other.mapping, NodeMapping{nullptr, 0, Binding::None})), homeNode(other.homeNode) {}
+    NodeMemory& operator=(NodeMemory&& other) noexcept {
+        if (this != &other) {
+            unmapNode(mapping.data, mapping.bytes);
+            mapping = std::exchange(other.mapping, NodeMapping{nullptr, 0, Binding::None});
+            homeNode = other.homeNode;
+        }
+        return *this;
+    }
+    NodeMemory(const NodeMemory&) = delete;
+    NodeMemory& operator=(const NodeMemory&) = delete;
+
+    void* data() const { return mapping.data; }
+    size_t size() const { return mapping.bytes; }
+    unsigned node() const { return homeNode; }
+    Binding binding() const { return mapping.binding; }
+};
+
+// makeOnNode가 돌려주는 unique_ptr의 deleter: 소멸자 호출 + 매핑 해제
+template<typename T>
+struct NodeDelete {
+    size_t bytes = 0;
+    void operator()(T* p) const {
+        p->~T();
+        unmapNode(p, bytes);
+    }
+};
+
+template<typename T>
+using NodeUnique = std::unique_ptr<T, NodeDelete<T>>;
+
+// 큰 고정 크기 객체 하나를 node 메모리에 생성 (RingBuffer처럼 저장 공간을 멤버 배열로 가진 타입)
+template<typename T, typename... Args>
+NodeUnique<T> makeOnNode(unsigned node, Args&&... args) {
+    static_assert(alignof(T) <= 4096, "over page-aligned type");
+    NodeMapping mapping = mapOnNode(sizeof(T), node);
+    try {
+        T* object = new (mapping.data) T(std::forward<Args>(args)...);
+        return NodeUnique<T>(object, NodeDelete<T>{mapping.bytes});
+    } catch (...) {
+        unmapNode(mapping.data, mapping.bytes);
+        throw;
+    }
+}
+
+} // namespace topology
+
+#endif // CODING_SKILL_TOPOLOGY_H
@@ -6,6 +6,7 @@ BLDC 모터 시뮬레이션 및 자동 파라미터 최적화
   2. FOC (Field Oriented Control) 제어 시뮬레이션
   3. 정상상태 분석으로 필요 전압/파라미터 자동 계산
   4. scipy.optimize를 이용한 PID 게인 자동 튜닝
+     (dc_native 빌드 시 C++ 커널로 세대 전체를 한 번에 평가: make -C dc_native)
   5. 3상 전류 및 토크 리플 시각화
 
 BLDC vs DC 모터 차이점:
@@ -19,6 +20,11 @@ import matplotlib.pyplot as plt
 from scipy.integrate import solve_ivp
 from scipy.optimize import minimize, differential_evolution
 
+try:
+    import dc_native  # C++ RK4 커널 (SIMD 레인 + 멀티코어), 없으면 scipy 경로 사용
+except ImportError:
+    dc_native = None
+
 # =============================================================================
 # 1. BLDC 모터 파라미터 (예시)
 # =============================================================================
@@ -189,6 +195,23 @@ def cost_function(gains, target_speed, V_max, params):
     except:
         return 1e6
 
+def cost_function_batch(population, target_speed, V_max, params):
+    """
+    cost_function의 네이티브 배치 버전 (differential_evolution vectorized=True용)
+      population: shape (2, S) - 열 하나가 후보 [kp, ki]
+      반환: shape (S,) 비용 (같은 지표/가중치, 적분기만 고정 간격 RK4)
+    """
+    gains = np.asarray(population).T
+    costs = dc_native.evaluate(gains, params, target_speed, V_max, t_end=0.3, fs=1000)
+    
+    # 매 10회마다 진행 상황 출력 (cost_function과 같은 카운터)
+    for (kp, ki), cost in zip(gains, costs):
+        eval_counter[0] += 1
+        if eval_counter[0] % 10 == 0:
+            print(f"    Eval #{eval_counter[0]:4d}: Kp={kp:.3f}, Ki={ki:.1f}, Cost={cost:.1f}")
+    
+    return costs
+
 def auto_tune_pid(target_speed, V_max, params):
     """PID 게인 자동 튜닝 (Differential Evolution)"""
     print("  Searching for optimal gains...")
@@ -196,18 +219,30 @@ def auto_tune_pid(target_speed, V_max, params):
     bounds = [(0.01, 10), (1, 500)]  # kp, ki 범위
     iteration_count = [0]  # 리스트로 감싸서 클로저에서 수정 가능하게
     
+    if dc_native is not None:
+        # 세대 전체를 한 번의 네이티브 호출로 평가 (vectorized는 deferred 갱신 필요)
+        print(f"  Objective: native C++ kernel (RK4, {dc_native.LANES} SIMD lanes, multi-core)")
+        objective = cost_function_batch
+        single_cost = lambda x: cost_function_batch(np.reshape(x, (2, 1)), target_speed, V_max, params)[0]
+        native_options = dict(vectorized=True, updating='deferred')
+    else:
+        print("  Objective: scipy solve_ivp (build dc_native for the native kernel)")
+        objective = cost_function
+        single_cost = lambda x: cost_function(x, target_speed, V_max, params)
+        native_options = {}
+    
     def callback(xk, convergence):
         iteration_count[0] += 1
         kp, ki = xk
-        cost = cost_function(xk, target_speed, V_max, params)
+        cost = single_cost(xk)
         print(f"    Iter {iteration_count[0]:3d}: Kp={kp:.4f}, Ki={ki:.4f}, Cost={cost:.2f}, Conv={convergence:.4f}")
         return False  # False를 반환하면 계속 진행
     
     result = differential_evolution(
-        cost_function, bounds,
+        objective, bounds,
         args=(target_speed, V_max, params),
         maxiter=50, popsize=10, seed=42, workers=1,
-        disp=False, callback=callback
+        disp=False, callback=callback, **native_options
     )
     
     return result.x[0], result.x[1], result.fun
@@ -258,6 +293,10 @@ if __name__ == "__main__":
     print(f"  Optimal Kp: {kp_opt:.4f}")
     print(f"  Optimal Ki: {ki_opt:.4f}")
     print(f"  Cost Function: {cost:.4f}")
+    if dc_native is not None:
+        # 네이티브 비용과 scipy 경로 비용 비교 (적분기 차이 확인용, 평가 1회)
+        reference = cost_function([kp_opt, ki_opt], target_speed, V_max, params)
+        print(f"  Cost (scipy solve_ivp check): {reference:.4f}")
     
     # Step 4: 최적 파라미터로 시뮬레이션
     print("\n[Step 4] Running Simulation with Optimal Parameters")
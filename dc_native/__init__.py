@@ -0,0 +1,76 @@
+"""
+BLDC FOC 시뮬레이션 네이티브 커널 - ctypes 바인딩
+===============================================
+dc.py의 simulate_motor / cost_function과 같은 모델을 C++ (bldc_sim.h)로 계산합니다.
+  - 고정 간격 RK4 (제어 주기당 substeps번), 후보 8개씩 SIMD 레인으로 함께 적분
+  - 후보 묶음을 CPU 코어에 나눠 병렬 평가
+
+빌드:
+  make -C dc_native        # libbldc_sim.so (없으면 import 시 ImportError)
+
+사용:
+  import dc_native
+  costs = dc_native.evaluate(gains, params, target_speed, V_max)    # gains: (S, 2) [kp, ki]
+  history = dc_native.simulate(kp, ki, target_speed, V_max, params)  # simulate_motor와 같은 9열
+"""
+import ctypes
+import os
+
+import numpy as np
+
+_LIB_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'libbldc_sim.so')
+
+try:
+    _lib = ctypes.CDLL(_LIB_PATH)
+except OSError as e:
+    raise ImportError(f"{_LIB_PATH} not built - run 'make -C dc_native' ({e})") from e
+
+_double_p = ctypes.POINTER(ctypes.c_double)
+
+_lib.bldc_evaluate.argtypes = [_double_p, ctypes.c_size_t, ctypes.c_double, ctypes.c_double, ctypes.c_double,
+                               ctypes.c_double, ctypes.c_uint, ctypes.c_uint, _double_p]
+_lib.bldc_evaluate.restype = ctypes.c_int
+_lib.bldc_simulate.argtypes = [_double_p, ctypes.c_double, ctypes.c_double, ctypes.c_double, ctypes.c_double,
+                               ctypes.c_uint, _double_p]
+_lib.bldc_simulate.restype = ctypes.c_int
+_lib.bldc_step_count.argtypes = [ctypes.c_double, ctypes.c_double]
+_lib.bldc_step_count.restype = ctypes.c_size_t
+_lib.bldc_lanes.argtypes = []
+_lib.bldc_lanes.restype = ctypes.c_size_t
+
+LANES = _lib.bldc_lanes()     # SIMD 묶음 크기 - 후보 수를 이 배수로 맞추면 빈 레인이 없음
+
+
+def _candidates(gains, params):
+    """(S, 2) 게인 + (7,) 또는 (S, 7) 모터 파라미터 → C 레이아웃 (S, 9) [kp, ki, Rs, Ls, J, B, Kt, Ke, P]"""
+    gains = np.atleast_2d(np.asarray(gains, dtype=np.float64))
+    motors = np.broadcast_to(np.asarray(params, dtype=np.float64), (gains.shape[0], 7))
+    return np.ascontiguousarray(np.hstack([gains, motors]))
+
+
+def _check(status, name):
+    if status != 0:
+        raise ValueError(f"{name} failed (status {status})")
+
+
+def evaluate(gains, params, target_speed, V_max, t_end=0.3, fs=1000, substeps=4, threads=0):
+    """
+    후보 S개의 비용 (dc.py cost_function과 같은 식) → shape (S,)
+      gains:   (S, 2) [kp, ki]
+      params:  (Rs, Ls, J, B, Kt, Ke, P) 하나 또는 후보별 (S, 7)
+      threads: 0이면 모든 코어 (후보가 적으면 호출 스레드 하나로 계산)
+    """
+    rows = _candidates(gains, params)
+    costs = np.empty(rows.shape[0])
+    _check(_lib.bldc_evaluate(rows.ctypes.data_as(_double_p), rows.shape[0], target_speed, V_max, t_end, fs,
+                              substeps, threads, costs.ctypes.data_as(_double_p)), 'bldc_evaluate')
+    return costs
+
+
+def simulate(kp, ki, target_speed, V_max, params, t_end=0.5, fs=10000, substeps=4):
+    """simulate_motor와 같은 궤적 → shape (steps, 9) [t, iq, omega_m, Vq, ia, ib, ic, Te, theta_e]"""
+    row = _candidates([kp, ki], params)
+    history = np.empty((_lib.bldc_step_count(t_end, fs), 9))
+    _check(_lib.bldc_simulate(row.ctypes.data_as(_double_p), target_speed, V_max, t_end, fs, substeps,
+                              history.ctypes.data_as(_double_p)), 'bldc_simulate')
+    return history
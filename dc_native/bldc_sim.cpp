@@ -0,0 +1,48 @@
+/*
+ * bldc_sim.h의 C ABI (ctypes에서 호출, dc_native/__init__.py 참고)
+ *  - candidates: count × 9 행 우선 배열 (kp, ki, Rs, Ls, J, B, Kt, Ke, P)
+ *  - 반환: 0 성공, -1 잘못된 인자, -2 내부 오류 (스레드 생성 실패 등) - 예외는 경계를 넘기지 않음
+ */
+#include "bldc_sim.h"
+
+#include <exception>
+
+namespace {
+
+bool validConfig(const bldc::Config& cfg) {
+    return cfg.fs > 0 && cfg.tEnd > 0 && cfg.vMax >= 0 && cfg.targetSpeed != 0 && cfg.substeps > 0;
+}
+
+}  // namespace
+
+extern "C" {
+
+int bldc_evaluate(const double* candidates, size_t count, double target_speed, double v_max, double t_end, double fs,
+                  unsigned substeps, unsigned threads, double* costs) {
+    const bldc::Config cfg{target_speed, v_max, t_end, fs, substeps};
+    if ((count && (!candidates || !costs)) || !validConfig(cfg)) return -1;
+    try {
+        bldc::evaluate(reinterpret_cast<const bldc::Candidate*>(candidates), count, cfg, costs, threads);
+        return 0;
+    } catch (const std::exception&) {
+        return -2;
+    }
+}
+
+// history는 bldc_step_count() × 9 크기
+int bldc_simulate(const double* candidate, double target_speed, double v_max, double t_end, double fs, unsigned substeps,
+                  double* history) {
+    const bldc::Config cfg{target_speed, v_max, t_end, fs, substeps};
+    if (!candidate || !history || !validConfig(cfg)) return -1;
+    bldc::simulate(*reinterpret_cast<const bldc::Candidate*>(candidate), cfg, history);
+    return 0;
+}
+
+size_t bldc_step_count(double t_end, double fs) {
+    if (fs <= 0 || t_end <= 0) return 0;
+    return bldc::stepCount(bldc::Config{0, 0, t_end, fs, 1});
+}
+
+size_t bldc_lanes() { return bldc::LANES; }
+
+}  // extern "C"
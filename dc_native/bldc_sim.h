@@ -0,0 +1,220 @@
+/*
+ * BLDC dq 모델 + FOC 속도 PI 제어 네이티브 시뮬레이션 커널 (dc.py의 simulate_motor / cost_function과 같은 모델)
+ *
+ *   bldc::Candidate c[n] = {{kp, ki, {Rs, Ls, J, B, Kt, Ke, P}}, ...};
+ *   bldc::evaluate(c, n, config, costs);            // 후보 n개의 비용 (dc.py cost_function과 같은 식)
+ *   bldc::simulate(c[0], config, history);          // 한 후보의 궤적 (simulate_motor와 같은 9열)
+ *
+ *  - 제어 주기 dt = 1/fs마다 PI 계산 → Vq 고정 → 고정 간격 RK4를 substeps번 (dc.py는 같은 구간을 RK45로 적분)
+ *  - 후보 LANES개를 레인 하나씩 맡아 SoA 배열로 함께 적분: 모델이 선형이고 clip / 정착 판정도 select라
+ *    레인 루프에 분기가 없음 → #pragma omp simd로 레인 루프를 SIMD 벡터화
+ *    (-fopenmp-simd: OpenMP 런타임 없이 pragma만 사용, AVX-512면 레지스터 1개 / AVX2면 2개 분량)
+ *  - 묶음(batch) 단위로 스레드에 나눠 병렬 평가, 작업량이 작으면 호출 스레드에서 바로 실행
+ */
+#ifndef DC_NATIVE_BLDC_SIM_H
+#define DC_NATIVE_BLDC_SIM_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace bldc {
+
+// 모터 파라미터 - dc.py params 튜플과 같은 순서
+struct Motor {
+    double Rs;      // 상 저항 [Ω]
+    double Ls;      // 상 인덕턴스 [H]
+    double J;       // 관성 모멘트 [kg·m²]
+    double B;       // 마찰 계수 [N·m·s/rad]
+    double Kt;      // 토크 상수 [N·m/A]
+    double Ke;      // 역기전력 상수 [V·s/rad]
+    double P;       // 극 쌍 수
+};
+
+// 평가 후보 하나 = 게인 + 모터 (double 9개, C API의 candidates 행 하나)
+struct Candidate {
+    double kp;
+    double ki;
+    Motor motor;
+};
+static_assert(sizeof(Candidate) == 9 * sizeof(double), "Candidate must match the 9-column C layout");
+
+struct Config {
+    double targetSpeed = 300.0;     // [rad/s]
+    double vMax = 24.0;             // Vq 한계 [V]
+    double tEnd = 0.3;              // [s]
+    double fs = 1000.0;             // 제어 주기 [Hz]
+    unsigned substeps = 4;          // 제어 주기당 RK4 단계 수
+};
+
+constexpr std::size_t LANES = 8;                // 한 묶음의 후보 수
+constexpr std::size_t HISTORY_COLUMNS = 9;      // t, iq, omega_m, Vq, ia, ib, ic, Te, theta_e
+constexpr std::size_t TAIL_SAMPLES = 50;        // 정상상태 오차 = 마지막 50 샘플 평균
+constexpr double SETTLING_BAND = 0.02;          // 정착 판정 ±2%
+constexpr double INVALID_COST = 1e6;            // 게인 <= 0 또는 발산
+
+// np.arange(0, tEnd, 1/fs)의 길이와 같게
+inline std::size_t stepCount(const Config& cfg) {
+    return static_cast<std::size_t>(std::ceil(cfg.tEnd / (1.0 / cfg.fs)));
+}
+
+namespace detail {
+
+// dq 모델을 미분 계수로 정리 (나눗셈은 후보마다 한 번)
+//   diq/dt = Vq/Ls - (Rs/Ls)·iq - (Ke·P/Ls)·ω
+//   dω/dt  = (1.5·P·Kt/J)·iq - (B/J)·ω
+struct Coefficients {
+    double invL, rOverL, emfOverL, torqueOverJ, bOverJ;
+};
+
+inline Coefficients coefficientsOf(const Motor& m) {
+    return {1.0 / m.Ls, m.Rs / m.Ls, m.Ke * m.P / m.Ls, 1.5 * m.P * m.Kt / m.J, m.B / m.J};
+}
+
+// RK4 한 단계 (Vq는 제어 주기 동안 고정) - 스칼라 함수, 레인 루프 안에서 인라인되어 벡터화됨
+inline void rk4Step(double& iq, double& w, double vq, double invL, double rOverL, double emfOverL,
+                    double torqueOverJ, double bOverJ, double h) {
+    const double drive = vq * invL;
+    auto di = [&](double i, double x) { return drive - rOverL * i - emfOverL * x; };
+    auto dw = [&](double i, double x) { return torqueOverJ * i - bOverJ * x; };
+    const double i1 = di(iq, w), w1 = dw(iq, w);
+    const double i2 = di(iq + 0.5 * h * i1, w + 0.5 * h * w1), w2 = dw(iq + 0.5 * h * i1, w + 0.5 * h * w1);
+    const double i3 = di(iq + 0.5 * h * i2, w + 0.5 * h * w2), w3 = dw(iq + 0.5 * h * i2, w + 0.5 * h * w2);
+    const double i4 = di(iq + h * i3, w + h * w3), w4 = dw(iq + h * i3, w + h * w3);
+    iq += h / 6.0 * (i1 + 2.0 * i2 + 2.0 * i3 + i4);
+    w += h / 6.0 * (w1 + 2.0 * w2 + 2.0 * w3 + w4);
+}
+
+// dc.py cost_function: 정상상태 오차*10 + 오버슈트[%]*0.5 + 정착시간*100
+inline double costOf(const Candidate& c, const Config& cfg, double tailMean, double peak, double settledStep) {
+    if (c.kp <= 0 || c.ki <= 0) return INVALID_COST;
+    const double steadyError = std::fabs(cfg.targetSpeed - tailMean);
+    const double overshoot = std::max(0.0, (peak - cfg.targetSpeed) / cfg.targetSpeed * 100.0);
+    const double settling = settledStep >= 0 ? settledStep * (1.0 / cfg.fs) : cfg.tEnd;     // 처음 ±2% 안에 든 샘플의 시각
+    const double cost = steadyError * 10.0 + overshoot * 0.5 + settling * 100.0;
+    return std::isfinite(cost) ? cost : INVALID_COST;
+}
+
+}  // namespace detail
+
+// 후보 count개 (1..LANES)를 한 묶음으로 평가 → costs[count]
+// 빈 레인은 마지막 후보를 복제해서 계산만 하고 버림 (레인 루프 길이를 상수로 유지)
+inline void evaluateBatch(const Candidate* candidates, std::size_t count, const Config& cfg, double* costs) {
+    constexpr std::size_t W = LANES;
+    alignas(64) double kp[W], ki[W], invL[W], rOverL[W], emfOverL[W], torqueOverJ[W], bOverJ[W];
+    alignas(64) double iq[W], w[W], integral[W], vq[W], peak[W], settledStep[W], tailSum[W];
+
+    for (std::size_t l = 0; l < W; ++l) {
+        const Candidate& c = candidates[std::min(l, count - 1)];
+        const detail::Coefficients k = detail::coefficientsOf(c.motor);
+        kp[l] = c.kp;
+        ki[l] = c.ki;
+        invL[l] = k.invL;
+        rOverL[l] = k.rOverL;
+        emfOverL[l] = k.emfOverL;
+        torqueOverJ[l] = k.torqueOverJ;
+        bOverJ[l] = k.bOverJ;
+        iq[l] = w[l] = integral[l] = tailSum[l] = 0.0;
+        peak[l] = -HUGE_VAL;
+        settledStep[l] = -1.0;
+    }
+
+    const double dt = 1.0 / cfg.fs, h = dt / cfg.substeps;
+    const double target = cfg.targetSpeed, tolerance = SETTLING_BAND * target, vMax = cfg.vMax;
+    const std::size_t steps = stepCount(cfg);
+    const std::size_t tailFrom = steps - std::min(steps, TAIL_SAMPLES);
+
+    for (std::size_t n = 0; n < steps; ++n) {
+        // Controller: PI 속도 제어 → Vq (np.clip과 같은 포화)
+#pragma omp simd
+        for (std::size_t l = 0; l < W; ++l) {
+            const double error = target - w[l];
+            integral[l] += error * dt;
+            vq[l] = std::min(std::max(kp[l] * error + ki[l] * integral[l], -vMax), vMax);
+        }
+        // Plant: 고정 간격 RK4
+        for (unsigned s = 0; s < cfg.substeps; ++s) {
+#pragma omp simd
+            for (std::size_t l = 0; l < W; ++l) {
+                detail::rk4Step(iq[l], w[l], vq[l], invL[l], rOverL[l], emfOverL[l], torqueOverJ[l], bOverJ[l], h);
+            }
+        }
+        // 지표: 최고 속도, 첫 정착 샘플, 마지막 구간 합
+        const double step = static_cast<double>(n);
+        const double tailWeight = n >= tailFrom ? 1.0 : 0.0;
+#pragma omp simd
+        for (std::size_t l = 0; l < W; ++l) {
+            peak[l] = std::max(peak[l], w[l]);
+            const bool first = settledStep[l] < 0 && std::fabs(w[l] - target) < tolerance;
+            settledStep[l] = first ? step : settledStep[l];
+            tailSum[l] += tailWeight * w[l];
+        }
+    }
+
+    const double tailCount = static_cast<double>(steps - tailFrom);
+    for (std::size_t l = 0; l < count; ++l) {
+        costs[l] = detail::costOf(candidates[l], cfg, tailSum[l] / tailCount, peak[l], settledStep[l]);
+    }
+}
+
+// 묶음 단위 최소 작업량 (RK4 단계 × 레인): 이보다 작으면 스레드 생성 비용이 더 큼
+constexpr std::size_t PARALLEL_MIN_WORK = std::size_t{1} << 18;
+
+// 후보 count개 평가 → costs[count],  threads = 0이면 hardware_concurrency()
+inline void evaluate(const Candidate* candidates, std::size_t count, const Config& cfg, double* costs, unsigned threads = 0) {
+    if (count == 0) return;
+    const std::size_t batches = (count + LANES - 1) / LANES;
+    const std::size_t work = batches * LANES * stepCount(cfg) * cfg.substeps;
+    std::size_t workers = threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+    workers = work < PARALLEL_MIN_WORK ? 1 : std::min(workers, batches);
+
+    std::atomic<std::size_t> next{0};
+    auto run = [&] {
+        for (std::size_t b; (b = next.fetch_add(1, std::memory_order_relaxed)) < batches;) {
+            const std::size_t first = b * LANES;
+            evaluateBatch(candidates + first, std::min(LANES, count - first), cfg, costs + first);
+        }
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (std::size_t i = 1; i < workers; ++i) pool.emplace_back(run);
+    run();
+    for (std::thread& t : pool) t.join();
+}
+
+// 한 후보의 궤적 → history[stepCount(cfg)][HISTORY_COLUMNS] (simulate_motor와 같은 열, 같은 적분기)
+inline void simulate(const Candidate& c, const Config& cfg, double* history) {
+    constexpr double PI = 3.14159265358979323846;
+    const detail::Coefficients k = detail::coefficientsOf(c.motor);
+    const double dt = 1.0 / cfg.fs, h = dt / cfg.substeps;
+    double iq = 0.0, w = 0.0, integral = 0.0, theta = 0.0;
+
+    const std::size_t steps = stepCount(cfg);
+    for (std::size_t n = 0; n < steps; ++n, history += HISTORY_COLUMNS) {
+        const double error = cfg.targetSpeed - w;
+        integral += error * dt;
+        const double vq = std::min(std::max(c.kp * error + c.ki * integral, -cfg.vMax), cfg.vMax);
+        for (unsigned s = 0; s < cfg.substeps; ++s) {
+            detail::rk4Step(iq, w, vq, k.invL, k.rOverL, k.emfOverL, k.torqueOverJ, k.bOverJ, h);
+        }
+        theta = std::fmod(theta + c.motor.P * w * dt, 2 * PI);
+        if (theta < 0) theta += 2 * PI;     // Python %와 같은 부호 (0 ≤ theta < 2π)
+
+        history[0] = static_cast<double>(n) * dt;
+        history[1] = iq;
+        history[2] = w;
+        history[3] = vq;
+        history[4] = iq * std::cos(theta - PI / 2);
+        history[5] = iq * std::cos(theta - PI / 2 - 2 * PI / 3);
+        history[6] = iq * std::cos(theta - PI / 2 + 2 * PI / 3);
+        history[7] = 1.5 * c.motor.P * c.motor.Kt * iq;
+        history[8] = theta;
+    }
+}
+
+}  // namespace bldc
+
+#endif  // DC_NATIVE_BLDC_SIM_H